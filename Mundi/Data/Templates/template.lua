@@ -18,4 +18,15 @@ function Tick(dt)
     Obj.Location = Obj.Location + Obj.Velocity * dt
     --[[Obj:PrintLocation()]]--
     --[[print("[Tick] ")]]--
-end
\ No newline at end of file
+end
+
+--[[
+-- 배치 틱: TickBatch를 정의하면 Tick 대신 같은 스크립트 인스턴스를 프레임당 한 번에 틱합니다 (군중 AI용)
+-- Instances[i]는 인스턴스 환경, Locations[3i-2 .. 3i]는 액터 위치이고 바꾼 값은 호출 후 한 번에 반영됩니다
+function TickBatch(Instances, DeltaTimes, Locations, Count)
+    for i = 1, Count do
+        local Base = i * 3
+        Locations[Base] = Locations[Base] + 10 * DeltaTimes[i]
+    end
+end
+]]--
\ No newline at end of file
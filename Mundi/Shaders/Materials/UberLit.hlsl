@@ -4,6 +4,10 @@
 //                Extends StaticMeshShader with full lighting support (Gouraud, Lambert, Phong)
 //================================================================================================
 
+// --- 엔진 메타데이터 ---
+// GPU_INSTANCING variant(슬롯 1 인스턴스 스트림)를 구현했음을 엔진에 알림 (UShader::ParseIncludeFiles가 읽음)
+#define SUPPORTS_GPU_INSTANCING 1
+
 // --- 조명 모델 선택 ---
 // #define LIGHTING_MODEL_GOURAUD 1
 // #define LIGHTING_MODEL_LAMBERT 1
@@ -117,6 +121,17 @@ struct VS_INPUT
     uint4 BoneIndices : BLENDINDICES;    // 영향을 주는 본 인덱스 (최대 4개)
     float4 BoneWeights : BLENDWEIGHT;    // 본 가중치 (합=1.0)
 #endif
+#ifdef GPU_INSTANCING
+    // 슬롯 1: 인스턴스 데이터 (FStaticMeshInstanceData와 정확히 일치해야 함)
+    float4 InstanceWorld0 : INSTANCE_WORLD0;     // WorldMatrix 행 0~3
+    float4 InstanceWorld1 : INSTANCE_WORLD1;
+    float4 InstanceWorld2 : INSTANCE_WORLD2;
+    float4 InstanceWorld3 : INSTANCE_WORLD3;
+    float4 InstanceNormal0 : INSTANCE_NORMAL0;   // WorldInverseTranspose 행 0~2 (xyz)
+    float4 InstanceNormal1 : INSTANCE_NORMAL1;
+    float4 InstanceNormal2 : INSTANCE_NORMAL2;
+    uint InstanceUUID : INSTANCE_UUID;           // 피킹용 오브젝트 ID
+#endif
 };
 
 struct PS_INPUT
@@ -127,6 +142,9 @@ struct PS_INPUT
     row_major float3x3 TBN : TBN;
     float4 Color : COLOR;
     float2 TexCoord : TEXCOORD0;
+#ifdef GPU_INSTANCING
+    nointerpolation uint InstanceUUID : INSTANCE_UUID;
+#endif
 };
 
 struct PS_OUTPUT
@@ -177,8 +195,18 @@ PS_INPUT mainVS(VS_INPUT Input)
     float3 localTangent = Input.Tangent.xyz;
 #endif
 
+#ifdef GPU_INSTANCING
+    // 자동 인스턴싱: 월드 행렬을 인스턴스 스트림에서 읽음 (ModelBuffer는 사용하지 않음)
+    row_major float4x4 ObjectWorldMatrix = float4x4(Input.InstanceWorld0, Input.InstanceWorld1, Input.InstanceWorld2, Input.InstanceWorld3);
+    row_major float3x3 ObjectNormalMatrix = float3x3(Input.InstanceNormal0.xyz, Input.InstanceNormal1.xyz, Input.InstanceNormal2.xyz);
+    Out.InstanceUUID = Input.InstanceUUID;
+#else
+    row_major float4x4 ObjectWorldMatrix = WorldMatrix;
+    row_major float3x3 ObjectNormalMatrix = (float3x3) WorldInverseTranspose;
+#endif
+
     // 위치를 월드 공간으로 먼저 변환
-    float4 worldPos = mul(float4(localPosition, 1.0f), WorldMatrix);
+    float4 worldPos = mul(float4(localPosition, 1.0f), ObjectWorldMatrix);
     Out.WorldPos = worldPos.xyz;
     
     // 뷰 공간으로 변환
@@ -190,9 +218,9 @@ PS_INPUT mainVS(VS_INPUT Input)
     // 노멀을 월드 공간으로 변환
     // 비균등 스케일에서 올바른 노멀 변환을 위해 WorldInverseTranspose 사용
     // 노멀 벡터는 transpose(inverse(WorldMatrix))로 변환됨
-    float3 worldNormal = normalize(mul(localNormal, (float3x3) WorldInverseTranspose));
+    float3 worldNormal = normalize(mul(localNormal, ObjectNormalMatrix));
     Out.Normal = worldNormal;
-    float3 Tangent = normalize(mul(localTangent, (float3x3) WorldMatrix));
+    float3 Tangent = normalize(mul(localTangent, (float3x3) ObjectWorldMatrix));
     Tangent = normalize(Tangent - worldNormal * dot(worldNormal, Tangent));  // 그람-슈미트 재직교화
     float3 BiTangent = normalize(cross(Tangent, worldNormal) * Input.Tangent.w);
     row_major float3x3 TBN;
@@ -280,7 +308,11 @@ PS_INPUT mainVS(VS_INPUT Input)
 PS_OUTPUT mainPS(PS_INPUT Input)
 {
     PS_OUTPUT Output;
+#ifdef GPU_INSTANCING
+    Output.UUID = Input.InstanceUUID;
+#else
     Output.UUID = UUID;
+#endif
     
     //CSM 구간 시각화
     float3 Color[2] =
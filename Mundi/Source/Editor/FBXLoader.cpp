@@ -4,8 +4,10 @@
 #include "fbxsdk/fileio/fbxiosettings.h"
 #include "fbxsdk/scene/geometry/fbxcluster.h"
 #include "ObjectIterator.h"
-#include "WindowsBinReader.h"
 #include "WindowsBinWriter.h"
+#include "WindowsMappedReader.h"
+#include "CookedMesh.h"
+#include "DerivedDataCache.h"
 #include "PathUtils.h"
 #include "AnimSequence.h"
 #include "AnimDataModel.h"
@@ -15,6 +17,10 @@
 
 IMPLEMENT_CLASS(UFbxLoader)
 
+// FBX 임포트/쿠킹 로직이 바뀌면 올려서 기존 DDC 엔트리를 무효화합니다.
+static constexpr uint32 FbxMeshCookVersion = 1;
+static constexpr uint32 FbxAnimCookVersion = 1;
+
 // 노드가 스켈레톤 속성을 포함하는지 확인
 static bool NodeContainsSkeleton(FbxNode* InNode)
 {
@@ -104,86 +110,6 @@ UFbxLoader::UFbxLoader()
 
 }
 
-void UFbxLoader::PreLoad()
-{
-	UFbxLoader& FbxLoader = GetInstance();
-
-	const fs::path DataDir(UTF8ToWide(GDataDir));
-
-	if (!fs::exists(DataDir) || !fs::is_directory(DataDir))
-	{
-		UE_LOG("UFbxLoader::Preload: Data directory not found: %s", WideToUTF8(DataDir.wstring()).c_str());
-		return;
-	}
-
-	size_t LoadedCount = 0;
-	std::unordered_set<FString> ProcessedFiles; // 중복 로딩 방지
-
-	for (const auto& Entry : fs::recursive_directory_iterator(DataDir))
-	{
-		if (!Entry.is_regular_file())
-			continue;
-
-		const fs::path& Path = Entry.path();
-		FString Extension = WideToUTF8(Path.extension().wstring());
-		std::transform(Extension.begin(), Extension.end(), Extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
-
-		if (Extension == ".fbx")
-		{
-			FString PathStr = NormalizePath(WideToUTF8(Path.wstring()));
-
-			// 이미 처리된 파일인지 확인
-			if (ProcessedFiles.find(PathStr) == ProcessedFiles.end())
-			{
-				ProcessedFiles.insert(PathStr);
-
-				// 1. FBX 메시 로드
-				USkeletalMesh* SkeletalMesh = FbxLoader.LoadFbxMesh(PathStr);
-
-				// 2. 애니메이션 로드 (메시가 성공적으로 로드되고 스켈레톤이 있는 경우)
-				if (SkeletalMesh)
-				{
-					const FSkeleton* Skeleton = SkeletalMesh->GetSkeleton();
-					if (Skeleton && !Skeleton->Bones.IsEmpty())
-					{
-						// 3. FBX 파일에서 모든 애니메이션 스택 이름 가져오기
-						TArray<FString> AnimStackNames = FbxLoader.GetAnimationStackNames(PathStr);
-
-						// 4. 각 애니메이션 스택 로드
-						for (const FString& AnimStackName : AnimStackNames)
-						{
-							UAnimSequence* AnimSequence = FbxLoader.LoadFbxAnimation(PathStr, Skeleton, AnimStackName);
-							if (AnimSequence)
-							{
-								UE_LOG("UFbxLoader::PreLoad: Loaded animation '%s' from '%s'",
-									AnimStackName.c_str(), PathStr.c_str());
-							}
-						}
-
-						if (!AnimStackNames.IsEmpty())
-						{
-							UE_LOG("UFbxLoader::PreLoad: Total %d animations loaded from '%s'",
-								AnimStackNames.Num(), PathStr.c_str());
-						}
-					}
-				}
-
-				++LoadedCount;
-			}
-		}
-		else if (Extension == ".dds" || Extension == ".jpg" || Extension == ".png")
-		{
-			UResourceManager::GetInstance().Load<UTexture>(WideToUTF8(Path.wstring())); // 데칼 텍스쳐를 ui에서 고를 수 있게 하기 위해 임시로 만듬.
-		}
-	}
-
-	RESOURCE.SetSkeletalMeshs();
-	RESOURCE.SetAnimations();
-
-	UE_LOG("UFbxLoader::Preload: Loaded %zu .fbx files from %s", LoadedCount, WideToUTF8(DataDir.wstring()).c_str());
-}
-
-
 UFbxLoader::~UFbxLoader()
 {
 	SdkManager->Destroy();
@@ -228,41 +154,17 @@ FSkeletalMeshData* UFbxLoader::LoadFbxMeshAsset(const FString& FilePath)
 	FString NormalizedPath = NormalizePath(FilePath);
 	FSkeletalMeshData* MeshData = nullptr;
 #ifdef USE_OBJ_CACHE
-	// 1. 캐시 파일 경로 설정
-	FString CachePathStr = ConvertDataPathToCachePath(NormalizedPath);
-	const FString BinPathFileName = CachePathStr + ".bin";
-
-	// 캐시를 저장할 디렉토리가 없으면 생성
-	std::filesystem::path CacheFileDirPath(UTF8ToWide(BinPathFileName));
-	if (CacheFileDirPath.has_parent_path())
-	{
-		std::filesystem::create_directories(CacheFileDirPath.parent_path());
-	}
+	// 1. 캐시 파일 경로 설정 (FBX 내용 해시 + 쿠커 버전으로 만든 DDC 엔트리)
+	FDerivedDataCache& DDC = FDerivedDataCache::GetInstance();
+	FDerivedDataKeyBuilder KeyBuilder(EDerivedDataType::SkeletalMesh, FbxMeshCookVersion);
+	KeyBuilder.AddUInt32(CookedMesh::Version);
+	KeyBuilder.AddSourceFile(NormalizedPath);
+	const FString BinPathFileName = DDC.GetEntryPath(EDerivedDataType::SkeletalMesh, KeyBuilder.Build(), ".skel");
 
 	bool bLoadedFromCache = false;
-	
-
-	// 2. 캐시 유효성 검사
-	bool bShouldRegenerate = true;
-	if (std::filesystem::exists(UTF8ToWide(BinPathFileName)))
-	{
-		try
-		{
-			auto binTime = std::filesystem::last_write_time(UTF8ToWide(BinPathFileName));
-			auto fbxTime = std::filesystem::last_write_time(UTF8ToWide(NormalizedPath));
 
-			// FBX 파일이 캐시보다 오래되었으면 캐시 사용
-			if (fbxTime <= binTime)
-			{
-				bShouldRegenerate = false;
-			}
-		}
-		catch (const std::filesystem::filesystem_error& e)
-		{
-			UE_LOG("Filesystem error during cache validation: %s. Forcing regeneration.", e.what());
-			bShouldRegenerate = true;
-		}
-	}
+	// 2. 캐시 유효성 검사 (입력이 같으면 키도 같으므로 엔트리가 있으면 유효)
+	bool bShouldRegenerate = !KeyBuilder.HasAllSources() || !std::filesystem::exists(UTF8ToWide(BinPathFileName));
 
 	// 3. 캐시에서 로드 시도
 	if (!bShouldRegenerate)
@@ -277,13 +179,8 @@ FSkeletalMeshData* UFbxLoader::LoadFbxMeshAsset(const FString& FilePath)
 			std::filesystem::path p(UTF8ToWide(NormalizedPath));
 			MeshData->Skeleton.Name = WideToUTF8(p.stem().wstring());
 
-			FWindowsBinReader Reader(BinPathFileName);
-			if (!Reader.IsOpen())
-			{
-				throw std::runtime_error("Failed to open bin file for reading.");
-			}
-			Reader << *MeshData;
-			Reader.Close();
+			// 쿠킹 포맷을 매핑해 배열마다 한 번에 복사 (실패 시 예외)
+			FCookedMeshSerializer::Load(BinPathFileName, *MeshData);
 
 			for (int Index = 0; Index < MeshData->GroupInfos.Num(); Index++)
 			{
@@ -291,7 +188,7 @@ FSkeletalMeshData* UFbxLoader::LoadFbxMeshAsset(const FString& FilePath)
 					continue;
 				const FString& MaterialName = MeshData->GroupInfos[Index].InitialMaterialName;
 				const FString& MaterialFilePath = ConvertDataPathToCachePath(MaterialName + ".mat.bin");
-				FWindowsBinReader MatReader(MaterialFilePath);
+				FWindowsMappedReader MatReader(MaterialFilePath);
 				if (!MatReader.IsOpen())
 				{
 					throw std::runtime_error("Failed to open material bin file for reading.");
@@ -311,6 +208,7 @@ FSkeletalMeshData* UFbxLoader::LoadFbxMeshAsset(const FString& FilePath)
 
 			MeshData->CacheFilePath = BinPathFileName;
 			bLoadedFromCache = true;
+			DDC.RecordLookup(EDerivedDataType::SkeletalMesh, true);
 
 			UE_LOG("Successfully loaded FBX '%s' from cache.", NormalizedPath.c_str());
 			return MeshData;
@@ -331,6 +229,7 @@ FSkeletalMeshData* UFbxLoader::LoadFbxMeshAsset(const FString& FilePath)
 	}
 
 	// 4. 캐시 로드 실패 시 FBX 파싱
+	DDC.RecordLookup(EDerivedDataType::SkeletalMesh, false);
 	UE_LOG("Regenerating cache for FBX '%s'...", NormalizedPath.c_str());
 #endif // USE_OBJ_CACHE
 
@@ -453,9 +352,10 @@ FSkeletalMeshData* UFbxLoader::LoadFbxMeshAsset(const FString& FilePath)
 	// 5. 캐시 저장
 	try
 	{
-		FWindowsBinWriter Writer(BinPathFileName);
-		Writer << *MeshData;
-		Writer.Close();
+		if (!FCookedMeshSerializer::Save(BinPathFileName, *MeshData))
+		{
+			throw std::runtime_error("Failed to write cooked mesh file.");
+		}
 
 		for (FMaterialInfo& MaterialInfo : MaterialInfos)
 		{
@@ -1374,51 +1274,17 @@ UAnimSequence* UFbxLoader::LoadFbxAnimation(const FString& FilePath, const struc
 	// 4. 바이너리 캐시 파일 처리
 	UAnimDataModel* DataModel = nullptr;
 #ifdef USE_OBJ_CACHE
-	// 4-1. 캐시 파일 경로 설정 (AnimStack 이름 포함)
-	FString CachePathStr = ConvertDataPathToCachePath(NormalizedPath);
-	FString AnimCacheFileName = CachePathStr;
-	if (!AnimStackName.empty())
-	{
-		// 확장자 제거 후 Sanitized AnimStack 이름 추가
-		size_t LastDot = AnimCacheFileName.find_last_of('.');
-		if (LastDot != FString::npos)
-		{
-			AnimCacheFileName = AnimCacheFileName.substr(0, LastDot);
-		}
-		AnimCacheFileName += "_" + SanitizedAnimStackName;
-	}
-	AnimCacheFileName += ".anim.bin";
-
-	// 캐시를 저장할 디렉토리가 없으면 생성
-	std::filesystem::path CacheFileDirPath(UTF8ToWide(AnimCacheFileName));
-	if (CacheFileDirPath.has_parent_path())
-	{
-		std::filesystem::create_directories(CacheFileDirPath.parent_path());
-	}
+	// 4-1. 캐시 파일 경로 설정 (FBX 내용 해시 + AnimStack 이름 + 쿠커 버전으로 만든 DDC 엔트리)
+	FDerivedDataCache& DDC = FDerivedDataCache::GetInstance();
+	FDerivedDataKeyBuilder KeyBuilder(EDerivedDataType::Animation, FbxAnimCookVersion);
+	KeyBuilder.AddSourceFile(NormalizedPath);
+	KeyBuilder.AddString(AnimStackName);
+	const FString AnimCacheFileName = DDC.GetEntryPath(EDerivedDataType::Animation, KeyBuilder.Build(), ".anim");
 
 	bool bLoadedFromCache = false;
 
-	// 4-2. 캐시 유효성 검사
-	bool bShouldRegenerate = true;
-	if (std::filesystem::exists(UTF8ToWide(AnimCacheFileName)))
-	{
-		try
-		{
-			auto binTime = std::filesystem::last_write_time(UTF8ToWide(AnimCacheFileName));
-			auto fbxTime = std::filesystem::last_write_time(UTF8ToWide(NormalizedPath));
-
-			// FBX 파일이 캐시보다 오래되었으면 캐시 사용
-			if (fbxTime <= binTime)
-			{
-				bShouldRegenerate = false;
-			}
-		}
-		catch (const std::filesystem::filesystem_error& e)
-		{
-			UE_LOG("UFbxLoader::LoadFbxAnimation: Filesystem error during cache validation: %s. Forcing regeneration.", e.what());
-			bShouldRegenerate = true;
-		}
-	}
+	// 4-2. 캐시 유효성 검사 (입력이 같으면 키도 같으므로 엔트리가 있으면 유효)
+	bool bShouldRegenerate = !KeyBuilder.HasAllSources() || !std::filesystem::exists(UTF8ToWide(AnimCacheFileName));
 
 	// 4-3. 캐시에서 로드 시도
 	if (!bShouldRegenerate)
@@ -1428,7 +1294,7 @@ UAnimSequence* UFbxLoader::LoadFbxAnimation(const FString& FilePath, const struc
 		{
 			DataModel = NewObject<UAnimDataModel>();
 
-			FWindowsBinReader Reader(AnimCacheFileName);
+			FWindowsMappedReader Reader(AnimCacheFileName);
 			if (!Reader.IsOpen())
 			{
 				throw std::runtime_error("Failed to open animation cache file for reading.");
@@ -1457,6 +1323,7 @@ UAnimSequence* UFbxLoader::LoadFbxAnimation(const FString& FilePath, const struc
 
 			// 리소스 매니저에 등록 (ResourceKey 사용)
 			UResourceManager::GetInstance().Add<UAnimSequence>(ResourceKey, AnimSequence);
+			DDC.RecordLookup(EDerivedDataType::Animation, true);
 
 			return AnimSequence;
 		}
@@ -1478,6 +1345,7 @@ UAnimSequence* UFbxLoader::LoadFbxAnimation(const FString& FilePath, const struc
 	}
 
 	// 4-4. 캐시 로드 실패 시 FBX 파싱
+	DDC.RecordLookup(EDerivedDataType::Animation, false);
 	if (!bLoadedFromCache)
 	{
 		UE_LOG("UFbxLoader::LoadFbxAnimation: Regenerating animation cache from FBX...");
@@ -1826,9 +1694,13 @@ UAnimSequence* UFbxLoader::LoadFbxAnimation(const FString& FilePath, const struc
 		{
 			UE_LOG("UFbxLoader::LoadFbxAnimation: Saving animation to cache '%s'", AnimCacheFileName.c_str());
 
-			FWindowsBinWriter Writer(AnimCacheFileName);
-			Writer << *DataModel;
-			Writer.Close();
+			const FString TempPath = FDerivedDataCache::GetTempPath(AnimCacheFileName);
+			{
+				FWindowsBinWriter Writer(TempPath);
+				Writer << *DataModel;
+				Writer.Close();
+			}
+			FDerivedDataCache::CommitFile(TempPath, AnimCacheFileName);
 
 			UE_LOG("UFbxLoader::LoadFbxAnimation: Successfully saved animation cache");
 		}
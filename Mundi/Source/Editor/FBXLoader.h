@@ -10,8 +10,6 @@ public:
 	static UFbxLoader& GetInstance();
 	UFbxLoader();
 
-	static void PreLoad();
-
 	USkeletalMesh* LoadFbxMesh(const FString& FilePath);
 
 	FSkeletalMeshData* LoadFbxMeshAsset(const FString& FilePath);
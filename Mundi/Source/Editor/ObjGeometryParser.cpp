@@ -0,0 +1,360 @@
+#include "pch.h"
+#include "ObjGeometryParser.h"
+#include "ObjManager.h"
+#include "TaskScheduler.h"
+#include <charconv>
+
+namespace
+{
+	// 청크 하나의 최소 크기 (작은 파일은 스레드 분배 비용이 파싱보다 큼)
+	constexpr size_t MinParallelChunkBytes = 4 * 1024 * 1024;
+
+	// 음수(상대) 인덱스 보정 정보: 청크 안의 슬롯과, 청크 시작 기준 인덱스
+	struct FRelativeIndexFixup
+	{
+		uint32 Slot;
+		int32 ChunkRelativeIndex;
+	};
+
+	// 청크 하나의 파싱 결과 (인덱스는 양수면 이미 전역 0-based)
+	struct FObjParseChunk
+	{
+		TArray<FVector> Positions;
+		TArray<FVector2D> TexCoords;
+		TArray<FVector> Normals;
+
+		TArray<uint32> PositionIndices;
+		TArray<uint32> TexCoordIndices;
+		TArray<uint32> NormalIndices;
+		TArray<FRelativeIndexFixup> Fixups[3];	// 0: Position, 1: TexCoord, 2: Normal
+
+		TArray<FString> MaterialNames;
+		TArray<uint32> GroupStarts;				// 청크 안의 VIndex 기준
+		FString MtlLibName;
+
+		int32 NumUnknownLines = 0;
+		FString FirstUnknownLine;
+	};
+
+	// 면 정점 하나의 원본 v/vt/vn 값 (1-based, 음수는 상대, 0은 생략)
+	struct FFaceCorner
+	{
+		int32 Raw[3];
+	};
+
+	inline const char* SkipBlanks(const char* Cursor, const char* End)
+	{
+		while (Cursor < End && (*Cursor == ' ' || *Cursor == '\t'))
+		{
+			++Cursor;
+		}
+		return Cursor;
+	}
+
+	// 실패하면 0 (stringstream >> float 실패와 같음)
+	inline float ParseFloat(const char*& Cursor, const char* End)
+	{
+		Cursor = SkipBlanks(Cursor, End);
+		if (Cursor < End && *Cursor == '+')
+		{
+			++Cursor;	// from_chars는 '+' 부호를 받지 않음
+		}
+
+		float Value = 0.0f;
+		const std::from_chars_result Result = std::from_chars(Cursor, End, Value);
+		if (Result.ec == std::errc())
+		{
+			Cursor = Result.ptr;
+		}
+		return Value;
+	}
+
+	inline int32 ParseIndex(const char*& Cursor, const char* End)
+	{
+		bool bNegative = false;
+		if (Cursor < End && (*Cursor == '-' || *Cursor == '+'))
+		{
+			bNegative = (*Cursor == '-');
+			++Cursor;
+		}
+
+		int64 Value = 0;
+		while (Cursor < End && static_cast<uint8>(*Cursor - '0') <= 9)
+		{
+			Value = Value * 10 + (*Cursor - '0');
+			++Cursor;
+		}
+		return static_cast<int32>(bNegative ? -Value : Value);
+	}
+
+	// "v", "v/vt", "v//vn", "v/vt/vn" 토큰 하나를 소비
+	inline FFaceCorner ParseFaceCorner(const char*& Cursor, const char* End)
+	{
+		FFaceCorner Corner = { { 0, 0, 0 } };
+		for (int32 Element = 0; Element < 3; ++Element)
+		{
+			Corner.Raw[Element] = ParseIndex(Cursor, End);
+			if (Cursor >= End || *Cursor != '/')
+			{
+				break;
+			}
+			++Cursor;
+		}
+
+		// 토큰의 나머지(잘못된 문자)는 무시
+		while (Cursor < End && *Cursor != ' ' && *Cursor != '\t')
+		{
+			++Cursor;
+		}
+		return Corner;
+	}
+
+	// 키워드 뒤에 공백이 있어야 일치 ("v " / "vt " 구분)
+	inline bool MatchKeyword(const char* Line, const char* LineEnd, const char* Keyword, size_t Length)
+	{
+		return static_cast<size_t>(LineEnd - Line) > Length
+			&& memcmp(Line, Keyword, Length) == 0
+			&& (Line[Length] == ' ' || Line[Length] == '\t');
+	}
+
+	inline void EmitCorner(FObjParseChunk& Chunk, const FFaceCorner& Corner)
+	{
+		TArray<uint32>* const Targets[3] = { &Chunk.PositionIndices, &Chunk.TexCoordIndices, &Chunk.NormalIndices };
+		const int32 LocalCounts[3] = { Chunk.Positions.Num(), Chunk.TexCoords.Num(), Chunk.Normals.Num() };
+
+		for (int32 Element = 0; Element < 3; ++Element)
+		{
+			const int32 Raw = Corner.Raw[Element];
+			TArray<uint32>& Indices = *Targets[Element];
+			if (Raw < 0)
+			{
+				// 상대 인덱스는 앞 청크의 개수를 알아야 하므로 병합할 때 확정
+				Chunk.Fixups[Element].Add({ static_cast<uint32>(Indices.Num()), LocalCounts[Element] + Raw });
+				Indices.Add(0);
+			}
+			else
+			{
+				Indices.Add(Raw > 0 ? static_cast<uint32>(Raw - 1) : 0);
+			}
+		}
+	}
+
+	void ParseChunk(const char* Cursor, const char* End, bool bIsRightHanded, FObjParseChunk& Chunk)
+	{
+		TArray<FFaceCorner> Corners;	// 줄마다 재사용
+		uint32 VIndex = 0;
+
+		while (Cursor < End)
+		{
+			const char* LineEnd = static_cast<const char*>(memchr(Cursor, '\n', End - Cursor));
+			if (!LineEnd)
+			{
+				LineEnd = End;
+			}
+			const char* NextLine = (LineEnd < End) ? LineEnd + 1 : End;
+			if (LineEnd > Cursor && LineEnd[-1] == '\r')
+			{
+				--LineEnd;
+			}
+
+			const char* Line = SkipBlanks(Cursor, LineEnd);
+			Cursor = NextLine;
+
+			if (Line >= LineEnd || *Line == '#')
+			{
+				continue;
+			}
+
+			if (MatchKeyword(Line, LineEnd, "v", 1)) // 정점 좌표 (v x y z)
+			{
+				const char* Token = Line + 2;
+				const float X = ParseFloat(Token, LineEnd);
+				const float Y = ParseFloat(Token, LineEnd);
+				const float Z = ParseFloat(Token, LineEnd);
+				Chunk.Positions.Add(FVector(X, bIsRightHanded ? -Y : Y, Z));
+			}
+			else if (MatchKeyword(Line, LineEnd, "vt", 2)) // 텍스처 좌표 (vt u v)
+			{
+				const char* Token = Line + 3;
+				const float U = ParseFloat(Token, LineEnd);
+				const float V = ParseFloat(Token, LineEnd);
+				// obj의 vt는 좌하단이 (0,0) -> DirectX UV는 좌상단이 (0,0) (상하 반전으로 컨버팅)
+				Chunk.TexCoords.Add(FVector2D(U, 1.0f - V));
+			}
+			else if (MatchKeyword(Line, LineEnd, "vn", 2)) // 법선 (vn x y z)
+			{
+				const char* Token = Line + 3;
+				const float X = ParseFloat(Token, LineEnd);
+				const float Y = ParseFloat(Token, LineEnd);
+				const float Z = ParseFloat(Token, LineEnd);
+				Chunk.Normals.Add(FVector(X, bIsRightHanded ? -Y : Y, Z));
+			}
+			else if (MatchKeyword(Line, LineEnd, "f", 1)) // 면 (f v1/vt1/vn1 v2/vt2/vn2 ...)
+			{
+				Corners.clear();
+				const char* Token = Line + 2;
+				while (true)
+				{
+					Token = SkipBlanks(Token, LineEnd);
+					// '#'을 만나면 주석 처리 (이후 데이터 무시)
+					if (Token >= LineEnd || *Token == '#')
+					{
+						break;
+					}
+					Corners.Add(ParseFaceCorner(Token, LineEnd));
+				}
+
+				// 4각형 이상의 폴리곤은 부채꼴로 삼각화
+				for (int32 i = 1; i + 1 < Corners.Num(); ++i)
+				{
+					EmitCorner(Chunk, Corners[0]);
+					EmitCorner(Chunk, bIsRightHanded ? Corners[i + 1] : Corners[i]);
+					EmitCorner(Chunk, bIsRightHanded ? Corners[i] : Corners[i + 1]);
+					VIndex += 3;
+				}
+			}
+			else if (MatchKeyword(Line, LineEnd, "g", 1))
+			{
+				// 현재 'usemtl'을 기준으로 그룹을 나누므로 'g' 태그는 무시합니다.
+			}
+			else if (MatchKeyword(Line, LineEnd, "usemtl", 6))
+			{
+				Chunk.MaterialNames.Add(FString(Line + 7, LineEnd));
+				Chunk.GroupStarts.Add(VIndex);
+			}
+			else if (MatchKeyword(Line, LineEnd, "mtllib", 6))
+			{
+				Chunk.MtlLibName = FString(Line + 7, LineEnd);
+			}
+			else
+			{
+				if (Chunk.NumUnknownLines++ == 0)
+				{
+					Chunk.FirstUnknownLine = FString(Line, LineEnd);
+				}
+			}
+		}
+	}
+}
+
+void FObjGeometryParser::Parse(const char* Data, size_t Size, bool bIsRightHanded, FObjInfo& OutObjInfo, FString& OutMtlLibName, bool bAllowParallel)
+{
+	const char* const DataEnd = Data + Size;
+
+	// 1. 줄 경계로 청크 나누기
+	const int32 NumChunks = ComputeNumChunks(Size, bAllowParallel);
+	TArray<const char*> ChunkBounds;
+	ChunkBounds.SetNum(NumChunks + 1);
+	ChunkBounds[0] = Data;
+	ChunkBounds[NumChunks] = DataEnd;
+	for (int32 ChunkIndex = 1; ChunkIndex < NumChunks; ++ChunkIndex)
+	{
+		const char* Guess = std::max(Data + Size / NumChunks * ChunkIndex, ChunkBounds[ChunkIndex - 1]);
+		const char* NewLine = static_cast<const char*>(memchr(Guess, '\n', DataEnd - Guess));
+		ChunkBounds[ChunkIndex] = NewLine ? NewLine + 1 : DataEnd;
+	}
+
+	// 2. 청크별 파싱
+	TArray<FObjParseChunk> Chunks;
+	Chunks.SetNum(NumChunks);
+	FTaskScheduler::ParallelFor(NumChunks, NumChunks, [&](int32 /*ChunkIndex*/, int32 Begin, int32 End)
+	{
+		for (int32 ChunkIndex = Begin; ChunkIndex < End; ++ChunkIndex)
+		{
+			ParseChunk(ChunkBounds[ChunkIndex], ChunkBounds[ChunkIndex + 1], bIsRightHanded, Chunks[ChunkIndex]);
+		}
+	});
+
+	// 3. 순서대로 병합 (상대 인덱스와 그룹 시작 위치에 앞 청크 개수를 더함)
+	int32 NumPositions = 0, NumTexCoords = 0, NumNormals = 0, NumIndices = 0;
+	for (const FObjParseChunk& Chunk : Chunks)
+	{
+		NumPositions += Chunk.Positions.Num();
+		NumTexCoords += Chunk.TexCoords.Num();
+		NumNormals += Chunk.Normals.Num();
+		NumIndices += Chunk.PositionIndices.Num();
+	}
+	OutObjInfo.Positions.Reserve(NumPositions);
+	OutObjInfo.TexCoords.Reserve(NumTexCoords);
+	OutObjInfo.Normals.Reserve(NumNormals);
+	OutObjInfo.PositionIndices.Reserve(NumIndices);
+	OutObjInfo.TexCoordIndices.Reserve(NumIndices);
+	OutObjInfo.NormalIndices.Reserve(NumIndices);
+
+	int32 NumUnknownLines = 0;
+	const FString* FirstUnknownLine = nullptr;
+
+	for (FObjParseChunk& Chunk : Chunks)
+	{
+		const int32 Bases[3] = { OutObjInfo.Positions.Num(), OutObjInfo.TexCoords.Num(), OutObjInfo.Normals.Num() };
+		TArray<uint32>* const ChunkIndices[3] = { &Chunk.PositionIndices, &Chunk.TexCoordIndices, &Chunk.NormalIndices };
+		for (int32 Element = 0; Element < 3; ++Element)
+		{
+			for (const FRelativeIndexFixup& Fixup : Chunk.Fixups[Element])
+			{
+				(*ChunkIndices[Element])[Fixup.Slot] = static_cast<uint32>(Bases[Element] + Fixup.ChunkRelativeIndex);
+			}
+		}
+
+		const uint32 VIndexBase = static_cast<uint32>(OutObjInfo.PositionIndices.Num());
+		for (int32 GroupIndex = 0; GroupIndex < Chunk.MaterialNames.Num(); ++GroupIndex)
+		{
+			OutObjInfo.MaterialNames.Add(Chunk.MaterialNames[GroupIndex]);
+			OutObjInfo.GroupIndexStartArray.Add(VIndexBase + Chunk.GroupStarts[GroupIndex]);
+		}
+		if (!Chunk.MtlLibName.empty())
+		{
+			OutMtlLibName = Chunk.MtlLibName;
+		}
+		if (Chunk.NumUnknownLines > 0 && !FirstUnknownLine)
+		{
+			FirstUnknownLine = &Chunk.FirstUnknownLine;
+		}
+		NumUnknownLines += Chunk.NumUnknownLines;
+
+		OutObjInfo.Positions.Append(Chunk.Positions);
+		OutObjInfo.TexCoords.Append(Chunk.TexCoords);
+		OutObjInfo.Normals.Append(Chunk.Normals);
+		OutObjInfo.PositionIndices.Append(Chunk.PositionIndices);
+		OutObjInfo.TexCoordIndices.Append(Chunk.TexCoordIndices);
+		OutObjInfo.NormalIndices.Append(Chunk.NormalIndices);
+	}
+
+	if (NumUnknownLines > 0)
+	{
+		UE_LOG("While parsing %s, %d lines with unknown symbols were skipped (first: '%s')",
+			OutObjInfo.ObjFileName.c_str(), NumUnknownLines, FirstUnknownLine->c_str());
+	}
+
+	// 4. 그룹 범위 마무리 (usemtl이 없으면 그룹 하나)
+	const uint32 VIndex = static_cast<uint32>(OutObjInfo.PositionIndices.Num());
+	if (OutObjInfo.MaterialNames.IsEmpty())
+	{
+		OutObjInfo.GroupIndexStartArray.Add(0);
+	}
+	OutObjInfo.GroupIndexStartArray.Add(VIndex);
+
+	if (OutObjInfo.GroupIndexStartArray.size() > 1 && OutObjInfo.GroupIndexStartArray[1] == 0)
+	{
+		OutObjInfo.GroupIndexStartArray.erase(OutObjInfo.GroupIndexStartArray.begin() + 1);
+	}
+
+	if (OutObjInfo.Normals.IsEmpty())
+	{
+		OutObjInfo.Normals.Add(FVector(0.0f, 0.0f, 0.0f));
+	}
+	if (OutObjInfo.TexCoords.IsEmpty())
+	{
+		OutObjInfo.TexCoords.Add(FVector2D(0.0f, 0.0f));
+	}
+}
+
+int32 FObjGeometryParser::ComputeNumChunks(size_t Size, bool bAllowParallel)
+{
+	if (!bAllowParallel || Size < MinParallelChunkBytes * 2)
+	{
+		return 1;
+	}
+	const size_t MaxChunks = Size / MinParallelChunkBytes;
+	return FTaskScheduler::ComputeNumChunks(static_cast<int32>(std::min<size_t>(MaxChunks, 1024)), 1);
+}
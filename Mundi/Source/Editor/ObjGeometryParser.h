@@ -0,0 +1,47 @@
+#pragma once
+#include "UEContainer.h"
+
+struct FObjInfo;
+
+/**
+ * @struct FObjParserBenchmarkResult
+ * @brief FObjGeometryParser::RunBenchmark 결과입니다.
+ */
+struct FObjParserBenchmarkResult
+{
+	int32 NumFaces = 0;
+	double FileSizeMB = 0.0;
+	double GenerateMS = 0.0;
+	double LegacyParseMS = 0.0;		// ifstream + getline + stringstream (이전 LoadObjModel 방식)
+	double SerialParseMS = 0.0;		// 메모리 매핑 + 단일 스레드
+	double ParallelParseMS = 0.0;	// 메모리 매핑 + 청크 병렬
+	int32 NumParallelChunks = 0;
+	bool bSerialMatches = false;	// 레거시 결과와 FObjInfo가 완전히 같은지
+	bool bParallelMatches = false;
+};
+
+/**
+ * @class FObjGeometryParser
+ * @brief .obj 텍스트의 지오메트리(v/vt/vn/f/usemtl/mtllib)를 FObjInfo로 파싱합니다.
+ *
+ * 메모리 매핑된 버퍼를 포인터로 순회하며 줄/토큰 단위 문자열을 만들지 않고,
+ * 실수는 std::from_chars(정확한 반올림이므로 stringstream과 같은 값), 인덱스는 직접 파싱합니다.
+ * 큰 파일은 줄 경계로 나눈 청크를 FTaskScheduler 워커에서 병렬 파싱한 뒤 순서대로 이어붙입니다.
+ * 음수(상대) 면 인덱스도 지원합니다.
+ */
+class FObjGeometryParser
+{
+public:
+	/**
+	 * @param bIsRightHanded	true면 Y를 반전하고 삼각형 감기 순서를 뒤집음 (FObjImporter::LoadObjModel과 동일)
+	 * @param OutMtlLibName		마지막 mtllib 지시어의 파일 이름 (.obj 기준 상대 경로, 없으면 빈 문자열)
+	 * @param bAllowParallel	false면 크기와 관계없이 단일 스레드로 파싱
+	 */
+	static void Parse(const char* Data, size_t Size, bool bIsRightHanded, FObjInfo& OutObjInfo, FString& OutMtlLibName, bool bAllowParallel = true);
+
+	/** @brief Size 바이트를 파싱할 때 나누는 청크 수 (작은 파일은 1) */
+	static int32 ComputeNumChunks(size_t Size, bool bAllowParallel = true);
+
+	/** @brief NumFaces개 삼각형 OBJ를 생성해 레거시/직렬/병렬 파싱 시간을 비교하고 결과가 같은지 검증합니다. (ObjGeometryParserBenchmark.cpp) */
+	static FObjParserBenchmarkResult RunBenchmark(int32 NumFaces = 5000000);
+};
@@ -0,0 +1,232 @@
+#include "pch.h"
+#include "ObjGeometryParser.h"
+#include "ObjManager.h"
+#include "PlatformTime.h"
+#include "WindowsMappedFile.h"
+#include <array>
+#include <fstream>
+#include <sstream>
+
+// FObjGeometryParser::RunBenchmark 전용 (레거시 파서는 비교 기준으로만 사용하며 로드 경로에서는 쓰지 않음)
+
+namespace
+{
+	// 이전 LoadObjModel의 지오메트리 파싱 (ifstream + getline + stringstream). 결과 비교 기준
+	void ParseVertexDefLegacy(const FString& InVertexDef, uint32 OutIndices[3])
+	{
+		OutIndices[0] = OutIndices[1] = OutIndices[2] = 0;
+		std::stringstream ss(InVertexDef);
+		FString part;
+		uint32 temp_val;
+		for (int32 Element = 0; Element < 3; ++Element)
+		{
+			if (!std::getline(ss, part, '/')) break;
+			if (!part.empty()) { std::stringstream conv(part); if (conv >> temp_val) OutIndices[Element] = temp_val - 1; }
+		}
+	}
+
+	bool ParseObjGeometryLegacy(const FString& InFileName, bool bIsRightHanded, FObjInfo& OutObjInfo, FString& OutMtlLibName)
+	{
+		std::ifstream FileIn(UTF8ToWide(InFileName));
+		if (!FileIn)
+		{
+			return false;
+		}
+
+		uint32 subsetCount = 0;
+		uint32 VIndex = 0;
+		FString line;
+		while (std::getline(FileIn, line))
+		{
+			if (line.empty()) continue;
+			line.erase(0, line.find_first_not_of(" \t\n\r"));
+			if (line[0] == '#') continue;
+
+			if (line.rfind("v ", 0) == 0)
+			{
+				std::stringstream wss(line.substr(2));
+				float vx, vy, vz;
+				wss >> vx >> vy >> vz;
+				OutObjInfo.Positions.push_back(bIsRightHanded ? FVector(vx, -vy, vz) : FVector(vx, vy, vz));
+			}
+			else if (line.rfind("vt ", 0) == 0)
+			{
+				std::stringstream wss(line.substr(3));
+				float u, v;
+				wss >> u >> v;
+				OutObjInfo.TexCoords.push_back(FVector2D(u, 1.0f - v));
+			}
+			else if (line.rfind("vn ", 0) == 0)
+			{
+				std::stringstream wss(line.substr(3));
+				float nx, ny, nz;
+				wss >> nx >> ny >> nz;
+				OutObjInfo.Normals.push_back(bIsRightHanded ? FVector(nx, -ny, nz) : FVector(nx, ny, nz));
+			}
+			else if (line.rfind("f ", 0) == 0)
+			{
+				std::stringstream wss(line.substr(2));
+				FString VertexDef;
+				TArray<std::array<uint32, 3>> LineFaceVertices;
+				while (wss >> VertexDef)
+				{
+					if (VertexDef[0] == '#') break;
+					std::array<uint32, 3> FaceVertex;
+					ParseVertexDefLegacy(VertexDef, FaceVertex.data());
+					LineFaceVertices.push_back(FaceVertex);
+				}
+				for (uint32 i = 1; i + 1 < LineFaceVertices.size(); ++i)
+				{
+					const uint32 Order[3] = { 0, bIsRightHanded ? i + 1 : i, bIsRightHanded ? i : i + 1 };
+					for (uint32 Corner : Order)
+					{
+						OutObjInfo.PositionIndices.push_back(LineFaceVertices[Corner][0]);
+						OutObjInfo.TexCoordIndices.push_back(LineFaceVertices[Corner][1]);
+						OutObjInfo.NormalIndices.push_back(LineFaceVertices[Corner][2]);
+					}
+					VIndex += 3;
+				}
+			}
+			else if (line.rfind("mtllib ", 0) == 0)
+			{
+				OutMtlLibName = line.substr(7);
+			}
+			else if (line.rfind("usemtl ", 0) == 0)
+			{
+				OutObjInfo.MaterialNames.push_back(line.substr(7));
+				OutObjInfo.GroupIndexStartArray.push_back(VIndex);
+				subsetCount++;
+			}
+		}
+
+		if (subsetCount == 0)
+		{
+			OutObjInfo.GroupIndexStartArray.push_back(0);
+		}
+		OutObjInfo.GroupIndexStartArray.push_back(VIndex);
+		if (OutObjInfo.GroupIndexStartArray.size() > 1 && OutObjInfo.GroupIndexStartArray[1] == 0)
+		{
+			OutObjInfo.GroupIndexStartArray.erase(OutObjInfo.GroupIndexStartArray.begin() + 1);
+		}
+		if (OutObjInfo.Normals.empty()) OutObjInfo.Normals.push_back(FVector(0.0f, 0.0f, 0.0f));
+		if (OutObjInfo.TexCoords.empty()) OutObjInfo.TexCoords.push_back(FVector2D(0.0f, 0.0f));
+		return true;
+	}
+
+	template<typename T>
+	bool IsSameArrayBytes(const TArray<T>& A, const TArray<T>& B)
+	{
+		return A.size() == B.size() && (A.empty() || memcmp(A.data(), B.data(), A.size() * sizeof(T)) == 0);
+	}
+
+	bool IsSameObjGeometry(const FObjInfo& A, const FObjInfo& B)
+	{
+		return IsSameArrayBytes(A.Positions, B.Positions)
+			&& IsSameArrayBytes(A.TexCoords, B.TexCoords)
+			&& IsSameArrayBytes(A.Normals, B.Normals)
+			&& IsSameArrayBytes(A.PositionIndices, B.PositionIndices)
+			&& IsSameArrayBytes(A.TexCoordIndices, B.TexCoordIndices)
+			&& IsSameArrayBytes(A.NormalIndices, B.NormalIndices)
+			&& IsSameArrayBytes(A.GroupIndexStartArray, B.GroupIndexStartArray)
+			&& A.MaterialNames == B.MaterialNames;
+	}
+}
+
+FObjParserBenchmarkResult FObjGeometryParser::RunBenchmark(int32 NumFaces)
+{
+	FObjParserBenchmarkResult Result;
+	Result.NumFaces = NumFaces;
+
+	// 1. 격자 메시 생성 (Side x Side 정점, 칸마다 삼각형 2개, 중간에서 머티리얼 전환)
+	uint64 Start = FPlatformTime::Cycles64();
+	int32 Side = 2;
+	while (2LL * (Side - 1) * (Side - 1) < NumFaces)
+	{
+		++Side;
+	}
+
+	FString Text;
+	Text.reserve(static_cast<size_t>(Side) * Side * 100 + static_cast<size_t>(NumFaces) * 48);
+	char Line[160];
+	Text += "mtllib ObjParserBenchmark.mtl\n";
+	for (int32 Y = 0; Y < Side; ++Y)
+	{
+		for (int32 X = 0; X < Side; ++X)
+		{
+			const float Height = std::sin(X * 0.05f) * std::cos(Y * 0.07f);
+			int32 Length = snprintf(Line, sizeof(Line), "v %.6f %.6f %.6f\nvt %.6f %.6f\nvn %.6f %.6f %.6f\n",
+				X * 0.01f, Height, Y * -0.01f, X / float(Side - 1), Y / float(Side - 1), Height * 0.3f, 0.95f, -Height * 0.1f);
+			Text.append(Line, Length);
+		}
+	}
+
+	Text += "usemtl BenchmarkA\n";
+	int32 FacesWritten = 0;
+	for (int32 Y = 0; Y + 1 < Side && FacesWritten < NumFaces; ++Y)
+	{
+		for (int32 X = 0; X + 1 < Side && FacesWritten < NumFaces; ++X)
+		{
+			if (FacesWritten == NumFaces / 2)
+			{
+				Text += "usemtl BenchmarkB\n";
+			}
+
+			const int32 I00 = Y * Side + X + 1, I10 = I00 + 1, I01 = I00 + Side, I11 = I01 + 1;
+			int32 Length = snprintf(Line, sizeof(Line), "f %d/%d/%d %d/%d/%d %d/%d/%d\n", I00, I00, I00, I10, I10, I10, I11, I11, I11);
+			Text.append(Line, Length);
+			if (++FacesWritten < NumFaces)
+			{
+				Length = snprintf(Line, sizeof(Line), "f %d/%d/%d %d/%d/%d %d/%d/%d\n", I00, I00, I00, I11, I11, I11, I01, I01, I01);
+				Text.append(Line, Length);
+				++FacesWritten;
+			}
+		}
+	}
+
+	const FString FilePath = GCacheDir + "/ObjParserBenchmark.obj";
+	{
+		std::error_code ErrorCode;
+		fs::create_directories(fs::path(UTF8ToWide(GCacheDir)), ErrorCode);
+		std::ofstream File(UTF8ToWide(FilePath), std::ios::binary);
+		File.write(Text.data(), static_cast<std::streamsize>(Text.size()));
+	}
+	Result.FileSizeMB = Text.size() / (1024.0 * 1024.0);
+	FString().swap(Text);
+	Result.GenerateMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	// 2. 레거시 파싱
+	FObjInfo LegacyInfo;
+	FString LegacyMtlLib;
+	Start = FPlatformTime::Cycles64();
+	ParseObjGeometryLegacy(FilePath, true, LegacyInfo, LegacyMtlLib);
+	Result.LegacyParseMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	// 3. 메모리 매핑 파싱 (직렬 / 병렬)
+	FWindowsMappedFile MappedFile(FilePath);
+	if (MappedFile.IsOpen())
+	{
+		const char* Data = reinterpret_cast<const char*>(MappedFile.GetData());
+
+		FObjInfo SerialInfo;
+		FString SerialMtlLib;
+		Start = FPlatformTime::Cycles64();
+		Parse(Data, MappedFile.GetSize(), true, SerialInfo, SerialMtlLib, false);
+		Result.SerialParseMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+		Result.bSerialMatches = IsSameObjGeometry(LegacyInfo, SerialInfo) && LegacyMtlLib == SerialMtlLib;
+		SerialInfo = FObjInfo();
+
+		FObjInfo ParallelInfo;
+		FString ParallelMtlLib;
+		Start = FPlatformTime::Cycles64();
+		Parse(Data, MappedFile.GetSize(), true, ParallelInfo, ParallelMtlLib, true);
+		Result.ParallelParseMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+		Result.NumParallelChunks = ComputeNumChunks(MappedFile.GetSize(), true);
+		Result.bParallelMatches = IsSameObjGeometry(LegacyInfo, ParallelInfo) && LegacyMtlLib == ParallelMtlLib;
+
+		MappedFile.Close();
+	}
+
+	std::error_code ErrorCode;
+	fs::remove(fs::path(UTF8ToWide(FilePath)), ErrorCode);
+	return Result;
+}
@@ -5,8 +5,13 @@
 #include "ObjectIterator.h"
 #include "StaticMesh.h"
 #include "Enums.h"
-#include "WindowsBinReader.h"
 #include "WindowsBinWriter.h"
+#include "WindowsMappedFile.h"
+#include "WindowsMappedReader.h"
+#include "CookedMesh.h"
+#include "DerivedDataCache.h"
+#include "ObjGeometryParser.h"
+#include "MeshBVH.h"
 #include <filesystem>
 #include <unordered_set>
 
@@ -14,6 +19,9 @@ namespace fs = std::filesystem;
 
 TMap<FString, FStaticMesh*> FObjManager::ObjStaticMeshMap;
 
+// OBJ 임포트/쿠킹 로직이 바뀌면 올려서 기존 DDC 엔트리를 무효화합니다.
+static constexpr uint32 ObjCookVersion = 1;
+
 // 파일 유틸 함수
 namespace
 {
@@ -129,137 +137,89 @@ static FString FindMtlFilePath(const FString& InObjPath)
  */
 bool GetMtlDependencies(const FString& ObjPath, TArray<FString>& OutMtlFilePaths)
 {
-	// 한글 경로 지원: UTF-8 → UTF-16 변환 후 파일 열기
-	FWideString WPath = UTF8ToWide(ObjPath);
-	std::ifstream InFile(WPath);
-	if (!InFile.is_open())
+	// 캐시 히트에도 매번 호출되므로 getline 대신 매핑된 뷰에서 줄 머리만 확인합니다.
+	FWindowsMappedFile ObjFile(ObjPath);
+	if (!ObjFile.IsOpen())
 	{
 		UE_LOG("Failed to open .obj file for dependency scan: %s", ObjPath.c_str());
 		return false;
 	}
 
 	fs::path BaseDir = fs::path(UTF8ToWide(ObjPath)).parent_path();
-	FString Line;
+	const char* Cursor = reinterpret_cast<const char*>(ObjFile.GetData());
+	const char* const End = Cursor + ObjFile.GetSize();
 
-	while (std::getline(InFile, Line))
+	while (Cursor < End)
 	{
+		const char* LineEnd = static_cast<const char*>(memchr(Cursor, '\n', End - Cursor));
+		if (!LineEnd)
+		{
+			LineEnd = End;
+		}
+
 		// 라인 앞뒤의 공백을 제거하여 안정성을 높입니다.
-		Line.erase(0, Line.find_first_not_of(" \t\r\n"));
-		Line.erase(Line.find_last_not_of(" \t\r\n") + 1);
+		const char* LineStart = Cursor;
+		while (LineStart < LineEnd && (*LineStart == ' ' || *LineStart == '\t'))
+		{
+			++LineStart;
+		}
+		const char* LineStop = LineEnd;
+		while (LineStop > LineStart && (LineStop[-1] == ' ' || LineStop[-1] == '\t' || LineStop[-1] == '\r'))
+		{
+			--LineStop;
+		}
+		Cursor = (LineEnd < End) ? LineEnd + 1 : End;
 
-		if (Line.rfind("mtllib ", 0) == 0) // "mtllib "으로 시작하는지 확인
+		if (LineStop - LineStart > 7 && memcmp(LineStart, "mtllib ", 7) == 0) // "mtllib "으로 시작하는지 확인
 		{
 			// "mtllib " 다음의 모든 문자열을 경로로 추출합니다.
-			FString MtlFileName = Line.substr(7);
-			if (!MtlFileName.empty())
-			{
-				fs::path FullPath = fs::weakly_canonical(BaseDir / MtlFileName);
-				FString PathStr = WideToUTF8(FullPath.wstring());
-				std::replace(PathStr.begin(), PathStr.end(), '\\', '/');
-				OutMtlFilePaths.AddUnique(NormalizePath(PathStr));
-			}
+			FString MtlFileName(LineStart + 7, LineStop);
+			fs::path FullPath = fs::weakly_canonical(BaseDir / UTF8ToWide(MtlFileName));
+			FString PathStr = WideToUTF8(FullPath.wstring());
+			std::replace(PathStr.begin(), PathStr.end(), '\\', '/');
+			OutMtlFilePaths.AddUnique(NormalizePath(PathStr));
 		}
 	}
 	return true;
 }
 
 /**
- * @brief 캐시 파일이 원본(.obj) 및 모든 의존성(.mtl) 파일보다 최신인지 검사합니다.
+ * @brief .obj의 DDC 키를 계산합니다.
+ * 원본 .obj와 참조하는 모든 .mtl의 내용 해시, 쿠커 버전, 임포트 설정을 섞으므로
+ * 파일 시간만 바뀐 경우(git checkout, 다른 머신으로 복사)에는 키가 그대로입니다.
  * @param ObjPath 원본 .obj 파일의 경로입니다.
- * @param BinPath 메쉬 데이터 캐시(.obj.bin) 파일의 경로입니다.
- * @param MatBinPath 머티리얼 데이터 캐시(.mtl.bin) 파일의 경로입니다.
- * @return 캐시를 다시 생성해야 하면 true, 캐시가 유효하면 false를 반환합니다.
+ * @param bIsRightHanded LoadObjModel에 넘기는 좌표계 설정입니다.
  */
-bool ShouldRegenerateCache(const FString& ObjPath, const FString& BinPath, const FString& MatBinPath)
+uint64 ComputeObjCacheKey(const FString& ObjPath, bool bIsRightHanded)
 {
-	// 캐시 파일 중 하나라도 존재하지 않으면 무조건 재생성해야 합니다.
-	if (!fs::exists(UTF8ToWide(BinPath)) || !fs::exists(UTF8ToWide(MatBinPath)))
-	{
-		return true;
-	}
-
-	try
-	{
-		auto BinTimestamp = fs::last_write_time(UTF8ToWide(BinPath));
-
-		// 1. 원본 .obj 파일의 수정 시간을 캐시 파일과 비교합니다.
-		if (fs::last_write_time(UTF8ToWide(ObjPath)) > BinTimestamp)
-		{
-			return true;
-		}
-
-		// 2. .obj 파일을 빠르게 스캔하여 의존하는 .mtl 파일 목록을 가져옵니다.
-		TArray<FString> MtlDependencies;
-		if (!GetMtlDependencies(ObjPath, MtlDependencies))
-		{
-			return true; // .obj 파일을 읽을 수 없으면 안전을 위해 캐시를 재생성합니다.
-		}
+	FDerivedDataKeyBuilder KeyBuilder(EDerivedDataType::StaticMesh, ObjCookVersion);
+	KeyBuilder.AddUInt32(CookedMesh::Version);
+	KeyBuilder.AddUInt32(bIsRightHanded ? 1 : 0);
+	KeyBuilder.AddSourceFile(ObjPath);
 
-		// 3. 각 .mtl 파일의 수정 시간을 캐시 파일과 비교합니다.
-		for (const FString& MtlPath : MtlDependencies)
-		{
-			// .mtl 파일이 존재하지 않거나 캐시보다 최신 버전이면 재생성합니다.
-			if (!fs::exists(UTF8ToWide(MtlPath)) || fs::last_write_time(UTF8ToWide(MtlPath)) > BinTimestamp)
-			{
-				return true;
-			}
-		}
-	}
-	catch (const fs::filesystem_error& e)
+	// mtllib 이름은 .obj 내용에 이미 포함되므로 .mtl은 내용만 섞습니다. (없으면 '없음' 표시)
+	// 절대 경로는 머신마다 다르므로 키에 넣지 않습니다.
+	TArray<FString> MtlDependencies;
+	GetMtlDependencies(ObjPath, MtlDependencies);
+	for (const FString& MtlPath : MtlDependencies)
 	{
-		// 파일 시스템 오류(예: 접근 권한 없음) 발생 시 안전하게 캐시를 재생성합니다.
-		UE_LOG("Filesystem error during cache validation: %s. Forcing regeneration.", e.what());
-		return true;
+		KeyBuilder.AddSourceFile(MtlPath);
 	}
-
-	// 모든 검사를 통과하면 캐시는 유효합니다.
-	return false;
+	return KeyBuilder.Build();
 }
 
-void FObjManager::Preload()
+/**
+ * @brief 머티리얼 캐시(.mat.bin)를 임시 파일에 쓴 뒤 DDC 엔트리로 교체합니다.
+ */
+static void SaveMaterialInfosCache(const FString& MatBinPath, const TArray<FMaterialInfo>& MaterialInfos)
 {
-	const fs::path DataDir(UTF8ToWide(GDataDir));
-
-	if (!fs::exists(DataDir) || !fs::is_directory(DataDir))
+	const FString TempPath = FDerivedDataCache::GetTempPath(MatBinPath);
 	{
-		UE_LOG("FObjManager::Preload: Data directory not found: %s", WideToUTF8(DataDir.wstring()).c_str());
-		return;
-	}
-
-	size_t LoadedCount = 0;
-	std::unordered_set<FString> ProcessedFiles; // 중복 로딩 방지
-
-	for (const auto& Entry : fs::recursive_directory_iterator(DataDir))
-	{
-		if (!Entry.is_regular_file())
-			continue;
-
-		const fs::path& Path = Entry.path();
-		FString Extension = WideToUTF8(Path.extension().wstring());
-		std::transform(Extension.begin(), Extension.end(), Extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
-
-		if (Extension == ".obj"|| Extension == ".fbx")
-		{
-			FString PathStr = NormalizePath(WideToUTF8(Path.wstring()));
-
-			// 이미 처리된 파일인지 확인
-			if (ProcessedFiles.find(PathStr) == ProcessedFiles.end())
-			{
-				ProcessedFiles.insert(PathStr);
-				LoadObjStaticMesh(PathStr);
-				++LoadedCount;
-			}
-		}
-		else if (Extension == ".dds" || Extension == ".jpg" || Extension == ".png")
-		{
-			UResourceManager::GetInstance().Load<UTexture>(WideToUTF8(Path.wstring())); // 데칼 텍스쳐를 ui에서 고를 수 있게 하기 위해 임시로 만듬.
-		}
+		FWindowsBinWriter MatWriter(TempPath);
+		Serialization::WriteArray<FMaterialInfo>(MatWriter, MaterialInfos);
+		MatWriter.Close();
 	}
-
-	// 4) 모든 StaticMeshs 가져오기
-	RESOURCE.SetStaticMeshs();
-
-	UE_LOG("FObjManager::Preload: Loaded %zu .obj files from %s", LoadedCount, WideToUTF8(DataDir.wstring()).c_str());
+	FDerivedDataCache::CommitFile(TempPath, MatBinPath);
 }
 
 void FObjManager::Clear()
@@ -283,6 +243,21 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 		return *It;
 	}
 
+	// 2~4. 캐시 로드 또는 .obj 파싱
+	TArray<FMaterialInfo> MaterialInfos;
+	FStaticMesh* NewFStaticMesh = ParseObjStaticMeshAsset(NormalizedPathStr, MaterialInfos);
+	if (!NewFStaticMesh)
+	{
+		return nullptr;
+	}
+
+	// 5. 머티리얼 생성 후 메모리 캐시에 등록하고 반환
+	return RegisterParsedStaticMeshAsset(NormalizedPathStr, NewFStaticMesh, MaterialInfos);
+}
+
+// 리소스 매니저/디바이스를 사용하지 않으므로 워커 스레드에서 호출 가능 (FAssetPreloader)
+FStaticMesh* FObjManager::ParseObjStaticMeshAsset(const FString& NormalizedPathStr, TArray<FMaterialInfo>& OutMaterialInfos)
+{
 	std::filesystem::path Path(UTF8ToWide(NormalizedPathStr));
 
 	// 2. 파일 경로 설정
@@ -297,49 +272,36 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 	}
 
 #ifdef USE_OBJ_CACHE
-	// 2-1. 캐시 파일 경로 설정
-	FString CachePathStr = ConvertDataPathToCachePath(NormalizedPathStr);
+	// 2-1. 캐시 파일 경로 설정 (내용 해시 기반 DDC 엔트리, 디렉토리는 GetEntryPath가 생성)
+	FDerivedDataCache& DDC = FDerivedDataCache::GetInstance();
+	const uint64 CacheKey = ComputeObjCacheKey(NormalizedPathStr, true);
 
-	const FString BinPathFileName = CachePathStr + ".bin";
-	const FString MatBinPathFileName = CachePathStr + ".mat.bin";
-
-	// 캐시를 저장할 디렉토리가 없으면 생성
-	fs::path CacheFileDirPath(UTF8ToWide(BinPathFileName));
-	if (CacheFileDirPath.has_parent_path())
-	{
-		fs::create_directories(CacheFileDirPath.parent_path());
-	}
+	const FString BinPathFileName = DDC.GetEntryPath(EDerivedDataType::StaticMesh, CacheKey, ".mesh");
+	const FString MatBinPathFileName = DDC.GetEntryPath(EDerivedDataType::StaticMesh, CacheKey, ".mat.bin");
 
 	// 3. 캐시 데이터 로드 시도 및 실패 시 재생성 로직
 	FStaticMesh* NewFStaticMesh = new FStaticMesh();
-	TArray<FMaterialInfo> MaterialInfos;
 	bool bLoadedSuccessfully = false;
 
-	// 캐시가 오래되었는지 먼저 확인
-	bool bShouldRegenerate = ShouldRegenerateCache(NormalizedPathStr, BinPathFileName, MatBinPathFileName);
+	// 입력이 같으면 키도 같으므로 엔트리가 있으면 그대로 유효
+	bool bShouldRegenerate = !fs::exists(UTF8ToWide(BinPathFileName)) || !fs::exists(UTF8ToWide(MatBinPathFileName));
 
 	if (!bShouldRegenerate)
 	{
 		UE_LOG("Attempting to load '%s' from cache.", NormalizedPathStr.c_str());
 		try
 		{
-			// 캐시에서 FStaticMesh 데이터 로드
-			FWindowsBinReader Reader(BinPathFileName);
-			if (!Reader.IsOpen())
-			{
-				// Reader 생성자에서 예외를 던지지 않는 경우를 대비한 명시적 실패 처리
-				throw std::runtime_error("Failed to open bin file for reading.");
-			}
-			Reader << *NewFStaticMesh;
-			Reader.Close();
+			// 캐시에서 FStaticMesh 데이터 로드 (쿠킹 포맷을 매핑해 배열마다 한 번에 복사, 실패 시 예외)
+			FCookedMeshSerializer::Load(BinPathFileName, *NewFStaticMesh);
+			NewFStaticMesh->PathFileName = NormalizedPathStr;	// 같은 내용의 다른 경로와 엔트리를 공유할 수 있음
 
 			// 캐시에서 Material 데이터 로드
-			FWindowsBinReader MatReader(MatBinPathFileName);
+			FWindowsMappedReader MatReader(MatBinPathFileName);
 			if (!MatReader.IsOpen())
 			{
 				throw std::runtime_error("Failed to open material bin file for reading.");
 			}
-			Serialization::ReadArray<FMaterialInfo>(MatReader, MaterialInfos);
+			Serialization::ReadArray<FMaterialInfo>(MatReader, OutMaterialInfos);
 			MatReader.Close();
 
 			NewFStaticMesh->CacheFilePath = BinPathFileName;
@@ -364,9 +326,9 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 			bLoadedSuccessfully = false;
 		}
 	}
+	DDC.RecordLookup(EDerivedDataType::StaticMesh, bLoadedSuccessfully);
 #else
 	FStaticMesh* NewFStaticMesh = new FStaticMesh();
-	TArray<FMaterialInfo> MaterialInfos;
 	bool bLoadedSuccessfully = false;
 #endif // USE_OBJ_CACHE
 
@@ -402,26 +364,29 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 		UE_LOG("Regenerating cache for '%s'...", NormalizedPathStr.c_str());
 
 		FObjInfo RawObjInfo;
-		if (!FObjImporter::LoadObjModel(NormalizedPathStr, &RawObjInfo, MaterialInfos, true))
+		if (!FObjImporter::LoadObjModel(NormalizedPathStr, &RawObjInfo, OutMaterialInfos, true))
 		{
 			delete NewFStaticMesh;
 			return nullptr;
 		}
 
-		FObjImporter::ConvertToStaticMesh(RawObjInfo, MaterialInfos, NewFStaticMesh);
+		FObjImporter::ConvertToStaticMesh(RawObjInfo, OutMaterialInfos, NewFStaticMesh);
 
 		// 캐시 저장 *직전에* 기본 머티리얼 로직을 호출합니다.
-		EnsureDefaultMaterial(NewFStaticMesh, MaterialInfos);
+		EnsureDefaultMaterial(NewFStaticMesh, OutMaterialInfos);
+
+		// 피킹용 BVH도 쿠킹 시점에 빌드해 캐시에 함께 저장 (첫 피킹에서 빌드하지 않음)
+		NewFStaticMesh->MeshBVH = std::make_shared<FMeshBVH>();
+		NewFStaticMesh->MeshBVH->Build(NewFStaticMesh->Vertices, NewFStaticMesh->Indices);
 
 #ifdef USE_OBJ_CACHE
 		// 새로운 캐시 파일(.bin) 저장 (이제 올바른 데이터가 저장됨)
-		FWindowsBinWriter Writer(BinPathFileName);
-		Writer << *NewFStaticMesh;
-		Writer.Close();
+		if (!FCookedMeshSerializer::Save(BinPathFileName, *NewFStaticMesh))
+		{
+			UE_LOG("Failed to write cooked mesh cache '%s'.", BinPathFileName.c_str());
+		}
 
-		FWindowsBinWriter MatWriter(MatBinPathFileName);
-		Serialization::WriteArray<FMaterialInfo>(MatWriter, MaterialInfos);
-		MatWriter.Close();
+		SaveMaterialInfosCache(MatBinPathFileName, OutMaterialInfos);
 
 		UE_LOG("Cache regeneration complete for '%s'.", NormalizedPathStr.c_str());
 #endif // USE_OBJ_CACHE
@@ -430,19 +395,15 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 	{
 		// 캐시 로드에 성공한 경우(bLoadedSuccessfully == true)
 		// 구버전 캐시(기본 머티리얼이 없는)일 수 있으므로, 동일한 검사를 수행합니다.
-		if (EnsureDefaultMaterial(NewFStaticMesh, MaterialInfos))
+		if (EnsureDefaultMaterial(NewFStaticMesh, OutMaterialInfos))
 		{
 #ifdef USE_OBJ_CACHE
 			// 변경된 경우, 캐시를 갱신합니다.
 			UE_LOG("Updating outdated cache for '%s' with default material.", NormalizedPathStr.c_str());
 			try
 			{
-				FWindowsBinWriter Writer(BinPathFileName);
-				Writer << *NewFStaticMesh;
-				Writer.Close();
-				FWindowsBinWriter MatWriter(MatBinPathFileName);
-				Serialization::WriteArray<FMaterialInfo>(MatWriter, MaterialInfos);
-				MatWriter.Close();
+				FCookedMeshSerializer::Save(BinPathFileName, *NewFStaticMesh);
+				SaveMaterialInfosCache(MatBinPathFileName, OutMaterialInfos);
 			}
 			catch (const std::exception& e)
 			{
@@ -460,7 +421,7 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 	fs::path BaseDirFs = fs::path(WNormalizedPath).parent_path();
 	FString ObjBaseDir = NormalizePath(WideToUTF8(BaseDirFs.wstring()));
 
-	for (auto& MaterialInfo : MaterialInfos)
+	for (auto& MaterialInfo : OutMaterialInfos)
 	{
 		// 람다 함수 대신 PathUtils 유틸리티 함수를 직접 호출
 		MaterialInfo.DiffuseTextureFileName =
@@ -485,6 +446,18 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 			ResolveAssetRelativePath(MaterialInfo.EmissiveTextureFileName, ObjBaseDir);
 	}
 
+	return NewFStaticMesh;
+}
+
+FStaticMesh* FObjManager::RegisterParsedStaticMeshAsset(const FString& NormalizedPathStr, FStaticMesh* InStaticMesh, const TArray<FMaterialInfo>& InMaterialInfos)
+{
+	// 파싱하는 동안 다른 경로로 먼저 등록되었으면 기존 에셋을 사용
+	if (FStaticMesh** It = ObjStaticMeshMap.Find(NormalizedPathStr))
+	{
+		delete InStaticMesh;
+		return *It;
+	}
+
 	// 루프가 시작되기 전에 기본 UberLit 셰이더 포인터를 한 번만 가져옵니다.
 	UShader* DefaultUberlitShader = nullptr;
 	UMaterial* DefaultMaterial = UResourceManager::GetInstance().GetDefaultMaterial();
@@ -498,7 +471,7 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 		UE_LOG("CRITICAL: Default Uberlit Shader not found. OBJ materials may fail.");
 	}
 
-	for (const FMaterialInfo& InMaterialInfo : MaterialInfos)
+	for (const FMaterialInfo& InMaterialInfo : InMaterialInfos)
 	{
 		if (!UResourceManager::GetInstance().Get<UMaterial>(InMaterialInfo.MaterialName))
 		{
@@ -516,9 +489,9 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 		}
 	}
 
-	// 5. 메모리 캐시에 등록하고 반환
-	ObjStaticMeshMap.Add(NormalizedPathStr, NewFStaticMesh);
-	return NewFStaticMesh;
+	// 메모리 캐시에 등록하고 반환
+	ObjStaticMeshMap.Add(NormalizedPathStr, InStaticMesh);
+	return InStaticMesh;
 }
 
 void FObjManager::RegisterStaticMeshAsset(const FString& PathFileName, FStaticMesh* InStaticMesh)
@@ -539,6 +512,17 @@ void FObjManager::RegisterStaticMeshAsset(const FString& PathFileName, FStaticMe
 	ObjStaticMeshMap.Add(NormalizedPathStr, InStaticMesh);
 }
 
+void FObjManager::ReleaseStaticMeshAsset(const FString& PathFileName)
+{
+	FString NormalizedPathStr = NormalizePath(PathFileName);
+
+	if (FStaticMesh** Existing = ObjStaticMeshMap.Find(NormalizedPathStr))
+	{
+		delete *Existing;
+		ObjStaticMeshMap.erase(NormalizedPathStr);
+	}
+}
+
 // 여기서 BVH 정보 담아주기 작업을 해야 함 
 UStaticMesh* FObjManager::LoadObjStaticMesh(const FString& PathFileName)
 {
@@ -566,186 +550,36 @@ UStaticMesh* FObjManager::LoadObjStaticMesh(const FString& PathFileName)
 // obj File to FObjInfo, FMaterialParameters
 bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutObjInfo, TArray<FMaterialInfo>& OutMaterialInfos, bool bIsRightHanded)
 {
-	uint32 subsetCount = 0;
 	FString MtlFileName;
 
-	bool bHasTexcoord = false;
-	bool bHasNormal = false;
-	FString MaterialNameTemp;
-
-	FString Face;
-	uint32 VIndex = 0;
-	uint32 MeshTriangles = 0;
-
 	size_t pos = InFileName.find_last_of("/\\");
 	FString objDir = (pos == FString::npos) ? "" : InFileName.substr(0, pos + 1);
 
 	// [안정성] .obj 파일이 존재하지 않으면 로드 실패를 반환합니다.
 	// 이는 필수 데이터이므로 더 이상 진행할 수 없습니다.
-	// 한글 경로 지원: UTF-8 → UTF-16 변환 후 파일 열기
-	FWideString WPath = UTF8ToWide(InFileName);
-	std::ifstream FileIn(WPath);
-	if (!FileIn)
+	// 파일 전체를 메모리 매핑해 복사 없이 파싱합니다. (한글 경로 지원: 내부에서 UTF-16 변환)
+	FWindowsMappedFile ObjFile(InFileName);
+	if (!ObjFile.IsOpen())
 	{
 		UE_LOG("Error: The file '%s' does not exist!", InFileName.c_str());
 		return false;
 	}
-
-	OutObjInfo->ObjFileName = FString(InFileName.begin(), InFileName.end());
-
-	FString line;
-	while (std::getline(FileIn, line))
+	if (ObjFile.GetSize() == 0)
 	{
-		if (line.empty()) continue;
-
-		line.erase(0, line.find_first_not_of(" \t\n\r"));
-
-		if (line[0] == '#')
-			continue;
-
-		if (line.rfind("v ", 0) == 0) // 정점 좌표 (v x y z)
-		{
-			std::stringstream wss(line.substr(2));
-			float vx, vy, vz;
-			wss >> vx >> vy >> vz;
-			if (bIsRightHanded)
-			{
-				OutObjInfo->Positions.push_back(FVector(vx, -vy, vz));
-			}
-			else
-			{
-				OutObjInfo->Positions.push_back(FVector(vx, vy, vz));
-			}
-		}
-		else if (line.rfind("vt ", 0) == 0) // 텍스처 좌표 (vt u v)
-		{
-			std::stringstream wss(line.substr(3));
-			float u, v;
-			wss >> u >> v;
-			// obj의 vt는 좌하단이 (0,0) -> DirectX UV는 좌상단이 (0,0) (상하 반전으로 컨버팅)
-			v = 1.0f - v;
-			OutObjInfo->TexCoords.push_back(FVector2D(u, v));
-			bHasTexcoord = true;
-		}
-		else if (line.rfind("vn ", 0) == 0) // 법선 (vn x y z)
-		{
-			std::stringstream wss(line.substr(3));
-			float nx, ny, nz;
-			wss >> nx >> ny >> nz;
-			if (bIsRightHanded)
-			{
-				OutObjInfo->Normals.push_back(FVector(nx, -ny, nz));
-			}
-			else
-			{
-				OutObjInfo->Normals.push_back(FVector(nx, ny, nz));
-			}
-			bHasNormal = true;
-		}
-		else if (line.rfind("g ", 0) == 0) // 그룹 (g groupName)
-		{
-			// 현재 'usemtl'을 기준으로 그룹을 나누므로 'g' 태그는 무시합니다.
-		}
-		else if (line.rfind("f ", 0) == 0) // 면 (f v1/vt1/vn1 v2/vt2/vn2 ...)
-		{
-			Face = line.substr(2);
-			if (Face.length() <= 0)
-			{
-				continue;
-			}
-
-			// Parse face line and trim at '#' or newline
-			std::stringstream wss(Face);
-			FString VertexDef;
-
-			TArray<FFaceVertex> LineFaceVertices;
-			while (wss >> VertexDef)
-			{
-				// '#'을 만나면 주석 처리 (이후 데이터 무시)
-				if (VertexDef[0] == '#')
-				{
-					break;
-				}
-
-				FFaceVertex FaceVertex = ParseVertexDef(VertexDef);
-				LineFaceVertices.push_back(FaceVertex);
-			}
-
-			// 4각형 이상의 폴리곤도 처리하기 위해서 for문으로 처리
-			for (uint32 i = 1; i < LineFaceVertices.size() - 1; ++i)
-			{
-				if (bIsRightHanded)
-				{
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[0].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[0].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[0].NormalIndex);
-
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i + 1].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i + 1].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i + 1].NormalIndex);
-
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i].NormalIndex);
-				}
-				else
-				{
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[0].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[0].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[0].NormalIndex);
-
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i].NormalIndex);
-
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i + 1].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i + 1].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i + 1].NormalIndex);
-				}
-				VIndex += 3;
-				++MeshTriangles;
-			}
-		}
-		else if (line.rfind("mtllib ", 0) == 0)
-		{
-			MtlFileName = objDir + line.substr(7);
-		}
-		else if (line.rfind("usemtl ", 0) == 0)
-		{
-			MaterialNameTemp = line.substr(7);
-			OutObjInfo->MaterialNames.push_back(MaterialNameTemp);
-			OutObjInfo->GroupIndexStartArray.push_back(VIndex);
-			subsetCount++;
-		}
-		else
-		{
-			UE_LOG("While parsing the filename %s, the following unknown symbol was encountered: \'%s\'", InFileName.c_str(), line.c_str());
-		}
+		// 빈 .obj는 이전 getline 로더처럼 지오메트리 없는 메시로 로드 (파일 없음과 구분)
+		UE_LOG("Warning: The file '%s' is empty.", InFileName.c_str());
 	}
 
-	if (subsetCount == 0)
-	{
-		OutObjInfo->GroupIndexStartArray.push_back(0);
-		subsetCount++;
-	}
-	OutObjInfo->GroupIndexStartArray.push_back(VIndex);
+	OutObjInfo->ObjFileName = FString(InFileName.begin(), InFileName.end());
 
-	if (OutObjInfo->GroupIndexStartArray.size() > 1 && OutObjInfo->GroupIndexStartArray[1] == 0)
-	{
-		OutObjInfo->GroupIndexStartArray.erase(OutObjInfo->GroupIndexStartArray.begin() + 1);
-		subsetCount--;
-	}
+	FString MtlLibName;
+	FObjGeometryParser::Parse(reinterpret_cast<const char*>(ObjFile.GetData()), ObjFile.GetSize(), bIsRightHanded, *OutObjInfo, MtlLibName);
+	ObjFile.Close();
 
-	if (!bHasNormal)
+	if (!MtlLibName.empty())
 	{
-		OutObjInfo->Normals.push_back(FVector(0.0f, 0.0f, 0.0f));
+		MtlFileName = objDir + MtlLibName;
 	}
-	if (!bHasTexcoord)
-	{
-		OutObjInfo->TexCoords.push_back(FVector2D(0.0f, 0.0f));
-	}
-
-	FileIn.close();
 
 	// Material 파싱 시작
 	UE_LOG("[ObjImporter::LoadObjModel] MTL file path: %s", MtlFileName.c_str());
@@ -759,7 +593,7 @@ bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutOb
 
 	// 한글 경로 지원: UTF-8 → UTF-16 변환 후 파일 열기
 	FWideString WMtlPath = UTF8ToWide(MtlFileName);
-	FileIn.open(WMtlPath);
+	std::ifstream FileIn(WMtlPath);
 
 	// .mtl 파일이 존재하지 않더라도 로딩을 중단하지 않습니다.
 	// 경고를 로깅하고, 머티리얼이 없는 모델로 처리를 계속합니다.
@@ -777,6 +611,7 @@ bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutOb
 	TArray<FString> TempOptions;
 	FString TempTexturePath;
 
+	FString line;
 	while (std::getline(FileIn, line))
 	{
 		if (line.empty()) continue;
@@ -912,15 +747,35 @@ void FObjImporter::ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<F
 		BiTangentForVertex[Index + 2] += BiTangent;
 	}
 
-	std::unordered_map<VertexKey, uint32, VertexKeyHash> VertexMap;
+	// v/vt/vn 조합 중복 제거: 선형 탐사 해시 테이블 (노드 할당 없음, 슬롯에는 정점 인덱스만 저장)
+	uint32 TableSize = 16;
+	while (TableSize < NumDuplicatedVertex * 2)
+	{
+		TableSize <<= 1;
+	}
+	const uint32 TableMask = TableSize - 1;
+	TArray<uint32> VertexTable;
+	VertexTable.SetNum(TableSize, UINT32_MAX);
+	TArray<VertexKey> UniqueKeys;	// 정점 인덱스 -> 키 (테이블 비교용)
+	UniqueKeys.Reserve(InObjInfo.Positions.Num());
+
+	OutStaticMesh->Indices.Reserve(NumDuplicatedVertex);
+	OutStaticMesh->Vertices.Reserve(InObjInfo.Positions.Num());
 
+	const VertexKeyHash Hasher;
 	for (uint32 CurIndex = 0; CurIndex < NumDuplicatedVertex; ++CurIndex)
 	{
 		VertexKey Key{ InObjInfo.PositionIndices[CurIndex], InObjInfo.TexCoordIndices[CurIndex], InObjInfo.NormalIndices[CurIndex] };
-		auto It = VertexMap.find(Key);
-		if (It != VertexMap.end())
+
+		uint32 Slot = static_cast<uint32>(Hasher(Key)) & TableMask;
+		while (VertexTable[Slot] != UINT32_MAX && !(UniqueKeys[VertexTable[Slot]] == Key))
+		{
+			Slot = (Slot + 1) & TableMask;
+		}
+
+		if (VertexTable[Slot] != UINT32_MAX)
 		{
-			OutStaticMesh->Indices.push_back(It->second);
+			OutStaticMesh->Indices.push_back(VertexTable[Slot]);
 		}
 		else
 		{
@@ -943,7 +798,8 @@ void FObjImporter::ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<F
 			OutStaticMesh->Vertices.push_back(NormalVertex);
 			uint32 NewIndex = static_cast<uint32>(OutStaticMesh->Vertices.size() - 1);
 			OutStaticMesh->Indices.push_back(NewIndex);
-			VertexMap[Key] = NewIndex;
+			VertexTable[Slot] = NewIndex;
+			UniqueKeys.Add(Key);
 		}
 	}
 
@@ -980,17 +836,3 @@ void FObjImporter::ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<F
 		// else: InitialMaterialName은 비어있게 됨 (정상)
 	}
 }
-
-FObjImporter::FFaceVertex FObjImporter::ParseVertexDef(const FString& InVertexDef)
-{
-	FFaceVertex Result{ 0, 0, 0 };
-	std::stringstream ss(InVertexDef);
-	FString part;
-	uint32 temp_val;
-
-	if (std::getline(ss, part, '/')) { if (!part.empty()) { std::stringstream conv(part); if (conv >> temp_val) Result.PositionIndex = temp_val - 1; } }
-	if (std::getline(ss, part, '/')) { if (!part.empty()) { std::stringstream conv(part); if (conv >> temp_val) Result.TexCoordIndex = temp_val - 1; } }
-	if (std::getline(ss, part, '/')) { if (!part.empty()) { std::stringstream conv(part); if (conv >> temp_val) Result.NormalIndex = temp_val - 1; } }
-
-	return Result;
-}
@@ -42,17 +42,17 @@ public:
 
 	struct VertexKeyHash
 	{
-		size_t operator()(const VertexKey& Key) const { return std::hash<uint32>()(Key.PosIndex) ^ (std::hash<uint32>()(Key.TexIndex) << 1) ^ (std::hash<uint32>()(Key.NormalIndex) << 2); }
+		// 세 인덱스를 각각 다른 홀수 상수로 곱해 섞음 (격자 메시처럼 v/vt/vn이 같이 증가해도 충돌이 적음)
+		size_t operator()(const VertexKey& Key) const
+		{
+			const uint64 Hash = (Key.PosIndex * 0x9E3779B97F4A7C15ull) ^ (Key.TexIndex * 0xC2B2AE3D27D4EB4Full) ^ (Key.NormalIndex * 0x165667B19E3779F9ull);
+			return static_cast<size_t>(Hash ^ (Hash >> 32));
+		}
 	};
 
 	static bool LoadObjModel(const FString& InFileName, FObjInfo* const OutObjInfo, TArray<FMaterialInfo>& OutMaterialInfos, bool bIsRightHanded = true);
 
 	static void ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<FMaterialInfo>& InMaterialInfos, FStaticMesh* const OutStaticMesh);
-
-private:
-	struct FFaceVertex { uint32 PositionIndex, TexCoordIndex, NormalIndex; };
-
-	static FFaceVertex ParseVertexDef(const FString& InVertexDef);
 };
 
 class UStaticMesh;
@@ -62,11 +62,19 @@ class FObjManager
 private:
 	static TMap<FString, FStaticMesh*> ObjStaticMeshMap;
 public:
-	static void Preload();
 	static void Clear();
 	static FStaticMesh* LoadObjStaticMeshAsset(const FString& PathFileName);
+
+	// LoadObjStaticMeshAsset을 CPU 단계와 등록 단계로 나눈 것 (FAssetPreloader가 파싱을 워커 스레드에서 수행)
+	// Parse: 캐시 읽기/.obj 파싱/텍스처 경로 해석만 수행하므로 워커 스레드에서 호출 가능
+	// Register: 머티리얼 생성 및 메모리 캐시 등록 (소유 스레드 전용)
+	static FStaticMesh* ParseObjStaticMeshAsset(const FString& NormalizedPathStr, TArray<FMaterialInfo>& OutMaterialInfos);
+	static FStaticMesh* RegisterParsedStaticMeshAsset(const FString& NormalizedPathStr, FStaticMesh* InStaticMesh, const TArray<FMaterialInfo>& InMaterialInfos);
 	static UStaticMesh* LoadObjStaticMesh(const FString& PathFileName);
 
 	// FBX 등 외부에서 생성된 FStaticMesh를 캐시에 등록
 	static void RegisterStaticMeshAsset(const FString& PathFileName, FStaticMesh* InStaticMesh);
+
+	// 메모리 캐시에서 제거하고 해제 (FAssetStreamer가 UStaticMesh를 내보낼 때)
+	static void ReleaseStaticMeshAsset(const FString& PathFileName);
 };
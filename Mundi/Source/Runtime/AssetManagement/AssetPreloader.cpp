@@ -0,0 +1,357 @@
+#include "pch.h"
+#include "AssetPreloader.h"
+#include "ObjManager.h"
+#include "FbxLoader.h"
+#include "Texture.h"
+#include "SkeletalMesh.h"
+#include "AnimSequence.h"
+#include "Sound.h"
+#include "PathUtils.h"
+#include "PlatformTime.h"
+#include "TaskScheduler.h"
+#include "DerivedDataCache.h"
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+	enum class EPreloadAssetType : uint8
+	{
+		StaticMesh,		// .obj (워커에서 파싱)
+		Texture,		// .dds/.jpg/.png (워커에서 DDS 변환 + 파일 읽기)
+		Sound,			// .wav (워커에서 디코딩)
+		Fbx,			// .fbx (소유 스레드 전용)
+		Count
+	};
+
+	const char* GetPreloadAssetTypeName(EPreloadAssetType Type)
+	{
+		switch (Type)
+		{
+		case EPreloadAssetType::StaticMesh: return "StaticMesh(.obj)";
+		case EPreloadAssetType::Texture:	return "Texture";
+		case EPreloadAssetType::Sound:		return "Sound(.wav)";
+		case EPreloadAssetType::Fbx:		return "Fbx";
+		default:							return "Unknown";
+		}
+	}
+
+	struct FObjPreloadEntry
+	{
+		FString Path;
+		FStaticMesh* Mesh = nullptr;
+		TArray<FMaterialInfo> MaterialInfos;
+	};
+
+	struct FTexturePreloadEntry
+	{
+		FString Path;
+		UTexture::FSourceData Source;
+		bool bPrepared = false;
+	};
+
+	struct FSoundPreloadEntry
+	{
+		FString Path;
+		USound* Sound = nullptr;
+		bool bLoaded = false;
+	};
+
+	// 워커 단계 작업 하나 (종류별 엔트리 배열의 인덱스)
+	struct FPreloadJob
+	{
+		EPreloadAssetType Type;
+		int32 Index;
+		uintmax_t FileSize;
+	};
+
+	struct FPreloadTypeStats
+	{
+		int32 Count = 0;
+		double WorkerMS = 0.0;	// 워커 CPU 시간 합 (병렬이므로 벽시계 시간보다 클 수 있음)
+		double OwnerMS = 0.0;	// 소유 스레드 시간
+	};
+
+	FString ToLowerExtension(const fs::path& Path)
+	{
+		FString Extension = WideToUTF8(Path.extension().wstring());
+		std::transform(Extension.begin(), Extension.end(), Extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+		return Extension;
+	}
+
+	// 스켈레톤이 있는 FBX의 모든 애니메이션 스택 로드
+	void LoadAllAnimations(UFbxLoader& FbxLoader, const FString& PathStr, USkeletalMesh* SkeletalMesh)
+	{
+		const FSkeleton* Skeleton = SkeletalMesh->GetSkeleton();
+		if (!Skeleton || Skeleton->Bones.IsEmpty())
+		{
+			return;
+		}
+
+		TArray<FString> AnimStackNames = FbxLoader.GetAnimationStackNames(PathStr);
+		for (const FString& AnimStackName : AnimStackNames)
+		{
+			if (FbxLoader.LoadFbxAnimation(PathStr, Skeleton, AnimStackName))
+			{
+				UE_LOG("FAssetPreloader: Loaded animation '%s' from '%s'", AnimStackName.c_str(), PathStr.c_str());
+			}
+		}
+	}
+}
+
+void FAssetPreloader::Preload(const FAssetPreloadOptions& Options)
+{
+	const uint64 PreloadStart = FPlatformTime::Cycles64();
+
+	const fs::path DataDir(UTF8ToWide(GDataDir));
+	if (!fs::exists(DataDir) || !fs::is_directory(DataDir))
+	{
+		UE_LOG("FAssetPreloader: Data directory not found: %s", WideToUTF8(DataDir.wstring()).c_str());
+		return;
+	}
+
+	// --- 1. 탐색 (디렉토리 순회는 한 번만) ---
+	const FString AudioDirPrefix = NormalizePath(GDataDir + "/Audio/");
+
+	TArray<FObjPreloadEntry> ObjEntries;
+	TArray<FTexturePreloadEntry> TextureEntries;
+	TArray<FSoundPreloadEntry> SoundEntries;
+	TArray<FString> FbxPaths;
+	TArray<FPreloadJob> Jobs;
+	TArray<FString> DerivedDataSources;	// DDC 키에 들어가는 원본 (내용 해시 대상)
+
+	for (const auto& Entry : fs::recursive_directory_iterator(DataDir))
+	{
+		if (!Entry.is_regular_file())
+			continue;
+
+		const fs::path& Path = Entry.path();
+		const FString Extension = ToLowerExtension(Path);
+		const FString PathStr = NormalizePath(WideToUTF8(Path.wstring()));
+
+		if (Options.bStreamOnDemand && Extension == ".obj")
+		{
+			RESOURCE.RegisterAssetPath(EResourceType::StaticMesh, PathStr);
+		}
+		else if (Extension == ".obj")
+		{
+			Jobs.Add({ EPreloadAssetType::StaticMesh, ObjEntries.Num(), Entry.file_size() });
+			ObjEntries.Add({ PathStr });
+			DerivedDataSources.Add(PathStr);
+		}
+		else if (Extension == ".mtl")
+		{
+			if (!Options.bStreamOnDemand)
+			{
+				DerivedDataSources.Add(PathStr);
+			}
+		}
+		else if (Extension == ".fbx")
+		{
+			if (Options.bStreamOnDemand)
+			{
+				RESOURCE.RegisterAssetPath(EResourceType::StaticMesh, PathStr);
+				RESOURCE.RegisterAssetPath(EResourceType::SkeletalMesh, PathStr);
+			}
+			// 스트리밍 모드에서도 애니메이션 목록이 필요하면 스켈레탈 메시 + 애니메이션은 미리 로드
+			if (!Options.bStreamOnDemand || Options.bSkeletalMeshes)
+			{
+				FbxPaths.Add(PathStr);
+				DerivedDataSources.Add(PathStr);
+			}
+		}
+		else if (Options.bStreamOnDemand && (Extension == ".dds" || Extension == ".jpg" || Extension == ".png"))
+		{
+			RESOURCE.RegisterAssetPath(EResourceType::Texture, PathStr);
+		}
+		else if (Extension == ".dds" || Extension == ".jpg" || Extension == ".png")
+		{
+			// 데칼 텍스쳐를 ui에서 고를 수 있게 하기 위해 임시로 만듬.
+			if (!RESOURCE.Get<UTexture>(PathStr))
+			{
+				Jobs.Add({ EPreloadAssetType::Texture, TextureEntries.Num(), Entry.file_size() });
+				TextureEntries.Add({ PathStr });
+				if (Extension != ".dds")
+				{
+					DerivedDataSources.Add(PathStr);
+				}
+			}
+		}
+		else if (Options.bSounds && Extension == ".wav" && PathStr.rfind(AudioDirPrefix, 0) == 0)
+		{
+			if (!RESOURCE.Get<USound>(PathStr))
+			{
+				Jobs.Add({ EPreloadAssetType::Sound, SoundEntries.Num(), Entry.file_size() });
+				SoundEntries.Add({ PathStr });
+			}
+		}
+	}
+
+	// UObject 생성은 소유 스레드에서만 가능하므로 사운드 객체는 미리 만들어 두고 워커는 내용만 채운다
+	for (FSoundPreloadEntry& SoundEntry : SoundEntries)
+	{
+		SoundEntry.Sound = NewObject<USound>();
+	}
+
+	// 큰 파일부터 처리해 마지막에 큰 작업 하나만 남는 꼬리 지연을 줄인다
+	std::sort(Jobs.begin(), Jobs.end(), [](const FPreloadJob& A, const FPreloadJob& B) { return A.FileSize > B.FileSize; });
+	const uint64 DiscoverEnd = FPlatformTime::Cycles64();
+
+	// --- 1-1. DDC 원본 검증 (내용 해시를 병렬로 미리 채워 워커/FBX 단계의 키 계산은 메모 조회만 하도록) ---
+	FDerivedDataCache& DDC = FDerivedDataCache::GetInstance();
+	DDC.VerifySources(DerivedDataSources);
+	const uint64 VerifyEnd = FPlatformTime::Cycles64();
+
+	// --- 2. 워커 단계 (디바이스/리소스 매니저 사용 금지) ---
+	TArray<double> JobMS;
+	JobMS.SetNum(Jobs.Num());
+
+	// 작업 크기 편차가 크므로 청크를 고정 분할하지 않고 공유 카운터로 하나씩 가져간다
+	std::atomic<int32> NextJobIndex{ 0 };
+	const int32 NumSlots = FTaskScheduler::ComputeNumChunks(Jobs.Num(), 1);
+	FTaskScheduler::ParallelFor(NumSlots, NumSlots, [&](int32 /*ChunkIndex*/, int32 /*Begin*/, int32 /*End*/)
+	{
+		// WIC 디코딩(DDS 변환)에 COM이 필요. 이미 다른 모드로 초기화된 스레드면 실패하지만 그대로 사용 가능
+		const HRESULT ComResult = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+		for (int32 JobIndex = NextJobIndex++; JobIndex < Jobs.Num(); JobIndex = NextJobIndex++)
+		{
+			const FPreloadJob& Job = Jobs[JobIndex];
+			const uint64 JobStart = FPlatformTime::Cycles64();
+
+			switch (Job.Type)
+			{
+			case EPreloadAssetType::StaticMesh:
+			{
+				FObjPreloadEntry& ObjEntry = ObjEntries[Job.Index];
+				ObjEntry.Mesh = FObjManager::ParseObjStaticMeshAsset(ObjEntry.Path, ObjEntry.MaterialInfos);
+				break;
+			}
+			case EPreloadAssetType::Texture:
+			{
+				FTexturePreloadEntry& TextureEntry = TextureEntries[Job.Index];
+				TextureEntry.bPrepared = UTexture::PrepareSource(TextureEntry.Path, true, TextureEntry.Source);
+				break;
+			}
+			case EPreloadAssetType::Sound:
+			{
+				FSoundPreloadEntry& SoundEntry = SoundEntries[Job.Index];
+				SoundEntry.bLoaded = SoundEntry.Sound->Load(SoundEntry.Path);
+				break;
+			}
+			default:
+				break;
+			}
+
+			JobMS[JobIndex] = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - JobStart);
+		}
+
+		if (SUCCEEDED(ComResult))
+		{
+			CoUninitialize();
+		}
+	});
+	const uint64 WorkerEnd = FPlatformTime::Cycles64();
+
+	FPreloadTypeStats Stats[static_cast<int32>(EPreloadAssetType::Count)];
+	for (int32 JobIndex = 0; JobIndex < Jobs.Num(); ++JobIndex)
+	{
+		FPreloadTypeStats& TypeStats = Stats[static_cast<int32>(Jobs[JobIndex].Type)];
+		++TypeStats.Count;
+		TypeStats.WorkerMS += JobMS[JobIndex];
+	}
+
+	// --- 3. 소유 스레드 단계 (GPU 리소스 생성 + 등록) ---
+	ID3D11Device* Device = RESOURCE.GetDevice();
+	uint64 StepStart = FPlatformTime::Cycles64();
+
+	// 텍스처
+	for (FTexturePreloadEntry& TextureEntry : TextureEntries)
+	{
+		UTexture* Texture = NewObject<UTexture>();
+		if (TextureEntry.bPrepared)
+		{
+			Texture->LoadFromSource(TextureEntry.Source, Device);
+		}
+		else
+		{
+			// 준비에 실패했으면 기존 경로로 다시 시도 (에러 로그 포함)
+			Texture->Load(TextureEntry.Path, Device);
+		}
+		RESOURCE.Add<UTexture>(TextureEntry.Path, Texture);
+		TextureEntry.Source.FileData.Empty();
+	}
+	Stats[static_cast<int32>(EPreloadAssetType::Texture)].OwnerMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StepStart);
+
+	// OBJ: 파싱 결과를 등록하면 UStaticMesh::Load가 메모리 캐시를 사용하므로 버퍼 생성만 남는다
+	StepStart = FPlatformTime::Cycles64();
+	for (FObjPreloadEntry& ObjEntry : ObjEntries)
+	{
+		if (ObjEntry.Mesh)
+		{
+			FObjManager::RegisterParsedStaticMeshAsset(ObjEntry.Path, ObjEntry.Mesh, ObjEntry.MaterialInfos);
+			FObjManager::LoadObjStaticMesh(ObjEntry.Path);
+		}
+	}
+	Stats[static_cast<int32>(EPreloadAssetType::StaticMesh)].OwnerMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StepStart);
+
+	// FBX: 스태틱 메시 + (옵션) 스켈레탈 메시와 애니메이션
+	StepStart = FPlatformTime::Cycles64();
+	UFbxLoader& FbxLoader = UFbxLoader::GetInstance();
+	for (const FString& FbxPath : FbxPaths)
+	{
+		if (!Options.bStreamOnDemand)
+		{
+			FObjManager::LoadObjStaticMesh(FbxPath);
+		}
+
+		if (Options.bSkeletalMeshes)
+		{
+			if (USkeletalMesh* SkeletalMesh = FbxLoader.LoadFbxMesh(FbxPath))
+			{
+				LoadAllAnimations(FbxLoader, FbxPath, SkeletalMesh);
+			}
+		}
+	}
+	FPreloadTypeStats& FbxStats = Stats[static_cast<int32>(EPreloadAssetType::Fbx)];
+	FbxStats.Count = FbxPaths.Num();
+	FbxStats.OwnerMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StepStart);
+
+	// 사운드
+	StepStart = FPlatformTime::Cycles64();
+	for (FSoundPreloadEntry& SoundEntry : SoundEntries)
+	{
+		RESOURCE.Add<USound>(SoundEntry.Path, SoundEntry.Sound);
+	}
+	Stats[static_cast<int32>(EPreloadAssetType::Sound)].OwnerMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StepStart);
+
+	RESOURCE.SetStaticMeshs();
+	if (Options.bSkeletalMeshes)
+	{
+		RESOURCE.SetSkeletalMeshs();
+		RESOURCE.SetAnimations();
+	}
+	if (Options.bSounds)
+	{
+		RESOURCE.SetAudioFiles();
+	}
+
+	// --- 4. 시작 시간 리포트 ---
+	const uint64 PreloadEnd = FPlatformTime::Cycles64();
+	UE_LOG("FAssetPreloader: Total %.1f ms (discover %.1f ms, ddc verify %.1f ms, workers %.1f ms on %d threads, owning thread %.1f ms)",
+		FPlatformTime::ToMilliseconds(PreloadEnd - PreloadStart),
+		FPlatformTime::ToMilliseconds(DiscoverEnd - PreloadStart),
+		FPlatformTime::ToMilliseconds(VerifyEnd - DiscoverEnd),
+		FPlatformTime::ToMilliseconds(WorkerEnd - VerifyEnd), NumSlots,
+		FPlatformTime::ToMilliseconds(PreloadEnd - WorkerEnd));
+
+	for (int32 TypeIndex = 0; TypeIndex < static_cast<int32>(EPreloadAssetType::Count); ++TypeIndex)
+	{
+		const FPreloadTypeStats& TypeStats = Stats[TypeIndex];
+		UE_LOG("FAssetPreloader:   %-18s %4d files, worker cpu %8.1f ms, owning thread %8.1f ms",
+			GetPreloadAssetTypeName(static_cast<EPreloadAssetType>(TypeIndex)), TypeStats.Count, TypeStats.WorkerMS, TypeStats.OwnerMS);
+	}
+
+	DDC.LogReport();
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include "UEContainer.h"
+
+/**
+ * @struct FAssetPreloadOptions
+ * @brief 엔진 Startup에서 미리 로드할 에셋 종류입니다.
+ */
+struct FAssetPreloadOptions
+{
+	bool bSkeletalMeshes = true;	// FBX 스켈레탈 메시 + 모든 애니메이션 스택 (에디터 전용)
+	bool bSounds = true;			// Data/Audio 아래 .wav
+	bool bStreamOnDemand = false;	// OBJ/FBX 메시와 텍스처는 경로만 등록하고 참조될 때 로드 (FAssetStreamer)
+};
+
+/**
+ * @class FAssetPreloader
+ * @brief GDataDir을 한 번만 순회해 OBJ/FBX/텍스처/사운드를 찾아 미리 로드합니다.
+ *
+ * 1. 탐색: recursive_directory_iterator 한 번으로 종류별 목록 작성 (이미 로드된 에셋 제외)
+ * 2. 워커 단계: OBJ 캐시 읽기/파싱, 텍스처 DDS 변환 + 파일 읽기, WAV 디코딩을
+ *    FTaskScheduler 워커에서 큰 파일부터 동적으로 분배
+ * 3. 소유 스레드 단계: 버텍스/인덱스 버퍼, 텍스처/SRV, 머티리얼 생성과 리소스 매니저 등록
+ *
+ * FBX SDK 임포터(FbxManager 공유)는 스레드 안전하지 않으므로 FBX는 소유 스레드 단계에서 로드합니다.
+ * bStreamOnDemand면 메시/텍스처는 탐색만 하고 리소스 매니저 레지스트리에 경로를 등록합니다.
+ * 끝나면 종류별 개수/워커 CPU 시간/소유 스레드 시간을 로그로 출력합니다.
+ */
+class FAssetPreloader
+{
+public:
+	static void Preload(const FAssetPreloadOptions& Options = FAssetPreloadOptions());
+};
@@ -0,0 +1,531 @@
+#include "pch.h"
+#include "AssetStreamer.h"
+#include "ResourceManager.h"
+#include "ObjManager.h"
+#include "Texture.h"
+#include "StaticMesh.h"
+#include "SkeletalMesh.h"
+#include "ObjectFactory.h"
+#include "PathUtils.h"
+#include "PlatformTime.h"
+#include "TaskScheduler.h"
+#include <thread>
+
+namespace
+{
+	struct FPreparedTexture
+	{
+		FString Path;
+		bool bSRGB = true;
+		UTexture::FSourceData Source;
+		bool bPrepared = false;
+	};
+
+	FString ToLowerExtension(const FString& Path)
+	{
+		const size_t DotPos = Path.find_last_of('.');
+		if (DotPos == FString::npos)
+		{
+			return FString();
+		}
+		FString Extension = Path.substr(DotPos);
+		std::transform(Extension.begin(), Extension.end(), Extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+		return Extension;
+	}
+
+	// 레벨 문자열 중 에셋 경로로 보이는 것을 수집 (문자열 테이블이라 이미 중복 없음)
+	// 역직렬화는 FJsonSerializer::ReadString(= JSON::ToString)으로 경로를 읽으므로 같은 표현으로 변환해 요청
+	void CollectAssetPaths(const TArray<FString>& Strings, TArray<FString>& OutMeshPaths, TArray<FString>& OutTexturePaths)
+	{
+		for (const FString& Value : Strings)
+		{
+			const FString Extension = ToLowerExtension(Value);
+			if (Extension == ".obj")
+			{
+				OutMeshPaths.Add(JSON(Value).ToString());
+			}
+			else if (Extension == ".dds" || Extension == ".png" || Extension == ".jpg")
+			{
+				OutTexturePaths.Add(JSON(Value).ToString());
+			}
+		}
+	}
+
+	// 리소스를 가리키는 UPROPERTY 값 (단일 포인터 또는 포인터 배열)
+	void CountPropertyReferences(UObject* Object, const FProperty& Prop, TMap<UResourceBase*, int32>& InOutCounts)
+	{
+		const bool bIsMeshPointer = Prop.Type == EPropertyType::StaticMesh || Prop.Type == EPropertyType::SkeletalMesh;
+		const bool bIsMeshArray = Prop.Type == EPropertyType::Array
+			&& (Prop.InnerType == EPropertyType::StaticMesh || Prop.InnerType == EPropertyType::SkeletalMesh);
+
+		if (bIsMeshPointer)
+		{
+			if (UResourceBase* Resource = *Prop.GetValuePtr<UResourceBase*>(Object))
+			{
+				++InOutCounts[Resource];
+			}
+		}
+		else if (bIsMeshArray)
+		{
+			for (UResourceBase* Resource : *Prop.GetValuePtr<TArray<UResourceBase*>>(Object))
+			{
+				if (Resource)
+				{
+					++InOutCounts[Resource];
+				}
+			}
+		}
+	}
+}
+
+// 워커 단계 결과까지 담는 요청 (핸들에는 FAssetLoadRequest 부분만 노출)
+struct FAssetStreamer::FStreamingRequest : public FAssetLoadRequest
+{
+	std::atomic<bool> bWorkerDone{ false };
+
+	FStaticMesh* ParsedMesh = nullptr;
+	TArray<FMaterialInfo> MaterialInfos;
+	TArray<FPreparedTexture> Textures;	// 텍스처 요청이면 자기 자신, OBJ 요청이면 머티리얼이 참조하는 텍스처
+
+	~FStreamingRequest() override
+	{
+		// 마무리되지 못한 채 종료된 경우
+		delete ParsedMesh;
+	}
+};
+
+FAssetStreamingSettings FAssetStreamer::Settings;
+TArray<std::shared_ptr<FAssetStreamer::FStreamingRequest>> FAssetStreamer::PendingRequests;
+TMap<UResourceBase*, TArray<std::weak_ptr<FAssetLoadRequest>>> FAssetStreamer::HandleRequests;
+std::atomic<int32> FAssetStreamer::NumWorkerTasksInFlight{ 0 };
+bool FAssetStreamer::bResidencyDirty = false;
+uint32 FAssetStreamer::LastResidencyFrame = 0;
+FAssetStreamer::FStats FAssetStreamer::Stats;
+
+void FAssetStreamer::Initialize(const FAssetStreamingSettings& InSettings)
+{
+	Settings = InSettings;
+	UE_LOG("FAssetStreamer: %s (budget %u MB)", Settings.bEnabled ? "On-demand streaming" : "Disabled, all assets stay resident", Settings.BudgetMB);
+}
+
+void FAssetStreamer::Shutdown()
+{
+	// 워커가 요청 객체를 쓰는 중일 수 있으므로 끝날 때까지 기다린 뒤 버림
+	while (NumWorkerTasksInFlight.load() > 0)
+	{
+		std::this_thread::yield();
+	}
+	PendingRequests.Empty();
+	HandleRequests.Empty();
+	Settings.bEnabled = false;
+}
+
+FAssetStreamingSettings FAssetStreamer::LoadSettingsFromIni(bool bDefaultEnabled)
+{
+	FAssetStreamingSettings Result;
+	Result.bEnabled = bDefaultEnabled;
+
+	if (FString* Value = EditorINI.Find("AssetStreaming"))
+	{
+		Result.bEnabled = (*Value == "1" || *Value == "true");
+	}
+	if (FString* Value = EditorINI.Find("AssetStreamingBudgetMB"))
+	{
+		try { Result.BudgetMB = static_cast<uint32>(std::stoul(*Value)); } catch (...) {}
+	}
+	return Result;
+}
+
+std::shared_ptr<FAssetLoadRequest> FAssetStreamer::RequestLoad(EResourceType Type, const FString& NormalizedPath)
+{
+	for (const std::shared_ptr<FStreamingRequest>& Pending : PendingRequests)
+	{
+		if (Pending->Type == Type && Pending->Path == NormalizedPath)
+		{
+			return Pending;
+		}
+	}
+
+	std::shared_ptr<FStreamingRequest> Request = std::make_shared<FStreamingRequest>();
+	Request->Type = Type;
+	Request->Path = NormalizedPath;
+	PendingRequests.Add(Request);
+	++Stats.NumRequested;
+
+	// OBJ 파싱과 텍스처 디코딩만 워커에서 수행 (FBX는 Tick에서 동기 로드)
+	const bool bHasWorkerStage = (Type == EResourceType::StaticMesh && ToLowerExtension(NormalizedPath) == ".obj")
+		|| Type == EResourceType::Texture;
+	if (!bHasWorkerStage)
+	{
+		Request->bWorkerDone = true;
+		return Request;
+	}
+
+	if (Type == EResourceType::Texture)
+	{
+		FPreparedTexture& Texture = Request->Textures.emplace_back();
+		Texture.Path = NormalizedPath;
+	}
+
+	++NumWorkerTasksInFlight;
+	FTaskScheduler::Enqueue([Request]()
+	{
+		RunWorkerStage(*Request);
+		--NumWorkerTasksInFlight;
+	});
+	return Request;
+}
+
+std::shared_ptr<FAssetLoadRequest> FAssetStreamer::MakeCompletedRequest(EResourceType Type, const FString& NormalizedPath, UResourceBase* Resource)
+{
+	std::shared_ptr<FAssetLoadRequest> Request = std::make_shared<FAssetLoadRequest>();
+	Request->Type = Type;
+	Request->Path = NormalizedPath;
+	Request->Resource = Resource;
+	Request->State = Resource ? EAssetLoadState::Loaded : EAssetLoadState::Failed;
+	TrackHandleRequest(Request);
+	return Request;
+}
+
+void FAssetStreamer::TrackHandleRequest(const std::shared_ptr<FAssetLoadRequest>& Request)
+{
+	if (Request->State == EAssetLoadState::Loaded && Request->Resource && Request->Resource->IsEvictable())
+	{
+		HandleRequests[Request->Resource].Add(Request);
+	}
+}
+
+bool FAssetStreamer::IsHeldByHandle(UResourceBase* Resource)
+{
+	TArray<std::weak_ptr<FAssetLoadRequest>>* Requests = HandleRequests.Find(Resource);
+	if (!Requests)
+	{
+		return false;
+	}
+
+	Requests->erase(std::remove_if(Requests->begin(), Requests->end(),
+		[](const std::weak_ptr<FAssetLoadRequest>& Request) { return Request.expired(); }), Requests->end());
+	if (Requests->IsEmpty())
+	{
+		HandleRequests.Remove(Resource);
+		return false;
+	}
+	return true;
+}
+
+// 리소스 매니저/디바이스 사용 금지 (워커 스레드)
+void FAssetStreamer::RunWorkerStage(FStreamingRequest& Request)
+{
+	// WIC 디코딩(DDS 변환)에 COM이 필요. 이미 다른 모드로 초기화된 스레드면 실패하지만 그대로 사용 가능
+	const HRESULT ComResult = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+	if (Request.Type == EResourceType::StaticMesh)
+	{
+		Request.ParsedMesh = FObjManager::ParseObjStaticMeshAsset(Request.Path, Request.MaterialInfos);
+
+		// 머티리얼이 해석할 텍스처도 여기서 준비해 두면 소유 스레드에서는 SRV 생성만 남음 (UMaterial::ResolveTextures와 같은 sRGB 규칙)
+		auto AddTexture = [&Request](const FString& TexturePath, bool bSRGB)
+		{
+			if (TexturePath.empty())
+			{
+				return;
+			}
+			const FString NormalizedTexturePath = NormalizePath(TexturePath);
+			for (const FPreparedTexture& Existing : Request.Textures)
+			{
+				if (Existing.Path == NormalizedTexturePath)
+				{
+					return;
+				}
+			}
+			FPreparedTexture& Texture = Request.Textures.emplace_back();
+			Texture.Path = NormalizedTexturePath;
+			Texture.bSRGB = bSRGB;
+		};
+		for (const FMaterialInfo& MaterialInfo : Request.MaterialInfos)
+		{
+			AddTexture(MaterialInfo.DiffuseTextureFileName, true);
+			AddTexture(MaterialInfo.NormalTextureFileName, false);
+		}
+	}
+
+	for (FPreparedTexture& Texture : Request.Textures)
+	{
+		Texture.bPrepared = UTexture::PrepareSource(Texture.Path, Texture.bSRGB, Texture.Source);
+	}
+
+	if (SUCCEEDED(ComResult))
+	{
+		CoUninitialize();
+	}
+
+	Request.bWorkerDone = true;
+}
+
+void FAssetStreamer::FinalizeRequest(FStreamingRequest& Request)
+{
+	UResourceManager& ResourceManager = UResourceManager::GetInstance();
+	ID3D11Device* Device = ResourceManager.GetDevice();
+
+	// 1. 준비된 텍스처 생성 (그 사이 다른 경로로 로드됐으면 버림)
+	for (FPreparedTexture& Prepared : Request.Textures)
+	{
+		if (Prepared.bPrepared && !ResourceManager.Get<UTexture>(Prepared.Path))
+		{
+			UTexture* Texture = NewObject<UTexture>();
+			Texture->LoadFromSource(Prepared.Source, Device, Prepared.bSRGB);
+			ResourceManager.Add<UTexture>(Prepared.Path, Texture);
+		}
+		Prepared.Source.FileData.Empty();
+	}
+
+	// 2. 리소스 생성/등록. 워커 단계에 실패했으면 기존 동기 경로로 다시 시도 (에러 로그 포함)
+	bool bLoaded = false;
+	switch (Request.Type)
+	{
+	case EResourceType::StaticMesh:
+	{
+		if (Request.ParsedMesh)
+		{
+			FObjManager::RegisterParsedStaticMeshAsset(Request.Path, Request.ParsedMesh, Request.MaterialInfos);
+			Request.ParsedMesh = nullptr;
+		}
+		UStaticMesh* StaticMesh = ResourceManager.Load<UStaticMesh>(Request.Path);
+		bLoaded = StaticMesh && StaticMesh->GetStaticMeshAsset();
+		Request.Resource = StaticMesh;
+		break;
+	}
+	case EResourceType::SkeletalMesh:
+	{
+		USkeletalMesh* SkeletalMesh = ResourceManager.Load<USkeletalMesh>(Request.Path);
+		bLoaded = SkeletalMesh && SkeletalMesh->GetSkeletalMeshData();
+		Request.Resource = SkeletalMesh;
+		break;
+	}
+	case EResourceType::Texture:
+	{
+		UTexture* Texture = ResourceManager.Load<UTexture>(Request.Path);
+		bLoaded = Texture != nullptr;
+		Request.Resource = Texture;
+		break;
+	}
+	default:
+		break;
+	}
+
+	if (bLoaded)
+	{
+		Request.State = EAssetLoadState::Loaded;
+		Request.Resource->MarkUsed();
+	}
+	else
+	{
+		Request.State = EAssetLoadState::Failed;
+		Request.Resource = nullptr;
+		++Stats.NumFailed;
+	}
+
+	for (const std::function<void(UResourceBase*)>& Callback : Request.Callbacks)
+	{
+		Callback(Request.Resource);
+	}
+	Request.Callbacks.Empty();
+}
+
+void FAssetStreamer::FinalizeReadyRequests(double BudgetMS)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	// 요청 순서를 유지하되 워커 단계가 끝난 것만 마무리
+	for (int32 Index = 0; Index < PendingRequests.Num();)
+	{
+		std::shared_ptr<FStreamingRequest> Request = PendingRequests[Index];
+		if (!Request->bWorkerDone.load())
+		{
+			++Index;
+			continue;
+		}
+
+		// 콜백이 새 요청을 추가할 수 있으므로 먼저 목록에서 뺌
+		PendingRequests.erase(PendingRequests.begin() + Index);
+		FinalizeRequest(*Request);
+		TrackHandleRequest(Request);
+
+		if (BudgetMS > 0.0 && FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) >= BudgetMS)
+		{
+			break;
+		}
+	}
+}
+
+void FAssetStreamer::Tick()
+{
+	++UResourceBase::ResidencyFrame;
+
+	FinalizeReadyRequests(Settings.FinalizeBudgetMS);
+
+	if (Settings.bEnabled && (bResidencyDirty || UResourceBase::ResidencyFrame - LastResidencyFrame >= Settings.ResidencyIntervalFrames))
+	{
+		UpdateResidency();
+	}
+}
+
+void FAssetStreamer::WaitForRequest(const FAssetLoadRequest& Request)
+{
+	while (Request.State == EAssetLoadState::Pending)
+	{
+		FinalizeReadyRequests(0.0);
+		if (Request.State == EAssetLoadState::Pending)
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+void FAssetStreamer::FlushAsyncLoading()
+{
+	while (!PendingRequests.IsEmpty())
+	{
+		FinalizeReadyRequests(0.0);
+		if (!PendingRequests.IsEmpty())
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+void FAssetStreamer::PrefetchReferencedAssets(const TArray<FString>& LevelStrings)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	TArray<FString> MeshPaths;
+	TArray<FString> TexturePaths;
+	CollectAssetPaths(LevelStrings, MeshPaths, TexturePaths);
+
+	UResourceManager& ResourceManager = UResourceManager::GetInstance();
+	int32 NumRequested = 0;
+	for (const FString& MeshPath : MeshPaths)
+	{
+		if (!ResourceManager.Get<UStaticMesh>(MeshPath))
+		{
+			ResourceManager.LoadAsync<UStaticMesh>(MeshPath);
+			++NumRequested;
+		}
+	}
+	for (const FString& TexturePath : TexturePaths)
+	{
+		if (!ResourceManager.Get<UTexture>(TexturePath))
+		{
+			ResourceManager.LoadAsync<UTexture>(TexturePath);
+			++NumRequested;
+		}
+	}
+
+	FlushAsyncLoading();
+
+	UE_LOG("FAssetStreamer: Prefetched %d of %d referenced assets in %.1f ms", NumRequested, MeshPaths.Num() + TexturePaths.Num(),
+		FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+}
+
+void FAssetStreamer::UpdateResidency()
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	bResidencyDirty = false;
+	LastResidencyFrame = UResourceBase::ResidencyFrame;
+
+	// 1. 모든 UObject의 메시 UPROPERTY를 세어 참조 수 계산
+	TMap<UResourceBase*, int32> ReferenceCounts;
+	for (UObject* Object : GUObjectArray)
+	{
+		if (!Object)
+		{
+			continue;
+		}
+		for (const FProperty& Prop : Object->GetClass()->GetAllProperties())
+		{
+			CountPropertyReferences(Object, Prop, ReferenceCounts);
+		}
+	}
+
+	// 2. 해제 대상 메시의 참조 수/LRU 갱신
+	UResourceManager& ResourceManager = UResourceManager::GetInstance();
+	TArray<UResourceBase*> Candidates;
+	uint64 ResidentBytes = 0;
+	int32 NumEvictable = 0;
+	int32 NumReferenced = 0;
+	int32 NumHandlePinned = 0;
+
+	for (EResourceType Type : { EResourceType::StaticMesh, EResourceType::SkeletalMesh })
+	{
+		for (UResourceBase* Resource : ResourceManager.GetResidentResources(Type))
+		{
+			if (!Resource->IsEvictable())
+			{
+				continue;
+			}
+
+			const int32* Count = ReferenceCounts.Find(Resource);
+			Resource->SetNumReferencers(Count ? *Count : 0);
+			if (Count)
+			{
+				Resource->MarkUsed();
+				++NumReferenced;
+			}
+			else if (IsHeldByHandle(Resource))
+			{
+				// UPROPERTY로 참조하지 않고 핸들로만 들고 있는 리소스 (Get 결과가 댕글링되지 않도록 고정)
+				Resource->MarkUsed();
+				++NumHandlePinned;
+			}
+			else if (UResourceBase::ResidencyFrame - Resource->GetLastUsedFrame() >= Settings.MinUnusedFrames)
+			{
+				Candidates.Add(Resource);
+			}
+
+			ResidentBytes += Resource->GetResidentBytes();
+			++NumEvictable;
+		}
+	}
+
+	// 3. 예산을 넘으면 가장 오래 쓰이지 않은 것부터 해제
+	const uint64 BudgetBytes = static_cast<uint64>(Settings.BudgetMB) * 1024 * 1024;
+	if (ResidentBytes > BudgetBytes && !Candidates.IsEmpty())
+	{
+		std::sort(Candidates.begin(), Candidates.end(), [](const UResourceBase* A, const UResourceBase* B)
+		{
+			return A->GetLastUsedFrame() < B->GetLastUsedFrame();
+		});
+
+		for (UResourceBase* Resource : Candidates)
+		{
+			if (ResidentBytes <= BudgetBytes)
+			{
+				break;
+			}
+
+			const uint64 Bytes = Resource->GetResidentBytes();
+			const FString Path = Resource->GetFilePath();
+			if (ResourceManager.EvictResource(Resource))
+			{
+				ResidentBytes -= Bytes;
+				--NumEvictable;
+				++Stats.NumEvicted;
+				Stats.EvictedBytes += Bytes;
+				UE_LOG("FAssetStreamer: Evicted '%s' (%.2f MB)", Path.c_str(), Bytes / (1024.0 * 1024.0));
+			}
+		}
+	}
+
+	Stats.NumEvictable = NumEvictable;
+	Stats.NumReferenced = NumReferenced;
+	Stats.NumHandlePinned = NumHandlePinned;
+	Stats.ResidentBytes = ResidentBytes;
+	Stats.LastResidencyMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+}
+
+FAssetStreamer::FStats FAssetStreamer::GetStats()
+{
+	FStats Result = Stats;
+	Result.NumPending = PendingRequests.Num();
+	return Result;
+}
@@ -0,0 +1,175 @@
+#pragma once
+#include "UEContainer.h"
+#include "Enums.h"
+#include <atomic>
+#include <functional>
+#include <memory>
+
+class UResourceBase;
+
+/**
+ * @struct FAssetStreamingSettings
+ * @brief 온디맨드 스트리밍 설정입니다. (editor.ini의 AssetStreaming / AssetStreamingBudgetMB)
+ */
+struct FAssetStreamingSettings
+{
+	bool bEnabled = false;				// false면 기존처럼 시작 시 전부 로드하고 해제하지 않음
+	uint32 BudgetMB = 512;				// 참조 없는 메시를 해제하기 시작하는 상주 메모리 (메시 CPU + GPU)
+	uint32 ResidencyIntervalFrames = 60;	// 상주 집합 갱신 주기
+	uint32 MinUnusedFrames = 60;		// 이 프레임 수 이상 참조/사용되지 않은 리소스만 해제
+	double FinalizeBudgetMS = 4.0;		// 프레임당 소유 스레드에서 비동기 로드를 마무리하는 시간 (최소 1개)
+};
+
+enum class EAssetLoadState : uint8
+{
+	Pending,
+	Loaded,
+	Failed,
+};
+
+/**
+ * @struct FAssetLoadRequest
+ * @brief 비동기 로드 요청의 공유 상태입니다. 모든 필드는 소유 스레드에서만 읽고 씁니다.
+ */
+struct FAssetLoadRequest
+{
+	EResourceType Type = EResourceType::None;
+	FString Path;												// 정규화된 경로
+	EAssetLoadState State = EAssetLoadState::Pending;
+	UResourceBase* Resource = nullptr;							// Loaded일 때만 유효
+	TArray<std::function<void(UResourceBase*)>> Callbacks;		// 완료 시 호출 (실패면 nullptr)
+
+	virtual ~FAssetLoadRequest() = default;
+};
+
+/**
+ * @class FAssetStreamer
+ * @brief 에셋을 참조될 때 로드하고, 참조가 없는 메시를 메모리 예산에 맞춰 LRU 순으로 해제합니다.
+ *
+ * - 로드: OBJ 파싱/DDS 변환 등 CPU 단계는 FTaskScheduler 워커에서, 버퍼/SRV 생성과 등록은 Tick에서 수행
+ *         (FAssetPreloader와 같은 분할. FBX는 SDK가 스레드 안전하지 않아 Tick에서 동기 로드)
+ * - 참조 수: 모든 UObject의 UStaticMesh* / USkeletalMesh* UPROPERTY(배열 포함)를 세어 갱신
+ *            컴포넌트뿐 아니라 직렬화/에디터/Lua가 직접 대입한 포인터도 빠짐없이 집계됨
+ * - 해제: 스트리밍 모드에서 파일로부터 로드된 메시만 대상. 살아 있는 TAssetHandle이 가리키는 리소스는 해제하지 않음
+ *         UPROPERTY/핸들이 아닌 곳에 오래 보관하려면 SetEvictable(false)로 고정해야 함
+ */
+class FAssetStreamer
+{
+public:
+	static void Initialize(const FAssetStreamingSettings& InSettings);
+	static void Shutdown();
+
+	/** editor.ini에서 설정을 읽음 (키가 없으면 bDefaultEnabled) */
+	static FAssetStreamingSettings LoadSettingsFromIni(bool bDefaultEnabled);
+
+	static bool IsEnabled() { return Settings.bEnabled; }
+	static const FAssetStreamingSettings& GetSettings() { return Settings; }
+
+	static bool IsEvictableType(EResourceType Type) { return Type == EResourceType::StaticMesh || Type == EResourceType::SkeletalMesh; }
+	static bool SupportsAsyncLoad(EResourceType Type) { return IsEvictableType(Type) || Type == EResourceType::Texture; }
+
+	/** 같은 (타입, 경로)의 요청이 진행 중이면 그 요청을 반환 */
+	static std::shared_ptr<FAssetLoadRequest> RequestLoad(EResourceType Type, const FString& NormalizedPath);
+	static std::shared_ptr<FAssetLoadRequest> MakeCompletedRequest(EResourceType Type, const FString& NormalizedPath, UResourceBase* Resource);
+
+	/** 매 프레임 소유 스레드에서 호출: 완료된 요청 마무리 + 주기적 상주 갱신 */
+	static void Tick();
+
+	/** 요청이 끝날 때까지 대기 (소유 스레드 전용) */
+	static void WaitForRequest(const FAssetLoadRequest& Request);
+	static void FlushAsyncLoading();
+
+	/**
+	 * 레벨이 참조하는 OBJ/텍스처를 병렬로 미리 로드하고 대기 (역직렬화의 동기 Load가 메모리에서 끝나도록)
+	 * @param LevelStrings 쿠킹된 레벨의 문자열 테이블 (문서의 모든 문자열이 중복 없이 들어 있음)
+	 */
+	static void PrefetchReferencedAssets(const TArray<FString>& LevelStrings);
+
+	/** 다음 Tick에서 상주 집합을 갱신 (레벨 교체 직후 등) */
+	static void RequestResidencyUpdate() { bResidencyDirty = true; }
+	static void UpdateResidency();
+
+	struct FStats
+	{
+		int32 NumPending = 0;
+		int32 NumRequested = 0;
+		int32 NumFailed = 0;
+		int32 NumEvictable = 0;
+		int32 NumReferenced = 0;
+		int32 NumHandlePinned = 0;		// UPROPERTY 참조는 없지만 TAssetHandle이 잡고 있어 해제하지 않은 수
+		uint64 ResidentBytes = 0;
+		int32 NumEvicted = 0;
+		uint64 EvictedBytes = 0;
+		double LastResidencyMS = 0.0;
+	};
+	static FStats GetStats();
+
+private:
+	struct FStreamingRequest;
+
+	/** 로드된 요청을 핸들 목록에 기록 (핸들이 살아 있는 동안 해제하지 않도록) */
+	static void TrackHandleRequest(const std::shared_ptr<FAssetLoadRequest>& Request);
+
+	/** Resource를 가리키는 핸들이 아직 있는지 (다 사라진 요청은 목록에서 정리) */
+	static bool IsHeldByHandle(UResourceBase* Resource);
+
+	static void RunWorkerStage(FStreamingRequest& Request);
+	static void FinalizeRequest(FStreamingRequest& Request);
+	static void FinalizeReadyRequests(double BudgetMS);
+
+	static FAssetStreamingSettings Settings;
+	static TArray<std::shared_ptr<FStreamingRequest>> PendingRequests;	// 요청 순서대로 마무리
+	static TMap<UResourceBase*, TArray<std::weak_ptr<FAssetLoadRequest>>> HandleRequests;	// 해제 가능한 리소스 -> 로드 완료 요청
+	static std::atomic<int32> NumWorkerTasksInFlight;
+	static bool bResidencyDirty;
+	static uint32 LastResidencyFrame;
+	static FStats Stats;
+};
+
+/**
+ * @class TAssetHandle
+ * @brief UResourceManager::LoadAsync가 반환하는 핸들입니다. 복사해도 같은 요청을 가리킵니다.
+ */
+template<typename T>
+class TAssetHandle
+{
+public:
+	TAssetHandle() = default;
+	explicit TAssetHandle(std::shared_ptr<FAssetLoadRequest> InRequest) : Request(std::move(InRequest)) {}
+
+	// 핸들(복사본 포함)이 하나라도 살아 있으면 FAssetStreamer가 리소스를 해제하지 않으므로 Get 결과는 핸들 수명 동안 유효
+
+	bool IsValid() const { return Request != nullptr; }
+	bool IsReady() const { return Request && Request->State != EAssetLoadState::Pending; }
+	bool HasFailed() const { return Request && Request->State == EAssetLoadState::Failed; }
+	T* Get() const { return (Request && Request->State == EAssetLoadState::Loaded) ? static_cast<T*>(Request->Resource) : nullptr; }
+	const FString& GetPath() const { static const FString Empty; return Request ? Request->Path : Empty; }
+
+	/** 완료되면 소유 스레드에서 호출 (이미 완료됐으면 즉시). 실패면 nullptr */
+	void OnLoaded(std::function<void(T*)> Callback) const
+	{
+		if (!Request)
+		{
+			return;
+		}
+		if (IsReady())
+		{
+			Callback(Get());
+			return;
+		}
+		Request->Callbacks.Add([Callback](UResourceBase* Resource) { Callback(static_cast<T*>(Resource)); });
+	}
+
+	/** 블로킹 대기 후 결과 반환 (소유 스레드 전용) */
+	T* WaitForCompletion() const
+	{
+		if (Request)
+		{
+			FAssetStreamer::WaitForRequest(*Request);
+		}
+		return Get();
+	}
+
+private:
+	std::shared_ptr<FAssetLoadRequest> Request;
+};
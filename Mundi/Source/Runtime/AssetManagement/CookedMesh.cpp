@@ -0,0 +1,377 @@
+#include "pch.h"
+#include "CookedMesh.h"
+#include "VertexData.h"
+#include "MeshBVH.h"
+#include "DerivedDataCache.h"
+#include <fstream>
+#include <stdexcept>
+
+using namespace CookedMesh;
+
+namespace
+{
+	inline uint64 AlignUp(uint64 Value, uint64 Alignment)
+	{
+		return (Value + Alignment - 1) & ~(Alignment - 1);
+	}
+
+	// 쿠킹 파일 한 개를 메모리에서 조립한 뒤 한 번에 기록
+	class FCookedMeshBuilder
+	{
+	public:
+		FStringRef AddString(const FString& Str)
+		{
+			FStringRef Ref;
+			Ref.Offset = static_cast<uint32>(Strings.size());
+			Ref.Length = static_cast<uint32>(Str.size());
+			Strings.append(Str);
+			return Ref;
+		}
+
+		template<typename T>
+		void AddBlob(EBlobType Type, const T* Data, uint32 Count)
+		{
+			Pending.Add({ Type, Count, reinterpret_cast<const uint8*>(Data), static_cast<uint64>(sizeof(T)) * Count });
+		}
+
+		bool Write(const FString& FilePath, FHeader Header)
+		{
+			AddBlob(EBlobType::Strings, Strings.data(), static_cast<uint32>(Strings.size()));
+
+			// 1. 오프셋 테이블 계산
+			TArray<FBlobEntry> Entries;
+			uint64 Cursor = AlignUp(sizeof(FHeader) + sizeof(FBlobEntry) * Pending.Num(), BlobAlignment);
+			for (const FPendingBlob& Blob : Pending)
+			{
+				Entries.Add({ Blob.Type, Blob.Count, Cursor, Blob.Size });
+				Cursor = AlignUp(Cursor + Blob.Size, BlobAlignment);
+			}
+
+			Header.Magic = Magic;
+			Header.Version = Version;
+			Header.FileSize = Cursor;
+			Header.NumBlobs = static_cast<uint32>(Entries.Num());
+
+			// 2. 파일 이미지 조립 (패딩은 0)
+			TArray<uint8> Image;
+			Image.SetNum(static_cast<int32>(Cursor), 0);
+			memcpy(Image.GetData(), &Header, sizeof(FHeader));
+			memcpy(Image.GetData() + sizeof(FHeader), Entries.GetData(), sizeof(FBlobEntry) * Entries.Num());
+			for (int32 Index = 0; Index < Pending.Num(); ++Index)
+			{
+				if (Pending[Index].Size > 0)
+				{
+					memcpy(Image.GetData() + Entries[Index].Offset, Pending[Index].Data, static_cast<size_t>(Pending[Index].Size));
+				}
+			}
+
+			// 3. 임시 파일에 쓰고 교체 (다른 스레드/프로세스가 반쯤 쓴 파일을 매핑하지 않도록)
+			const FString TempPath = FDerivedDataCache::GetTempPath(FilePath);
+			{
+				std::ofstream File(UTF8ToWide(TempPath), std::ios::binary | std::ios::out | std::ios::trunc);
+				if (!File)
+				{
+					return false;
+				}
+				File.write(reinterpret_cast<const char*>(Image.GetData()), static_cast<std::streamsize>(Image.Num()));
+				if (!File)
+				{
+					return false;
+				}
+			}
+			return FDerivedDataCache::CommitFile(TempPath, FilePath);
+		}
+
+	private:
+		struct FPendingBlob
+		{
+			EBlobType Type;
+			uint32 Count;
+			const uint8* Data;
+			uint64 Size;
+		};
+
+		TArray<FPendingBlob> Pending;
+		FString Strings;
+	};
+
+	uint64 GetElementSize(EBlobType Type, uint32 VertexStride)
+	{
+		switch (Type)
+		{
+		case EBlobType::Vertices:	return VertexStride;
+		case EBlobType::Indices:	return sizeof(uint32);
+		case EBlobType::Groups:		return sizeof(FCookedGroup);
+		case EBlobType::Bones:		return sizeof(FCookedBone);
+		case EBlobType::Strings:	return sizeof(char);
+		case EBlobType::BVHNodes:	return sizeof(FMeshBVHNode);
+		case EBlobType::BVHTriIndices:	return sizeof(uint32);
+		default:					return 0;
+		}
+	}
+
+	void AddGroups(FCookedMeshBuilder& Builder, const TArray<FGroupInfo>& GroupInfos, TArray<FCookedGroup>& OutGroups)
+	{
+		OutGroups.Reserve(GroupInfos.Num());
+		for (const FGroupInfo& Group : GroupInfos)
+		{
+			OutGroups.Add({ Group.StartIndex, Group.IndexCount, Builder.AddString(Group.InitialMaterialName) });
+		}
+		Builder.AddBlob(EBlobType::Groups, OutGroups.GetData(), static_cast<uint32>(OutGroups.Num()));
+	}
+
+	void ReadGroups(const FCookedMeshView& View, TArray<FGroupInfo>& OutGroupInfos)
+	{
+		uint32 NumGroups = 0;
+		const FCookedGroup* Groups = View.GetBlob<FCookedGroup>(EBlobType::Groups, NumGroups);
+		OutGroupInfos.SetNum(NumGroups);
+		for (uint32 Index = 0; Index < NumGroups; ++Index)
+		{
+			OutGroupInfos[Index].StartIndex = Groups[Index].StartIndex;
+			OutGroupInfos[Index].IndexCount = Groups[Index].IndexCount;
+			OutGroupInfos[Index].InitialMaterialName = View.GetString(Groups[Index].InitialMaterialName);
+		}
+	}
+
+	// 매핑된 블롭을 배열로 한 번에 복사 (trivially copyable이므로 memmove)
+	template<typename T>
+	void ReadArray(const FCookedMeshView& View, EBlobType Type, TArray<T>& OutArray)
+	{
+		uint32 Count = 0;
+		const T* Data = View.GetBlob<T>(Type, Count);
+		if (Data)
+		{
+			OutArray.assign(Data, Data + Count);
+		}
+		else
+		{
+			OutArray.Empty();
+		}
+	}
+}
+
+// ─────────────────────────────
+// FCookedMeshView
+// ─────────────────────────────
+
+const char* FCookedMeshView::Open(const FString& FilePath, EMeshType ExpectedType)
+{
+	Close();
+	for (const FBlobEntry*& Blob : Blobs)
+	{
+		Blob = nullptr;
+	}
+	Strings = nullptr;
+	StringsSize = 0;
+
+	if (!File.Open(FilePath))
+	{
+		return "Failed to map cooked mesh file.";
+	}
+
+	const uint64 FileSize = File.GetSize();
+	if (FileSize < sizeof(FHeader))
+	{
+		return "Cache corrupt: File is smaller than the header.";
+	}
+
+	const FHeader* CandidateHeader = reinterpret_cast<const FHeader*>(File.GetData());
+	if (CandidateHeader->Magic != Magic)
+	{
+		return "Cache incompatible: Not a cooked mesh file.";
+	}
+	if (CandidateHeader->Version != Version)
+	{
+		return "Cache incompatible: Cooked mesh version mismatch.";
+	}
+	if (CandidateHeader->MeshType != ExpectedType)
+	{
+		return "Cache incompatible: Mesh type mismatch.";
+	}
+	const uint32 ExpectedStride = (ExpectedType == EMeshType::Static) ? sizeof(FNormalVertex) : sizeof(FSkinnedVertex);
+	if (CandidateHeader->VertexStride != ExpectedStride)
+	{
+		return "Cache incompatible: Vertex layout changed.";
+	}
+	if (CandidateHeader->FileSize != FileSize
+		|| sizeof(FHeader) + sizeof(FBlobEntry) * static_cast<uint64>(CandidateHeader->NumBlobs) > FileSize)
+	{
+		return "Cache corrupt: File size mismatch.";
+	}
+
+	// 블롭 범위/정렬/원소 크기 검증
+	const FBlobEntry* Entries = reinterpret_cast<const FBlobEntry*>(File.GetData() + sizeof(FHeader));
+	for (uint32 Index = 0; Index < CandidateHeader->NumBlobs; ++Index)
+	{
+		const FBlobEntry& Entry = Entries[Index];
+		const uint32 TypeIndex = static_cast<uint32>(Entry.Type);
+		if (TypeIndex >= static_cast<uint32>(EBlobType::Count))
+		{
+			continue;	// 이후 버전에서 추가된 블롭은 무시
+		}
+
+		const uint64 ElementSize = GetElementSize(Entry.Type, CandidateHeader->VertexStride);
+		if (Entry.Offset % BlobAlignment != 0
+			|| Entry.Offset > FileSize || Entry.Size > FileSize - Entry.Offset
+			|| Entry.Size != ElementSize * Entry.Count)
+		{
+			return "Cache corrupt: Invalid blob entry.";
+		}
+		Blobs[TypeIndex] = &Entry;
+	}
+
+	if (const FBlobEntry* StringBlob = Blobs[static_cast<uint32>(EBlobType::Strings)])
+	{
+		Strings = reinterpret_cast<const char*>(File.GetData() + StringBlob->Offset);
+		StringsSize = StringBlob->Count;
+	}
+
+	Header = CandidateHeader;
+	return nullptr;
+}
+
+FString FCookedMeshView::GetString(const FStringRef& Ref) const
+{
+	if (Ref.Length == 0)
+	{
+		return FString();
+	}
+	if (!Strings || Ref.Offset > StringsSize || Ref.Length > StringsSize - Ref.Offset)
+	{
+		throw std::runtime_error("Cache corrupt: String reference out of range.");
+	}
+	return FString(Strings + Ref.Offset, Ref.Length);
+}
+
+// ─────────────────────────────
+// FCookedMeshSerializer
+// ─────────────────────────────
+
+bool FCookedMeshSerializer::Save(const FString& FilePath, const FStaticMesh& Mesh)
+{
+	FCookedMeshBuilder Builder;
+	FHeader Header = {};
+	Header.MeshType = EMeshType::Static;
+	Header.VertexStride = sizeof(FNormalVertex);
+	Header.bHasMaterial = Mesh.bHasMaterial ? 1 : 0;
+	Header.PathFileName = Builder.AddString(Mesh.PathFileName);
+
+	Builder.AddBlob(EBlobType::Vertices, Mesh.Vertices.data(), static_cast<uint32>(Mesh.Vertices.size()));
+	Builder.AddBlob(EBlobType::Indices, Mesh.Indices.data(), static_cast<uint32>(Mesh.Indices.size()));
+
+	TArray<FCookedGroup> Groups;
+	AddGroups(Builder, Mesh.GroupInfos, Groups);
+
+	if (Mesh.MeshBVH && !Mesh.MeshBVH->IsEmpty())
+	{
+		const TArray<FMeshBVHNode>& Nodes = Mesh.MeshBVH->GetNodes();
+		const TArray<uint32>& TriIndices = Mesh.MeshBVH->GetTriIndices();
+		Builder.AddBlob(EBlobType::BVHNodes, Nodes.GetData(), static_cast<uint32>(Nodes.Num()));
+		Builder.AddBlob(EBlobType::BVHTriIndices, TriIndices.GetData(), static_cast<uint32>(TriIndices.Num()));
+	}
+
+	return Builder.Write(FilePath, Header);
+}
+
+bool FCookedMeshSerializer::Save(const FString& FilePath, const FSkeletalMeshData& Mesh)
+{
+	FCookedMeshBuilder Builder;
+	FHeader Header = {};
+	Header.MeshType = EMeshType::Skeletal;
+	Header.VertexStride = sizeof(FSkinnedVertex);
+	Header.bHasMaterial = Mesh.bHasMaterial ? 1 : 0;
+	Header.PathFileName = Builder.AddString(Mesh.PathFileName);
+	Header.CacheFilePath = Builder.AddString(Mesh.CacheFilePath);
+	Header.SkeletonName = Builder.AddString(Mesh.Skeleton.Name);
+
+	Builder.AddBlob(EBlobType::Vertices, Mesh.Vertices.data(), static_cast<uint32>(Mesh.Vertices.size()));
+	Builder.AddBlob(EBlobType::Indices, Mesh.Indices.data(), static_cast<uint32>(Mesh.Indices.size()));
+
+	TArray<FCookedGroup> Groups;
+	AddGroups(Builder, Mesh.GroupInfos, Groups);
+
+	TArray<FCookedBone> Bones;
+	Bones.SetNum(static_cast<int32>(Mesh.Skeleton.Bones.size()));
+	for (int32 Index = 0; Index < Bones.Num(); ++Index)
+	{
+		const FBone& Bone = Mesh.Skeleton.Bones[Index];
+		Bones[Index].Name = Builder.AddString(Bone.Name);
+		Bones[Index].ParentIndex = Bone.ParentIndex;
+		Bones[Index].Pad = 0;
+		static_assert(sizeof(FMatrix) == sizeof(FCookedBone::BindPose), "FMatrix must be 16 floats");
+		memcpy(Bones[Index].BindPose, &Bone.BindPose, sizeof(FMatrix));
+		memcpy(Bones[Index].InverseBindPose, &Bone.InverseBindPose, sizeof(FMatrix));
+	}
+	Builder.AddBlob(EBlobType::Bones, Bones.GetData(), static_cast<uint32>(Bones.Num()));
+
+	return Builder.Write(FilePath, Header);
+}
+
+void FCookedMeshSerializer::Load(const FString& FilePath, FStaticMesh& OutMesh)
+{
+	FCookedMeshView View;
+	if (const char* Error = View.Open(FilePath, EMeshType::Static))
+	{
+		throw std::runtime_error(Error);
+	}
+
+	const FHeader& Header = View.GetHeader();
+	OutMesh.PathFileName = View.GetString(Header.PathFileName);
+	ReadArray(View, EBlobType::Vertices, OutMesh.Vertices);
+	ReadArray(View, EBlobType::Indices, OutMesh.Indices);
+	ReadGroups(View, OutMesh.GroupInfos);
+	OutMesh.bHasMaterial = Header.bHasMaterial != 0;
+
+	// BVH 블롭이 없거나 검증에 실패하면 비워두고, 피킹 시 ResourceManager가 지연 빌드
+	OutMesh.MeshBVH.reset();
+	uint32 NumNodes = 0;
+	uint32 NumTriIndices = 0;
+	const FMeshBVHNode* Nodes = View.GetBlob<FMeshBVHNode>(EBlobType::BVHNodes, NumNodes);
+	const uint32* TriIndices = View.GetBlob<uint32>(EBlobType::BVHTriIndices, NumTriIndices);
+	if (Nodes && TriIndices)
+	{
+		auto MeshBVH = std::make_shared<FMeshBVH>();
+		if (MeshBVH->InitializeFromCooked(Nodes, NumNodes, TriIndices, NumTriIndices, OutMesh.Vertices, OutMesh.Indices))
+		{
+			OutMesh.MeshBVH = std::move(MeshBVH);
+		}
+	}
+}
+
+void FCookedMeshSerializer::Load(const FString& FilePath, FSkeletalMeshData& OutMesh)
+{
+	FCookedMeshView View;
+	if (const char* Error = View.Open(FilePath, EMeshType::Skeletal))
+	{
+		throw std::runtime_error(Error);
+	}
+
+	const FHeader& Header = View.GetHeader();
+	ReadArray(View, EBlobType::Vertices, OutMesh.Vertices);
+	ReadArray(View, EBlobType::Indices, OutMesh.Indices);
+	ReadGroups(View, OutMesh.GroupInfos);
+	OutMesh.bHasMaterial = Header.bHasMaterial != 0;
+	OutMesh.CacheFilePath = View.GetString(Header.CacheFilePath);
+
+	// 엔트리는 같은 내용의 다른 경로와 공유될 수 있으므로 호출자가 정한 이름을 우선
+	if (OutMesh.Skeleton.Name.empty())
+	{
+		OutMesh.Skeleton.Name = View.GetString(Header.SkeletonName);
+	}
+
+	uint32 NumBones = 0;
+	const FCookedBone* Bones = View.GetBlob<FCookedBone>(EBlobType::Bones, NumBones);
+	OutMesh.Skeleton.Bones.resize(NumBones);
+	OutMesh.Skeleton.BoneNameToIndex.clear();
+	for (uint32 Index = 0; Index < NumBones; ++Index)
+	{
+		FBone& Bone = OutMesh.Skeleton.Bones[Index];
+		Bone.Name = View.GetString(Bones[Index].Name);
+		Bone.ParentIndex = Bones[Index].ParentIndex;
+		memcpy(&Bone.BindPose, Bones[Index].BindPose, sizeof(FMatrix));
+		memcpy(&Bone.InverseBindPose, Bones[Index].InverseBindPose, sizeof(FMatrix));
+
+		// BoneNameToIndex 재구축
+		OutMesh.Skeleton.BoneNameToIndex[Bone.Name] = static_cast<int32>(Index);
+	}
+}
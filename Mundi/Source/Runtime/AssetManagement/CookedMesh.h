@@ -0,0 +1,140 @@
+#pragma once
+#include "UEContainer.h"
+#include "WindowsMappedFile.h"
+
+struct FStaticMesh;
+struct FSkeletalMeshData;
+struct FNormalVertex;
+struct FSkinnedVertex;
+
+/**
+ * 쿠킹된 메시 캐시 포맷 (.obj.bin / FBX .bin)
+ *
+ * [FCookedMeshHeader 64B][FCookedBlobEntry x NumBlobs][Blob 0][Blob 1]...
+ *
+ * - 모든 블롭은 파일 시작 기준 16바이트 정렬 (FVector4/FMatrix가 alignas(16)이라 매핑된 뷰를 그대로 캐스팅 가능)
+ * - 정점/인덱스 블롭은 런타임 구조체(FNormalVertex/FSkinnedVertex/uint32)의 메모리 이미지 그대로 저장
+ * - 문자열은 Strings 블롭 하나에 모아두고 (Offset, Length)로 참조
+ * - 스태틱 메시는 피킹용 BVH(FMeshBVHNode[] + 삼각형 순서)를 함께 저장할 수 있음 (없으면 런타임에 지연 빌드)
+ * - Version이나 정점 크기가 다르면 로드 실패 -> 호출자가 캐시를 재생성
+ */
+namespace CookedMesh
+{
+	constexpr uint32 Magic = 0x4B434D4D;	// 'MMCK'
+	constexpr uint32 Version = 2;
+	constexpr uint64 BlobAlignment = 16;
+
+	enum class EMeshType : uint32
+	{
+		Static = 0,
+		Skeletal = 1,
+	};
+
+	enum class EBlobType : uint32
+	{
+		Vertices = 0,	// FNormalVertex[] 또는 FSkinnedVertex[]
+		Indices,		// uint32[]
+		Groups,			// FCookedGroup[]
+		Bones,			// FCookedBone[] (스켈레탈 전용)
+		Strings,		// char[]
+		BVHNodes,		// FMeshBVHNode[] (스태틱 전용, DFS 순서)
+		BVHTriIndices,	// uint32[] (BVH 리프가 참조하는 삼각형 순서)
+
+		Count
+	};
+
+	struct FStringRef
+	{
+		uint32 Offset = 0;
+		uint32 Length = 0;
+	};
+
+	struct FHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		EMeshType MeshType;
+		uint32 VertexStride;		// sizeof(정점 구조체), 구조체가 바뀌면 캐시 무효
+		uint64 FileSize;
+		uint32 NumBlobs;
+		uint32 bHasMaterial;
+		FStringRef PathFileName;
+		FStringRef CacheFilePath;
+		FStringRef SkeletonName;
+		uint32 Reserved[2];
+	};
+	static_assert(sizeof(FHeader) == 64, "Cooked mesh header must stay 64 bytes");
+
+	struct FBlobEntry
+	{
+		EBlobType Type;
+		uint32 Count;			// 원소 개수
+		uint64 Offset;			// 파일 시작 기준 (16바이트 정렬)
+		uint64 Size;			// 바이트 크기 (Count * 원소 크기)
+	};
+
+	struct FCookedGroup
+	{
+		uint32 StartIndex;
+		uint32 IndexCount;
+		FStringRef InitialMaterialName;
+	};
+
+	struct alignas(16) FCookedBone
+	{
+		FStringRef Name;
+		int32 ParentIndex;
+		uint32 Pad;
+		float BindPose[16];
+		float InverseBindPose[16];
+	};
+	static_assert(sizeof(FCookedBone) == 144, "FCookedBone must keep a 16-byte multiple size");
+}
+
+/**
+ * @class FCookedMeshView
+ * @brief 쿠킹된 메시 파일을 매핑한 채로 블롭을 타입 포인터로 노출합니다. (복사 없음)
+ *        Open이 성공하면 헤더/블롭 범위/정렬/원소 크기가 모두 검증된 상태입니다.
+ */
+class FCookedMeshView
+{
+public:
+	/** @return 실패 이유 (성공이면 nullptr) */
+	const char* Open(const FString& FilePath, CookedMesh::EMeshType ExpectedType);
+	void Close() { File.Close(); Header = nullptr; }
+
+	const CookedMesh::FHeader& GetHeader() const { return *Header; }
+
+	template<typename T>
+	const T* GetBlob(CookedMesh::EBlobType Type, uint32& OutCount) const
+	{
+		const CookedMesh::FBlobEntry* Entry = Blobs[static_cast<uint32>(Type)];
+		OutCount = Entry ? Entry->Count : 0;
+		return Entry ? reinterpret_cast<const T*>(File.GetData() + Entry->Offset) : nullptr;
+	}
+
+	FString GetString(const CookedMesh::FStringRef& Ref) const;
+
+private:
+	FWindowsMappedFile File;
+	const CookedMesh::FHeader* Header = nullptr;
+	const CookedMesh::FBlobEntry* Blobs[static_cast<uint32>(CookedMesh::EBlobType::Count)] = {};
+	const char* Strings = nullptr;
+	uint32 StringsSize = 0;
+};
+
+/**
+ * @class FCookedMeshSerializer
+ * @brief FStaticMesh / FSkeletalMeshData를 쿠킹 포맷으로 저장/로드합니다.
+ *        로드는 매핑된 블롭을 배열마다 한 번의 memcpy로 옮기며, 실패하면 std::runtime_error를 던집니다.
+ *        (기존 FWindowsBinReader 캐시 로드와 같은 예외 경로를 사용)
+ */
+class FCookedMeshSerializer
+{
+public:
+	static bool Save(const FString& FilePath, const FStaticMesh& Mesh);
+	static bool Save(const FString& FilePath, const FSkeletalMeshData& Mesh);
+
+	static void Load(const FString& FilePath, FStaticMesh& OutMesh);
+	static void Load(const FString& FilePath, FSkeletalMeshData& OutMesh);
+};
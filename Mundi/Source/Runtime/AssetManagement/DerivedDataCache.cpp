@@ -0,0 +1,411 @@
+#include "pch.h"
+#include "DerivedDataCache.h"
+#include "PathUtils.h"
+#include "PlatformTime.h"
+#include "TaskScheduler.h"
+#include "WindowsMappedFile.h"
+#include "WindowsMappedReader.h"
+#include "WindowsBinWriter.h"
+
+namespace
+{
+	constexpr uint32 SourceHashIndexVersion = 1;
+
+	constexpr uint64 Prime1 = 0x9E3779B185EBCA87ULL;
+	constexpr uint64 Prime2 = 0xC2B2AE3D27D4EB4FULL;
+	constexpr uint64 Prime3 = 0x165667B19E3779F9ULL;
+	constexpr uint64 Prime4 = 0x85EBCA77C2B2AE63ULL;
+	constexpr uint64 Prime5 = 0x27D4EB2F165667C5ULL;
+
+	inline uint64 RotateLeft(uint64 Value, int32 Bits)
+	{
+		return (Value << Bits) | (Value >> (64 - Bits));
+	}
+
+	inline uint64 Read64(const uint8* Data)
+	{
+		uint64 Value;
+		memcpy(&Value, Data, sizeof(Value));
+		return Value;
+	}
+
+	inline uint32 Read32(const uint8* Data)
+	{
+		uint32 Value;
+		memcpy(&Value, Data, sizeof(Value));
+		return Value;
+	}
+
+	inline uint64 Round(uint64 Acc, uint64 Input)
+	{
+		Acc += Input * Prime2;
+		Acc = RotateLeft(Acc, 31);
+		return Acc * Prime1;
+	}
+
+	inline uint64 MergeRound(uint64 Acc, uint64 Value)
+	{
+		Acc ^= Round(0, Value);
+		return Acc * Prime1 + Prime4;
+	}
+
+	const char* GetDerivedDataTypeName(EDerivedDataType Type)
+	{
+		switch (Type)
+		{
+		case EDerivedDataType::StaticMesh:		return "StaticMesh";
+		case EDerivedDataType::SkeletalMesh:	return "SkeletalMesh";
+		case EDerivedDataType::Animation:		return "Animation";
+		case EDerivedDataType::Texture:			return "Texture";
+		case EDerivedDataType::Level:			return "Level";
+		case EDerivedDataType::LuaScript:		return "LuaScript";
+		default:								return "Unknown";
+		}
+	}
+
+	bool GetFileStamp(const FString& Path, uint64& OutSize, int64& OutWriteTime)
+	{
+		std::error_code ErrorCode;
+		const fs::path FilePath(UTF8ToWide(Path));
+		OutSize = static_cast<uint64>(fs::file_size(FilePath, ErrorCode));
+		if (ErrorCode)
+		{
+			return false;
+		}
+		OutWriteTime = static_cast<int64>(fs::last_write_time(FilePath, ErrorCode).time_since_epoch().count());
+		return !ErrorCode;
+	}
+}
+
+// ─────────────────────────────
+// FDerivedDataKeyBuilder
+// ─────────────────────────────
+
+FDerivedDataKeyBuilder::FDerivedDataKeyBuilder(EDerivedDataType Type, uint32 CookVersion)
+	: State(0)
+{
+	const uint32 Header[2] = { static_cast<uint32>(Type), CookVersion };
+	Mix(Header, sizeof(Header));
+}
+
+FDerivedDataKeyBuilder& FDerivedDataKeyBuilder::AddSourceFile(const FString& Path)
+{
+	uint64 SourceHash = 0;
+	if (FDerivedDataCache::GetInstance().GetSourceHash(Path, SourceHash))
+	{
+		Mix(&SourceHash, sizeof(SourceHash));
+	}
+	else
+	{
+		bMissingSource = true;
+		AddString("<missing>");
+	}
+	return *this;
+}
+
+FDerivedDataKeyBuilder& FDerivedDataKeyBuilder::AddString(const FString& Value)
+{
+	const uint32 Length = static_cast<uint32>(Value.size());
+	Mix(&Length, sizeof(Length));
+	Mix(Value.data(), Value.size());
+	return *this;
+}
+
+FDerivedDataKeyBuilder& FDerivedDataKeyBuilder::AddUInt32(uint32 Value)
+{
+	Mix(&Value, sizeof(Value));
+	return *this;
+}
+
+void FDerivedDataKeyBuilder::Mix(const void* Data, size_t Size)
+{
+	State = FDerivedDataCache::HashBytes(Data, Size, State);
+}
+
+// ─────────────────────────────
+// FDerivedDataCache
+// ─────────────────────────────
+
+FDerivedDataCache& FDerivedDataCache::GetInstance()
+{
+	static FDerivedDataCache Instance;
+	return Instance;
+}
+
+FDerivedDataCache::FDerivedDataCache()
+{
+	LoadSourceHashIndex();
+}
+
+uint64 FDerivedDataCache::HashBytes(const void* Data, size_t Size, uint64 Seed)
+{
+	const uint8* Cursor = static_cast<const uint8*>(Data);
+	const uint8* const End = Cursor + Size;
+	uint64 Hash;
+
+	if (Size >= 32)
+	{
+		uint64 V1 = Seed + Prime1 + Prime2;
+		uint64 V2 = Seed + Prime2;
+		uint64 V3 = Seed;
+		uint64 V4 = Seed - Prime1;
+
+		const uint8* const Limit = End - 32;
+		do
+		{
+			V1 = Round(V1, Read64(Cursor));
+			V2 = Round(V2, Read64(Cursor + 8));
+			V3 = Round(V3, Read64(Cursor + 16));
+			V4 = Round(V4, Read64(Cursor + 24));
+			Cursor += 32;
+		} while (Cursor <= Limit);
+
+		Hash = RotateLeft(V1, 1) + RotateLeft(V2, 7) + RotateLeft(V3, 12) + RotateLeft(V4, 18);
+		Hash = MergeRound(Hash, V1);
+		Hash = MergeRound(Hash, V2);
+		Hash = MergeRound(Hash, V3);
+		Hash = MergeRound(Hash, V4);
+	}
+	else
+	{
+		Hash = Seed + Prime5;
+	}
+
+	Hash += static_cast<uint64>(Size);
+
+	while (Cursor + 8 <= End)
+	{
+		Hash ^= Round(0, Read64(Cursor));
+		Hash = RotateLeft(Hash, 27) * Prime1 + Prime4;
+		Cursor += 8;
+	}
+	if (Cursor + 4 <= End)
+	{
+		Hash ^= static_cast<uint64>(Read32(Cursor)) * Prime1;
+		Hash = RotateLeft(Hash, 23) * Prime2 + Prime3;
+		Cursor += 4;
+	}
+	while (Cursor < End)
+	{
+		Hash ^= (*Cursor) * Prime5;
+		Hash = RotateLeft(Hash, 11) * Prime1;
+		++Cursor;
+	}
+
+	Hash ^= Hash >> 33;
+	Hash *= Prime2;
+	Hash ^= Hash >> 29;
+	Hash *= Prime3;
+	Hash ^= Hash >> 32;
+	return Hash;
+}
+
+bool FDerivedDataCache::GetSourceHash(const FString& Path, uint64& OutHash)
+{
+	const FString Key = NormalizePath(Path);
+
+	uint64 FileSize = 0;
+	int64 WriteTime = 0;
+	if (!GetFileStamp(Key, FileSize, WriteTime))
+	{
+		return false;
+	}
+
+	// 1. 크기/수정 시간이 그대로면 이전 해시 재사용
+	{
+		std::lock_guard<std::mutex> Lock(IndexMutex);
+		if (const FSourceHashRecord* Record = SourceHashes.Find(Key))
+		{
+			if (Record->FileSize == FileSize && Record->WriteTime == WriteTime)
+			{
+				OutHash = Record->Hash;
+				++NumSourcesReused;
+				return true;
+			}
+		}
+	}
+
+	// 2. 내용 해시 (락 밖에서, 매핑된 뷰를 그대로 해시)
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	uint64 Hash = HashBytes(nullptr, 0);
+	if (FileSize > 0)
+	{
+		FWindowsMappedFile File(Key);
+		if (!File.IsOpen())
+		{
+			return false;
+		}
+		Hash = HashBytes(File.GetData(), File.GetSize());
+	}
+	HashCycles += FPlatformTime::Cycles64() - StartCycles;
+	NumBytesHashed += FileSize;
+	++NumSourcesHashed;
+
+	{
+		std::lock_guard<std::mutex> Lock(IndexMutex);
+		SourceHashes[Key] = { FileSize, WriteTime, Hash };
+		bIndexDirty = true;
+	}
+
+	OutHash = Hash;
+	return true;
+}
+
+void FDerivedDataCache::VerifySources(const TArray<FString>& Paths)
+{
+	const int32 NumChunks = FTaskScheduler::ComputeNumChunks(Paths.Num(), 4);
+	FTaskScheduler::ParallelFor(Paths.Num(), NumChunks, [&](int32 /*ChunkIndex*/, int32 Begin, int32 End)
+	{
+		uint64 UnusedHash;
+		for (int32 Index = Begin; Index < End; ++Index)
+		{
+			GetSourceHash(Paths[Index], UnusedHash);
+		}
+	});
+}
+
+FString FDerivedDataCache::GetEntryPath(EDerivedDataType Type, uint64 Key, const char* Extension) const
+{
+	char KeyText[17];
+	snprintf(KeyText, sizeof(KeyText), "%016llx", static_cast<unsigned long long>(Key));
+
+	const FString Directory = GCacheDir + "/DDC/" + GetDerivedDataTypeName(Type) + "/" + FString(KeyText, 2);
+	std::error_code ErrorCode;
+	fs::create_directories(fs::path(UTF8ToWide(Directory)), ErrorCode);
+
+	return Directory + "/" + KeyText + Extension;
+}
+
+FString FDerivedDataCache::GetTempPath(const FString& EntryPath)
+{
+	return EntryPath + "." + std::to_string(GetCurrentThreadId()) + ".tmp";
+}
+
+bool FDerivedDataCache::CommitFile(const FString& TempPath, const FString& EntryPath)
+{
+	if (MoveFileExW(UTF8ToWide(TempPath).c_str(), UTF8ToWide(EntryPath).c_str(), MOVEFILE_REPLACE_EXISTING))
+	{
+		return true;
+	}
+
+	UE_LOG("[DDC] Failed to commit '%s' (error %lu)", EntryPath.c_str(), GetLastError());
+	std::error_code ErrorCode;
+	fs::remove(fs::path(UTF8ToWide(TempPath)), ErrorCode);
+	return false;
+}
+
+void FDerivedDataCache::RecordLookup(EDerivedDataType Type, bool bHit)
+{
+	if (bHit)
+	{
+		++Hits[static_cast<int32>(Type)];
+	}
+	else
+	{
+		++Misses[static_cast<int32>(Type)];
+	}
+}
+
+void FDerivedDataCache::LogReport()
+{
+	UE_LOG("[DDC] Sources: %d hashed (%.1f MB, %.1f ms cpu), %d reused from index",
+		NumSourcesHashed.load(), NumBytesHashed.load() / (1024.0 * 1024.0),
+		FPlatformTime::ToMilliseconds(HashCycles.load()), NumSourcesReused.load());
+
+	for (int32 TypeIndex = 0; TypeIndex < static_cast<int32>(EDerivedDataType::Count); ++TypeIndex)
+	{
+		const int32 NumHits = Hits[TypeIndex].load();
+		const int32 NumMisses = Misses[TypeIndex].load();
+		if (NumHits + NumMisses == 0)
+		{
+			continue;
+		}
+		UE_LOG("[DDC]   %-12s %4d hit, %4d miss (%.0f%%)", GetDerivedDataTypeName(static_cast<EDerivedDataType>(TypeIndex)),
+			NumHits, NumMisses, 100.0 * NumHits / (NumHits + NumMisses));
+	}
+
+	SaveSourceHashIndex();
+}
+
+FString FDerivedDataCache::GetSourceHashIndexPath() const
+{
+	return GCacheDir + "/DDC/SourceHashes.bin";
+}
+
+void FDerivedDataCache::LoadSourceHashIndex()
+{
+	const FString IndexPath = GetSourceHashIndexPath();
+	try
+	{
+		FWindowsMappedReader Reader(IndexPath);
+		if (!Reader.IsOpen())
+		{
+			return;
+		}
+
+		uint32 Version = 0;
+		uint32 Count = 0;
+		Reader << Version;
+		if (Version != SourceHashIndexVersion)
+		{
+			return;
+		}
+		Reader << Count;
+		if (Count > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+		{
+			throw std::runtime_error("Cache corrupt: Source hash count is unreasonable.");
+		}
+
+		for (uint32 Index = 0; Index < Count; ++Index)
+		{
+			FString Path;
+			FSourceHashRecord Record;
+			Serialization::ReadString(Reader, Path);
+			Reader << Record.FileSize;
+			Reader << Record.WriteTime;
+			Reader << Record.Hash;
+			SourceHashes.Add(Path, Record);
+		}
+	}
+	catch (const std::exception& e)
+	{
+		// 메모는 힌트일 뿐이므로 버리고 다시 해시
+		UE_LOG("[DDC] Discarding source hash index: %s", e.what());
+		SourceHashes.Empty();
+	}
+}
+
+void FDerivedDataCache::SaveSourceHashIndex()
+{
+	std::lock_guard<std::mutex> Lock(IndexMutex);
+	if (!bIndexDirty)
+	{
+		return;
+	}
+
+	const FString IndexPath = GetSourceHashIndexPath();
+	std::error_code ErrorCode;
+	fs::create_directories(fs::path(UTF8ToWide(IndexPath)).parent_path(), ErrorCode);
+
+	const FString TempPath = GetTempPath(IndexPath);
+	{
+		FWindowsBinWriter Writer(TempPath);
+		uint32 Version = SourceHashIndexVersion;
+		uint32 Count = static_cast<uint32>(SourceHashes.size());
+		Writer << Version;
+		Writer << Count;
+		for (auto& Pair : SourceHashes)
+		{
+			Serialization::WriteString(Writer, Pair.first);
+			Writer << Pair.second.FileSize;
+			Writer << Pair.second.WriteTime;
+			Writer << Pair.second.Hash;
+		}
+		Writer.Close();
+	}
+
+	if (CommitFile(TempPath, IndexPath))
+	{
+		bIndexDirty = false;
+	}
+}
@@ -0,0 +1,109 @@
+#pragma once
+#include "UEContainer.h"
+#include <atomic>
+#include <mutex>
+
+/**
+ * 파생 데이터(쿠킹 메시, DDS, 애니메이션 캐시, 쿠킹 레벨, Lua 바이트코드) 종류
+ * 종류마다 DerivedDataCache/DDC/<종류>/ 아래에 저장되고 히트/미스를 따로 집계합니다.
+ */
+enum class EDerivedDataType : uint8
+{
+	StaticMesh,
+	SkeletalMesh,
+	Animation,
+	Texture,
+	Level,			// 쿠킹된 레벨/프리팹 (.scene / .prefab)
+	LuaScript,		// 컴파일된 Lua 청크 (.lua -> .luac)
+
+	Count
+};
+
+/**
+ * @class FDerivedDataKeyBuilder
+ * @brief (원본 내용 해시, 쿠커 버전, 임포트 설정)으로 64비트 DDC 키를 만듭니다.
+ *        같은 입력이면 어느 머신/경로에서든 같은 키가 나오므로 git checkout이나 복사 후에도 재쿠킹하지 않습니다.
+ */
+class FDerivedDataKeyBuilder
+{
+public:
+	FDerivedDataKeyBuilder(EDerivedDataType Type, uint32 CookVersion);
+
+	/** 파일 내용 해시를 키에 섞음 (파일이 없으면 '없음' 표시를 섞음) */
+	FDerivedDataKeyBuilder& AddSourceFile(const FString& Path);
+	FDerivedDataKeyBuilder& AddString(const FString& Value);
+	FDerivedDataKeyBuilder& AddUInt32(uint32 Value);
+
+	uint64 Build() const { return State; }
+
+	/** AddSourceFile로 넣은 파일이 모두 존재했는지 */
+	bool HasAllSources() const { return !bMissingSource; }
+
+private:
+	void Mix(const void* Data, size_t Size);
+
+	uint64 State;
+	bool bMissingSource = false;
+};
+
+/**
+ * @class FDerivedDataCache
+ * @brief 내용 주소 기반 로컬 파생 데이터 저장소입니다.
+ *
+ * - 엔트리 경로: GCacheDir/DDC/<종류>/<키 앞 2자리>/<16자리 키><확장자>
+ *   키가 같으면 경로도 같으므로 같은 내용의 에셋은 경로가 달라도 엔트리를 공유합니다.
+ * - 원본 해시는 (경로, 크기, 수정 시간)으로 메모해 DDC/SourceHashes.bin에 저장합니다.
+ *   수정 시간은 다시 해시할지 판단하는 힌트로만 쓰고, 캐시 유효성은 항상 내용 해시로 결정합니다.
+ * - 모든 함수는 스레드 안전합니다. (FAssetPreloader 워커에서 호출)
+ */
+class FDerivedDataCache
+{
+public:
+	static FDerivedDataCache& GetInstance();
+
+	/** XXH64 (파일 내용/키 해시용) */
+	static uint64 HashBytes(const void* Data, size_t Size, uint64 Seed = 0);
+
+	/** 원본 파일 내용 해시 (메모가 유효하면 파일을 읽지 않음). 파일이 없으면 false */
+	bool GetSourceHash(const FString& Path, uint64& OutHash);
+
+	/** 여러 원본을 FTaskScheduler로 병렬 해시해 메모를 채움 (시작 시 한 번) */
+	void VerifySources(const TArray<FString>& Paths);
+
+	/** 엔트리 경로 (디렉토리가 없으면 생성) */
+	FString GetEntryPath(EDerivedDataType Type, uint64 Key, const char* Extension) const;
+
+	/** 임시 파일에 다 쓴 뒤 엔트리 경로로 원자적으로 교체 (동시 쿠킹/중단 시 반쯤 쓴 엔트리 방지) */
+	static FString GetTempPath(const FString& EntryPath);
+	static bool CommitFile(const FString& TempPath, const FString& EntryPath);
+
+	void RecordLookup(EDerivedDataType Type, bool bHit);
+
+	/** 종류별 히트/미스와 원본 해시 통계를 로그로 출력하고, 바뀐 해시 메모를 저장 */
+	void LogReport();
+	void SaveSourceHashIndex();
+
+private:
+	FDerivedDataCache();
+
+	struct FSourceHashRecord
+	{
+		uint64 FileSize = 0;
+		int64 WriteTime = 0;
+		uint64 Hash = 0;
+	};
+
+	void LoadSourceHashIndex();
+	FString GetSourceHashIndexPath() const;
+
+	std::mutex IndexMutex;
+	TMap<FString, FSourceHashRecord> SourceHashes;
+	bool bIndexDirty = false;
+
+	std::atomic<int32> Hits[static_cast<int32>(EDerivedDataType::Count)] = {};
+	std::atomic<int32> Misses[static_cast<int32>(EDerivedDataType::Count)] = {};
+	std::atomic<int32> NumSourcesHashed{ 0 };
+	std::atomic<int32> NumSourcesReused{ 0 };
+	std::atomic<uint64> NumBytesHashed{ 0 };
+	std::atomic<uint64> HashCycles{ 0 };
+};
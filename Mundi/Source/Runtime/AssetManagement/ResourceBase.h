@@ -18,7 +18,29 @@ public:
 	std::filesystem::file_time_type GetLastModifiedTime() const { return LastModifiedTime; }
 	void SetLastModifiedTime(std::filesystem::file_time_type InTime) { LastModifiedTime = InTime; }
 
+	// Residency (FAssetStreamer)
+	// 상주 메모리 크기 (CPU + GPU). 예산 계산에 사용하며 0이면 집계하지 않음
+	virtual uint64 GetResidentBytes() const { return 0; }
+
+	// 스트리밍 모드에서 파일로부터 로드된 메시만 true. 참조가 없으면 예산 초과 시 해제될 수 있음
+	bool IsEvictable() const { return bEvictable; }
+	void SetEvictable(bool bInEvictable) { bEvictable = bInEvictable; }
+
+	// 마지막 상주 갱신에서 이 리소스를 가리키던 UPROPERTY 수
+	int32 GetNumReferencers() const { return NumReferencers; }
+	void SetNumReferencers(int32 InNumReferencers) { NumReferencers = InNumReferencers; }
+
+	// LRU 순서용 (FAssetStreamer::Tick마다 ResidencyFrame 증가)
+	uint32 GetLastUsedFrame() const { return LastUsedFrame; }
+	void MarkUsed() { LastUsedFrame = ResidencyFrame; }
+
+	static inline uint32 ResidencyFrame = 0;
+
 protected:
 	FString FilePath;	// 원본 파일의 경로이자, UResourceManager에 등록된 Key 
 	std::filesystem::file_time_type LastModifiedTime;
+
+	bool bEvictable = false;
+	int32 NumReferencers = 0;
+	uint32 LastUsedFrame = 0;
 };
\ No newline at end of file
@@ -35,6 +35,7 @@ void UResourceManager::Initialize(ID3D11Device* InDevice, ID3D11DeviceContext* I
 {
     Device = InDevice;
     Resources.SetNum(static_cast<uint8>(EResourceType::End));
+    KnownAssetPaths.SetNum(static_cast<uint8>(EResourceType::End));
 
     Context = InContext;
     //CreateGridMesh(GRIDNUM,"Grid");
@@ -119,6 +120,7 @@ void UResourceManager::Clear()
         Array.Empty();
     }
     Resources.Empty();
+    KnownAssetPaths.Empty();
 
     // Instance lifetime is managed by ObjectFactory
 }
@@ -138,6 +140,10 @@ FMeshBVH* UResourceManager::GetOrBuildMeshBVH(const FString& ObjPath, const FSta
     if (!StaticMeshAsset)
         return nullptr;
 
+    // 쿠킹 캐시에서 함께 로드된 BVH는 에셋이 소유
+    if (StaticMeshAsset->MeshBVH && !StaticMeshAsset->MeshBVH->IsEmpty())
+        return StaticMeshAsset->MeshBVH.get();
+
     FMeshBVH* NewBVH = new FMeshBVH();
     NewBVH->Build(StaticMeshAsset->Vertices, StaticMeshAsset->Indices);
     MeshBVHCache.Add(ObjPath, NewBVH);
@@ -164,6 +170,87 @@ void UResourceManager::SetAudioFiles()
     Sounds = GetAll<USound>();
 }
 
+void UResourceManager::RegisterAssetPath(EResourceType Type, const FString& InFilePath)
+{
+    const uint8 TypeIndex = static_cast<uint8>(Type);
+    if (TypeIndex < KnownAssetPaths.size())
+    {
+        KnownAssetPaths[TypeIndex].Add(NormalizePath(InFilePath));
+    }
+}
+
+TArray<UResourceBase*> UResourceManager::GetResidentResources(EResourceType Type)
+{
+    TArray<UResourceBase*> Result;
+    const uint8 TypeIndex = static_cast<uint8>(Type);
+    if (TypeIndex >= Resources.size())
+    {
+        return Result;
+    }
+
+    Result.Reserve(Resources[TypeIndex].size());
+    for (auto& Pair : Resources[TypeIndex])
+    {
+        if (Pair.second)
+        {
+            Result.Add(Pair.second);
+        }
+    }
+    return Result;
+}
+
+bool UResourceManager::EvictResource(UResourceBase* Resource)
+{
+    if (!Resource)
+    {
+        return false;
+    }
+
+    const EResourceType Type =
+        Resource->IsA<UStaticMesh>() ? EResourceType::StaticMesh :
+        Resource->IsA<USkeletalMesh>() ? EResourceType::SkeletalMesh : EResourceType::None;
+    if (Type == EResourceType::None)
+    {
+        return false;
+    }
+
+    const FString Path = Resource->GetFilePath();
+    TMap<FString, UResourceBase*>& TypeResources = Resources[static_cast<uint8>(Type)];
+    auto Iter = TypeResources.find(Path);
+    if (Iter == TypeResources.end() || Iter->second != Resource)
+    {
+        return false;
+    }
+    TypeResources.erase(Iter);
+
+    if (Type == EResourceType::StaticMesh)
+    {
+        UStaticMesh* StaticMesh = static_cast<UStaticMesh*>(Resource);
+
+        // 피킹용 BVH는 에셋 경로로 캐싱됨
+        const FString AssetPath = StaticMesh->GetAssetPathFileName();
+        if (FMeshBVH** BVH = MeshBVHCache.Find(AssetPath))
+        {
+            delete *BVH;
+            MeshBVHCache.erase(AssetPath);
+        }
+
+        StaticMesh->SetStaticMeshAsset(nullptr);
+        FObjManager::ReleaseStaticMeshAsset(Path);
+        DeleteObject(StaticMesh);
+        SetStaticMeshs();
+    }
+    else
+    {
+        DeleteObject(Resource);
+        SetSkeletalMeshs();
+    }
+
+    // 다시 선택할 수 있도록 경로는 레지스트리에 남겨 둠
+    RegisterAssetPath(Type, Path);
+    return true;
+}
+
 
 void UResourceManager::CreateAxisMesh(float Length, const FString& FilePath)
 {
@@ -13,6 +13,7 @@
 #include "SkeletalMesh.h"
 #include "AnimSequence.h"
 #include "../Engine/Particles/ParticleSystem.h"
+#include "AssetStreamer.h"
 // ... 기타 include ...
 
 // --- 전방 선언 ---
@@ -43,6 +44,10 @@ public:
 	template<typename T, typename... Args>
 	T* Load(const FString& InFilePath, Args&&... InArgs);
 
+	// 비동기 로드 핸들 (이미 상주하면 완료된 핸들). 완료는 FAssetStreamer::Tick에서 소유 스레드로 전달
+	template<typename T>
+	TAssetHandle<T> LoadAsync(const FString& InFilePath);
+
 	template<typename T>
 	bool Add(const FString& InFilePath, UObject* InObject);
 
@@ -62,6 +67,13 @@ public:
 	template<typename T>
 	EResourceType GetResourceType();
 
+	// --- 에셋 레지스트리 / 상주 관리 (FAssetStreamer) ---
+	// 아직 로드하지 않은 에셋 경로 (스트리밍 모드에서 에디터 선택 목록 등에 노출)
+	void RegisterAssetPath(EResourceType Type, const FString& InFilePath);
+	TArray<UResourceBase*> GetResidentResources(EResourceType Type);
+	// 리소스 맵/메시 캐시/BVH 캐시에서 제거하고 삭제. 참조가 없을 때만 호출해야 함
+	bool EvictResource(UResourceBase* Resource);
+
 	// --- 헬퍼 및 유틸리티 ---
 	ID3D11Device* GetDevice() { return Device; }
 	ID3D11DeviceContext* GetDeviceContext() { return Context; }
@@ -116,6 +128,9 @@ protected:
 	//Resource Type의 개수만큼 Array 생성 및 저장
 	TArray<TMap<FString, UResourceBase*>> Resources;
 
+	// Resource Type별 디스크에서 발견한 경로 (로드 여부와 무관)
+	TArray<TSet<FString>> KnownAssetPaths;
+
 	TMap<FString, TArray<D3D11_INPUT_ELEMENT_DESC>> ShaderToInputLayoutMap;
 	TMap<FString, FString> TextureToShaderMap;
 
@@ -214,6 +229,7 @@ inline T* UResourceManager::Load(const FString& InFilePath, Args && ...InArgs)
 			return Shader;
 		}
 
+		(*iter).second->MarkUsed();
 		return static_cast<T*>((*iter).second);
 	}
 	else//없으면 해당 리소스의 Load실행
@@ -221,11 +237,39 @@ inline T* UResourceManager::Load(const FString& InFilePath, Args && ...InArgs)
 		T* Resource = NewObject<T>();
 		Resource->Load(NormalizedPath, Device, std::forward<Args>(InArgs)...);
 		Resource->SetFilePath(NormalizedPath);
+		Resource->SetEvictable(FAssetStreamer::IsEnabled() && FAssetStreamer::IsEvictableType(static_cast<EResourceType>(typeIndex)));
+		Resource->MarkUsed();
 		Resources[typeIndex][NormalizedPath] = Resource;
 		return Resource;
 	}
 }
 
+template<typename T>
+TAssetHandle<T> UResourceManager::LoadAsync(const FString& InFilePath)
+{
+	if (InFilePath.empty())
+	{
+		return TAssetHandle<T>();
+	}
+
+	FString NormalizedPath = NormalizePath(InFilePath);
+	const EResourceType Type = GetResourceType<T>();
+
+	if (T* Resident = Get<T>(NormalizedPath))
+	{
+		Resident->MarkUsed();
+		return TAssetHandle<T>(FAssetStreamer::MakeCompletedRequest(Type, NormalizedPath, Resident));
+	}
+
+	// 워커 단계가 없는 타입은 바로 동기 로드
+	if (!FAssetStreamer::SupportsAsyncLoad(Type))
+	{
+		return TAssetHandle<T>(FAssetStreamer::MakeCompletedRequest(Type, NormalizedPath, Load<T>(NormalizedPath)));
+	}
+
+	return TAssetHandle<T>(FAssetStreamer::RequestLoad(Type, NormalizedPath));
+}
+
 template<>
 inline UShader* UResourceManager::Load(const FString& InFilePath, TArray<FShaderMacro>& InMacros)
 {
@@ -328,5 +372,17 @@ TArray<FString> UResourceManager::GetAllFilePaths()
 			}
 		}
 	}
+
+	// 스트리밍 모드에서 아직 로드되지 않은 에셋도 선택할 수 있도록
+	if (TypeIndex < KnownAssetPaths.size())
+	{
+		for (const FString& Path : KnownAssetPaths[TypeIndex])
+		{
+			if (Resources[TypeIndex].find(Path) == Resources[TypeIndex].end())
+			{
+				Paths.push_back(Path);
+			}
+		}
+	}
 	return Paths;
 }
@@ -42,6 +42,18 @@ void USkeletalMesh::Load(const FString& InFilePath, ID3D11Device* InDevice)
     VertexStride = sizeof(FVertexDynamic);
 }
 
+uint64 USkeletalMesh::GetResidentBytes() const
+{
+    // 인덱스 버퍼 + CPU 메시 데이터 (정점 버퍼는 컴포넌트가 소유)
+    uint64 Bytes = static_cast<uint64>(IndexCount) * sizeof(uint32);
+    if (Data)
+    {
+        Bytes += Data->Vertices.size() * sizeof(FSkinnedVertex) + Data->Indices.size() * sizeof(uint32);
+        Bytes += Data->Skeleton.Bones.size() * sizeof(FBone);
+    }
+    return Bytes;
+}
+
 void USkeletalMesh::ReleaseResources()
 {
     if (IndexBuffer)
@@ -197,6 +197,17 @@ void UStaticMesh::CreateLocalBound(const FStaticMesh* InStaticMesh)
     LocalBound = FAABB(Min, Max);
 }
 
+uint64 UStaticMesh::GetResidentBytes() const
+{
+    // GPU 버퍼 + ObjManager가 들고 있는 CPU 사본 (BVH/피킹용)
+    uint64 Bytes = static_cast<uint64>(VertexCount) * VertexStride + static_cast<uint64>(IndexCount) * sizeof(uint32);
+    if (StaticMeshAsset)
+    {
+        Bytes += StaticMeshAsset->Vertices.size() * sizeof(FNormalVertex) + StaticMeshAsset->Indices.size() * sizeof(uint32);
+    }
+    return Bytes;
+}
+
 void UStaticMesh::ReleaseResources()
 {
     if (VertexBuffer)
@@ -38,6 +38,8 @@ public:
     
     const FString& GetCacheFilePath() const { return CacheFilePath; }
 
+    uint64 GetResidentBytes() const override;
+
 private:
     void CreateVertexBuffer(FMeshData* InMeshData, ID3D11Device* InDevice, EVertexLayoutType InVertexType);
 	void CreateVertexBuffer(FStaticMesh* InStaticMesh, ID3D11Device* InDevice, EVertexLayoutType InVertexType);
@@ -1,9 +1,11 @@
 ﻿#include "pch.h"
 #include "Texture.h"
 #include "TextureConverter.h"
+#include "DerivedDataCache.h"
 #include "DDSTextureLoader.h"
 #include "WICTextureLoader.h"
 #include <filesystem>
+#include <fstream>
 
 IMPLEMENT_CLASS(UTexture)
 
@@ -24,6 +26,70 @@ void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 	assert(InDevice);
 
 	// 실제로 로드할 파일 경로 결정
+	FString ActualLoadPath = ResolveLoadPath(InFilePath, bSRGB, CacheFilePath);
+
+	// UTF-8 -> UTF-16 (Windows) 안전 변환: 한글/비ASCII 경로 대응
+	int needed = ::MultiByteToWideChar(CP_UTF8, 0, ActualLoadPath.c_str(), -1, nullptr, 0);
+	std::wstring WFilePath;
+	if (needed > 0)
+	{
+		WFilePath.resize(needed - 1);
+		::MultiByteToWideChar(CP_UTF8, 0, ActualLoadPath.c_str(), -1, WFilePath.data(), needed);
+	}
+	else
+	{
+		int needA = ::MultiByteToWideChar(CP_ACP, 0, ActualLoadPath.c_str(), -1, nullptr, 0);
+		if (needA > 0)
+		{
+			WFilePath.resize(needA - 1);
+			::MultiByteToWideChar(CP_ACP, 0, ActualLoadPath.c_str(), -1, WFilePath.data(), needA);
+		}
+	}
+
+	// 최종 로드할 파일의 확장자 재확인
+	std::filesystem::path LoadPath(UTF8ToWide(ActualLoadPath));
+	std::wstring ext = LoadPath.has_extension() ? LoadPath.extension().wstring() : L"";
+	for (auto& ch : ext) ch = static_cast<wchar_t>(::towlower(ch));
+
+	HRESULT hr = E_FAIL;
+	if (ext == L".dds")
+	{
+		// DDS 로딩: Ex 버전 사용하여 sRGB 지정
+		hr = DirectX::CreateDDSTextureFromFileEx(
+			InDevice,
+			WFilePath.c_str(),
+			0, // maxsize (0 = no limit)
+			D3D11_USAGE_DEFAULT,
+			D3D11_BIND_SHADER_RESOURCE,
+			0, // cpuAccessFlags
+			0, // miscFlags
+			bSRGB ? DirectX::DDS_LOADER_FORCE_SRGB : DirectX::DDS_LOADER_DEFAULT,
+			reinterpret_cast<ID3D11Resource**>(&Texture2D),
+			&ShaderResourceView
+		);
+	}
+	else
+	{
+		// WIC 로딩: Ex 버전 사용하여 sRGB 지정
+		hr = DirectX::CreateWICTextureFromFileEx(
+			InDevice,
+			WFilePath.c_str(),
+			0, // maxsize (0 = no limit)
+			D3D11_USAGE_DEFAULT,
+			D3D11_BIND_SHADER_RESOURCE,
+			0, // cpuAccessFlags
+			0, // miscFlags
+			bSRGB ? DirectX::WIC_LOADER_FORCE_SRGB : DirectX::WIC_LOADER_DEFAULT,
+			reinterpret_cast<ID3D11Resource**>(&Texture2D),
+			&ShaderResourceView
+		);
+	}
+
+	ApplyLoadResult(hr, ActualLoadPath);
+}
+
+FString UTexture::ResolveLoadPath(const FString& InFilePath, bool bSRGB, FString& OutCacheFilePath)
+{
 	FString ActualLoadPath = InFilePath;
 
 #ifdef USE_DDS_CACHE
@@ -37,16 +103,36 @@ void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 		// DDS가 아닌 경우 → DDS 캐시 확인 및 생성
 		if (Extension != ".dds")
 		{
-			FString DDSCachePath = FTextureConverter::GetDDSCachePath(InFilePath);
+			// DDC 키: 원본 내용 해시 + 변환 설정 (FBX 임포트로 .fbm 텍스처가 재추출돼도 내용이 같으면 재변환 안 함)
+			DXGI_FORMAT TargetFormat = FTextureConverter::GetRecommendedFormat(true, bSRGB); // 알파는 일단 true로 가정
+			FDerivedDataKeyBuilder KeyBuilder(EDerivedDataType::Texture, FTextureConverter::CookVersion);
+			KeyBuilder.AddUInt32(static_cast<uint32>(TargetFormat));
+			KeyBuilder.AddUInt32(FTextureConverter::GetGenerateMipmaps() ? 1 : 0);
+			KeyBuilder.AddSourceFile(InFilePath);
 
-			// 캐시 유효성 검사
-			if (FTextureConverter::ShouldRegenerateDDS(InFilePath, DDSCachePath))
+			FDerivedDataCache& DDC = FDerivedDataCache::GetInstance();
+			FString DDSCachePath = DDC.GetEntryPath(EDerivedDataType::Texture, KeyBuilder.Build(), ".dds");
+
+			// 캐시 유효성 검사 (원본이 없으면 변환 없이 원본 경로로 로드 시도 -> 기존과 같은 에러 로그)
+			const bool bHasSource = KeyBuilder.HasAllSources();
+			const bool bCacheHit = bHasSource && std::filesystem::exists(UTF8ToWide(DDSCachePath));
+			if (bHasSource)
+			{
+				DDC.RecordLookup(EDerivedDataType::Texture, bCacheHit);
+			}
+
+			if (!bHasSource)
+			{
+				DDSCachePath.clear();
+			}
+			else if (!bCacheHit)
 			{
 				UE_LOG("[UTexture] Converting texture to DDS: %s", InFilePath.c_str());
 
-					// DDS 변환 시도 (bSRGB 파라미터 전달)
-				DXGI_FORMAT TargetFormat = FTextureConverter::GetRecommendedFormat(true, bSRGB); // 알파는 일단 true로 가정
-				if (FTextureConverter::ConvertToDDS(InFilePath, DDSCachePath, TargetFormat))
+				// 임시 파일로 변환한 뒤 교체 (워커 스레드끼리 같은 엔트리를 만들어도 반쯤 쓴 DDS를 읽지 않음)
+				const FString TempPath = FDerivedDataCache::GetTempPath(DDSCachePath);
+				if (FTextureConverter::ConvertToDDS(InFilePath, TempPath, TargetFormat)
+					&& FDerivedDataCache::CommitFile(TempPath, DDSCachePath))
 				{
 					ActualLoadPath = DDSCachePath; // DDS 캐시 사용
 				}
@@ -64,8 +150,7 @@ void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 			}
 
 			// 경로 정규화: 모든 백슬래시를 슬래시로 변환하여 일관성 유지
-			FString NormalizedCachePath = NormalizePath(DDSCachePath);
-			CacheFilePath = NormalizedCachePath;   // 실제 로드된 경로 저장 (DDS 캐시 사용 시 DDS 경로, 정규화됨)
+			OutCacheFilePath = NormalizePath(DDSCachePath);   // 실제 로드된 경로 저장 (DDS 캐시 사용 시 DDS 경로, 정규화됨)
 		}
 	}
 #else
@@ -73,36 +158,49 @@ void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 	UE_LOG("[UTexture] Loading original texture (DDS cache disabled): %s", InFilePath.c_str());
 #endif
 
-	// UTF-8 -> UTF-16 (Windows) 안전 변환: 한글/비ASCII 경로 대응
-	int needed = ::MultiByteToWideChar(CP_UTF8, 0, ActualLoadPath.c_str(), -1, nullptr, 0);
-	std::wstring WFilePath;
-	if (needed > 0)
+	return ActualLoadPath;
+}
+
+bool UTexture::PrepareSource(const FString& InFilePath, bool bSRGB, FSourceData& OutSource)
+{
+	// DDS 변환(디코딩 + 블록 압축)이 필요하면 여기서 수행됨
+	OutSource.LoadPath = ResolveLoadPath(InFilePath, bSRGB, OutSource.CacheFilePath);
+
+	std::ifstream File(std::filesystem::path(UTF8ToWide(OutSource.LoadPath)), std::ios::binary | std::ios::ate);
+	if (!File.is_open())
 	{
-		WFilePath.resize(needed - 1);
-		::MultiByteToWideChar(CP_UTF8, 0, ActualLoadPath.c_str(), -1, WFilePath.data(), needed);
+		UE_LOG("[UTexture] Failed to open texture: %s", OutSource.LoadPath.c_str());
+		return false;
 	}
-	else
+
+	const std::streamsize FileSize = File.tellg();
+	File.seekg(0, std::ios::beg);
+	OutSource.FileData.SetNum(static_cast<int32>(FileSize));
+	return FileSize > 0 && File.read(reinterpret_cast<char*>(OutSource.FileData.GetData()), FileSize).good();
+}
+
+void UTexture::LoadFromSource(const FSourceData& InSource, ID3D11Device* InDevice, bool bSRGB)
+{
+	assert(InDevice);
+
+	CacheFilePath = InSource.CacheFilePath;
+	if (InSource.FileData.IsEmpty())
 	{
-		int needA = ::MultiByteToWideChar(CP_ACP, 0, ActualLoadPath.c_str(), -1, nullptr, 0);
-		if (needA > 0)
-		{
-			WFilePath.resize(needA - 1);
-			::MultiByteToWideChar(CP_ACP, 0, ActualLoadPath.c_str(), -1, WFilePath.data(), needA);
-		}
+		UE_LOG("[UTexture] Failed to load texture: %s (empty source)", InSource.LoadPath.c_str());
+		return;
 	}
 
-	// 최종 로드할 파일의 확장자 재확인
-	std::filesystem::path LoadPath(UTF8ToWide(ActualLoadPath));
+	std::filesystem::path LoadPath(UTF8ToWide(InSource.LoadPath));
 	std::wstring ext = LoadPath.has_extension() ? LoadPath.extension().wstring() : L"";
 	for (auto& ch : ext) ch = static_cast<wchar_t>(::towlower(ch));
 
 	HRESULT hr = E_FAIL;
 	if (ext == L".dds")
 	{
-		// DDS 로딩: Ex 버전 사용하여 sRGB 지정
-		hr = DirectX::CreateDDSTextureFromFileEx(
+		hr = DirectX::CreateDDSTextureFromMemoryEx(
 			InDevice,
-			WFilePath.c_str(),
+			InSource.FileData.GetData(),
+			InSource.FileData.Num(),
 			0, // maxsize (0 = no limit)
 			D3D11_USAGE_DEFAULT,
 			D3D11_BIND_SHADER_RESOURCE,
@@ -115,10 +213,10 @@ void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 	}
 	else
 	{
-		// WIC 로딩: Ex 버전 사용하여 sRGB 지정
-		hr = DirectX::CreateWICTextureFromFileEx(
+		hr = DirectX::CreateWICTextureFromMemoryEx(
 			InDevice,
-			WFilePath.c_str(),
+			InSource.FileData.GetData(),
+			InSource.FileData.Num(),
 			0, // maxsize (0 = no limit)
 			D3D11_USAGE_DEFAULT,
 			D3D11_BIND_SHADER_RESOURCE,
@@ -130,7 +228,12 @@ void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 		);
 	}
 
-	if (SUCCEEDED(hr))
+	ApplyLoadResult(hr, InSource.LoadPath);
+}
+
+void UTexture::ApplyLoadResult(HRESULT InResult, const FString& InLoadPath)
+{
+	if (SUCCEEDED(InResult))
 	{
 		if (Texture2D)
 		{
@@ -143,7 +246,7 @@ void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 	}
 	else
 	{
-		UE_LOG("[UTexture] Failed to load texture: %s (HRESULT: 0x%08X)", ActualLoadPath.c_str(), hr);
+		UE_LOG("[UTexture] Failed to load texture: %s (HRESULT: 0x%08X)", InLoadPath.c_str(), InResult);
 	}
 }
 
@@ -14,6 +14,20 @@ public:
 	// bSRGB: true = sRGB 포맷 사용 (Diffuse/Albedo 텍스처), false = Linear 포맷 (Normal/Data 텍스처)
 	void Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRGB = true);
 
+	// 디바이스 없이 준비할 수 있는 단계 (DDS 변환/캐시 확인 + 파일 읽기)
+	struct FSourceData
+	{
+		FString LoadPath;			// 실제 로드할 파일 (DDS 캐시 또는 원본)
+		FString CacheFilePath;
+		TArray<uint8> FileData;
+	};
+
+	// Load를 준비/생성 두 단계로 나눈 것 (FAssetPreloader가 준비 단계를 워커 스레드에서 수행)
+	// PrepareSource: 디바이스를 사용하지 않으므로 워커 스레드에서 호출 가능
+	// LoadFromSource: 메모리에서 텍스처/SRV 생성 (디바이스 소유 스레드 전용)
+	static bool PrepareSource(const FString& InFilePath, bool bSRGB, FSourceData& OutSource);
+	void LoadFromSource(const FSourceData& InSource, ID3D11Device* InDevice, bool bSRGB = true);
+
 	ID3D11ShaderResourceView* GetShaderResourceView() const { return ShaderResourceView; }
 	ID3D11Texture2D* GetTexture2D() const { return Texture2D; }
 
@@ -27,6 +41,10 @@ public:
 	void ReleaseResources();
 
 private:
+	// DDS 캐시가 켜져 있으면 필요 시 변환 후 캐시 경로를, 아니면 원본 경로를 반환
+	static FString ResolveLoadPath(const FString& InFilePath, bool bSRGB, FString& OutCacheFilePath);
+	void ApplyLoadResult(HRESULT InResult, const FString& InLoadPath);
+
 	FString CacheFilePath;  // 캐시된 소스 경로 (예: DerivedDataCache/cube_texture.png.dds)
 
 	ID3D11Texture2D* Texture2D;
@@ -33,15 +33,10 @@ public:
 	);
 
 	/**
-	 * @brief DDS 캐시 재생성이 필요한지 확인
-	 * @param SourcePath 원본 텍스처 파일 경로
-	 * @param DDSPath 캐시된 DDS 파일 경로
-	 * @return 캐시가 유효하지 않거나 없으면 true
+	 * @brief 변환 로직(리사이즈/밉맵/압축 옵션)이 바뀌면 올려서 기존 DDS 캐시를 무효화
+	 * @details DDS 캐시 유효성은 FDerivedDataCache 키(원본 내용 해시 + 포맷 + 이 버전)로 판단합니다.
 	 */
-	static bool ShouldRegenerateDDS(
-		const FString& SourcePath,
-		const FString& DDSPath
-	);
+	static constexpr uint32 CookVersion = 1;
 
 	/**
 	 * @brief 주어진 원본 텍스처에 대한 DDS 캐시 경로 생성
@@ -62,6 +57,7 @@ public:
 	 * @param bGenerateMips 밉맵 생성 여부 (기본값: true)
 	 */
 	static void SetGenerateMipmaps(bool bGenerateMips);
+	static bool GetGenerateMipmaps() { return bShouldGenerateMipmaps; }
 
 	/**
 	 * @brief 이미지 특성에 따라 권장 압축 포맷 반환
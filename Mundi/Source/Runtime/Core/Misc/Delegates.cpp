@@ -0,0 +1,140 @@
+#include "pch.h"
+#include "Delegates.h"
+#include "PlatformTime.h"
+
+namespace
+{
+	// 비교용 이전 TDelegate (std::vector<std::function> + remove_if)
+	template<typename... Args>
+	class TLegacyDelegate
+	{
+	public:
+		template<typename TObj, typename TClass>
+		FDelegateHandle AddDynamic(TObj* Instance, void(TClass::* Func)(Args...))
+		{
+			FDelegateHandle Handle = NextHandle++;
+			Handlers.push_back({ Handle, [=](Args... args) { (Instance->*Func)(args...); } });
+			return Handle;
+		}
+
+		void Broadcast(Args... args)
+		{
+			for (auto& Entry : Handlers)
+			{
+				if (Entry.Handler)
+				{
+					Entry.Handler(args...);
+				}
+			}
+		}
+
+		void Remove(FDelegateHandle Handle)
+		{
+			auto It = std::remove_if(Handlers.begin(), Handlers.end(),
+				[&](const FEntry& E) { return E.Handle == Handle; });
+			Handlers.erase(It, Handlers.end());
+		}
+
+	private:
+		struct FEntry
+		{
+			FDelegateHandle Handle;
+			std::function<void(Args...)> Handler;
+		};
+
+		std::vector<FEntry> Handlers;
+		FDelegateHandle NextHandle = 1;
+	};
+
+	// 다형 수신자 (OnComponentHit 등과 같은 가상 멤버 함수 바인딩)
+	struct FBenchmarkReceiverBase
+	{
+		virtual ~FBenchmarkReceiverBase() = default;
+		virtual void OnEvent(int32 Value, float Scale) = 0;
+	};
+
+	struct FBenchmarkReceiver : public FBenchmarkReceiverBase
+	{
+		int64 Sum = 0;
+		int32 Weight = 1;
+
+		void OnEvent(int32 Value, float Scale) override
+		{
+			Sum += static_cast<int64>(Value) * Weight + static_cast<int64>(Scale);
+		}
+	};
+
+	template<typename TDelegateType>
+	int64 RunBroadcasts(TDelegateType& Delegate, TArray<FBenchmarkReceiver>& Receivers, int32 NumBroadcasts, double& OutMS)
+	{
+		for (FBenchmarkReceiver& Receiver : Receivers)
+		{
+			Receiver.Sum = 0;
+		}
+
+		const uint64 Start = FPlatformTime::Cycles64();
+		for (int32 Index = 0; Index < NumBroadcasts; ++Index)
+		{
+			Delegate.Broadcast(Index, 2.0f);
+		}
+		OutMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+		int64 Total = 0;
+		for (const FBenchmarkReceiver& Receiver : Receivers)
+		{
+			Total += Receiver.Sum;
+		}
+		return Total;
+	}
+
+	// 바인딩 NumBindings개가 있는 상태에서 가운데 바인딩을 추가/제거 반복 (오버랩 시작/종료 구독 패턴)
+	template<typename TDelegateType>
+	double RunAddRemove(TDelegateType& Delegate, FBenchmarkReceiver& Receiver, int32 NumIterations)
+	{
+		const uint64 Start = FPlatformTime::Cycles64();
+		for (int32 Index = 0; Index < NumIterations; ++Index)
+		{
+			const FDelegateHandle Handle = Delegate.AddDynamic(&Receiver, &FBenchmarkReceiverBase::OnEvent);
+			Delegate.Remove(Handle);
+		}
+		return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	}
+}
+
+FDelegateBenchmarkResult FDelegateBenchmark::Run(int32 NumBroadcasts, int32 NumBindings)
+{
+	FDelegateBenchmarkResult Result;
+	Result.NumBroadcasts = NumBroadcasts > 0 ? NumBroadcasts : 1;
+	Result.NumBindings = NumBindings > 0 ? NumBindings : 1;
+
+	TArray<FBenchmarkReceiver> Receivers;
+	Receivers.SetNum(Result.NumBindings);
+	for (int32 Index = 0; Index < Result.NumBindings; ++Index)
+	{
+		Receivers[Index].Weight = Index + 1;
+	}
+
+	TLegacyDelegate<int32, float> LegacyDelegate;
+	TDelegate<int32, float> Delegate;
+	for (FBenchmarkReceiver& Receiver : Receivers)
+	{
+		LegacyDelegate.AddDynamic(&Receiver, &FBenchmarkReceiverBase::OnEvent);
+		Delegate.AddDynamic(&Receiver, &FBenchmarkReceiverBase::OnEvent);
+	}
+
+	// 1. Broadcast
+	const int64 LegacySum = RunBroadcasts(LegacyDelegate, Receivers, Result.NumBroadcasts, Result.LegacyBroadcastMS);
+	const int64 Sum = RunBroadcasts(Delegate, Receivers, Result.NumBroadcasts, Result.BroadcastMS);
+	Result.bResultsMatch = LegacySum == Sum;
+
+	// 2. 추가 + 핸들 제거
+	FBenchmarkReceiver Extra;
+	Result.LegacyAddRemoveMS = RunAddRemove(LegacyDelegate, Extra, Result.NumBroadcasts);
+	Result.AddRemoveMS = RunAddRemove(Delegate, Extra, Result.NumBroadcasts);
+
+	// 제거 후에도 원래 바인딩만 남아 있는지 확인
+	double UnusedMS = 0.0;
+	Result.bResultsMatch = Result.bResultsMatch && RunBroadcasts(Delegate, Receivers, 1, UnusedMS) == RunBroadcasts(LegacyDelegate, Receivers, 1, UnusedMS);
+
+	return Result;
+}
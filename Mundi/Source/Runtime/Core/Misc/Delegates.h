@@ -4,71 +4,415 @@
 #include <functional>
 #include <algorithm>
 #include <memory>
+#include <new>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
 
+// 0이면 빈 핸들. 하위 32비트는 핸들 슬롯 번호 + 1, 상위 32비트는 슬롯 세대 (제거된 핸들은 재사용 슬롯과 구별됨)
 using FDelegateHandle = size_t;
 
+/**
+ * TDelegateBinding
+ *
+ * 델리게이트 바인딩 하나입니다. 멤버 함수(AddDynamic)와 작은 람다는 인라인 버퍼에 담아 힙 할당이 없고,
+ * 버퍼보다 큰 호출 객체(std::function 등)만 힙에 둡니다.
+ */
+template<typename... Args>
+class TDelegateBinding
+{
+public:
+	// 객체 포인터 + 멤버 함수 포인터(MSVC 최대 24바이트), 또는 포인터 몇 개를 캡처한 람다
+	static constexpr size_t InlineSize = 48;
+
+	TDelegateBinding() = default;
+	~TDelegateBinding() { Reset(); }
+
+	TDelegateBinding(const TDelegateBinding& Other) { CopyFrom(Other); }
+	TDelegateBinding(TDelegateBinding&& Other) noexcept { MoveFrom(Other); }
+
+	TDelegateBinding& operator=(const TDelegateBinding& Other)
+	{
+		if (this != &Other)
+		{
+			Reset();
+			CopyFrom(Other);
+		}
+		return *this;
+	}
+
+	TDelegateBinding& operator=(TDelegateBinding&& Other) noexcept
+	{
+		if (this != &Other)
+		{
+			Reset();
+			MoveFrom(Other);
+		}
+		return *this;
+	}
+
+	template<typename F>
+	void Bind(F&& Callable)
+	{
+		using FType = std::decay_t<F>;
+		Reset();
+		if constexpr (FitsInline<FType>())
+		{
+			new (Storage) FType(std::forward<F>(Callable));
+			Ops = &InlineOps<FType>;
+		}
+		else
+		{
+			*reinterpret_cast<FType**>(Storage) = new FType(std::forward<F>(Callable));
+			Ops = &HeapOps<FType>;
+		}
+	}
+
+	bool IsBound() const { return Ops != nullptr; }
+
+	void Execute(Args... args) const
+	{
+		Ops->Invoke(const_cast<unsigned char*>(Storage), args...);
+	}
+
+	void Reset()
+	{
+		if (Ops)
+		{
+			Ops->Destroy(Storage);
+			Ops = nullptr;
+		}
+	}
+
+private:
+	struct FOps
+	{
+		void (*Invoke)(void* Storage, Args... args);
+		void (*Copy)(void* Dest, const void* Source);
+		void (*Move)(void* Dest, void* Source);		// Source의 호출 객체는 파괴됨
+		void (*Destroy)(void* Storage);
+	};
+
+	template<typename FType>
+	static constexpr bool FitsInline()
+	{
+		return sizeof(FType) <= InlineSize
+			&& alignof(FType) <= alignof(std::max_align_t)
+			&& std::is_nothrow_move_constructible_v<FType>;
+	}
+
+	template<typename FType>
+	static inline const FOps InlineOps = {
+		[](void* S, Args... args) { (*static_cast<FType*>(S))(args...); },
+		[](void* D, const void* S) { new (D) FType(*static_cast<const FType*>(S)); },
+		[](void* D, void* S) { new (D) FType(std::move(*static_cast<FType*>(S))); static_cast<FType*>(S)->~FType(); },
+		[](void* S) { static_cast<FType*>(S)->~FType(); }
+	};
+
+	template<typename FType>
+	static inline const FOps HeapOps = {
+		[](void* S, Args... args) { (**static_cast<FType**>(S))(args...); },
+		[](void* D, const void* S) { *static_cast<FType**>(D) = new FType(**static_cast<FType* const*>(S)); },
+		[](void* D, void* S) { *static_cast<FType**>(D) = *static_cast<FType**>(S); },
+		[](void* S) { delete *static_cast<FType**>(S); }
+	};
+
+	void CopyFrom(const TDelegateBinding& Other)
+	{
+		if (Other.Ops)
+		{
+			Other.Ops->Copy(Storage, Other.Storage);
+			Ops = Other.Ops;
+		}
+	}
+
+	void MoveFrom(TDelegateBinding& Other)
+	{
+		if (Other.Ops)
+		{
+			Other.Ops->Move(Storage, Other.Storage);
+			Ops = Other.Ops;
+			Other.Ops = nullptr;
+		}
+	}
+
+	alignas(std::max_align_t) unsigned char Storage[InlineSize];
+	const FOps* Ops = nullptr;
+};
+
+/**
+ * TDelegate
+ *
+ * 멀티캐스트 델리게이트입니다. (게임 스레드 전용이라 락 없음)
+ * - 바인딩은 추가 순서대로 호출되고, 핸들 슬롯 테이블로 Remove가 O(1)
+ * - Broadcast 중 Add한 바인딩은 다음 Broadcast부터 호출되고, Remove한 바인딩은 그 즉시 호출에서 빠짐
+ *   (실행 중인 자기 자신을 지워도 안전하도록 정리는 Broadcast가 끝난 뒤)
+ */
 template<typename... Args>
 class TDelegate
 {
 public:
 	using HandlerType = std::function<void(Args...)>;
 
-	TDelegate() : NextHandle(1) {}
+	TDelegate() = default;
 
-	FDelegateHandle Add(const HandlerType& Handler)
+	TDelegate(const TDelegate& Other)
+		: Entries(Other.Entries)
+		, PendingEntries(Other.PendingEntries)
+		, HandleSlots(Other.HandleSlots)
+		, FreeHandleSlots(Other.FreeHandleSlots)
+		, NumDead(Other.NumDead)
 	{
-		FDelegateHandle Handle = NextHandle++;
-		Handlers.push_back({ Handle, Handler });
-		return Handle;
+	}
+
+	TDelegate& operator=(const TDelegate& Other)
+	{
+		if (this != &Other)
+		{
+			Entries = Other.Entries;
+			PendingEntries = Other.PendingEntries;
+			HandleSlots = Other.HandleSlots;
+			FreeHandleSlots = Other.FreeHandleSlots;
+			NumDead = Other.NumDead;
+		}
+		return *this;
+	}
+
+	// 람다/std::function 등 호출 객체 (작은 람다는 힙 할당 없음)
+	template<typename F, typename = std::enable_if_t<std::is_invocable_v<std::decay_t<F>&, Args...>>>
+	FDelegateHandle Add(F&& Handler)
+	{
+		using FType = std::decay_t<F>;
+		if constexpr (std::is_constructible_v<bool, const FType&> && !std::is_pointer_v<FType>)
+		{
+			// 빈 std::function은 바인딩하지 않음 (이전에는 Broadcast에서 건너뜀)
+			if (!static_cast<bool>(Handler))
+			{
+				return 0;
+			}
+		}
+		return AddBinding(std::forward<F>(Handler));
 	}
 
 	// original: template<typename T>
 	template<typename TObj, typename TClass>
 	FDelegateHandle AddDynamic(TObj* Instance, void(TClass::* Func)(Args...))
 	{
-		FDelegateHandle Handle = NextHandle++;
-		Handlers.push_back({
-			Handle,
-			[=](Args... args) {
-			(Instance->*Func)(args...); }
-		});
-		return Handle;
+		return AddBinding([Instance, Func](Args... args) { (Instance->*Func)(args...); });
 	}
 
-	void Broadcast(Args... args) 
+	void Broadcast(Args... args)
 	{
-		for (auto& Entry : Handlers) {
-			if (Entry.Handler)
+		// 이번 Broadcast 동안 Entries는 늘어나지 않음 (Add는 PendingEntries로)
+		++BroadcastDepth;
+		const size_t NumEntries = Entries.size();
+		for (size_t Index = 0; Index < NumEntries; ++Index)
+		{
+			const FEntry& Entry = Entries[Index];
+			if (!Entry.bRemoved)
 			{
-				Entry.Handler(args...);
+				Entry.Binding.Execute(args...);
 			}
 		}
+		if (--BroadcastDepth == 0)
+		{
+			FlushDeferred();
+		}
 	}
 
 	void Remove(FDelegateHandle Handle)
 	{
-		auto it = std::remove_if(Handlers.begin(), Handlers.end(),
-		[&](const Entry& e)
+		const uint32_t SlotIndex = static_cast<uint32_t>(Handle & 0xFFFFFFFFu);
+		const uint32_t Generation = static_cast<uint32_t>(static_cast<uint64_t>(Handle) >> 32);
+		if (SlotIndex == 0 || SlotIndex > HandleSlots.size())
 		{
-			return e.Handle == Handle;
-		});
-		Handlers.erase(it, Handlers.end());
+			return;
+		}
+
+		FHandleSlot& Slot = HandleSlots[SlotIndex - 1];
+		if (Slot.Generation != Generation || Slot.EntryIndex < 0)
+		{
+			return;
+		}
+
+		RemoveEntry(Slot.bPending ? PendingEntries[Slot.EntryIndex] : Entries[Slot.EntryIndex], Slot.bPending);
+
+		// 슬롯 반환 (세대를 올려 이 핸들로는 다시 찾지 못하게)
+		++Slot.Generation;
+		Slot.EntryIndex = -1;
+		Slot.bPending = false;
+		FreeHandleSlots.push_back(SlotIndex - 1);
+
+		// 죽은 항목이 절반을 넘으면 압축 (Remove 전체로 보면 O(1))
+		if (BroadcastDepth == 0 && NumDead * 2 > Entries.size())
+		{
+			Compact();
+		}
 	}
 
 	void Clear()
 	{
-		Handlers.clear();
+		for (FEntry& Entry : Entries)
+		{
+			ReleaseEntry(Entry, false);
+		}
+		for (FEntry& Entry : PendingEntries)
+		{
+			ReleaseEntry(Entry, true);
+		}
+
+		if (BroadcastDepth == 0)
+		{
+			Entries.clear();
+			PendingEntries.clear();
+			NumDead = 0;
+		}
 	}
 
 private:
-	struct Entry
+	struct FEntry
 	{
-		FDelegateHandle Handle;
-		HandlerType Handler;
+		TDelegateBinding<Args...> Binding;
+		uint32_t HandleSlot = 0;
+		bool bRemoved = false;
 	};
 
-	std::vector<Entry> Handlers;
-	FDelegateHandle NextHandle;
+	struct FHandleSlot
+	{
+		uint32_t Generation = 1;
+		int32_t EntryIndex = -1;	// Entries (bPending이면 PendingEntries) 인덱스, 빈 슬롯이면 -1
+		bool bPending = false;
+	};
+
+	template<typename F>
+	FDelegateHandle AddBinding(F&& Callable)
+	{
+		uint32_t SlotIndex = 0;
+		if (!FreeHandleSlots.empty())
+		{
+			SlotIndex = FreeHandleSlots.back();
+			FreeHandleSlots.pop_back();
+		}
+		else
+		{
+			SlotIndex = static_cast<uint32_t>(HandleSlots.size());
+			HandleSlots.emplace_back();
+		}
+
+		// Broadcast 중이면 실행 중인 바인딩이 옮겨지지 않도록 따로 모았다가 끝난 뒤 붙임
+		FHandleSlot& Slot = HandleSlots[SlotIndex];
+		Slot.bPending = BroadcastDepth > 0;
+		std::vector<FEntry>& Target = Slot.bPending ? PendingEntries : Entries;
+		Slot.EntryIndex = static_cast<int32_t>(Target.size());
+
+		FEntry& Entry = Target.emplace_back();
+		Entry.Binding.Bind(std::forward<F>(Callable));
+		Entry.HandleSlot = SlotIndex;
+
+		return (static_cast<FDelegateHandle>(Slot.Generation) << 32) | static_cast<FDelegateHandle>(SlotIndex + 1);
+	}
+
+	void RemoveEntry(FEntry& Entry, bool bPending)
+	{
+		Entry.bRemoved = true;
+		if (!bPending)
+		{
+			++NumDead;
+		}
+
+		// 실행 중일 수 있는 바인딩은 Broadcast가 끝난 뒤 파괴
+		if (bPending || BroadcastDepth == 0)
+		{
+			Entry.Binding.Reset();
+		}
+	}
+
+	void ReleaseEntry(FEntry& Entry, bool bPending)
+	{
+		if (Entry.bRemoved)
+		{
+			return;
+		}
+
+		FHandleSlot& Slot = HandleSlots[Entry.HandleSlot];
+		++Slot.Generation;
+		Slot.EntryIndex = -1;
+		Slot.bPending = false;
+		FreeHandleSlots.push_back(Entry.HandleSlot);
+
+		RemoveEntry(Entry, bPending);
+	}
+
+	// 죽은 항목을 지우고 남은 항목의 슬롯 인덱스를 갱신 (추가 순서 유지)
+	void Compact()
+	{
+		size_t WriteIndex = 0;
+		for (size_t ReadIndex = 0; ReadIndex < Entries.size(); ++ReadIndex)
+		{
+			if (Entries[ReadIndex].bRemoved)
+			{
+				continue;
+			}
+			if (WriteIndex != ReadIndex)
+			{
+				Entries[WriteIndex] = std::move(Entries[ReadIndex]);
+			}
+			HandleSlots[Entries[WriteIndex].HandleSlot].EntryIndex = static_cast<int32_t>(WriteIndex);
+			++WriteIndex;
+		}
+		Entries.erase(Entries.begin() + WriteIndex, Entries.end());
+		NumDead = 0;
+	}
+
+	void FlushDeferred()
+	{
+		if (NumDead > 0)
+		{
+			Compact();
+		}
+
+		for (FEntry& Pending : PendingEntries)
+		{
+			if (Pending.bRemoved)
+			{
+				continue;
+			}
+			FHandleSlot& Slot = HandleSlots[Pending.HandleSlot];
+			Slot.bPending = false;
+			Slot.EntryIndex = static_cast<int32_t>(Entries.size());
+			Entries.push_back(std::move(Pending));
+		}
+		PendingEntries.clear();
+	}
+
+	std::vector<FEntry> Entries;			// 추가 순서. 제거된 항목은 bRemoved로 두었다가 압축
+	std::vector<FEntry> PendingEntries;		// Broadcast 중 추가된 항목
+	std::vector<FHandleSlot> HandleSlots;
+	std::vector<uint32_t> FreeHandleSlots;
+	size_t NumDead = 0;
+	int32_t BroadcastDepth = 0;
+};
+
+/**
+ * @struct FDelegateBenchmarkResult
+ * @brief FDelegateBenchmark::Run 결과입니다.
+ */
+struct FDelegateBenchmarkResult
+{
+	int32 NumBroadcasts = 0;
+	int32 NumBindings = 0;
+	double LegacyBroadcastMS = 0.0;		// std::vector<std::function> 순회 (이전 TDelegate)
+	double BroadcastMS = 0.0;			// 인라인 멤버 함수 바인딩
+	double LegacyAddRemoveMS = 0.0;		// AddDynamic + remove_if
+	double AddRemoveMS = 0.0;			// AddDynamic + 핸들로 O(1) Remove
+	bool bResultsMatch = false;			// 두 방식의 수신 결과가 같은지
+};
+
+class FDelegateBenchmark
+{
+public:
+	/** @brief 멤버 함수 바인딩 NumBindings개에 NumBroadcasts번 Broadcast하고, 바인딩 추가/제거를 같은 횟수만큼 반복해 비교합니다. */
+	static FDelegateBenchmarkResult Run(int32 NumBroadcasts = 1000000, int32 NumBindings = 8);
 };
 
 // 델리게이트 인스턴스 생성용 매크로 (실제 멤버 변수 선언)
@@ -1,8 +1,16 @@
 ﻿#include "pch.h"
 #include "Name.h"
+#include <shared_mutex>
 
 namespace
 {
+    // 병렬 배치 수집 등 워커 스레드에서도 FName이 생성되므로 풀 접근을 보호한다.
+    static std::shared_mutex& GetNamePoolMutex()
+    {
+        static std::shared_mutex GNamePoolMutex;
+        return GNamePoolMutex;
+    }
+
     // NameMap을 안전하게 가져오는 getter
     static TMap<FString, uint32>& GetNameMap()
     {
@@ -13,9 +21,10 @@ namespace
     }
 
     // Entries를 안전하게 가져오는 getter
-    static TArray<FNameEntry>& GetEntries()
+    // deque는 push_back 시 기존 원소를 이동하지 않으므로 Get()이 반환한 참조가 계속 유효하다.
+    static std::deque<FNameEntry>& GetEntries()
     {
-        static TArray<FNameEntry> GEntries;
+        static std::deque<FNameEntry> GEntries;
         return GEntries;
     }
 
@@ -35,8 +44,16 @@ uint32 FNamePool::Add(const FString& InStr)
 
     // 전역 변수 대신 getter를 통해 접근
     TMap<FString, uint32>& NameMap = GetNameMap();
-    TArray<FNameEntry>& Entries = GetEntries();
+    std::deque<FNameEntry>& Entries = GetEntries();
+
+    {
+        std::shared_lock<std::shared_mutex> ReadLock(GetNamePoolMutex());
+        auto it = NameMap.find(Lower);
+        if (it != NameMap.end())
+            return it->second;
+    }
 
+    std::unique_lock<std::shared_mutex> WriteLock(GetNamePoolMutex());
     auto it = NameMap.find(Lower);
     if (it != NameMap.end())
         return it->second;
@@ -50,7 +67,8 @@ uint32 FNamePool::Add(const FString& InStr)
 const FNameEntry& FNamePool::Get(uint32 Index)
 {
     // 전역 변수 대신 getter를 통해 접근
-    TArray<FNameEntry>& Entries = GetEntries();
+    std::deque<FNameEntry>& Entries = GetEntries();
+    std::shared_lock<std::shared_mutex> ReadLock(GetNamePoolMutex());
 
     // (안전성 강화) 경계 검사 추가
     if (Index >= Entries.size())
@@ -17,6 +17,7 @@
 #include "Vector.h"
 #include "Enums.h"
 #include "nlohmann/json.hpp"  // 사용하는 JSON 라이브러리
+#include "JsonStream.h"
 
 namespace json { class JSON; }
 using JSON = json::JSON;
@@ -381,18 +382,12 @@ public:
 	// File I/O
 	//====================================================================================
 
+	// DOM 문자열을 만들지 않고 FJsonWriter로 바로 스트림에 기록
 	static bool SaveJsonToFile(const JSON& InJsonData, const FWideString& InFilePath)
 	{
 		try
 		{
-			std::ofstream File(InFilePath);
-			if (!File.is_open())
-			{
-				return false;
-			}
-			File << std::setw(2) << InJsonData << "\n";
-			File.close();
-			return true;
+			return FJsonWriter::WriteDomToFile(InJsonData, InFilePath);
 		}
 		catch (const std::exception&)
 		{
@@ -400,22 +395,13 @@ public:
 		}
 	}
 
+	// 파일을 매핑해 FJsonReader로 한 번에 DOM 구성 (파일 내용 복사/노드 복사 없음)
+	// 트리 없이 읽으려면 FJsonReader::ParseFile에 IJsonHandler를 직접 넘김
 	static bool LoadJsonFromFile(JSON& OutJson, const FWideString& InFilePath)
 	{
 		try
 		{
-			std::ifstream File(InFilePath);
-			if (!File.is_open())
-			{
-				return false;
-			}
-
-			FString FileContent((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>());
-			File.close();
-
-			std::cout << "[JsonSerializer] File Content Length: " << FileContent.length() << "\n";
-			OutJson = JSON::Load(FileContent);
-			return true;
+			return FJsonReader::ParseFileToDom(InFilePath, OutJson);
 		}
 		catch (const std::exception&)
 		{
@@ -0,0 +1,986 @@
+#include "pch.h"
+#include "JsonStream.h"
+#include "WindowsMappedFile.h"
+#include "PlatformTime.h"
+#include <charconv>
+#include <climits>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+	inline bool IsJsonSpace(char C)
+	{
+		return C == ' ' || C == '\n' || C == '\r' || C == '\t';
+	}
+
+	inline bool IsHexDigit(char C)
+	{
+		return (C >= '0' && C <= '9') || (C >= 'a' && C <= 'f') || (C >= 'A' && C <= 'F');
+	}
+
+	inline bool IsDigit(char C)
+	{
+		return C >= '0' && C <= '9';
+	}
+}
+
+// ─────────────────────────────
+// FJsonReader
+// ─────────────────────────────
+
+bool FJsonReader::Fail(const char* InError, const char* At)
+{
+	Error = InError;
+	ErrorOffset = static_cast<size_t>(At - Begin);
+	return false;
+}
+
+bool FJsonReader::ReadString(const char*& Cursor, const char* End, const char*& OutStr, size_t& OutLength)
+{
+	// Cursor는 여는 따옴표
+	const char* Start = ++Cursor;
+
+	// 1. 이스케이프가 없으면 입력 버퍼를 그대로 전달
+	while (Cursor < End && *Cursor != '\"' && *Cursor != '\\')
+	{
+		++Cursor;
+	}
+	if (Cursor >= End)
+	{
+		return Fail("Unterminated string", Start - 1);
+	}
+	if (*Cursor == '\"')
+	{
+		OutStr = Start;
+		OutLength = static_cast<size_t>(Cursor - Start);
+		++Cursor;
+		return true;
+	}
+
+	// 2. 이스케이프가 있으면 Scratch에 풀어 씀 (json.hpp parse_string과 같은 결과)
+	Scratch.assign(Start, Cursor);
+	while (Cursor < End && *Cursor != '\"')
+	{
+		const char C = *Cursor++;
+		if (C != '\\')
+		{
+			Scratch += C;
+			continue;
+		}
+		if (Cursor >= End)
+		{
+			break;
+		}
+
+		switch (*Cursor++)
+		{
+		case '\"': Scratch += '\"'; break;
+		case '\\': Scratch += '\\'; break;
+		case '/':  Scratch += '/';  break;
+		case 'b':  Scratch += '\b'; break;
+		case 'f':  Scratch += '\f'; break;
+		case 'n':  Scratch += '\n'; break;
+		case 'r':  Scratch += '\r'; break;
+		case 't':  Scratch += '\t'; break;
+		case 'u':
+			if (End - Cursor < 4 || !IsHexDigit(Cursor[0]) || !IsHexDigit(Cursor[1]) || !IsHexDigit(Cursor[2]) || !IsHexDigit(Cursor[3]))
+			{
+				return Fail("Expected 4 hex digits in unicode escape", Cursor);
+			}
+			Scratch += "\\u";
+			Scratch.append(Cursor, 4);
+			Cursor += 4;
+			break;
+		default:
+			Scratch += '\\';
+			break;
+		}
+	}
+	if (Cursor >= End)
+	{
+		return Fail("Unterminated string", Start - 1);
+	}
+
+	++Cursor;
+	OutStr = Scratch.data();
+	OutLength = Scratch.size();
+	return true;
+}
+
+bool FJsonReader::Parse(const char* Data, size_t Size, IJsonHandler& Handler)
+{
+	Begin = Data;
+	Error = nullptr;
+	ErrorOffset = 0;
+
+	const char* Cursor = Data;
+	const char* End = Data + Size;
+
+	// UTF-8 BOM
+	if (Size >= 3 && static_cast<uint8>(Data[0]) == 0xEF && static_cast<uint8>(Data[1]) == 0xBB && static_cast<uint8>(Data[2]) == 0xBF)
+	{
+		Cursor += 3;
+	}
+
+	auto SkipWhitespace = [&]()
+	{
+		while (Cursor < End && IsJsonSpace(*Cursor))
+		{
+			++Cursor;
+		}
+	};
+
+	// "키" : 까지 읽음
+	auto ReadKey = [&]() -> bool
+	{
+		SkipWhitespace();
+		if (Cursor >= End || *Cursor != '\"')
+		{
+			return Fail("Expected object key", Cursor);
+		}
+		const char* Str = nullptr;
+		size_t Length = 0;
+		if (!ReadString(Cursor, End, Str, Length))
+		{
+			return false;
+		}
+		if (!Handler.OnKey(Str, Length))
+		{
+			return Fail("Aborted by handler", Cursor);
+		}
+		SkipWhitespace();
+		if (Cursor >= End || *Cursor != ':')
+		{
+			return Fail("Expected ':' after object key", Cursor);
+		}
+		++Cursor;
+		return true;
+	};
+
+	// true = 객체, false = 배열
+	TArray<bool> Containers;
+
+	while (true)
+	{
+		// 1. 값 하나
+		SkipWhitespace();
+		if (Cursor >= End)
+		{
+			return Fail("Unexpected end of input", Cursor);
+		}
+
+		bool bHandled = true;
+		bool bOpenedContainer = false;
+		const char C = *Cursor;
+		switch (C)
+		{
+		case '{':
+			++Cursor;
+			bHandled = Handler.OnBeginObject();
+			SkipWhitespace();
+			if (Cursor < End && *Cursor == '}')
+			{
+				++Cursor;
+				bHandled = bHandled && Handler.OnEndObject();
+			}
+			else
+			{
+				Containers.Add(true);
+				bOpenedContainer = true;
+				if (bHandled && !ReadKey())
+				{
+					return false;
+				}
+			}
+			break;
+		case '[':
+			++Cursor;
+			bHandled = Handler.OnBeginArray();
+			SkipWhitespace();
+			if (Cursor < End && *Cursor == ']')
+			{
+				++Cursor;
+				bHandled = bHandled && Handler.OnEndArray();
+			}
+			else
+			{
+				Containers.Add(false);
+				bOpenedContainer = true;
+			}
+			break;
+		case '\"':
+		{
+			const char* Str = nullptr;
+			size_t Length = 0;
+			if (!ReadString(Cursor, End, Str, Length))
+			{
+				return false;
+			}
+			bHandled = Handler.OnString(Str, Length);
+			break;
+		}
+		case 't':
+			if (End - Cursor < 4 || memcmp(Cursor, "true", 4) != 0)
+			{
+				return Fail("Expected 'true'", Cursor);
+			}
+			Cursor += 4;
+			bHandled = Handler.OnBool(true);
+			break;
+		case 'f':
+			if (End - Cursor < 5 || memcmp(Cursor, "false", 5) != 0)
+			{
+				return Fail("Expected 'false'", Cursor);
+			}
+			Cursor += 5;
+			bHandled = Handler.OnBool(false);
+			break;
+		case 'n':
+			if (End - Cursor < 4 || memcmp(Cursor, "null", 4) != 0)
+			{
+				return Fail("Expected 'null'", Cursor);
+			}
+			Cursor += 4;
+			bHandled = Handler.OnNull();
+			break;
+		default:
+		{
+			if (C != '-' && !IsDigit(C))
+			{
+				return Fail("Unexpected character", Cursor);
+			}
+
+			// '.'이나 지수가 있으면 실수
+			const char* NumberStart = Cursor;
+			bool bIsFloat = false;
+			if (*Cursor == '-')
+			{
+				++Cursor;
+			}
+			const char* DigitsStart = Cursor;
+			while (Cursor < End && IsDigit(*Cursor))
+			{
+				++Cursor;
+			}
+			if (Cursor == DigitsStart)
+			{
+				return Fail("Expected digits", Cursor);
+			}
+			if (Cursor < End && *Cursor == '.')
+			{
+				bIsFloat = true;
+				++Cursor;
+				while (Cursor < End && IsDigit(*Cursor))
+				{
+					++Cursor;
+				}
+			}
+			if (Cursor < End && (*Cursor == 'e' || *Cursor == 'E'))
+			{
+				bIsFloat = true;
+				++Cursor;
+				if (Cursor < End && (*Cursor == '+' || *Cursor == '-'))
+				{
+					++Cursor;
+				}
+				while (Cursor < End && IsDigit(*Cursor))
+				{
+					++Cursor;
+				}
+			}
+
+			if (!bIsFloat)
+			{
+				int64 IntValue = 0;
+				const std::from_chars_result Result = std::from_chars(NumberStart, Cursor, IntValue);
+				if (Result.ec == std::errc() && Result.ptr == Cursor)
+				{
+					bHandled = Handler.OnInteger(IntValue);
+					break;
+				}
+				// int64 범위를 넘으면 실수로 처리
+			}
+
+			double FloatValue = 0.0;
+			const std::from_chars_result Result = std::from_chars(NumberStart, Cursor, FloatValue);
+			if (Result.ec != std::errc() || Result.ptr != Cursor)
+			{
+				return Fail("Invalid number", NumberStart);
+			}
+			bHandled = Handler.OnFloat(FloatValue);
+			break;
+		}
+		}
+
+		if (!bHandled)
+		{
+			return Fail("Aborted by handler", Cursor);
+		}
+		if (bOpenedContainer)
+		{
+			continue;
+		}
+
+		// 2. 값 다음: 구분자나 닫는 괄호 (닫힌 컨테이너 자체도 값이므로 반복)
+		while (true)
+		{
+			SkipWhitespace();
+			if (Containers.IsEmpty())
+			{
+				if (Cursor != End)
+				{
+					return Fail("Unexpected trailing characters", Cursor);
+				}
+				return true;
+			}
+			if (Cursor >= End)
+			{
+				return Fail("Unexpected end of input", Cursor);
+			}
+
+			const bool bInObject = Containers.back();
+			if (*Cursor == ',')
+			{
+				++Cursor;
+				if (bInObject && !ReadKey())
+				{
+					return false;
+				}
+				break;
+			}
+			if (*Cursor == (bInObject ? '}' : ']'))
+			{
+				++Cursor;
+				Containers.pop_back();
+				if (!(bInObject ? Handler.OnEndObject() : Handler.OnEndArray()))
+				{
+					return Fail("Aborted by handler", Cursor);
+				}
+				continue;
+			}
+			return Fail(bInObject ? "Expected ',' or '}'" : "Expected ',' or ']'", Cursor);
+		}
+	}
+}
+
+bool FJsonReader::ParseFile(const FWideString& FilePath, IJsonHandler& Handler)
+{
+	FWindowsMappedFile File;
+	if (!File.Open(WideToUTF8(FilePath)))
+	{
+		return false;
+	}
+
+	// 빈 파일은 빈 문서로 취급 (이벤트 없이 성공, DOM은 null로 남음)
+	if (File.GetSize() == 0)
+	{
+		return true;
+	}
+
+	FJsonReader Reader;
+	if (!Reader.Parse(reinterpret_cast<const char*>(File.GetData()), File.GetSize(), Handler))
+	{
+		UE_LOG("[error] JsonReader: %s at offset %zu (%s)", Reader.GetError(), Reader.GetErrorOffset(), WideToUTF8(FilePath).c_str());
+		return false;
+	}
+	return true;
+}
+
+bool FJsonReader::ParseFileToDom(const FWideString& FilePath, JSON& OutJson)
+{
+	OutJson = JSON();
+	FJsonDomBuilder Builder(OutJson);
+	return ParseFile(FilePath, Builder);
+}
+
+bool FJsonReader::VisitDom(const JSON& Node, IJsonHandler& Handler)
+{
+	switch (Node.JSONType())
+	{
+	case JSON::Class::Object:
+		if (!Handler.OnBeginObject())
+		{
+			return false;
+		}
+		for (const auto& Pair : Node.ObjectRange())
+		{
+			if (!Handler.OnKey(Pair.first.data(), Pair.first.size()) || !VisitDom(Pair.second, Handler))
+			{
+				return false;
+			}
+		}
+		return Handler.OnEndObject();
+	case JSON::Class::Array:
+		if (!Handler.OnBeginArray())
+		{
+			return false;
+		}
+		for (const JSON& Element : Node.ArrayRange())
+		{
+			if (!VisitDom(Element, Handler))
+			{
+				return false;
+			}
+		}
+		return Handler.OnEndArray();
+	case JSON::Class::String:
+	{
+		const FString Raw = FJsonDomBuilder::GetRawString(Node);
+		return Handler.OnString(Raw.data(), Raw.size());
+	}
+	case JSON::Class::Floating:
+		return Handler.OnFloat(Node.ToFloat());
+	case JSON::Class::Integral:
+		return Handler.OnInteger(Node.ToInt());
+	case JSON::Class::Boolean:
+		return Handler.OnBool(Node.ToBool());
+	default:
+		return Handler.OnNull();
+	}
+}
+
+// ─────────────────────────────
+// FJsonDomBuilder
+// ─────────────────────────────
+
+JSON& FJsonDomBuilder::Emplace()
+{
+	++NumNodes;
+	if (Stack.IsEmpty())
+	{
+		return Root;
+	}
+
+	// 부모 안에 바로 생성 (std::map 노드 / std::deque 끝 추가는 기존 원소의 참조를 유지하므로 스택 포인터가 안전)
+	FFrame& Top = Stack.back();
+	if (Top.Node->JSONType() == JSON::Class::Object)
+	{
+		return (*Top.Node)[PendingKey];
+	}
+	return (*Top.Node)[Top.NextIndex++];
+}
+
+bool FJsonDomBuilder::OnInteger(int64 Value)
+{
+	// json::JSON은 long으로 저장 (Windows에서 32비트). 범위를 넘으면 실수로 보관
+	if (Value >= LONG_MIN && Value <= LONG_MAX)
+	{
+		Emplace() = static_cast<long>(Value);
+	}
+	else
+	{
+		Emplace() = static_cast<double>(Value);
+	}
+	return true;
+}
+
+bool FJsonDomBuilder::OnBeginObject()
+{
+	JSON& Node = Emplace();
+	Node = JSON::Make(JSON::Class::Object);
+	Stack.Add({ &Node, 0 });
+	return true;
+}
+
+bool FJsonDomBuilder::OnBeginArray()
+{
+	JSON& Node = Emplace();
+	Node = JSON::Make(JSON::Class::Array);
+	Stack.Add({ &Node, 0 });
+	return true;
+}
+
+FString FJsonDomBuilder::GetRawString(const JSON& StringNode)
+{
+	const FString Escaped = StringNode.ToString();
+	if (Escaped.find('\\') == FString::npos)
+	{
+		return Escaped;
+	}
+
+	// json_escape의 역변환
+	FString Result;
+	Result.reserve(Escaped.size());
+	for (size_t Index = 0; Index < Escaped.size(); ++Index)
+	{
+		const char C = Escaped[Index];
+		if (C != '\\' || Index + 1 >= Escaped.size())
+		{
+			Result += C;
+			continue;
+		}
+
+		switch (Escaped[++Index])
+		{
+		case '\"': Result += '\"'; break;
+		case '\\': Result += '\\'; break;
+		case 'b':  Result += '\b'; break;
+		case 'f':  Result += '\f'; break;
+		case 'n':  Result += '\n'; break;
+		case 'r':  Result += '\r'; break;
+		case 't':  Result += '\t'; break;
+		default:   Result += '\\'; Result += Escaped[Index]; break;
+		}
+	}
+	return Result;
+}
+
+// ─────────────────────────────
+// FJsonWriter
+// ─────────────────────────────
+
+FJsonWriter::FJsonWriter(std::ostream& InStream, bool bInPretty)
+	: Stream(InStream), bPretty(bInPretty)
+{
+	Buffer.reserve(FlushThreshold + 4096);
+}
+
+void FJsonWriter::NewLine()
+{
+	if (bPretty)
+	{
+		Buffer += '\n';
+		Buffer.append(static_cast<size_t>(Stack.Num()) * 2, ' ');
+	}
+}
+
+void FJsonWriter::BeforeValue()
+{
+	if (bAfterKey)
+	{
+		bAfterKey = false;
+		return;
+	}
+	if (!Stack.IsEmpty())
+	{
+		FFrame& Top = Stack.back();
+		if (Top.bHasElements)
+		{
+			Buffer += bPretty ? ", " : ",";
+		}
+		Top.bHasElements = true;
+	}
+}
+
+void FJsonWriter::AppendEscaped(const char* Str, size_t Length)
+{
+	// json_escape와 같은 규칙 (DOM 저장 결과와 같은 텍스트)
+	const char* RunStart = Str;
+	const char* End = Str + Length;
+	for (const char* Cursor = Str; Cursor < End; ++Cursor)
+	{
+		const char* Escape = nullptr;
+		switch (*Cursor)
+		{
+		case '\"': Escape = "\\\""; break;
+		case '\\': Escape = "\\\\"; break;
+		case '\b': Escape = "\\b";  break;
+		case '\f': Escape = "\\f";  break;
+		case '\n': Escape = "\\n";  break;
+		case '\r': Escape = "\\r";  break;
+		case '\t': Escape = "\\t";  break;
+		default: continue;
+		}
+		Buffer.append(RunStart, Cursor);
+		Buffer += Escape;
+		RunStart = Cursor + 1;
+	}
+	Buffer.append(RunStart, End);
+}
+
+void FJsonWriter::BeginObject()
+{
+	BeforeValue();
+	Buffer += '{';
+	Stack.Add({ true, false });
+}
+
+void FJsonWriter::EndObject()
+{
+	const bool bHadElements = Stack.back().bHasElements;
+	Stack.pop_back();
+	if (bHadElements)
+	{
+		NewLine();
+	}
+	Buffer += '}';
+	MaybeFlush();
+}
+
+void FJsonWriter::BeginArray()
+{
+	BeforeValue();
+	Buffer += '[';
+	Stack.Add({ false, false });
+}
+
+void FJsonWriter::EndArray()
+{
+	Stack.pop_back();
+	Buffer += ']';
+	MaybeFlush();
+}
+
+void FJsonWriter::Key(const char* Str, size_t Length)
+{
+	FFrame& Top = Stack.back();
+	if (Top.bHasElements)
+	{
+		Buffer += ',';
+	}
+	Top.bHasElements = true;
+	NewLine();
+	Buffer += '\"';
+	AppendEscaped(Str, Length);
+	Buffer += bPretty ? "\" : " : "\":";
+	bAfterKey = true;
+}
+
+void FJsonWriter::Null()
+{
+	BeforeValue();
+	Buffer += "null";
+}
+
+void FJsonWriter::Bool(bool bValue)
+{
+	BeforeValue();
+	Buffer += bValue ? "true" : "false";
+}
+
+void FJsonWriter::Integer(int64 Value)
+{
+	BeforeValue();
+	char Text[24];
+	const std::to_chars_result Result = std::to_chars(Text, Text + sizeof(Text), Value);
+	Buffer.append(Text, Result.ptr);
+}
+
+void FJsonWriter::Float(double Value)
+{
+	BeforeValue();
+	if (!std::isfinite(Value))
+	{
+		// JSON은 NaN/Inf를 표현할 수 없음. 0으로 바꿔 쓰면 값이 조용히 오염되므로 null로 남기고 알림
+		// (ReadFloat는 null을 실수로 읽지 않으므로 로드 시에도 누락 경고가 뜸)
+		UE_LOG("[error] JsonWriter: Non-finite float (%f) cannot be stored in JSON. Written as null.", Value);
+		Buffer += "null";
+		return;
+	}
+
+	char Text[32];
+	std::to_chars_result Result;
+	const float AsFloat = static_cast<float>(Value);
+	if (static_cast<double>(AsFloat) == Value)
+	{
+		Result = std::to_chars(Text, Text + sizeof(Text), AsFloat);
+	}
+	else
+	{
+		Result = std::to_chars(Text, Text + sizeof(Text), Value);
+	}
+	Buffer.append(Text, Result.ptr);
+
+	// 다시 읽을 때 정수로 분류되지 않도록 (FJsonSerializer::ReadFloat는 Floating만 허용)
+	bool bHasFraction = false;
+	for (const char* Cursor = Text; Cursor < Result.ptr; ++Cursor)
+	{
+		if (*Cursor == '.' || *Cursor == 'e' || *Cursor == 'E')
+		{
+			bHasFraction = true;
+			break;
+		}
+	}
+	if (!bHasFraction)
+	{
+		Buffer += ".0";
+	}
+}
+
+void FJsonWriter::String(const char* Str, size_t Length)
+{
+	BeforeValue();
+	Buffer += '\"';
+	AppendEscaped(Str, Length);
+	Buffer += '\"';
+	MaybeFlush();
+}
+
+void FJsonWriter::Value(const JSON& Node)
+{
+	switch (Node.JSONType())
+	{
+	case JSON::Class::Object:
+		BeginObject();
+		for (const auto& Pair : Node.ObjectRange())
+		{
+			Key(Pair.first);
+			Value(Pair.second);
+		}
+		EndObject();
+		break;
+	case JSON::Class::Array:
+		BeginArray();
+		for (const JSON& Element : Node.ArrayRange())
+		{
+			Value(Element);
+		}
+		EndArray();
+		break;
+	case JSON::Class::String:
+		// ToString()이 이미 json_escape 결과이므로 그대로 씀
+		BeforeValue();
+		Buffer += '\"';
+		Buffer += Node.ToString();
+		Buffer += '\"';
+		MaybeFlush();
+		break;
+	case JSON::Class::Floating:
+		Float(Node.ToFloat());
+		break;
+	case JSON::Class::Integral:
+		Integer(Node.ToInt());
+		break;
+	case JSON::Class::Boolean:
+		Bool(Node.ToBool());
+		break;
+	default:
+		Null();
+		break;
+	}
+}
+
+bool FJsonWriter::Flush()
+{
+	if (!Buffer.empty())
+	{
+		Stream.write(Buffer.data(), static_cast<std::streamsize>(Buffer.size()));
+		Buffer.clear();
+	}
+	return static_cast<bool>(Stream);
+}
+
+bool FJsonWriter::WriteDomToFile(const JSON& Root, const FWideString& FilePath)
+{
+	std::ofstream File(fs::path(FilePath), std::ios::binary | std::ios::out | std::ios::trunc);
+	if (!File.is_open())
+	{
+		return false;
+	}
+
+	{
+		FJsonWriter Writer(File);
+		Writer.Value(Root);
+		if (!Writer.Flush())
+		{
+			return false;
+		}
+	}
+	File << "\n";
+	return static_cast<bool>(File);
+}
+
+// ─────────────────────────────
+// FJsonStreamBenchmark
+// ─────────────────────────────
+
+namespace
+{
+	// 이벤트 수만 세는 핸들러 (파싱 자체 비용 측정용)
+	class FJsonCountingHandler : public IJsonHandler
+	{
+	public:
+		bool OnNull() override { ++NumEvents; return true; }
+		bool OnBool(bool) override { ++NumEvents; return true; }
+		bool OnInteger(int64) override { ++NumEvents; return true; }
+		bool OnFloat(double) override { ++NumEvents; return true; }
+		bool OnString(const char*, size_t) override { ++NumEvents; return true; }
+		bool OnKey(const char*, size_t) override { ++NumEvents; return true; }
+		bool OnBeginObject() override { ++NumEvents; return true; }
+		bool OnEndObject() override { ++NumEvents; return true; }
+		bool OnBeginArray() override { ++NumEvents; return true; }
+		bool OnEndArray() override { ++NumEvents; return true; }
+
+		uint64 NumEvents = 0;
+	};
+
+	void WriteVector(FJsonWriter& Writer, const char* Key, float X, float Y, float Z)
+	{
+		Writer.Key(Key);
+		Writer.BeginArray();
+		Writer.Float(X);
+		Writer.Float(Y);
+		Writer.Float(Z);
+		Writer.EndArray();
+	}
+
+	// 에디터가 저장하는 씬과 같은 모양의 액터 (스태틱 메시 + 박스 충돌체)
+	void WriteSyntheticActor(FJsonWriter& Writer, int32 ActorIndex)
+	{
+		const int32 ActorId = 1000 + ActorIndex * 3;
+		const float X = static_cast<float>(ActorIndex % 256) * 3.5f;
+		const float Y = static_cast<float>((ActorIndex / 256) % 256) * 3.5f;
+		const float Z = std::sin(ActorIndex * 0.01f) * 2.0f;
+
+		Writer.Key(std::to_string(ActorId));
+		Writer.BeginObject();
+		Writer.Key("Type");
+		Writer.String("AStaticMeshActor");
+		Writer.Key("ObjectName");
+		Writer.String("StaticMeshActor_" + std::to_string(ActorIndex));
+		Writer.Key("bIsActive");
+		Writer.Bool(true);
+		Writer.Key("RootComponentId");
+		Writer.Integer(ActorId + 1);
+		Writer.Key("OwnedComponents");
+		Writer.BeginArray();
+		for (int32 ComponentIndex = 0; ComponentIndex < 2; ++ComponentIndex)
+		{
+			Writer.BeginObject();
+			Writer.Key("Id");
+			Writer.Integer(ActorId + 1 + ComponentIndex);
+			Writer.Key("ParentId");
+			Writer.Integer(ComponentIndex == 0 ? 0 : ActorId + 1);
+			Writer.Key("Type");
+			Writer.String(ComponentIndex == 0 ? "UStaticMeshComponent" : "UBoxComponent");
+			WriteVector(Writer, "RelativeLocation", ComponentIndex == 0 ? X : 0.0f, ComponentIndex == 0 ? Y : 0.0f, ComponentIndex == 0 ? Z : 0.5f);
+			WriteVector(Writer, "RelativeRotation", 0.0f, 0.0f, static_cast<float>(ActorIndex % 360));
+			WriteVector(Writer, "RelativeScale", 1.0f, 1.0f, 1.0f + (ActorIndex % 7) * 0.125f);
+			if (ComponentIndex == 0)
+			{
+				Writer.Key("StaticMesh");
+				Writer.String("Data/Model/Cube.obj");
+				Writer.Key("MaterialSlots");
+				Writer.BeginArray();
+				Writer.String("Shaders/Materials/UberLit.hlsl");
+				Writer.EndArray();
+			}
+			else
+			{
+				WriteVector(Writer, "BoxExtent", 0.5f, 0.5f, 0.5f);
+				Writer.Key("bGenerateOverlapEvents");
+				Writer.Bool(true);
+			}
+			Writer.EndObject();
+		}
+		Writer.EndArray();
+		Writer.EndObject();
+	}
+
+	FString WriteDomToString(const JSON& Root)
+	{
+		std::ostringstream Stream;
+		{
+			FJsonWriter Writer(Stream);
+			Writer.Value(Root);
+		}
+		return Stream.str();
+	}
+}
+
+FJsonStreamBenchmarkResult FJsonStreamBenchmark::Run(int32 TargetMB)
+{
+	FJsonStreamBenchmarkResult Result;
+	const uint64 TargetBytes = static_cast<uint64>(TargetMB > 0 ? TargetMB : 1) * 1024 * 1024;
+
+	std::error_code ErrorCode;
+	fs::create_directories(fs::path(UTF8ToWide(GCacheDir)), ErrorCode);
+	const FWideString FilePath = UTF8ToWide(GCacheDir + "/JsonStreamBenchmark.scene");
+	const FWideString LegacyOutPath = UTF8ToWide(GCacheDir + "/JsonStreamBenchmark.legacy.scene");
+	const FWideString StreamOutPath = UTF8ToWide(GCacheDir + "/JsonStreamBenchmark.stream.scene");
+
+	// 1. 합성 씬 생성 (스트리밍 라이터로 바로 파일에 기록)
+	uint64 Start = FPlatformTime::Cycles64();
+	{
+		std::ofstream File(fs::path(FilePath), std::ios::binary | std::ios::out | std::ios::trunc);
+		FJsonWriter Writer(File);
+		Writer.BeginObject();
+		Writer.Key("Version");
+		Writer.Integer(1);
+		Writer.Key("PerspectiveCamera");
+		Writer.BeginObject();
+		WriteVector(Writer, "Location", -10.0f, 0.0f, 5.0f);
+		WriteVector(Writer, "Rotation", 0.0f, 15.0f, 0.0f);
+		Writer.Key("FOV");
+		Writer.BeginArray();
+		Writer.Float(60.0f);
+		Writer.EndArray();
+		Writer.EndObject();
+		Writer.Key("Actors");
+		Writer.BeginObject();
+		while (static_cast<uint64>(File.tellp()) < TargetBytes)
+		{
+			WriteSyntheticActor(Writer, Result.NumActors++);
+			if (Result.NumActors % 256 == 0)
+			{
+				Writer.Flush();
+			}
+		}
+		Writer.EndObject();
+		Writer.EndObject();
+		Writer.Flush();
+		Result.FileSizeMB = static_cast<double>(File.tellp()) / (1024.0 * 1024.0);
+	}
+	Result.GenerateMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	// 2. 레거시 읽기: 파일 전체 복사 + JSON::Load
+	JSON LegacyDom;
+	Start = FPlatformTime::Cycles64();
+	{
+		std::ifstream File(fs::path(FilePath), std::ios::in);
+		FString FileContent((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>());
+		LegacyDom = JSON::Load(FileContent);
+	}
+	Result.LegacyParseMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	// 3. SAX만 (트리 없음)
+	Start = FPlatformTime::Cycles64();
+	{
+		FJsonCountingHandler Counter;
+		FJsonReader::ParseFile(FilePath, Counter);
+		Result.NumEvents = Counter.NumEvents;
+	}
+	Result.SaxParseMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	// 4. SAX + DOM
+	JSON StreamDom;
+	Start = FPlatformTime::Cycles64();
+	{
+		FJsonDomBuilder Builder(StreamDom);
+		FJsonReader::ParseFile(FilePath, Builder);
+		Result.NumDomNodes = Builder.GetNumNodes();
+	}
+	Result.DomBuildMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	// 5. 쓰기: dump 문자열 조립 vs 스트리밍
+	Start = FPlatformTime::Cycles64();
+	{
+		std::ofstream File(fs::path(LegacyOutPath), std::ios::out | std::ios::trunc);
+		File << std::setw(2) << LegacyDom << "\n";
+	}
+	Result.LegacyWriteMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	Start = FPlatformTime::Cycles64();
+	FJsonWriter::WriteDomToFile(StreamDom, StreamOutPath);
+	Result.StreamWriteMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+	// 6. 검증: 같은 DOM인지, 스트리밍 출력을 다시 읽어도 같은지
+	const FString StreamText = WriteDomToString(StreamDom);
+	Result.bDomMatches = (WriteDomToString(LegacyDom) == StreamText);
+	LegacyDom = JSON();
+	{
+		JSON RoundTripDom;
+		Result.bRoundTripMatches = FJsonReader::ParseFileToDom(StreamOutPath, RoundTripDom) && WriteDomToString(RoundTripDom) == StreamText;
+	}
+
+	fs::remove(fs::path(FilePath), ErrorCode);
+	fs::remove(fs::path(LegacyOutPath), ErrorCode);
+	fs::remove(fs::path(StreamOutPath), ErrorCode);
+	return Result;
+}
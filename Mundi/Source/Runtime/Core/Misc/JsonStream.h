@@ -0,0 +1,207 @@
+#pragma once
+#include "UEContainer.h"
+#include "nlohmann/json.hpp"
+#include <ostream>
+
+using JSON = json::JSON;
+
+/**
+ * @class IJsonHandler
+ * @brief FJsonReader가 값을 만날 때마다 호출하는 SAX 콜백입니다. false를 반환하면 파싱을 중단합니다.
+ *        문자열/키는 이스케이프가 풀린 값이며, 포인터는 콜백 안에서만 유효합니다. (매핑된 파일을 직접 가리킬 수 있음)
+ */
+class IJsonHandler
+{
+public:
+	virtual ~IJsonHandler() = default;
+
+	virtual bool OnNull() = 0;
+	virtual bool OnBool(bool bValue) = 0;
+	virtual bool OnInteger(int64 Value) = 0;
+	virtual bool OnFloat(double Value) = 0;
+	virtual bool OnString(const char* Str, size_t Length) = 0;
+	virtual bool OnKey(const char* Str, size_t Length) = 0;
+	virtual bool OnBeginObject() = 0;
+	virtual bool OnEndObject() = 0;
+	virtual bool OnBeginArray() = 0;
+	virtual bool OnEndArray() = 0;
+};
+
+/**
+ * @class FJsonReader
+ * @brief 버퍼를 한 번 순회하며 IJsonHandler로 이벤트를 보내는 스트리밍 파서입니다.
+ *
+ * - 중간 트리/토큰 문자열을 만들지 않음 (이스케이프가 없는 문자열은 입력 버퍼를 그대로 전달)
+ * - 재귀 대신 명시적 스택을 사용하므로 깊은 중첩에서도 스택 오버플로가 없음
+ * - 숫자는 std::from_chars로 변환. '.'이나 지수가 있으면 실수, 아니면 정수 (json.hpp와 같은 분류)
+ * - 문자열 이스케이프는 json.hpp 파서와 같은 값으로 풀림 (\uXXXX는 그대로 보존)
+ */
+class FJsonReader
+{
+public:
+	/** @return 성공하면 true. 실패 시 GetError()/GetErrorOffset()에 원인 기록 */
+	bool Parse(const char* Data, size_t Size, IJsonHandler& Handler);
+
+	const char* GetError() const { return Error; }
+	size_t GetErrorOffset() const { return ErrorOffset; }
+
+	/** 파일을 메모리 매핑해 Handler로 파싱 (빈 파일은 이벤트 없이 성공) */
+	static bool ParseFile(const FWideString& FilePath, IJsonHandler& Handler);
+
+	/** 파일을 파싱해 json::JSON DOM을 만듦 (FJsonSerializer::LoadJsonFromFile의 구현) */
+	static bool ParseFileToDom(const FWideString& FilePath, JSON& OutJson);
+
+	/** 이미 있는 DOM을 파싱할 때와 같은 이벤트 순서로 Handler에 전달 (문자열은 이스케이프가 풀린 값) */
+	static bool VisitDom(const JSON& Node, IJsonHandler& Handler);
+
+private:
+	bool Fail(const char* InError, const char* At);
+	bool ReadString(const char*& Cursor, const char* End, const char*& OutStr, size_t& OutLength);
+
+	FString Scratch;				// 이스케이프가 있는 문자열을 풀어 쓰는 버퍼 (재사용)
+	const char* Begin = nullptr;
+	const char* Error = nullptr;
+	size_t ErrorOffset = 0;
+};
+
+/**
+ * @class FJsonDomBuilder
+ * @brief SAX 이벤트로 json::JSON DOM을 만듭니다. 값은 부모 노드 안에 바로 생성되므로 복사가 없습니다.
+ */
+class FJsonDomBuilder : public IJsonHandler
+{
+public:
+	explicit FJsonDomBuilder(JSON& InRoot) : Root(InRoot) {}
+
+	bool OnNull() override { Emplace() = JSON(); return true; }
+	bool OnBool(bool bValue) override { Emplace() = bValue; return true; }
+	bool OnInteger(int64 Value) override;
+	bool OnFloat(double Value) override { Emplace() = Value; return true; }
+	bool OnString(const char* Str, size_t Length) override { Emplace() = FString(Str, Length); return true; }
+	bool OnKey(const char* Str, size_t Length) override { PendingKey.assign(Str, Length); return true; }
+	bool OnBeginObject() override;
+	bool OnEndObject() override { Stack.pop_back(); return true; }
+	bool OnBeginArray() override;
+	bool OnEndArray() override { Stack.pop_back(); return true; }
+
+	/** 지금까지 만든 노드 수 (벤치마크용) */
+	uint64 GetNumNodes() const { return NumNodes; }
+
+	/** 문자열 노드의 원래 값 (json::JSON::ToString()은 이스케이프된 문자열을 반환하므로 되돌림) */
+	static FString GetRawString(const JSON& StringNode);
+
+private:
+	struct FFrame
+	{
+		JSON* Node;
+		uint32 NextIndex;
+	};
+
+	JSON& Emplace();
+
+	JSON& Root;
+	TArray<FFrame> Stack;
+	FString PendingKey;
+	uint64 NumNodes = 0;
+};
+
+/**
+ * @class FJsonWriter
+ * @brief 값을 바로 출력 스트림에 쓰는 스트리밍 JSON 라이터입니다. (내부 버퍼가 차면 스트림으로 플러시)
+ *        IJsonHandler이기도 하므로 FJsonReader 출력을 그대로 연결할 수 있습니다.
+ *
+ * - 객체는 한 줄에 키 하나씩 2칸 들여쓰기, 배열은 한 줄 (json::JSON::dump와 같은 모양)
+ * - 실수는 항상 '.'이나 지수를 포함해 다시 읽었을 때 정수로 바뀌지 않음
+ *   NaN/Inf는 JSON으로 표현할 수 없어 에러 로그를 남기고 null로 기록
+ *   float로 정확히 표현되는 값은 float 최단 표기, 아니면 double 최단 표기 (왕복 시 같은 값)
+ */
+class FJsonWriter : public IJsonHandler
+{
+public:
+	explicit FJsonWriter(std::ostream& InStream, bool bInPretty = true);
+	~FJsonWriter() override { Flush(); }
+
+	FJsonWriter(const FJsonWriter&) = delete;
+	FJsonWriter& operator=(const FJsonWriter&) = delete;
+
+	void BeginObject();
+	void EndObject();
+	void BeginArray();
+	void EndArray();
+	void Key(const char* Str, size_t Length);
+	void Key(const FString& Str) { Key(Str.data(), Str.size()); }
+	void Null();
+	void Bool(bool bValue);
+	void Integer(int64 Value);
+	void Float(double Value);
+	void String(const char* Str, size_t Length);
+	void String(const FString& Str) { String(Str.data(), Str.size()); }
+
+	/** DOM 서브트리를 기록 */
+	void Value(const JSON& Node);
+
+	/** @return 스트림 상태가 정상이면 true */
+	bool Flush();
+
+	// IJsonHandler
+	bool OnNull() override { Null(); return true; }
+	bool OnBool(bool bValue) override { Bool(bValue); return true; }
+	bool OnInteger(int64 InValue) override { Integer(InValue); return true; }
+	bool OnFloat(double InValue) override { Float(InValue); return true; }
+	bool OnString(const char* Str, size_t Length) override { String(Str, Length); return true; }
+	bool OnKey(const char* Str, size_t Length) override { Key(Str, Length); return true; }
+	bool OnBeginObject() override { BeginObject(); return true; }
+	bool OnEndObject() override { EndObject(); return true; }
+	bool OnBeginArray() override { BeginArray(); return true; }
+	bool OnEndArray() override { EndArray(); return true; }
+
+	/** DOM을 파일로 저장 (FJsonSerializer::SaveJsonToFile의 구현) */
+	static bool WriteDomToFile(const JSON& Root, const FWideString& FilePath);
+
+private:
+	struct FFrame
+	{
+		bool bIsObject;
+		bool bHasElements;
+	};
+
+	void BeforeValue();
+	void NewLine();
+	void AppendEscaped(const char* Str, size_t Length);
+	void MaybeFlush() { if (Buffer.size() >= FlushThreshold) { Flush(); } }
+
+	static constexpr size_t FlushThreshold = 1 << 20;
+
+	std::ostream& Stream;
+	bool bPretty;
+	bool bAfterKey = false;
+	FString Buffer;
+	TArray<FFrame> Stack;
+};
+
+/**
+ * @struct FJsonStreamBenchmarkResult
+ * @brief FJsonStreamBenchmark::Run 결과입니다.
+ */
+struct FJsonStreamBenchmarkResult
+{
+	int32 NumActors = 0;
+	double FileSizeMB = 0.0;
+	double GenerateMS = 0.0;
+	double LegacyParseMS = 0.0;		// 파일 전체 FString 복사 + JSON::Load (이전 LoadJsonFromFile)
+	double SaxParseMS = 0.0;		// FJsonReader, 이벤트만 집계 (트리 없음)
+	double DomBuildMS = 0.0;		// FJsonReader + FJsonDomBuilder
+	double LegacyWriteMS = 0.0;		// JSON::dump 문자열 조립 후 기록 (이전 SaveJsonToFile)
+	double StreamWriteMS = 0.0;		// FJsonWriter로 DOM을 바로 기록
+	uint64 NumEvents = 0;
+	uint64 NumDomNodes = 0;
+	bool bDomMatches = false;		// 레거시/새 DOM을 같은 라이터로 쓴 결과가 같은지
+	bool bRoundTripMatches = false;	// 새 라이터 출력을 다시 읽어 쓴 결과가 같은지
+};
+
+class FJsonStreamBenchmark
+{
+public:
+	/** @brief 약 TargetMB 크기의 합성 씬 JSON을 만들어 레거시/스트리밍 읽기·쓰기를 비교합니다. */
+	static FJsonStreamBenchmarkResult Run(int32 TargetMB = 100);
+};
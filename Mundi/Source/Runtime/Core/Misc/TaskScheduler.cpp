@@ -0,0 +1,169 @@
+#include "pch.h"
+#include "TaskScheduler.h"
+
+TArray<std::thread> FTaskScheduler::Workers;
+std::deque<FTaskScheduler::FTask> FTaskScheduler::TaskQueue;
+std::mutex FTaskScheduler::QueueMutex;
+std::condition_variable FTaskScheduler::QueueCondition;
+bool FTaskScheduler::bStopping = false;
+
+namespace
+{
+	// ParallelFor 한 번의 공유 상태.
+	// 늦게 깨어난 워커가 ParallelFor 반환 이후에 접근할 수 있으므로 shared_ptr로 수명을 관리한다.
+	struct FParallelForState
+	{
+		const FTaskScheduler::FParallelForBody* Body = nullptr;
+		int32 Num = 0;
+		int32 NumChunks = 0;
+		std::atomic<int32> NextChunk{ 0 };
+		std::atomic<int32> CompletedChunks{ 0 };
+		std::mutex DoneMutex;
+		std::condition_variable DoneCondition;
+	};
+
+	void RunParallelForChunks(FParallelForState& State)
+	{
+		while (true)
+		{
+			const int32 ChunkIndex = State.NextChunk.fetch_add(1);
+			if (ChunkIndex >= State.NumChunks)
+			{
+				// 이미 모든 청크가 할당됨. Body는 더 이상 유효하지 않을 수 있으므로 접근하지 않는다.
+				return;
+			}
+
+			const int32 Begin = static_cast<int32>(static_cast<int64>(State.Num) * ChunkIndex / State.NumChunks);
+			const int32 End = static_cast<int32>(static_cast<int64>(State.Num) * (ChunkIndex + 1) / State.NumChunks);
+			(*State.Body)(ChunkIndex, Begin, End);
+
+			if (State.CompletedChunks.fetch_add(1) + 1 == State.NumChunks)
+			{
+				std::lock_guard<std::mutex> Lock(State.DoneMutex);
+				State.DoneCondition.notify_all();
+			}
+		}
+	}
+}
+
+void FTaskScheduler::Initialize(int32 InNumWorkers)
+{
+	if (!Workers.IsEmpty())
+	{
+		return;
+	}
+
+	int32 NumWorkers = InNumWorkers;
+	if (NumWorkers < 0)
+	{
+		NumWorkers = FMath::Max(static_cast<int32>(std::thread::hardware_concurrency()) - 1, 0);
+	}
+
+	bStopping = false;
+	Workers.Reserve(NumWorkers);
+	for (int32 Index = 0; Index < NumWorkers; ++Index)
+	{
+		Workers.Emplace(&FTaskScheduler::WorkerMain);
+	}
+
+	UE_LOG("[info] FTaskScheduler: %d worker threads", NumWorkers);
+}
+
+void FTaskScheduler::Shutdown()
+{
+	{
+		std::lock_guard<std::mutex> Lock(QueueMutex);
+		bStopping = true;
+	}
+	QueueCondition.notify_all();
+
+	for (std::thread& Worker : Workers)
+	{
+		if (Worker.joinable())
+		{
+			Worker.join();
+		}
+	}
+	Workers.Empty();
+	TaskQueue.clear();
+}
+
+void FTaskScheduler::Enqueue(FTask Task)
+{
+	if (Workers.IsEmpty())
+	{
+		Task();
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(QueueMutex);
+		TaskQueue.push_back(std::move(Task));
+	}
+	QueueCondition.notify_one();
+}
+
+int32 FTaskScheduler::ComputeNumChunks(int32 Num, int32 MinItemsPerChunk)
+{
+	if (Num <= 0)
+	{
+		return 0;
+	}
+
+	const int32 MaxChunks = GetNumWorkers() + 1;
+	const int32 ChunksBySize = (Num + FMath::Max(MinItemsPerChunk, 1) - 1) / FMath::Max(MinItemsPerChunk, 1);
+	return FMath::Clamp(ChunksBySize, 1, MaxChunks);
+}
+
+void FTaskScheduler::ParallelFor(int32 Num, int32 NumChunks, const FParallelForBody& Body)
+{
+	if (Num <= 0 || NumChunks <= 0)
+	{
+		return;
+	}
+
+	NumChunks = FMath::Min(NumChunks, Num);
+
+	// 청크가 하나면 스레드 동기화 비용 없이 바로 실행
+	if (NumChunks == 1)
+	{
+		Body(0, 0, Num);
+		return;
+	}
+
+	std::shared_ptr<FParallelForState> State = std::make_shared<FParallelForState>();
+	State->Body = &Body;
+	State->Num = Num;
+	State->NumChunks = NumChunks;
+
+	// 호출 스레드가 한 몫을 맡으므로 도우미는 (청크 수 - 1)개까지만 필요
+	const int32 NumHelpers = FMath::Min(NumChunks - 1, GetNumWorkers());
+	for (int32 Index = 0; Index < NumHelpers; ++Index)
+	{
+		Enqueue([State]() { RunParallelForChunks(*State); });
+	}
+
+	RunParallelForChunks(*State);
+
+	std::unique_lock<std::mutex> Lock(State->DoneMutex);
+	State->DoneCondition.wait(Lock, [&State]() { return State->CompletedChunks.load() == State->NumChunks; });
+}
+
+void FTaskScheduler::WorkerMain()
+{
+	while (true)
+	{
+		FTask Task;
+		{
+			std::unique_lock<std::mutex> Lock(QueueMutex);
+			QueueCondition.wait(Lock, []() { return bStopping || !TaskQueue.empty(); });
+			if (bStopping && TaskQueue.empty())
+			{
+				return;
+			}
+			Task = std::move(TaskQueue.front());
+			TaskQueue.pop_front();
+		}
+		Task();
+	}
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include "UEContainer.h"
+
+/**
+ * @class FTaskScheduler
+ * @brief 고정 개수의 워커 스레드로 작업을 분배하는 전역 스레드 풀입니다.
+ *        엔진 Startup에서 Initialize, Shutdown에서 Shutdown을 호출합니다.
+ *
+ * ParallelFor는 호출 스레드도 청크 처리에 참여하므로, 워커가 모두 바쁘거나
+ * 초기화 전(워커 0개)이어도 교착 없이 직렬로 완료됩니다.
+ */
+class FTaskScheduler
+{
+public:
+	using FTask = std::function<void()>;
+
+	/**
+	 * @brief ParallelFor 청크 작업입니다. [Begin, End) 범위를 처리합니다.
+	 *        ChunkIndex는 0..NumChunks-1 이며, 청크별 출력 버퍼의 인덱스로 사용하면
+	 *        잠금 없이 결과를 모은 뒤 청크 순서대로 이어붙여 직렬 실행과 같은 순서를 얻을 수 있습니다.
+	 */
+	using FParallelForBody = std::function<void(int32 ChunkIndex, int32 Begin, int32 End)>;
+
+	/** @param InNumWorkers 워커 스레드 수. 음수면 (논리 코어 수 - 1) */
+	static void Initialize(int32 InNumWorkers = -1);
+	static void Shutdown();
+
+	static int32 GetNumWorkers() { return static_cast<int32>(Workers.Num()); }
+
+	/** @brief 워커 스레드에서 실행할 작업을 큐에 넣습니다. 워커가 없으면 즉시 호출 스레드에서 실행합니다. */
+	static void Enqueue(FTask Task);
+
+	/**
+	 * @brief Num개 항목을 청크 하나당 최소 MinItemsPerChunk개가 되도록 나눌 때의 청크 수를 계산합니다.
+	 *        (워커 수 + 호출 스레드)를 넘지 않습니다.
+	 */
+	static int32 ComputeNumChunks(int32 Num, int32 MinItemsPerChunk);
+
+	/**
+	 * @brief [0, Num) 범위를 NumChunks개 청크로 나누어 병렬 처리하고, 모든 청크가 끝날 때까지 대기합니다.
+	 * @note Body는 여러 스레드에서 동시에 호출되므로 청크 간에 공유 상태를 쓰면 안 됩니다.
+	 */
+	static void ParallelFor(int32 Num, int32 NumChunks, const FParallelForBody& Body);
+
+private:
+	static void WorkerMain();
+
+	static TArray<std::thread> Workers;
+	static std::deque<FTask> TaskQueue;
+	static std::mutex QueueMutex;
+	static std::condition_variable QueueCondition;
+	static bool bStopping;
+};
@@ -1,6 +1,9 @@
 ﻿#pragma once
 #include "Archive.h"
 #include "Vector.h"
+#include <memory>
+
+class FMeshBVH;
 
 // 직렬화 포맷 (FVertexDynamic와 역할이 달라서 분리됨)
 struct FNormalVertex
@@ -203,6 +206,9 @@ struct FStaticMesh
 
     bool bHasMaterial;
 
+    // 피킹용 삼각형 BVH. 쿠킹 시 빌드되어 캐시에 함께 저장됨 (없으면 UResourceManager::GetOrBuildMeshBVH가 지연 빌드)
+    std::shared_ptr<FMeshBVH> MeshBVH;
+
     friend FArchive& operator<<(FArchive& Ar, FStaticMesh& Mesh)
     {
         if (Ar.IsSaving())
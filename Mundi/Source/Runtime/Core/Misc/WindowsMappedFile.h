@@ -0,0 +1,80 @@
+#pragma once
+#include "UEContainer.h"
+#include "PathUtils.h"
+
+/**
+ * @class FWindowsMappedFile
+ * @brief 파일 전체를 읽기 전용으로 메모리 매핑합니다.
+ *        큰 텍스트/바이너리 에셋을 복사 없이 포인터로 순회할 때 사용합니다.
+ *        빈 파일은 매핑할 수 없으므로 열기만 하고 GetData() == nullptr, GetSize() == 0을 반환합니다.
+ */
+class FWindowsMappedFile
+{
+public:
+	FWindowsMappedFile() = default;
+	explicit FWindowsMappedFile(const FString& Filename) { Open(Filename); }
+	~FWindowsMappedFile() { Close(); }
+
+	FWindowsMappedFile(const FWindowsMappedFile&) = delete;
+	FWindowsMappedFile& operator=(const FWindowsMappedFile&) = delete;
+
+	bool Open(const FString& Filename)
+	{
+		Close();
+
+		FileHandle = CreateFileW(UTF8ToWide(Filename).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+			OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (FileHandle == INVALID_HANDLE_VALUE)
+		{
+			return false;
+		}
+
+		LARGE_INTEGER FileSize = {};
+		if (!GetFileSizeEx(FileHandle, &FileSize))
+		{
+			Close();
+			return false;
+		}
+
+		// 크기 0인 파일은 CreateFileMapping이 실패하므로 매핑 없이 연 상태로 둠
+		if (FileSize.QuadPart == 0)
+		{
+			return true;
+		}
+
+		MappingHandle = CreateFileMappingW(FileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!MappingHandle)
+		{
+			Close();
+			return false;
+		}
+
+		Data = static_cast<const uint8*>(MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0));
+		if (!Data)
+		{
+			Close();
+			return false;
+		}
+
+		Size = static_cast<size_t>(FileSize.QuadPart);
+		return true;
+	}
+
+	void Close()
+	{
+		if (Data) { UnmapViewOfFile(Data); Data = nullptr; }
+		if (MappingHandle) { CloseHandle(MappingHandle); MappingHandle = nullptr; }
+		if (FileHandle != INVALID_HANDLE_VALUE) { CloseHandle(FileHandle); FileHandle = INVALID_HANDLE_VALUE; }
+		Size = 0;
+	}
+
+	bool IsOpen() const { return FileHandle != INVALID_HANDLE_VALUE; }
+	const uint8* GetData() const { return Data; }
+	size_t GetSize() const { return Size; }
+
+private:
+	HANDLE FileHandle = INVALID_HANDLE_VALUE;
+	HANDLE MappingHandle = nullptr;
+	const uint8* Data = nullptr;
+	size_t Size = 0;
+};
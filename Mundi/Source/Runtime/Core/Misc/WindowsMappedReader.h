@@ -0,0 +1,46 @@
+#pragma once
+#include "Archive.h"
+#include "WindowsMappedFile.h"
+#include <stdexcept>
+
+/**
+ * @class FWindowsMappedReader
+ * @brief 메모리 매핑된 파일에서 읽는 FArchive (FWindowsBinReader 대체).
+ *        필드마다 ifstream::read를 호출하지 않고 매핑된 뷰에서 memcpy합니다.
+ *        파일 끝을 넘겨 읽으면 캐시 손상으로 보고 예외를 던집니다.
+ */
+class FWindowsMappedReader : public FArchive
+{
+public:
+    FWindowsMappedReader(const FString& Filename)
+        : FArchive(true, false) // Loading 모드
+    {
+        File.Open(Filename);
+    }
+    ~FWindowsMappedReader() { Close(); }
+
+    bool IsOpen() const
+    {
+        return File.IsOpen();
+    }
+
+    void Serialize(void* Data, int64 Length) override
+    {
+        if (Length < 0 || static_cast<uint64>(Length) > File.GetSize() - Offset)
+        {
+            throw std::runtime_error("Cache corrupt: Read past end of file.");
+        }
+        memcpy(Data, File.GetData() + Offset, static_cast<size_t>(Length));
+        Offset += static_cast<size_t>(Length);
+    }
+
+    bool Close() override
+    {
+        if (File.IsOpen()) { File.Close(); Offset = 0; return true; }
+        return false;
+    }
+
+private:
+    FWindowsMappedFile File;
+    size_t Offset = 0;
+};
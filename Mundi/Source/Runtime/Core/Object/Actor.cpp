@@ -57,31 +57,8 @@ void AActor::BeginPlay()
 
 void AActor::Tick(float DeltaSeconds)
 {
-	// Actor 레벨 에디터 틱 체크 (Preview World에서는 항상 틱 허용)
-	if (!bTickInEditor && !World->bPie && !World->IsPreviewWorld()) return;
-
-	for (UActorComponent* Comp : OwnedComponents)
-	{
-		if (Comp && Comp->IsComponentTickEnabled())
-		{
-			// 에디터 모드일 때 컴포넌트별 bTickInEditor 체크 (Preview World 포함)
-			bool bShouldTick = World->bPie || Comp->CanTickInEditor() || World->IsPreviewWorld();
-
-			// DEBUG: 컴포넌트 틱 조건 확인 (추후 제거)
-			static bool bLoggedComp = false;
-			if (!bLoggedComp && !World->bPie)
-			{
-				UE_LOG("[Actor::Tick] Comp=%s, bShouldTick=%d, CanTickInEditor=%d",
-					Comp->ObjectName.ToString(), bShouldTick, Comp->CanTickInEditor());
-				bLoggedComp = true;
-			}
-
-			if (bShouldTick)
-			{
-				Comp->TickComponent(DeltaSeconds);
-			}
-		}
-	}
+	// 컴포넌트 틱은 UWorld의 FTickTaskManager가 틱 목록에서 직접 처리함 (기본 설정 컴포넌트는 액터 Tick보다 먼저)
+	// 에디터 틱 조건(bTickInEditor)도 FTickTaskManager에서 확인
 }
 
 void AActor::EndPlay()
@@ -202,6 +179,10 @@ void AActor::AddOwnedComponent(UActorComponent* Component)
 
 	OwnedComponents.insert(Component);
 	Component->SetOwner(this);
+	if (UWorld* OwningWorld = GetWorld())
+	{
+		OwningWorld->MarkLevelModified(this);
+	}
 	if (USceneComponent* SC = Cast<USceneComponent>(Component))
 	{
 		SceneComponents.AddUnique(SC);
@@ -252,6 +233,7 @@ void AActor::RemoveOwnedComponent(UActorComponent* Component)
 
 	// OwnedComponents에서 제거
 	OwnedComponents.erase(Component);
+	GetWorld()->MarkLevelModified(this);
 
 	Component->DestroyComponent();
 }
@@ -531,6 +513,7 @@ void AActor::SetActorHiddenInEditor(bool bNewHidden)
 {
 	bHiddenInEditor = bNewHidden; 
 	GWorld->GetLightManager()->SetDirtyFlag();
+	GWorld->MarkLevelModified(this);
 }
 
 bool AActor::IsActorVisible() const
@@ -207,7 +207,7 @@ protected:
     bool bPendingDestroy = false;
 
     bool bIsPicked = false;
-    bool bCanEverTick = true;   // Tick을 허용하는 Actor 라는 뜻 (생성자 시점에만 변경해야 됨)
+    bool bCanEverTick = true;   // Tick을 허용하는 Actor 라는 뜻 (생성자 시점에만 변경해야 됨, 월드 틱 목록 등록 기준. 컴포넌트 틱과는 무관)
     bool bIsCulled = false;
 
     float CustomTimeDillation;
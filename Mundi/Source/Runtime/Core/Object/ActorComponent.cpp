@@ -3,6 +3,7 @@
 #include "Actor.h"
 #include "World.h"
 #include "SelectionManager.h"
+#include "TickTaskManager.h"
 
 //BEGIN_PROPERTIES(UActorComponent)
 //    ADD_PROPERTY(FName, ObjectName, "[컴포넌트]", true, "컴포넌트의 이름입니다")
@@ -52,6 +53,14 @@ void UActorComponent::RegisterComponent(UWorld* InWorld)
 
     bRegistered = true;
     OnRegister(InWorld);
+
+    if (bCanEverTick && InWorld)
+    {
+        if (FTickTaskManager* TickTaskManager = InWorld->GetTickTaskManager())
+        {
+            TickTaskManager->RegisterComponentTick(this);
+        }
+    }
 }
 
 // DestroyComponent에서 스스로 호출됨 (내부에서도 처리 가능하기 때문에)
@@ -62,6 +71,15 @@ void UActorComponent::UnregisterComponent()
         return;
     }
 
+    // 틱 목록에서 해제 (틱 도중이면 이번 프레임의 남은 틱에서도 제외)
+    if (UWorld* World = GetWorld())
+    {
+        if (FTickTaskManager* TickTaskManager = World->GetTickTaskManager())
+        {
+            TickTaskManager->UnregisterComponentTick(this);
+        }
+    }
+
     OnUnregister();
     bRegistered = false;
 }
@@ -98,6 +116,20 @@ void UActorComponent::TickComponent(float DeltaTime)
     // 매 프레임 처리
 }
 
+void UActorComponent::AddTickPrerequisiteComponent(UActorComponent* PrerequisiteComponent)
+{
+    if (!PrerequisiteComponent || PrerequisiteComponent == this)
+    {
+        return;
+    }
+    TickPrerequisites.AddUnique(PrerequisiteComponent);
+}
+
+void UActorComponent::RemoveTickPrerequisiteComponent(UActorComponent* PrerequisiteComponent)
+{
+    TickPrerequisites.Remove(PrerequisiteComponent);
+}
+
 // Override시 Super::EndPlay() 권장
 void UActorComponent::EndPlay()
 {
@@ -113,6 +145,7 @@ void UActorComponent::DuplicateSubObjects()
     Super::DuplicateSubObjects();
 
     Owner = nullptr; // Actor에서 이거 설정해 줌
+    TickPrerequisites.Empty(); // 원본 월드의 컴포넌트를 가리키므로 복사본에서는 다시 설정해야 함
 }
 
 void UActorComponent::PostDuplicate()
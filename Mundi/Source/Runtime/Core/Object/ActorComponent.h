@@ -5,6 +5,19 @@
 class AActor;
 class UWorld;
 
+/**
+ * 틱 그룹. UWorld::Tick에서 그룹 순서대로 실행됩니다.
+ * PrePhysics -> DuringPhysics -> (에디터 액터/Lua/지연 삭제) -> 물리 단계(충돌 갱신) -> PostPhysics -> PostUpdateWork
+ */
+enum class ETickingGroup : uint8
+{
+    PrePhysics,         // 기본값. 액터 Tick과 같은 그룹
+    DuringPhysics,
+    PostPhysics,        // 충돌 BVH/겹침 이벤트가 갱신된 뒤
+    PostUpdateWork,     // 다른 모든 틱이 끝난 뒤 (카메라 등 최종 결과를 읽는 작업)
+    Max
+};
+
 UCLASS(DisplayName="UActorComponent", Description="UActorComponent 컴포넌트")
 class UActorComponent : public UObject
 {
@@ -62,6 +75,33 @@ public:
 
     bool CanEverTick() const { return bCanEverTick; }
 
+    // ─────────────── 틱 스케줄 (UWorld의 FTickTaskManager)
+    // bCanEverTick 컴포넌트는 RegisterComponent 시 월드 틱 목록에 등록됨
+    // 기본(PrePhysics, 게임 스레드, 선행 조건 없음) 컴포넌트는 액터 Tick 직전에 바로 틱하고,
+    // 그 외에는 그룹/선행 조건 순서대로 스케줄해서 틱함
+    void SetTickGroup(ETickingGroup InTickGroup) { TickGroup = InTickGroup; }
+    ETickingGroup GetTickGroup() const { return TickGroup; }
+
+    // true면 같은 그룹/단계의 다른 컴포넌트와 워커 스레드에서 병렬로 틱함
+    // 조건: 소유 액터의 컴포넌트 상태만 바꾸고, 다른 액터 상태 읽기/Lua/사운드/스폰/파괴를 하지 않아야 함
+    // (트랜스폼 변경 알림(파티션/충돌/라이트 Dirty)은 스레드 안전)
+    void SetTickOnAnyThread(bool bInTickOnAnyThread) { bTickOnAnyThread = bInTickOnAnyThread; }
+    bool CanTickOnAnyThread() const { return bTickOnAnyThread; }
+
+    // 같은 프레임에서 PrerequisiteComponent가 틱한 뒤에 이 컴포넌트가 틱하도록 함
+    // 선행 컴포넌트가 더 늦은 그룹이면 이 컴포넌트도 그 그룹으로 밀려남. 순환은 끊고 경고
+    void AddTickPrerequisiteComponent(UActorComponent* PrerequisiteComponent);
+    void RemoveTickPrerequisiteComponent(UActorComponent* PrerequisiteComponent);
+    const TArray<UActorComponent*>& GetTickPrerequisites() const { return TickPrerequisites; }
+
+    bool RequiresTickScheduling() const
+    {
+        return TickGroup != ETickingGroup::PrePhysics || bTickOnAnyThread || !TickPrerequisites.IsEmpty();
+    }
+
+    // bTickOnAnyThread 컴포넌트의 틱 단계가 끝나면 게임 스레드에서 호출 (워커에서 미뤄둔 이벤트 처리용)
+    virtual void EndParallelTick() {}
+
     bool IsComponentTickEnabled() const
     {
         // 틱을 진짜 돌릴지 최종 판단(액터 Tick에서 이걸로 거른다)
@@ -97,6 +137,11 @@ protected:
     bool bIsNative = false;      // 액터의 기본 구성 컴포넌트인지 여부. 활성화되면 보호되어 UI에서 삭제 불가 상태가 됨 
     bool bIsEditable = true;    //UI에서 Edit이 가능한가
     bool bCanEverTick = false;   // 컴포넌트 설계상 틱 지원 여부
+    bool bTickOnAnyThread = false;  // 워커 스레드 병렬 틱 허용 (클래스 코드가 스레드 안전할 때만 생성자에서 켬)
+    ETickingGroup TickGroup = ETickingGroup::PrePhysics;
+
+    // 틱 선행 컴포넌트. 포인터 비교로만 쓰고 역참조하지 않음 (이번 프레임에 틱하지 않는 대상은 무시)
+    TArray<UActorComponent*> TickPrerequisites;
 
     // 설정 가능한 데이터
 
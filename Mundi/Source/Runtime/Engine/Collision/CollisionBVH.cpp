@@ -62,6 +62,7 @@ void FCollisionBVH::Clear()
 	// NOTE: TMap, TArray를 clear로 비우면 capacity가 그대로이기 때문에 새 객체로 초기화
 	ShapeComponentBounds = TMap<UShapeComponent*, FAABB>();
 	ShapeComponentArray = TArray<UShapeComponent*>();
+	ShapeComponentArrayBounds = TArray<FAABB>();
 	Nodes = TArray<FLBVHNode>();
 	Bounds = FAABB();
 	bPendingRebuild = false;
@@ -136,27 +137,32 @@ TArray<UShapeComponent*> FCollisionBVH::QueryOverlappingComponents(UShapeCompone
 TArray<UShapeComponent*> FCollisionBVH::QueryIntersectedComponents(const FAABB& InBound) const
 {
 	TArray<UShapeComponent*> Result;
+	QueryIntersectedComponents(InBound, Result);
+	return Result;
+}
 
+void FCollisionBVH::QueryIntersectedComponents(const FAABB& InBound, TArray<UShapeComponent*>& OutComponents) const
+{
 	if (Nodes.empty())
 	{
-		return Result;
+		return;
 	}
 
 	// 루트 노드와 교차하지 않으면 종료
 	if (!Nodes[0].Bounds.Intersects(InBound))
 	{
-		return Result;
+		return;
 	}
 
 	// DFS 스택 기반 순회
-	TArray<int32> IdxStack;
-	IdxStack.push_back(0);
+	// BuildRange가 중앙 분할이라 깊이는 log2(N / MaxObjects) 정도 -> 고정 크기 스택으로 충분
+	int32 IdxStack[64];
+	int32 StackSize = 0;
+	IdxStack[StackSize++] = 0;
 
-	while (!IdxStack.empty())
+	while (StackSize > 0)
 	{
-		int32 Idx = IdxStack.back();
-		IdxStack.pop_back();
-
+		const int32 Idx = IdxStack[--StackSize];
 		const FLBVHNode& Node = Nodes[Idx];
 
 		// 리프 노드: 컴포넌트 체크
@@ -165,15 +171,9 @@ TArray<UShapeComponent*> FCollisionBVH::QueryIntersectedComponents(const FAABB&
 			for (int32 i = 0; i < Node.Count; ++i)
 			{
 				UShapeComponent* Comp = ShapeComponentArray[Node.First + i];
-				if (!Comp)
-					continue;
-
-				const FAABB* Cached = ShapeComponentBounds.Find(Comp);
-				const FAABB Box = Cached ? *Cached : Comp->GetWorldAABB();
-
-				if (Box.Intersects(InBound))
+				if (Comp && ShapeComponentArrayBounds[Node.First + i].Intersects(InBound))
 				{
-					Result.push_back(Comp);
+					OutComponents.push_back(Comp);
 				}
 			}
 			continue;
@@ -182,16 +182,14 @@ TArray<UShapeComponent*> FCollisionBVH::QueryIntersectedComponents(const FAABB&
 		// 내부 노드: 자식 노드와 교차 체크
 		if (Node.Left >= 0 && Nodes[Node.Left].Bounds.Intersects(InBound))
 		{
-			IdxStack.push_back(Node.Left);
+			IdxStack[StackSize++] = Node.Left;
 		}
 
 		if (Node.Right >= 0 && Nodes[Node.Right].Bounds.Intersects(InBound))
 		{
-			IdxStack.push_back(Node.Right);
+			IdxStack[StackSize++] = Node.Right;
 		}
 	}
-
-	return Result;
 }
 
 // ────────────────────────────────────────────────────────────────────────────
@@ -375,9 +373,13 @@ void FCollisionBVH::BuildLBVH()
 			return LHS.second < RHS.second;
 		});
 
+	ShapeComponentArrayBounds.resize(N);
 	for (int i = 0; i < N; ++i)
 	{
 		ShapeComponentArray[i] = ComponentCodePairs[i].first;
+
+		const FAABB* Bound = ShapeComponentBounds.Find(ShapeComponentArray[i]);
+		ShapeComponentArrayBounds[i] = Bound ? *Bound : ShapeComponentArray[i]->GetWorldAABB();
 	}
 
 	// 5. BVH 트리 구축
@@ -99,6 +99,15 @@ public:
 	 */
 	TArray<UShapeComponent*> QueryIntersectedComponents(const FAABB& InBound) const;
 
+	/**
+	 * 특정 AABB와 겹치는 컴포넌트들을 OutComponents 뒤에 추가합니다.
+	 * 매 프레임 셰이프마다 쿼리하는 겹침 갱신용으로, 할당 없이 결과 배열을 재사용합니다.
+	 *
+	 * @param InBound - 쿼리할 AABB
+	 * @param OutComponents - 결과를 추가할 배열
+	 */
+	void QueryIntersectedComponents(const FAABB& InBound, TArray<UShapeComponent*>& OutComponents) const;
+
 	// ────────────────────────────────────────────────
 	// 디버그 / 통계
 	// ────────────────────────────────────────────────
@@ -218,6 +227,9 @@ private:
 	/** 컴포넌트 배열 (BuildLBVH에서 정렬됨) */
 	TArray<UShapeComponent*> ShapeComponentArray;
 
+	/** ShapeComponentArray와 같은 순서의 AABB (쿼리 시 맵 조회 없이 연속으로 읽음) */
+	TArray<FAABB> ShapeComponentArrayBounds;
+
 	/** LBVH 노드 배열 */
 	TArray<FLBVHNode> Nodes;
 
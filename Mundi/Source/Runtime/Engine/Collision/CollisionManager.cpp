@@ -5,8 +5,21 @@
 #include "pch.h"
 #include "CollisionManager.h"
 #include "ShapeComponent.h"
+#include "SphereComponent.h"
+#include "BoxComponent.h"
+#include "CapsuleComponent.h"
+#include "StaticMeshComponent.h"
+#include "StaticMeshActor.h"
+#include "StaticMesh.h"
+#include "MeshBVH.h"
+#include "Collision.h"
 #include "World.h"
+#include "WorldPartitionManager.h"
+#include "BVHierarchy.h"
 #include "Renderer.h"
+#include "TaskScheduler.h"
+#include "PlatformTime.h"
+#include <random>
 
 IMPLEMENT_CLASS(UCollisionManager)
 
@@ -19,6 +32,7 @@ UCollisionManager::UCollisionManager()
 	// BVH 초기화 (월드 크기에 맞게 설정)
 	FAABB WorldBounds(FVector(-100000, -100000, -100000), FVector(100000, 100000, 100000));
 	BVH = std::make_unique<FCollisionBVH>(WorldBounds, 0, 12, 8);
+	PhysicsScene = std::make_unique<FPhysicsScene>();
 }
 
 UCollisionManager::~UCollisionManager()
@@ -36,8 +50,15 @@ void UCollisionManager::RegisterComponent(UShapeComponent* Component)
 		return;
 	}
 
+	// 대량 등록 중에는 모아 두기만 함 (Contains가 선형 탐색이라 N개 등록이 O(N^2)이 되는 것 방지)
+	if (bBulkRegistering)
+	{
+		PendingBulkComponents.push_back(Component);
+		return;
+	}
+
 	// 이미 등록된 컴포넌트는 무시
-	if (RegisteredComponents.Contains(Component))
+	if (!RegisteredComponentSet.insert(Component).second)
 	{
 		return;
 	}
@@ -48,6 +69,9 @@ void UCollisionManager::RegisterComponent(UShapeComponent* Component)
 	// BVH에 추가
 	BVH->Update(Component);
 
+	// 강체 바디 추가 (시뮬레이션 여부는 매 프레임 컴포넌트 설정을 따름)
+	PhysicsScene->AddBody(Component);
+
 	// 대량 등록 시 재구축 플래그 설정
 	bNeedsFullRebuild = true;
 }
@@ -59,8 +83,16 @@ void UCollisionManager::UnregisterComponent(UShapeComponent* Component)
 		return;
 	}
 
+	if (bBulkRegistering)
+	{
+		PendingBulkComponents.erase(
+			std::remove(PendingBulkComponents.begin(), PendingBulkComponents.end(), Component),
+			PendingBulkComponents.end()
+		);
+	}
+
 	// 등록되지 않은 컴포넌트는 무시
-	if (!RegisteredComponents.Contains(Component))
+	if (!RegisteredComponentSet.Remove(Component))
 	{
 		return;
 	}
@@ -75,10 +107,13 @@ void UCollisionManager::UnregisterComponent(UShapeComponent* Component)
 	BVH->Remove(Component);
 
 	// Dirty 목록에서도 제거
-	DirtyComponents.erase(
-		std::remove(DirtyComponents.begin(), DirtyComponents.end(), Component),
-		DirtyComponents.end()
-	);
+	DirtyComponents.Remove(Component);
+
+	// 강체 바디 제거
+	PhysicsScene->RemoveBody(Component);
+
+	// 겹침 쌍과 상대 셰이프의 겹침 목록에서도 제거 (해제된 포인터가 남지 않도록)
+	RemoveOverlapPairs(Component);
 
 	bNeedsFullRebuild = true;
 }
@@ -90,19 +125,53 @@ void UCollisionManager::MarkComponentDirty(UShapeComponent* Component)
 		return;
 	}
 
-	// 등록된 컴포넌트만 Dirty 마킹
-	if (!RegisteredComponents.Contains(Component))
+	// 등록된 컴포넌트만 Dirty 마킹 (셰이프마다 매 틱 호출되므로 해시 조회만)
+	// 등록/해제는 게임 스레드에서만 일어나므로 조회는 잠금 없이, 추가만 병렬 틱과 경합
+	if (!RegisteredComponentSet.Contains(Component))
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> Lock(DirtyMutex);
+	DirtyComponents.Add(Component);
+}
+
+void UCollisionManager::BeginBulkRegister()
+{
+	bBulkRegistering = true;
+}
+
+void UCollisionManager::EndBulkRegister()
+{
+	if (!bBulkRegistering)
 	{
 		return;
 	}
+	bBulkRegistering = false;
 
-	// 이미 Dirty 목록에 있으면 무시
-	if (DirtyComponents.Contains(Component))
+	if (PendingBulkComponents.IsEmpty())
 	{
 		return;
 	}
 
-	DirtyComponents.push_back(Component);
+	// 기존 등록분과 대기분의 중복 제거 (순서 유지)
+	RegisteredComponents.Reserve(RegisteredComponents.Num() + PendingBulkComponents.Num());
+	for (UShapeComponent* Component : PendingBulkComponents)
+	{
+		if (RegisteredComponentSet.insert(Component).second)
+		{
+			RegisteredComponents.push_back(Component);
+			PhysicsScene->AddBody(Component);
+		}
+	}
+	PendingBulkComponents.Empty();
+
+	// 한 번에 바운드를 넣고 재구축
+	if (BVH)
+	{
+		BVH->BulkUpdate(RegisteredComponents);
+	}
+	bNeedsFullRebuild = false;
 }
 
 // ────────────────────────────────────────────────────────────────────────────
@@ -134,6 +203,230 @@ void UCollisionManager::UpdateCollisions(float DeltaTime)
 	// Dirty 플래그 초기화
 	ClearDirtyFlags();
 	bNeedsFullRebuild = false;
+
+	// 겹침 이벤트는 게임이 도는 월드에서만 (에디터 월드에서 게임플레이/Lua 이벤트가 불리지 않도록)
+	if (World && (World->bPie || World->IsPreviewWorld()))
+	{
+		UpdateOverlaps();
+		DispatchOverlapEvents();
+	}
+}
+
+void UCollisionManager::UpdateOverlaps()
+{
+	if (!BVH)
+	{
+		return;
+	}
+
+	// 기존 TickComponent와 같은 조건: 살아 있는 활성 액터의 셰이프만 (기본 UShapeComponent는 모양이 없어 제외)
+	auto IsOverlapCandidate = [](UShapeComponent* Comp)
+	{
+		if (!Comp || Comp->IsPendingDestroy() || Comp->GetClass() == UShapeComponent::StaticClass())
+		{
+			return false;
+		}
+		AActor* Owner = Comp->GetOwner();
+		return Owner && Owner->IsActorActive();
+	};
+
+	// 1. 브로드 페이즈(BVH 쿼리) + 내로우 페이즈
+	//    이벤트를 생성하는 셰이프만 쿼리. 둘 다 생성하면 양쪽에서 발견되므로 주소가 작은 쪽에서만 처리
+	NewOverlapPairs.clear();
+	for (UShapeComponent* Comp : RegisteredComponents)
+	{
+		if (!IsOverlapCandidate(Comp) || !Comp->bGenerateOverlapEvents)
+		{
+			continue;
+		}
+
+		QueryResults.clear();
+		BVH->QueryIntersectedComponents(Comp->GetWorldAABB(), QueryResults);
+		for (UShapeComponent* Other : QueryResults)
+		{
+			if (Other == Comp || (Other->bGenerateOverlapEvents && Other < Comp))
+			{
+				continue;
+			}
+			if (Other->GetOwner() == Comp->GetOwner() || !IsOverlapCandidate(Other))
+			{
+				continue;
+			}
+
+			++CollisionPairsChecked;
+			if (!Collision::CheckOverlap(Comp, Other))
+			{
+				continue;
+			}
+
+			NewOverlapPairs.push_back(Comp < Other ? FOverlapPair{ Comp, Other } : FOverlapPair{ Other, Comp });
+		}
+	}
+	std::sort(NewOverlapPairs.begin(), NewOverlapPairs.end());
+
+	// 2. 지난 프레임과 비교해 Begin/End 쌍 추출
+	BeginPairs.clear();
+	EndPairs.clear();
+	std::set_difference(NewOverlapPairs.begin(), NewOverlapPairs.end(), OverlapPairs.begin(), OverlapPairs.end(), std::back_inserter(BeginPairs));
+	std::set_difference(OverlapPairs.begin(), OverlapPairs.end(), NewOverlapPairs.begin(), NewOverlapPairs.end(), std::back_inserter(EndPairs));
+	OverlapPairs.swap(NewOverlapPairs);
+
+	// 3. 셰이프별 OverlapNow/OverlapPrev/OverlapInfos
+	//    상대가 이벤트를 생성하는 셰이프일 때만 목록에 넣음 (기존 TickComponent 동작과 동일)
+	for (UShapeComponent* Comp : RegisteredComponents)
+	{
+		if (Comp)
+		{
+			Comp->OverlapPrev.swap(Comp->OverlapNow);
+			Comp->OverlapNow.clear();
+		}
+	}
+	for (const FOverlapPair& Pair : OverlapPairs)
+	{
+		if (Pair.B->bGenerateOverlapEvents)
+		{
+			Pair.A->OverlapNow.Add(Pair.B);
+		}
+		if (Pair.A->bGenerateOverlapEvents)
+		{
+			Pair.B->OverlapNow.Add(Pair.A);
+		}
+	}
+	for (UShapeComponent* Comp : RegisteredComponents)
+	{
+		if (!Comp)
+		{
+			continue;
+		}
+
+		Comp->OverlapInfos.clear();
+		for (UShapeComponent* Other : Comp->OverlapNow)
+		{
+			FOverlapInfo Info;
+			Info.OtherActor = Other->GetOwner();
+			Info.Other = Other;
+			Comp->OverlapInfos.Add(Info);
+		}
+	}
+}
+
+void UCollisionManager::DispatchOverlapEvents()
+{
+	if (!World)
+	{
+		return;
+	}
+
+	// 이벤트 주체는 이벤트를 생성하는 쪽 (둘 다면 A). 액터 쌍당 프레임에 한 번만 (UWorld::TryMarkOverlapPair)
+	auto GetInstigator = [](const FOverlapPair& Pair)
+	{
+		return Pair.A->bGenerateOverlapEvents ? std::make_pair(Pair.A, Pair.B) : std::make_pair(Pair.B, Pair.A);
+	};
+
+	// 이벤트 핸들러에서 컴포넌트가 해제되면 RemoveOverlapPairs가 쌍을 비우므로 매번 확인
+	for (int32 Index = 0; Index < BeginPairs.Num(); ++Index)
+	{
+		const FOverlapPair Pair = BeginPairs[Index];
+		if (!Pair.A)
+		{
+			continue;
+		}
+
+		auto [Comp, Other] = GetInstigator(Pair);
+		if (Comp->IsPendingDestroy() || Other->IsPendingDestroy())
+		{
+			continue;
+		}
+
+		AActor* Owner = Comp->GetOwner();
+		AActor* OtherOwner = Other->GetOwner();
+		if (!(Owner && OtherOwner && World->TryMarkOverlapPair(Owner, OtherOwner)))
+		{
+			continue;
+		}
+
+		// 양방향 호출
+		Owner->OnComponentBeginOverlap.Broadcast(Comp, Other);
+		OtherOwner->OnComponentBeginOverlap.Broadcast(Other, Comp);
+
+		// Hit호출
+		Owner->OnComponentHit.Broadcast(Comp, Other);
+		if (Comp->bBlockComponent)
+		{
+			OtherOwner->OnComponentHit.Broadcast(Other, Comp);
+		}
+		++OverlapEventsTriggered;
+	}
+
+	for (int32 Index = 0; Index < EndPairs.Num(); ++Index)
+	{
+		const FOverlapPair Pair = EndPairs[Index];
+		if (!Pair.A)
+		{
+			continue;
+		}
+
+		auto [Comp, Other] = GetInstigator(Pair);
+		if (Comp->IsPendingDestroy() || Other->IsPendingDestroy())
+		{
+			continue;
+		}
+
+		AActor* Owner = Comp->GetOwner();
+		AActor* OtherOwner = Other->GetOwner();
+		if (!(Owner && OtherOwner && World->TryMarkOverlapPair(Owner, OtherOwner)))
+		{
+			continue;
+		}
+
+		// 양방향 호출
+		Owner->OnComponentEndOverlap.Broadcast(Comp, Other);
+		OtherOwner->OnComponentEndOverlap.Broadcast(Other, Comp);
+		++OverlapEventsTriggered;
+	}
+}
+
+void UCollisionManager::RemoveOverlapPairs(UShapeComponent* Component)
+{
+	auto Involves = [Component](const FOverlapPair& Pair)
+	{
+		return Pair.A == Component || Pair.B == Component;
+	};
+
+	for (const FOverlapPair& Pair : OverlapPairs)
+	{
+		if (!Involves(Pair))
+		{
+			continue;
+		}
+
+		UShapeComponent* Other = (Pair.A == Component) ? Pair.B : Pair.A;
+		Other->OverlapNow.Remove(Component);
+		Other->OverlapPrev.Remove(Component);
+		Other->OverlapInfos.erase(
+			std::remove_if(Other->OverlapInfos.begin(), Other->OverlapInfos.end(),
+				[Component](const FOverlapInfo& Info) { return Info.Other == Component; }),
+			Other->OverlapInfos.end()
+		);
+	}
+
+	OverlapPairs.erase(std::remove_if(OverlapPairs.begin(), OverlapPairs.end(), Involves), OverlapPairs.end());
+
+	// 이벤트 처리 중(DispatchOverlapEvents 순회 중)에 해제될 수 있으므로 지우지 않고 비워둠
+	for (TArray<FOverlapPair>* EventPairs : { &BeginPairs, &EndPairs })
+	{
+		for (FOverlapPair& Pair : *EventPairs)
+		{
+			if (Involves(Pair))
+			{
+				Pair = FOverlapPair();
+			}
+		}
+	}
+
+	Component->OverlapNow.clear();
+	Component->OverlapPrev.clear();
+	Component->OverlapInfos.clear();
 }
 
 void UCollisionManager::RebuildBVH()
@@ -147,6 +440,14 @@ void UCollisionManager::RebuildBVH()
 	BVH->BulkUpdate(RegisteredComponents);
 }
 
+void UCollisionManager::SimulatePhysics(float DeltaTime)
+{
+	if (PhysicsScene)
+	{
+		PhysicsScene->Simulate(DeltaTime);
+	}
+}
+
 // ────────────────────────────────────────────────────────────────────────────
 // 쿼리 API
 // ────────────────────────────────────────────────────────────────────────────
@@ -160,6 +461,622 @@ TArray<UShapeComponent*> UCollisionManager::QueryIntersectedComponents(const FAA
 	return BVH->QueryIntersectedComponents(InBound);
 }
 
+namespace
+{
+	constexpr int32 MinSweepsPerChunk = 32;
+
+	// 코어가 Delta만큼 이동하며 지나가는 영역의 AABB (접촉 허용 거리만큼 여유)
+	FAABB ComputeSweptBounds(const CollisionQuery::FConvexCore& Core, const FVector& Delta)
+	{
+		FVector Min = Core.Points[0];
+		FVector Max = Core.Points[0];
+		for (int32 i = 0; i < Core.NumPoints; ++i)
+		{
+			for (const FVector& Point : { Core.Points[i], Core.Points[i] + Delta })
+			{
+				Min = Min.ComponentMin(Point);
+				Max = Max.ComponentMax(Point);
+			}
+		}
+		const float Margin = Core.Radius + CollisionQuery::ContactTolerance;
+		return FAABB(Min - Margin, Max + Margin);
+	}
+
+	// 월드 AABB를 메시 로컬 공간으로 옮긴 AABB (회전/스케일이 있으면 보수적으로 커짐)
+	FAABB TransformBounds(const FAABB& Bounds, const FMatrix& Matrix)
+	{
+		FVector Min(FLT_MAX, FLT_MAX, FLT_MAX);
+		FVector Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		for (int32 Corner = 0; Corner < 8; ++Corner)
+		{
+			const FVector Point(
+				(Corner & 1) ? Bounds.Max.X : Bounds.Min.X,
+				(Corner & 2) ? Bounds.Max.Y : Bounds.Min.Y,
+				(Corner & 4) ? Bounds.Max.Z : Bounds.Min.Z);
+			const FVector Transformed = Matrix.TransformPosition(Point);
+			Min = Min.ComponentMin(Transformed);
+			Max = Max.ComponentMax(Transformed);
+		}
+		return FAABB(Min, Max);
+	}
+
+	bool IsIgnored(const UPrimitiveComponent* Component, const FCollisionQueryParams& Params)
+	{
+		return Component == Params.IgnoredComponent || (Params.IgnoredActor && Component->GetOwner() == Params.IgnoredActor);
+	}
+}
+
+bool UCollisionManager::RayCast(const FVector& Start, const FVector& End, FHitResult& OutHit, const FCollisionQueryParams& Params) const
+{
+	FSweepRequest Request;
+	Request.Start = Start;
+	Request.End = End;
+	Request.Params = Params;
+
+	FSweepScratch Scratch;
+	return SweepInternal(Request, OutHit, Scratch);
+}
+
+bool UCollisionManager::Sweep(const FVector& Start, const FVector& End, const FQuat& Rotation, const FCollisionShape& Shape,
+	FHitResult& OutHit, const FCollisionQueryParams& Params) const
+{
+	FSweepRequest Request;
+	Request.Start = Start;
+	Request.End = End;
+	Request.Rotation = Rotation;
+	Request.Shape = Shape;
+	Request.Params = Params;
+
+	FSweepScratch Scratch;
+	return SweepInternal(Request, OutHit, Scratch);
+}
+
+int32 UCollisionManager::SweepBatch(const FSweepRequest* Requests, int32 NumRequests, FHitResult* OutHits) const
+{
+	if (NumRequests <= 0)
+	{
+		return 0;
+	}
+
+	const int32 NumChunks = FTaskScheduler::ComputeNumChunks(NumRequests, MinSweepsPerChunk);
+	TArray<int32> ChunkHits(NumChunks, 0);
+	FTaskScheduler::ParallelFor(NumRequests, NumChunks,
+		[&](int32 ChunkIndex, int32 Begin, int32 End)
+		{
+			FSweepScratch Scratch;
+			int32 NumHits = 0;
+			for (int32 Index = Begin; Index < End; ++Index)
+			{
+				NumHits += SweepInternal(Requests[Index], OutHits[Index], Scratch) ? 1 : 0;
+			}
+			ChunkHits[ChunkIndex] = NumHits;
+		});
+
+	int32 TotalHits = 0;
+	for (const int32 NumHits : ChunkHits)
+	{
+		TotalHits += NumHits;
+	}
+	return TotalHits;
+}
+
+bool UCollisionManager::SweepInternal(const FSweepRequest& Request, FHitResult& OutHit, FSweepScratch& Scratch) const
+{
+	OutHit = FHitResult();
+
+	const FVector Delta = Request.End - Request.Start;
+	CollisionQuery::FConvexCore MovingCore;
+	CollisionQuery::BuildCore(Request.Shape, Request.Start, Request.Rotation, MovingCore);
+	const FAABB SweptBounds = ComputeSweptBounds(MovingCore, Delta);
+
+	float BestTime = 1.0f;
+	bool bHit = false;
+
+	// 1. 등록된 셰이프 (충돌 BVH)
+	if (Request.Params.bTraceShapes && BVH)
+	{
+		Scratch.Shapes.clear();
+		BVH->QueryIntersectedComponents(SweptBounds, Scratch.Shapes);
+		for (UShapeComponent* Shape : Scratch.Shapes)
+		{
+			// 기본 UShapeComponent는 모양이 없어 제외 (UpdateOverlaps와 같은 조건)
+			if (!Shape || Shape->IsPendingDestroy() || !Shape->bBlockComponent || IsIgnored(Shape, Request.Params)
+				|| Shape->GetClass() == UShapeComponent::StaticClass())
+			{
+				continue;
+			}
+
+			FShape ShapeDesc;
+			Shape->GetShape(ShapeDesc);
+			CollisionQuery::FConvexCore ShapeCore;
+			CollisionQuery::BuildCore(ShapeDesc, Shape->GetWorldTransform(), ShapeCore);
+
+			FHitResult Candidate;
+			if (CollisionQuery::SweepConvex(MovingCore, Delta, ShapeCore, BestTime, Candidate) && (!bHit || Candidate.Time < BestTime))
+			{
+				Candidate.Component = Shape;
+				Candidate.Actor = Shape->GetOwner();
+				OutHit = Candidate;
+				BestTime = Candidate.Time;
+				bHit = true;
+			}
+		}
+	}
+
+	// 2. 스태틱 메시 (World Partition BVH -> 메시 BVH 삼각형)
+	UWorldPartitionManager* Partition = (Request.Params.bTraceStaticMeshes && World) ? World->GetPartitionManager() : nullptr;
+	FBVHierarchy* SceneBVH = Partition ? Partition->GetBVH() : nullptr;
+	if (SceneBVH)
+	{
+		const float DeltaSize = Delta.Size();
+		for (UPrimitiveComponent* Primitive : SceneBVH->QueryIntersectedComponents(SweptBounds))
+		{
+			UStaticMeshComponent* MeshComponent = Cast<UStaticMeshComponent>(Primitive);
+			if (!MeshComponent || MeshComponent->IsPendingDestroy() || !MeshComponent->bBlockComponent || IsIgnored(MeshComponent, Request.Params))
+			{
+				continue;
+			}
+
+			// 메시 BVH는 쿠킹/로드 시 만들어진 것만 사용 (병렬 쿼리 중 지연 빌드하지 않음)
+			UStaticMesh* Mesh = MeshComponent->GetStaticMesh();
+			FStaticMesh* MeshAsset = Mesh ? Mesh->GetStaticMeshAsset() : nullptr;
+			const FMeshBVH* MeshBVH = MeshAsset ? MeshAsset->MeshBVH.get() : nullptr;
+			if (!MeshBVH || MeshBVH->IsEmpty() || MeshAsset->Indices.IsEmpty())
+			{
+				continue;
+			}
+
+			// GetWorldMatrix()는 더티 플래그가 있으면 캐시를 갱신(쓰기)하므로 병렬 스윕에서 경쟁. 캐시 없이 트랜스폼에서 직접 계산
+			const FMatrix WorldMatrix = MeshComponent->GetWorldTransform().ToMatrix();
+			const FMatrix InvWorld = WorldMatrix.InverseAffine();
+			auto GetWorldTriangle = [&](uint32 TriangleID, FVector& OutV0, FVector& OutV1, FVector& OutV2)
+			{
+				OutV0 = WorldMatrix.TransformPosition(MeshAsset->Vertices[MeshAsset->Indices[TriangleID * 3 + 0]].pos);
+				OutV1 = WorldMatrix.TransformPosition(MeshAsset->Vertices[MeshAsset->Indices[TriangleID * 3 + 1]].pos);
+				OutV2 = WorldMatrix.TransformPosition(MeshAsset->Vertices[MeshAsset->Indices[TriangleID * 3 + 2]].pos);
+			};
+
+			if (Request.Shape.Kind == FCollisionShape::EKind::Line)
+			{
+				// 레이는 메시 BVH의 패킷 교차를 그대로 사용. 로컬 방향을 정규화하지 않으므로 거리 = Delta 비율
+				if (DeltaSize <= KINDA_SMALL_NUMBER)
+				{
+					continue;
+				}
+				const FRay LocalRay{ InvWorld.TransformPosition(Request.Start), InvWorld.TransformVector(Delta) };
+				FMeshBVHHit MeshHit;
+				if (!MeshBVH->IntersectRay(LocalRay, MeshHit) || MeshHit.Distance > BestTime || (bHit && MeshHit.Distance >= BestTime))
+				{
+					continue;
+				}
+
+				FVector V0, V1, V2;
+				GetWorldTriangle(MeshHit.TriangleID, V0, V1, V2);
+				FVector Normal = FVector::Cross(V1 - V0, V2 - V0).GetNormalized();
+				if (FVector::Dot(Normal, Delta) > 0.0f)
+				{
+					Normal = -Normal;
+				}
+
+				OutHit = FHitResult();
+				OutHit.ImpactPoint = Request.Start + Delta * MeshHit.Distance;
+				OutHit.ImpactNormal = Normal;
+				OutHit.Time = FMath::Max(0.0f, MeshHit.Distance - CollisionQuery::ContactTolerance * 0.5f / DeltaSize);
+				OutHit.Component = MeshComponent;
+				OutHit.Actor = MeshComponent->GetOwner();
+				OutHit.TriangleID = MeshHit.TriangleID;
+				BestTime = OutHit.Time;
+				bHit = true;
+				continue;
+			}
+
+			Scratch.Triangles.clear();
+			MeshBVH->QueryTriangles(TransformBounds(SweptBounds, InvWorld), Scratch.Triangles);
+			for (const uint32 TriangleID : Scratch.Triangles)
+			{
+				FVector V0, V1, V2;
+				GetWorldTriangle(TriangleID, V0, V1, V2);
+				CollisionQuery::FConvexCore TriangleCore;
+				CollisionQuery::BuildTriangleCore(V0, V1, V2, TriangleCore);
+
+				FHitResult Candidate;
+				if (CollisionQuery::SweepConvex(MovingCore, Delta, TriangleCore, BestTime, Candidate) && (!bHit || Candidate.Time < BestTime))
+				{
+					Candidate.Component = MeshComponent;
+					Candidate.Actor = MeshComponent->GetOwner();
+					Candidate.TriangleID = TriangleID;
+					OutHit = Candidate;
+					BestTime = Candidate.Time;
+					bHit = true;
+				}
+			}
+		}
+	}
+
+	OutHit.bBlockingHit = bHit;
+	OutHit.Time = bHit ? OutHit.Time : 1.0f;
+	OutHit.Location = Request.Start + Delta * OutHit.Time;
+	OutHit.Distance = Delta.Size() * OutHit.Time;
+	return bHit;
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 벤치마크
+// ────────────────────────────────────────────────────────────────────────────
+
+TArray<FOverlapBenchmarkSample> UCollisionManager::RunOverlapBenchmark(int32 MaxShapes)
+{
+	TArray<FOverlapBenchmarkSample> Samples;
+	MaxShapes = std::clamp(MaxShapes, 100, 100000);
+
+	// 기존 방식은 N^2라서 이보다 많으면 측정하지 않음 (2000개 = 프레임당 400만 방문)
+	constexpr int32 LegacyMaxShapes = 2000;
+	const int32 ShapeCounts[] = { 100, 500, 1000, 2000, 5000, 10000, 20000, 50000, 100000 };
+
+	// 최대 개수만큼 한 번만 만들고 앞쪽 N개를 사용 (DeleteObject가 선형 탐색이라 생성/삭제 횟수를 줄임)
+	TArray<AActor*> Actors;
+	TArray<USphereComponent*> Spheres;
+	Actors.Reserve(MaxShapes);
+	Spheres.Reserve(MaxShapes);
+	for (int32 Index = 0; Index < MaxShapes; ++Index)
+	{
+		AActor* Actor = ObjectFactory::NewObject<AActor>();
+		USphereComponent* Sphere = Actor->CreateDefaultSubobject<USphereComponent>("BenchmarkSphere");
+		Sphere->SetSphereRadius(1.0f);
+		Actors.Add(Actor);
+		Spheres.Add(Sphere);
+	}
+
+	std::mt19937 Random(12345);
+	for (const int32 NumShapes : ShapeCounts)
+	{
+		if (NumShapes > MaxShapes)
+		{
+			break;
+		}
+
+		FOverlapBenchmarkSample Sample;
+		Sample.NumShapes = NumShapes;
+
+		// 셰이프 수와 무관하게 구 하나당 평균 이웃 2개 정도가 되도록 공간 크기를 맞춤
+		const float HalfSize = 0.5f * std::cbrt(16.75f * NumShapes);
+		std::uniform_real_distribution<float> Coordinate(-HalfSize, HalfSize);
+		for (int32 Index = 0; Index < NumShapes; ++Index)
+		{
+			Spheres[Index]->SetWorldLocation(FVector(Coordinate(Random), Coordinate(Random), Coordinate(Random)));
+		}
+
+		// 1. 기존 방식: 셰이프마다 모든 액터의 모든 씬 컴포넌트 순회
+		TArray<FOverlapPair> LegacyPairs;
+		if (NumShapes <= LegacyMaxShapes)
+		{
+			const uint64 Start = FPlatformTime::Cycles64();
+			for (int32 Index = 0; Index < NumShapes; ++Index)
+			{
+				UShapeComponent* Comp = Spheres[Index];
+				for (int32 ActorIndex = 0; ActorIndex < NumShapes; ++ActorIndex)
+				{
+					AActor* Actor = Actors[ActorIndex];
+					if (!Actor || !Actor->IsActorActive())
+						continue;
+
+					for (USceneComponent* SceneComp : Actor->GetSceneComponents())
+					{
+						++Sample.LegacyVisits;
+						UShapeComponent* Other = Cast<UShapeComponent>(SceneComp);
+						if (!Other || Other == Comp) continue;
+						if (Other->GetOwner() == Comp->GetOwner()) continue;
+						if (!Other->bGenerateOverlapEvents) continue;
+						if (!Collision::CheckOverlap(Comp, Other)) continue;
+
+						if (Comp < Other)
+						{
+							LegacyPairs.push_back({ Comp, Other });
+						}
+					}
+				}
+			}
+			Sample.LegacyMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+			std::sort(LegacyPairs.begin(), LegacyPairs.end());
+		}
+
+		// 2. 충돌 매니저 경로: BVH 갱신/재구축 + UpdateOverlaps (두 번째 프레임 기준)
+		UCollisionManager Manager;
+		Manager.BeginBulkRegister();
+		for (int32 Index = 0; Index < NumShapes; ++Index)
+		{
+			Manager.RegisterComponent(Spheres[Index]);
+		}
+		Manager.EndBulkRegister();
+		Manager.UpdateCollisions(0.0f);
+		Manager.UpdateOverlaps();
+
+		{
+			const uint64 Start = FPlatformTime::Cycles64();
+			Manager.UpdateCollisions(0.0f);
+			Sample.BroadPhaseMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+		}
+		{
+			Manager.CollisionPairsChecked = 0;
+			const uint64 Start = FPlatformTime::Cycles64();
+			Manager.UpdateOverlaps();
+			Sample.OverlapMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+		}
+		Sample.NumCandidatePairs = Manager.CollisionPairsChecked;
+		Sample.NumOverlapPairs = Manager.OverlapPairs.Num();
+		if (Sample.LegacyMS >= 0.0)
+		{
+			Sample.bPairsMatch = LegacyPairs == Manager.OverlapPairs;
+		}
+
+		// 매니저 소멸 전에 셰이프에 남긴 겹침 목록 정리 (UnregisterComponent는 N번 선형 제거라 직접 비움)
+		for (int32 Index = 0; Index < NumShapes; ++Index)
+		{
+			UShapeComponent* Shape = Spheres[Index];
+			Shape->OverlapNow.clear();
+			Shape->OverlapPrev.clear();
+			Shape->OverlapInfos.clear();
+		}
+
+		Samples.Add(Sample);
+	}
+
+	for (AActor* Actor : Actors)
+	{
+		ObjectFactory::DeleteObject(Actor);
+	}
+
+	return Samples;
+}
+
+FSweepBenchmarkResult UCollisionManager::RunSweepBenchmark(int32 NumShapes, int32 NumSweeps, int32 NumMeshes)
+{
+	FSweepBenchmarkResult Result;
+	Result.NumShapes = NumShapes = std::clamp(NumShapes, 1, 100000);
+	Result.NumSweeps = NumSweeps = std::clamp(NumSweeps, 1, 1000000);
+
+	// 회전된 박스를 흩어 놓음 (박스 하나당 평균 이웃이 몇 개 정도인 밀도)
+	std::mt19937 Random(4321);
+	const float HalfSize = 0.5f * std::cbrt(64.0f * NumShapes);
+	std::uniform_real_distribution<float> Coordinate(-HalfSize, HalfSize);
+	std::uniform_real_distribution<float> Angle(-180.0f, 180.0f);
+
+	TArray<AActor*> Actors;
+	Actors.Reserve(NumShapes);
+	UCollisionManager Manager;
+	Manager.BeginBulkRegister();
+	for (int32 Index = 0; Index < NumShapes; ++Index)
+	{
+		AActor* Actor = ObjectFactory::NewObject<AActor>();
+		UBoxComponent* Box = Actor->CreateDefaultSubobject<UBoxComponent>("BenchmarkBox");
+		Box->SetBoxExtent(FVector(1.0f, 1.0f, 1.0f));
+		Box->bBlockComponent = true;
+		Box->SetWorldLocationAndRotation(FVector(Coordinate(Random), Coordinate(Random), Coordinate(Random)),
+			FQuat::MakeFromEulerZYX(FVector(Angle(Random), Angle(Random), Angle(Random))));
+		Actors.Add(Actor);
+		Manager.RegisterComponent(Box);
+	}
+	Manager.EndBulkRegister();
+
+	// 스태틱 메시 경로(World Partition BVH -> 메시 BVH)도 병렬로 타도록 임시 월드에 메시 장애물을 배치
+	UWorld* MeshWorld = NewObject<UWorld>();
+	MeshWorld->Initialize();
+	Result.NumMeshes = NumMeshes = std::clamp(NumMeshes, 0, 10000);
+	for (int32 Index = 0; Index < NumMeshes; ++Index)
+	{
+		MeshWorld->SpawnActor<AStaticMeshActor>(FTransform(FVector(Coordinate(Random), Coordinate(Random), Coordinate(Random)),
+			FQuat::MakeFromEulerZYX(FVector(Angle(Random), Angle(Random), Angle(Random))), FVector(3.0f, 3.0f, 3.0f)));
+	}
+	if (UWorldPartitionManager* Partition = MeshWorld->GetPartitionManager())
+	{
+		Partition->Update(0.0f, static_cast<uint32>(NumMeshes) + 1);	// 대기열을 한 번에 비우고 BVH 재빌드
+	}
+	Manager.SetWorld(MeshWorld);
+	Manager.UpdateCollisions(0.0f);
+
+	// 캐릭터 한 프레임 이동 정도의 짧은 캡슐 스윕
+	TArray<FSweepRequest> Requests(NumSweeps);
+	std::uniform_real_distribution<float> Step(-4.0f, 4.0f);
+	for (FSweepRequest& Request : Requests)
+	{
+		Request.Start = FVector(Coordinate(Random), Coordinate(Random), Coordinate(Random));
+		Request.End = Request.Start + FVector(Step(Random), Step(Random), Step(Random));
+		Request.Shape = FCollisionShape::MakeCapsule(0.5f, 1.0f);
+	}
+
+	TArray<FHitResult> SingleHits(NumSweeps);
+	{
+		const uint64 Start = FPlatformTime::Cycles64();
+		for (int32 Index = 0; Index < NumSweeps; ++Index)
+		{
+			const FSweepRequest& Request = Requests[Index];
+			Result.NumHits += Manager.Sweep(Request.Start, Request.End, Request.Rotation, Request.Shape, SingleHits[Index]) ? 1 : 0;
+		}
+		Result.SingleMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	}
+
+	TArray<FHitResult> BatchHits(NumSweeps);
+	{
+		const uint64 Start = FPlatformTime::Cycles64();
+		Manager.SweepBatch(Requests.GetData(), NumSweeps, BatchHits.GetData());
+		Result.BatchMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	}
+
+	for (int32 Index = 0; Index < NumSweeps; ++Index)
+	{
+		Result.NumMeshHits += Cast<UStaticMeshComponent>(BatchHits[Index].Component) ? 1 : 0;
+		Result.bResultsMatch &= SingleHits[Index].bBlockingHit == BatchHits[Index].bBlockingHit
+			&& SingleHits[Index].Component == BatchHits[Index].Component
+			&& SingleHits[Index].Time == BatchHits[Index].Time;
+	}
+
+	for (AActor* Actor : Actors)
+	{
+		ObjectFactory::DeleteObject(Actor);
+	}
+	Manager.SetWorld(nullptr);
+	ObjectFactory::DeleteObject(MeshWorld);	// 스폰한 메시 액터도 함께 삭제
+	return Result;
+}
+
+TArray<FPhysicsBenchmarkSample> UCollisionManager::RunPhysicsBenchmark(int32 NumBodies, int32 NumFrames)
+{
+	TArray<FPhysicsBenchmarkSample> Samples;
+	NumBodies = std::clamp(NumBodies, 20, 100000);
+	NumFrames = std::clamp(NumFrames, 1, 10000);
+
+	// 절반은 10층 박스 스택을 격자로 세우고, 나머지는 그 위에서 무작위 자세로 떨어뜨림
+	constexpr int32 StackHeight = 10;
+	constexpr float StackSpacing = 3.0f;
+	const int32 NumStacks = (NumBodies / 2) / StackHeight;
+	const int32 GridSize = std::max(1, static_cast<int32>(std::ceil(std::sqrt(static_cast<float>(NumStacks)))));
+	const float HalfSize = 0.5f * GridSize * StackSpacing;
+
+	TArray<AActor*> Actors;
+	TArray<UShapeComponent*> Shapes;
+	TArray<FTransform> InitialTransforms;
+	Actors.Reserve(NumBodies + 1);
+	Shapes.Reserve(NumBodies + 1);
+
+	auto AddShape = [&](UShapeComponent* Shape, AActor* Actor, const FVector& Location, const FQuat& Rotation, bool bSimulate)
+	{
+		Shape->bBlockComponent = true;
+		Shape->bPhysicsCollider = true;
+		Shape->bSimulatePhysics = bSimulate;
+		Shape->SetWorldLocationAndRotation(Location, Rotation);
+		Actors.Add(Actor);
+		Shapes.Add(Shape);
+		InitialTransforms.Add(Shape->GetWorldTransform());
+	};
+
+	// 바닥 (정적)
+	{
+		AActor* Actor = ObjectFactory::NewObject<AActor>();
+		UBoxComponent* Ground = Actor->CreateDefaultSubobject<UBoxComponent>("BenchmarkGround");
+		Ground->SetBoxExtent(FVector(HalfSize + 10.0f, HalfSize + 10.0f, 1.0f));
+		AddShape(Ground, Actor, FVector(0.0f, 0.0f, -1.0f), FQuat::Identity(), false);
+	}
+
+	for (int32 Stack = 0; Stack < NumStacks; ++Stack)
+	{
+		const float X = (Stack % GridSize) * StackSpacing - HalfSize;
+		const float Y = (Stack / GridSize) * StackSpacing - HalfSize;
+		for (int32 Level = 0; Level < StackHeight; ++Level)
+		{
+			AActor* Actor = ObjectFactory::NewObject<AActor>();
+			UBoxComponent* Box = Actor->CreateDefaultSubobject<UBoxComponent>("BenchmarkBox");
+			Box->SetBoxExtent(FVector(0.5f, 0.5f, 0.5f));
+			AddShape(Box, Actor, FVector(X, Y, 0.5f + Level), FQuat::Identity(), true);
+		}
+	}
+
+	std::mt19937 Random(1234);
+	std::uniform_real_distribution<float> Coordinate(-HalfSize, HalfSize);
+	std::uniform_real_distribution<float> Height(12.0f, 40.0f);
+	std::uniform_real_distribution<float> Angle(-180.0f, 180.0f);
+	for (int32 Index = NumStacks * StackHeight; Index < NumBodies; ++Index)
+	{
+		const FVector Location(Coordinate(Random), Coordinate(Random), Height(Random));
+		const FQuat Rotation = FQuat::MakeFromEulerZYX(FVector(Angle(Random), Angle(Random), Angle(Random)));
+
+		AActor* Actor = ObjectFactory::NewObject<AActor>();
+		switch (Index % 3)
+		{
+		case 0:
+		{
+			UBoxComponent* Box = Actor->CreateDefaultSubobject<UBoxComponent>("BenchmarkBox");
+			Box->SetBoxExtent(FVector(0.4f, 0.4f, 0.4f));
+			AddShape(Box, Actor, Location, Rotation, true);
+			break;
+		}
+		case 1:
+		{
+			USphereComponent* Sphere = Actor->CreateDefaultSubobject<USphereComponent>("BenchmarkSphere");
+			Sphere->SetSphereRadius(0.4f);
+			AddShape(Sphere, Actor, Location, Rotation, true);
+			break;
+		}
+		default:
+		{
+			UCapsuleComponent* Capsule = Actor->CreateDefaultSubobject<UCapsuleComponent>("BenchmarkCapsule");
+			Capsule->SetCapsuleSize(0.3f, 0.8f);
+			AddShape(Capsule, Actor, Location, Rotation, true);
+			break;
+		}
+		}
+	}
+
+	// 스레드 수마다 같은 초기 상태에서 새 씬으로 시뮬레이션
+	const int32 MaxThreads = FTaskScheduler::GetNumWorkers() + 1;
+	double FirstChecksum = 0.0;
+	for (int32 NumThreads = 1; ; NumThreads = std::min(NumThreads * 2, MaxThreads))
+	{
+		for (int32 Index = 0; Index < Shapes.Num(); ++Index)
+		{
+			Shapes[Index]->SetWorldLocationAndRotation(InitialTransforms[Index].Translation, InitialTransforms[Index].Rotation);
+		}
+
+		UCollisionManager Manager;
+		Manager.BeginBulkRegister();
+		for (UShapeComponent* Shape : Shapes)
+		{
+			Manager.RegisterComponent(Shape);
+		}
+		Manager.EndBulkRegister();
+		Manager.PhysicsScene->SetMaxThreads(NumThreads);
+
+		FPhysicsBenchmarkSample Sample;
+		Sample.NumThreads = NumThreads;
+		Sample.NumBodies = NumBodies;
+		Sample.NumFrames = NumFrames;
+
+		double TotalMS = 0.0;
+		double TotalSolveMS = 0.0;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			const uint64 Start = FPlatformTime::Cycles64();
+			Manager.PhysicsScene->Simulate(1.0f / 60.0f);
+			const double StepMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+			TotalMS += StepMS;
+			Sample.MaxStepMS = std::max(Sample.MaxStepMS, StepMS);
+			TotalSolveMS += Manager.PhysicsScene->GetStats().SolveMS;
+		}
+		Sample.AvgStepMS = TotalMS / NumFrames;
+		Sample.AvgSolveMS = TotalSolveMS / NumFrames;
+
+		const FPhysicsStats& Stats = Manager.PhysicsScene->GetStats();
+		Sample.NumIslands = Stats.NumIslands;
+		Sample.NumAwakeBodies = Stats.NumAwakeBodies;
+		Sample.NumContacts = Stats.NumContacts;
+
+		// 아일랜드 결과는 스레드 수와 무관해야 하므로 최종 위치 합이 첫 샘플과 정확히 같아야 함
+		double Checksum = 0.0;
+		for (const UShapeComponent* Shape : Shapes)
+		{
+			const FVector Location = Shape->GetWorldLocation();
+			Checksum += Location.X + 1.3 * Location.Y + 1.7 * Location.Z;
+		}
+		if (Samples.IsEmpty())
+		{
+			FirstChecksum = Checksum;
+		}
+		Sample.bResultsMatch = Checksum == FirstChecksum;
+		Samples.Add(Sample);
+
+		if (NumThreads >= MaxThreads)
+		{
+			break;
+		}
+	}
+
+	for (AActor* Actor : Actors)
+	{
+		ObjectFactory::DeleteObject(Actor);
+	}
+	return Samples;
+}
+
 // ────────────────────────────────────────────────────────────────────────────
 // 디버그
 // ────────────────────────────────────────────────────────────────────────────
@@ -5,13 +5,46 @@
 #pragma once
 #include "Object.h"
 #include "CollisionBVH.h"
+#include "CollisionQuery.h"
+#include "PhysicsScene.h"
 #include <memory>
+#include <mutex>
 
 // Forward Declarations
 class UShapeComponent;
 class UWorld;
 class URenderer;
 
+/**
+ * UCollisionManager::RunOverlapBenchmark 결과 (셰이프 수 하나당 한 개)
+ */
+struct FOverlapBenchmarkSample
+{
+	int32 NumShapes = 0;
+	double LegacyMS = -1.0;			// 기존 TickComponent 방식 (월드 전체 순회, O(N^2)). 셰이프가 많으면 건너뜀(-1)
+	int64 LegacyVisits = 0;			// 기존 방식의 컴포넌트 방문 수
+	double BroadPhaseMS = 0.0;		// 충돌 BVH 갱신 + 재구축
+	double OverlapMS = 0.0;			// UpdateOverlaps (BVH 쿼리 + 내로우 페이즈 + Begin/End diff)
+	int32 NumCandidatePairs = 0;	// 내로우 페이즈까지 간 쌍 수
+	int32 NumOverlapPairs = 0;
+	bool bPairsMatch = true;		// 기존 방식을 돌린 경우 겹침 쌍 집합이 같은지
+};
+
+/**
+ * UCollisionManager::RunSweepBenchmark 결과
+ */
+struct FSweepBenchmarkResult
+{
+	int32 NumShapes = 0;
+	int32 NumMeshes = 0;		// 스태틱 메시 장애물 수 (메시 BVH 경로)
+	int32 NumSweeps = 0;
+	double SingleMS = 0.0;		// Sweep을 한 개씩 호출
+	double BatchMS = 0.0;		// SweepBatch (FTaskScheduler로 분할)
+	int32 NumHits = 0;
+	int32 NumMeshHits = 0;		// 그중 스태틱 메시에 막힌 스윕 수 (배치 기준)
+	bool bResultsMatch = true;	// 단일/배치 결과가 같은지
+};
+
 /**
  * UCollisionManager
  *
@@ -28,6 +61,21 @@ class URenderer;
  * - World::Initialize()에서 생성
  * - World::Tick()에서 UpdateCollisions() 호출
  * - ShapeComponent가 BeginPlay/EndPlay에서 자동 등록/해제
+ *
+ * Overlap 처리:
+ * - PIE/프리뷰 월드에서 UpdateCollisions가 이벤트를 생성하는 셰이프마다 BVH를 쿼리하고 내로우 페이즈(Collision::CheckOverlap)로 겹침 쌍을 만듦
+ * - 정렬된 쌍 목록을 지난 프레임 목록과 비교해 Begin/End 이벤트를 발생시키고,
+ *   각 셰이프의 OverlapNow/OverlapPrev/OverlapInfos도 여기서 갱신 (ShapeComponent::TickComponent는 월드를 순회하지 않음)
+ *
+ * 스윕/레이 캐스트:
+ * - 이동 경로를 감싸는 AABB로 충돌 BVH(bBlockComponent인 셰이프)와 World Partition BVH(StaticMeshComponent)를 쿼리
+ * - 셰이프는 CollisionQuery::SweepConvex, 메시는 메시 BVH 삼각형 단위로 검사해 가장 이른 충돌을 반환
+ * - 브로드 페이즈 AABB는 마지막 UpdateCollisions 기준이고, 내로우 페이즈는 현재 트랜스폼을 사용
+ * - 쿼리는 읽기 전용이라 SweepBatch로 여러 캐릭터/발사체의 이동을 병렬로 처리할 수 있음
+ *
+ * 강체 시뮬레이션:
+ * - 등록된 셰이프는 FPhysicsScene에도 바디로 등록 (bSimulatePhysics면 동적, bPhysicsCollider && bBlockComponent면 정적)
+ * - PIE에서 World::Tick이 UpdateCollisions 전에 SimulatePhysics를 호출해 고정 서브스텝으로 시뮬레이션
  */
 class UCollisionManager : public UObject
 {
@@ -68,6 +116,18 @@ public:
 	 */
 	void MarkComponentDirty(UShapeComponent* Component);
 
+	/**
+	 * 대량 등록을 시작합니다. (레벨 로드 등)
+	 * EndBulkRegister까지의 RegisterComponent는 중복 검사/BVH 갱신 없이 모아 두었다가
+	 * EndBulkRegister에서 한 번에 등록하고 BVH를 한 번만 재구축합니다.
+	 */
+	void BeginBulkRegister();
+
+	/**
+	 * 모아 둔 컴포넌트를 등록하고 BVH를 재구축합니다.
+	 */
+	void EndBulkRegister();
+
 	// ────────────────────────────────────────────────
 	// 충돌 업데이트
 	// ────────────────────────────────────────────────
@@ -86,6 +146,14 @@ public:
 	 */
 	void RebuildBVH();
 
+	/**
+	 * 강체 시뮬레이션을 DeltaTime만큼 진행하고 동적 셰이프의 트랜스폼을 갱신합니다.
+	 * World::Tick()에서 PIE일 때 UpdateCollisions 전에 호출됩니다.
+	 *
+	 * @param DeltaTime - 프레임 시간
+	 */
+	void SimulatePhysics(float DeltaTime);
+
 	// ────────────────────────────────────────────────
 	// 쿼리 API
 	// ────────────────────────────────────────────────
@@ -98,6 +166,60 @@ public:
 	 */
 	TArray<UShapeComponent*> QueryIntersectedComponents(const FAABB& InBound) const;
 
+	/**
+	 * Start에서 End까지 레이를 쏴 처음 부딪히는 셰이프/스태틱 메시를 찾습니다.
+	 *
+	 * @param Start - 시작 위치
+	 * @param End - 끝 위치
+	 * @param OutHit - 충돌 정보 (충돌이 없으면 bBlockingHit = false, Location = End)
+	 * @param Params - 무시할 대상과 검사 범위
+	 * @return 충돌하면 true
+	 */
+	bool RayCast(const FVector& Start, const FVector& End, FHitResult& OutHit, const FCollisionQueryParams& Params = FCollisionQueryParams()) const;
+
+	/**
+	 * Shape를 Rotation으로 놓고 Start에서 End까지 평행 이동시켜 처음 부딪히는 셰이프/스태틱 메시를 찾습니다.
+	 *
+	 * @param Start - 셰이프 중심의 시작 위치
+	 * @param End - 셰이프 중심의 끝 위치
+	 * @param Rotation - 셰이프 회전 (이동 중 고정)
+	 * @param Shape - 스윕할 셰이프 (캡슐/구/박스)
+	 * @param OutHit - 충돌 정보 (Location은 멈춰야 할 셰이프 중심)
+	 * @param Params - 무시할 대상과 검사 범위
+	 * @return 충돌하면 true
+	 */
+	bool Sweep(const FVector& Start, const FVector& End, const FQuat& Rotation, const FCollisionShape& Shape,
+		FHitResult& OutHit, const FCollisionQueryParams& Params = FCollisionQueryParams()) const;
+
+	/**
+	 * 여러 스윕/레이 캐스트를 한 번에 처리합니다. 요청이 많으면 FTaskScheduler로 나눠 병렬 처리합니다.
+	 * 처리 중에는 컴포넌트를 등록/해제/이동하면 안 됩니다.
+	 *
+	 * @param Requests - 요청 배열 (Shape가 Line이면 레이 캐스트)
+	 * @param NumRequests - 요청 수
+	 * @param OutHits - 요청마다 결과 (NumRequests개)
+	 * @return 충돌한 요청 수
+	 */
+	int32 SweepBatch(const FSweepRequest* Requests, int32 NumRequests, FHitResult* OutHits) const;
+
+	/**
+	 * 셰이프 수를 100 ~ MaxShapes로 늘려가며 기존 O(N^2) 순회와 BVH 기반 겹침 갱신의 비용을 비교합니다.
+	 * 월드 없이 임시 액터/구 컴포넌트를 만들어 측정하므로 이벤트는 발생하지 않습니다.
+	 */
+	static TArray<FOverlapBenchmarkSample> RunOverlapBenchmark(int32 MaxShapes = 10000);
+
+	/**
+	 * 박스 NumShapes개와 스태틱 메시 NumMeshes개를 흩어 놓고 캡슐 스윕 NumSweeps개를 단일 호출과 SweepBatch로 처리하는 시간을 비교합니다.
+	 * 메시 장애물은 임시 월드에 스폰해 World Partition BVH -> 메시 BVH 경로도 병렬로 검사합니다.
+	 */
+	static FSweepBenchmarkResult RunSweepBenchmark(int32 NumShapes = 2000, int32 NumSweeps = 1000, int32 NumMeshes = 100);
+
+	/**
+	 * 바디 NumBodies개(절반은 쌓인 박스, 절반은 떨어지는 박스/구/캡슐)를 NumFrames 프레임 시뮬레이션하며
+	 * 아일랜드 솔버 스레드 수(1, 2, 4, ... 워커 + 게임 스레드)별 스텝 시간을 측정합니다.
+	 */
+	static TArray<FPhysicsBenchmarkSample> RunPhysicsBenchmark(int32 NumBodies = 5000, int32 NumFrames = 120);
+
 	// ────────────────────────────────────────────────
 	// 디버그
 	// ────────────────────────────────────────────────
@@ -144,6 +266,13 @@ public:
 	 */
 	const TArray<UShapeComponent*>& GetRegisteredComponents() const { return RegisteredComponents; }
 
+	/**
+	 * 강체 시뮬레이션 씬을 반환합니다.
+	 *
+	 * @return FPhysicsScene 객체
+	 */
+	FPhysicsScene* GetPhysicsScene() const { return PhysicsScene.get(); }
+
 	/**
 	 * BVH 디버그 렌더링 활성화 여부
 	 */
@@ -165,6 +294,56 @@ private:
 	 */
 	void ClearDirtyFlags();
 
+	/**
+	 * BVH 브로드 페이즈 + 내로우 페이즈로 이번 프레임 겹침 쌍을 구하고,
+	 * 지난 프레임과 비교해 BeginPairs/EndPairs와 셰이프별 OverlapNow/OverlapPrev/OverlapInfos를 갱신합니다.
+	 */
+	void UpdateOverlaps();
+
+	/**
+	 * UpdateOverlaps가 모은 Begin/End 쌍의 이벤트를 발생시킵니다.
+	 */
+	void DispatchOverlapEvents();
+
+	/**
+	 * 해제되는 컴포넌트가 포함된 겹침 쌍을 지우고, 상대 셰이프의 겹침 목록에서도 제거합니다.
+	 *
+	 * @param Component - 해제되는 컴포넌트
+	 */
+	void RemoveOverlapPairs(UShapeComponent* Component);
+
+	/**
+	 * 스윕 한 번에 쓰는 임시 배열 (SweepBatch는 청크마다 하나씩 사용)
+	 */
+	struct FSweepScratch
+	{
+		TArray<UShapeComponent*> Shapes;
+		TArray<uint32> Triangles;
+	};
+
+	/**
+	 * 스윕/레이 캐스트 공통 구현입니다. 멤버를 수정하지 않으므로 여러 스레드에서 동시에 호출할 수 있습니다.
+	 * (컴포넌트의 지연 캐시도 건드리지 않음: 메시 BVH는 지연 빌드하지 않고, 월드 행렬은 캐시 대신 트랜스폼에서 계산)
+	 *
+	 * @param Request - 스윕 요청
+	 * @param OutHit - 충돌 정보
+	 * @param Scratch - 재사용할 임시 배열
+	 * @return 충돌하면 true
+	 */
+	bool SweepInternal(const FSweepRequest& Request, FHitResult& OutHit, FSweepScratch& Scratch) const;
+
+	/**
+	 * 겹침 쌍 (A < B, 주소 기준으로 정규화)
+	 */
+	struct FOverlapPair
+	{
+		UShapeComponent* A = nullptr;
+		UShapeComponent* B = nullptr;
+
+		bool operator<(const FOverlapPair& Other) const { return A != Other.A ? A < Other.A : B < Other.B; }
+		bool operator==(const FOverlapPair& Other) const { return A == Other.A && B == Other.B; }
+	};
+
 	// ────────────────────────────────────────────────
 	// 멤버 변수
 	// ────────────────────────────────────────────────
@@ -175,18 +354,46 @@ private:
 	/** BVH 구조 */
 	std::unique_ptr<FCollisionBVH> BVH;
 
+	/** 강체 시뮬레이션 */
+	std::unique_ptr<FPhysicsScene> PhysicsScene;
+
 	/** 등록된 모든 컴포넌트 */
 	TArray<UShapeComponent*> RegisteredComponents;
 
+	/** 등록 여부 조회용 (셰이프마다 매 틱 호출되는 MarkComponentDirty가 선형 탐색하지 않도록) */
+	TSet<UShapeComponent*> RegisteredComponentSet;
+
 	/** 이동한 컴포넌트 (증분 업데이트용) */
-	TArray<UShapeComponent*> DirtyComponents;
+	TSet<UShapeComponent*> DirtyComponents;
+
+	/** 병렬 틱(bTickOnAnyThread)에서 트랜스폼이 바뀔 때 MarkComponentDirty 보호 */
+	std::mutex DirtyMutex;
 
 	/** 완전 재구축 필요 여부 */
 	bool bNeedsFullRebuild = false;
 
+	/** BeginBulkRegister ~ EndBulkRegister 사이 여부 */
+	bool bBulkRegistering = false;
+
+	/** 대량 등록 중 모아 둔 컴포넌트 (중복 가능) */
+	TArray<UShapeComponent*> PendingBulkComponents;
+
 	/** 이번 프레임에 처리된 충돌 쌍 수 (통계용) */
 	int32 CollisionPairsChecked = 0;
 
 	/** 이번 프레임에 발생한 Overlap 이벤트 수 (통계용) */
 	int32 OverlapEventsTriggered = 0;
+
+	/** 지난 UpdateOverlaps의 겹침 쌍 (정렬됨) */
+	TArray<FOverlapPair> OverlapPairs;
+
+	/** 이번 프레임 겹침 쌍 (재사용 버퍼) */
+	TArray<FOverlapPair> NewOverlapPairs;
+
+	/** 이번 프레임에 시작/끝난 겹침 쌍 */
+	TArray<FOverlapPair> BeginPairs;
+	TArray<FOverlapPair> EndPairs;
+
+	/** BVH 쿼리 결과 (재사용 버퍼) */
+	TArray<UShapeComponent*> QueryResults;
 };
@@ -0,0 +1,474 @@
+#include "pch.h"
+#include "CollisionQuery.h"
+#include "Collision.h"
+#include "OBB.h"
+#include "ShapeComponent.h"
+
+namespace
+{
+	constexpr int32 MaxGJKIterations = 32;
+	constexpr int32 MaxAdvanceIterations = 32;
+
+	struct FSimplexVertex
+	{
+		FVector W;	// A - B
+		FVector A;
+		FVector B;
+	};
+
+	// 가중치가 0인 꼭짓점을 빼고 심플렉스를 앞으로 당김
+	void CompactSimplex(FSimplexVertex* Simplex, float* Lambda, int32& NumVertices)
+	{
+		int32 Kept = 0;
+		for (int32 i = 0; i < NumVertices; ++i)
+		{
+			if (Lambda[i] > 0.0f)
+			{
+				Simplex[Kept] = Simplex[i];
+				Lambda[Kept] = Lambda[i];
+				++Kept;
+			}
+		}
+		NumVertices = Kept;
+	}
+
+	// 원점에 가장 가까운 삼각형 위의 점의 무게중심 좌표 (Real-Time Collision Detection 5.1.5)
+	void ClosestOnTriangle(const FVector& A, const FVector& B, const FVector& C, float OutLambda[3])
+	{
+		const FVector AB = B - A;
+		const FVector AC = C - A;
+		const float D1 = -FVector::Dot(AB, A);
+		const float D2 = -FVector::Dot(AC, A);
+		if (D1 <= 0.0f && D2 <= 0.0f)
+		{
+			OutLambda[0] = 1.0f; OutLambda[1] = 0.0f; OutLambda[2] = 0.0f;
+			return;
+		}
+
+		const float D3 = -FVector::Dot(AB, B);
+		const float D4 = -FVector::Dot(AC, B);
+		if (D3 >= 0.0f && D4 <= D3)
+		{
+			OutLambda[0] = 0.0f; OutLambda[1] = 1.0f; OutLambda[2] = 0.0f;
+			return;
+		}
+
+		const float VC = D1 * D4 - D3 * D2;
+		if (VC <= 0.0f && D1 >= 0.0f && D3 <= 0.0f)
+		{
+			const float V = D1 / (D1 - D3);
+			OutLambda[0] = 1.0f - V; OutLambda[1] = V; OutLambda[2] = 0.0f;
+			return;
+		}
+
+		const float D5 = -FVector::Dot(AB, C);
+		const float D6 = -FVector::Dot(AC, C);
+		if (D6 >= 0.0f && D5 <= D6)
+		{
+			OutLambda[0] = 0.0f; OutLambda[1] = 0.0f; OutLambda[2] = 1.0f;
+			return;
+		}
+
+		const float VB = D5 * D2 - D1 * D6;
+		if (VB <= 0.0f && D2 >= 0.0f && D6 <= 0.0f)
+		{
+			const float W = D2 / (D2 - D6);
+			OutLambda[0] = 1.0f - W; OutLambda[1] = 0.0f; OutLambda[2] = W;
+			return;
+		}
+
+		const float VA = D3 * D6 - D5 * D4;
+		if (VA <= 0.0f && (D4 - D3) >= 0.0f && (D5 - D6) >= 0.0f)
+		{
+			const float W = (D4 - D3) / ((D4 - D3) + (D5 - D6));
+			OutLambda[0] = 0.0f; OutLambda[1] = 1.0f - W; OutLambda[2] = W;
+			return;
+		}
+
+		const float Denom = 1.0f / (VA + VB + VC);
+		const float V = VB * Denom;
+		const float W = VC * Denom;
+		OutLambda[0] = 1.0f - V - W; OutLambda[1] = V; OutLambda[2] = W;
+	}
+
+	/**
+	 * 심플렉스 위에서 원점에 가장 가까운 점을 구하고, 그 점을 표현하는 꼭짓점만 남깁니다.
+	 * @return 원점을 포함하면 true (사면체 내부)
+	 */
+	bool SolveSimplex(FSimplexVertex* Simplex, float* Lambda, int32& NumVertices, FVector& OutClosest)
+	{
+		switch (NumVertices)
+		{
+		case 1:
+			Lambda[0] = 1.0f;
+			break;
+
+		case 2:
+		{
+			const FVector& A = Simplex[0].W;
+			const FVector AB = Simplex[1].W - A;
+			const float LengthSquared = AB.SizeSquared();
+			const float T = LengthSquared > KINDA_SMALL_NUMBER ? FMath::Clamp(-FVector::Dot(A, AB) / LengthSquared, 0.0f, 1.0f) : 0.0f;
+			Lambda[0] = 1.0f - T;
+			Lambda[1] = T;
+			break;
+		}
+
+		case 3:
+			ClosestOnTriangle(Simplex[0].W, Simplex[1].W, Simplex[2].W, Lambda);
+			break;
+
+		case 4:
+		{
+			// 원점이 바깥쪽에 있는 면들 중 가장 가까운 면을 고름. 모두 안쪽이면 원점 포함
+			static constexpr int32 Faces[4][4] = { { 0, 1, 2, 3 }, { 0, 3, 1, 2 }, { 0, 2, 3, 1 }, { 1, 3, 2, 0 } };
+			float BestDistSquared = FLT_MAX;
+			float BestLambda[4] = {};
+			bool bOutside = false;
+			for (const auto& Face : Faces)
+			{
+				const FVector& A = Simplex[Face[0]].W;
+				const FVector& B = Simplex[Face[1]].W;
+				const FVector& C = Simplex[Face[2]].W;
+				const FVector Normal = FVector::Cross(B - A, C - A);
+				const float SignOrigin = -FVector::Dot(A, Normal);
+				const float SignOpposite = FVector::Dot(Simplex[Face[3]].W - A, Normal);
+
+				// 납작한 사면체는 면의 안팎을 판정할 수 없으므로 모든 면을 후보로 검사
+				if (std::fabs(SignOpposite) > KINDA_SMALL_NUMBER && SignOrigin * SignOpposite >= 0.0f)
+				{
+					continue;
+				}
+
+				bOutside = true;
+				float FaceLambda[3];
+				ClosestOnTriangle(A, B, C, FaceLambda);
+				const FVector Point = A * FaceLambda[0] + B * FaceLambda[1] + C * FaceLambda[2];
+				const float DistSquared = Point.SizeSquared();
+				if (DistSquared < BestDistSquared)
+				{
+					BestDistSquared = DistSquared;
+					BestLambda[Face[0]] = FaceLambda[0];
+					BestLambda[Face[1]] = FaceLambda[1];
+					BestLambda[Face[2]] = FaceLambda[2];
+					BestLambda[Face[3]] = 0.0f;
+				}
+			}
+
+			if (!bOutside)
+			{
+				OutClosest = FVector(0.0f, 0.0f, 0.0f);
+				return true;
+			}
+			for (int32 i = 0; i < 4; ++i)
+			{
+				Lambda[i] = BestLambda[i];
+			}
+			break;
+		}
+
+		default:
+			break;
+		}
+
+		CompactSimplex(Simplex, Lambda, NumVertices);
+		OutClosest = FVector(0.0f, 0.0f, 0.0f);
+		for (int32 i = 0; i < NumVertices; ++i)
+		{
+			OutClosest += Simplex[i].W * Lambda[i];
+		}
+		return false;
+	}
+
+	void AddBoxCorners(const FVector& Center, const FVector (&Axes)[3], const FVector& HalfExtent, CollisionQuery::FConvexCore& OutCore)
+	{
+		OutCore.NumPoints = 8;
+		for (int32 Corner = 0; Corner < 8; ++Corner)
+		{
+			const float SX = (Corner & 1) ? 1.0f : -1.0f;
+			const float SY = (Corner & 2) ? 1.0f : -1.0f;
+			const float SZ = (Corner & 4) ? 1.0f : -1.0f;
+			OutCore.Points[Corner] = Center
+				+ Axes[0] * (HalfExtent.X * SX)
+				+ Axes[1] * (HalfExtent.Y * SY)
+				+ Axes[2] * (HalfExtent.Z * SZ);
+		}
+	}
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// FCollisionShape
+// ────────────────────────────────────────────────────────────────────────────
+
+FCollisionShape FCollisionShape::MakeSphere(float InRadius)
+{
+	FCollisionShape Shape;
+	Shape.Kind = EKind::Sphere;
+	Shape.Radius = InRadius;
+	return Shape;
+}
+
+FCollisionShape FCollisionShape::MakeCapsule(float InRadius, float InHalfHeight)
+{
+	FCollisionShape Shape;
+	Shape.Kind = EKind::Capsule;
+	Shape.Radius = InRadius;
+	Shape.HalfHeight = FMath::Max(InHalfHeight, InRadius);
+	return Shape;
+}
+
+FCollisionShape FCollisionShape::MakeBox(const FVector& InHalfExtent)
+{
+	FCollisionShape Shape;
+	Shape.Kind = EKind::Box;
+	Shape.BoxHalfExtent = InHalfExtent;
+	return Shape;
+}
+
+FCollisionShape FCollisionShape::MakeFromComponent(const UShapeComponent* Component)
+{
+	if (!Component)
+	{
+		return FCollisionShape();
+	}
+
+	FShape Shape;
+	Component->GetShape(Shape);
+	const FVector Scale = Collision::AbsVec(Component->GetWorldTransform().Scale3D);
+
+	switch (Shape.Kind)
+	{
+	case EShapeKind::Box:
+		return MakeBox(Shape.Box.BoxExtent * Scale);
+	case EShapeKind::Sphere:
+		return MakeSphere(Shape.Sphere.SphereRadius * Collision::UniformScaleMax(Scale));
+	case EShapeKind::Capsule:
+	{
+		// Collision::BuildCapsule과 같은 규칙: 반지름은 XY 최대 스케일, 선분 길이는 Z 스케일
+		const float Radius = Shape.Capsule.CapsuleRadius * FMath::Max(Scale.X, Scale.Y);
+		const float SegmentHalf = FMath::Max(0.0f, Shape.Capsule.CapsuleHalfHeight - Shape.Capsule.CapsuleRadius) * Scale.Z;
+		return MakeCapsule(Radius, SegmentHalf + Radius);
+	}
+	}
+	return FCollisionShape();
+}
+
+namespace CollisionQuery
+{
+	FVector FConvexCore::Support(const FVector& Direction) const
+	{
+		int32 Best = 0;
+		float BestDot = FVector::Dot(Points[0], Direction);
+		for (int32 i = 1; i < NumPoints; ++i)
+		{
+			const float Dot = FVector::Dot(Points[i], Direction);
+			if (Dot > BestDot)
+			{
+				BestDot = Dot;
+				Best = i;
+			}
+		}
+		return Points[Best];
+	}
+
+	void BuildCore(const FCollisionShape& Shape, const FVector& Location, const FQuat& Rotation, FConvexCore& OutCore)
+	{
+		switch (Shape.Kind)
+		{
+		case FCollisionShape::EKind::Line:
+		case FCollisionShape::EKind::Sphere:
+			OutCore.NumPoints = 1;
+			OutCore.Points[0] = Location;
+			OutCore.Radius = Shape.Kind == FCollisionShape::EKind::Sphere ? Shape.Radius : 0.0f;
+			break;
+
+		case FCollisionShape::EKind::Capsule:
+		{
+			const FVector Axis = Rotation.RotateVector(FVector(0.0f, 0.0f, 1.0f)) * (Shape.HalfHeight - Shape.Radius);
+			OutCore.NumPoints = 2;
+			OutCore.Points[0] = Location - Axis;
+			OutCore.Points[1] = Location + Axis;
+			OutCore.Radius = Shape.Radius;
+			break;
+		}
+
+		case FCollisionShape::EKind::Box:
+		{
+			const FVector Axes[3] = {
+				Rotation.RotateVector(FVector(1.0f, 0.0f, 0.0f)),
+				Rotation.RotateVector(FVector(0.0f, 1.0f, 0.0f)),
+				Rotation.RotateVector(FVector(0.0f, 0.0f, 1.0f)) };
+			AddBoxCorners(Location, Axes, Shape.BoxHalfExtent, OutCore);
+			OutCore.Radius = 0.0f;
+			break;
+		}
+		}
+	}
+
+	void BuildCore(const FShape& Shape, const FTransform& Transform, FConvexCore& OutCore)
+	{
+		switch (Shape.Kind)
+		{
+		case EShapeKind::Box:
+		{
+			FOBB Box;
+			Collision::BuildOBB(Shape, Transform, Box);
+			AddBoxCorners(Box.Center, Box.Axes, Box.HalfExtent, OutCore);
+			OutCore.Radius = 0.0f;
+			break;
+		}
+
+		case EShapeKind::Sphere:
+			OutCore.NumPoints = 1;
+			OutCore.Points[0] = Transform.Translation;
+			OutCore.Radius = Shape.Sphere.SphereRadius * Collision::UniformScaleMax(Collision::AbsVec(Transform.Scale3D));
+			break;
+
+		case EShapeKind::Capsule:
+			OutCore.NumPoints = 2;
+			Collision::BuildCapsule(Shape, Transform, OutCore.Points[0], OutCore.Points[1], OutCore.Radius);
+			break;
+		}
+	}
+
+	void BuildTriangleCore(const FVector& V0, const FVector& V1, const FVector& V2, FConvexCore& OutCore)
+	{
+		OutCore.NumPoints = 3;
+		OutCore.Points[0] = V0;
+		OutCore.Points[1] = V1;
+		OutCore.Points[2] = V2;
+		OutCore.Radius = 0.0f;
+	}
+
+	float ComputeDistance(const FConvexCore& A, const FConvexCore& B, FVector& OutPointA, FVector& OutPointB)
+	{
+		FSimplexVertex Simplex[4];
+		float Lambda[4] = { 1.0f, 0.0f, 0.0f, 0.0f };
+		int32 NumVertices = 1;
+		Simplex[0] = { A.Points[0] - B.Points[0], A.Points[0], B.Points[0] };
+		FVector V = Simplex[0].W;
+		bool bContainsOrigin = false;
+
+		for (int32 Iteration = 0; Iteration < MaxGJKIterations; ++Iteration)
+		{
+			const float VV = V.SizeSquared();
+			if (VV <= KINDA_SMALL_NUMBER * KINDA_SMALL_NUMBER)
+			{
+				bContainsOrigin = true;
+				break;
+			}
+
+			// Minkowski 차(A - B)의 -V 방향 지지점
+			const FVector SupportA = A.Support(-V);
+			const FVector SupportB = B.Support(V);
+			const FVector W = SupportA - SupportB;
+
+			// 원점 쪽으로 더 나아갈 수 없으면 V가 최근접점
+			if (VV - FVector::Dot(V, W) <= 1.0e-5f * VV)
+			{
+				break;
+			}
+
+			bool bDuplicate = false;
+			for (int32 i = 0; i < NumVertices; ++i)
+			{
+				bDuplicate |= (Simplex[i].W - W).SizeSquared() <= KINDA_SMALL_NUMBER;
+			}
+			if (bDuplicate)
+			{
+				break;
+			}
+
+			Simplex[NumVertices] = { W, SupportA, SupportB };
+			Lambda[NumVertices] = 0.0f;
+			++NumVertices;
+
+			if (SolveSimplex(Simplex, Lambda, NumVertices, V))
+			{
+				bContainsOrigin = true;
+				break;
+			}
+		}
+
+		OutPointA = FVector(0.0f, 0.0f, 0.0f);
+		OutPointB = FVector(0.0f, 0.0f, 0.0f);
+		if (bContainsOrigin)
+		{
+			// 겹침: 최근접점 대신 심플렉스 평균 (거리 0이라 법선은 호출 측에서 정함)
+			for (int32 i = 0; i < NumVertices; ++i)
+			{
+				OutPointA += Simplex[i].A;
+				OutPointB += Simplex[i].B;
+			}
+			OutPointA /= static_cast<float>(NumVertices);
+			OutPointB /= static_cast<float>(NumVertices);
+			return 0.0f;
+		}
+
+		for (int32 i = 0; i < NumVertices; ++i)
+		{
+			OutPointA += Simplex[i].A * Lambda[i];
+			OutPointB += Simplex[i].B * Lambda[i];
+		}
+		return V.Size();
+	}
+
+	bool SweepConvex(const FConvexCore& A, const FVector& Delta, const FConvexCore& B, float MaxTime, FHitResult& OutHit)
+	{
+		const float RadiusSum = A.Radius + B.Radius;
+		const float DeltaSize = Delta.Size();
+		const FVector FallbackNormal = DeltaSize > KINDA_SMALL_NUMBER ? Delta * (-1.0f / DeltaSize) : FVector(0.0f, 0.0f, 1.0f);
+
+		FConvexCore Moving = A;
+		float Time = 0.0f;
+		FVector PointA, PointB, Normal = FallbackNormal;
+
+		for (int32 Iteration = 0; Iteration < MaxAdvanceIterations; ++Iteration)
+		{
+			const float CoreDistance = ComputeDistance(Moving, B, PointA, PointB);
+			const float Gap = CoreDistance - RadiusSum;
+			Normal = CoreDistance > KINDA_SMALL_NUMBER ? (PointA - PointB) / CoreDistance : FallbackNormal;
+
+			// 단위 Time당 B 쪽으로 다가가는 거리
+			const float Approach = -FVector::Dot(Delta, Normal);
+
+			if (Gap <= ContactTolerance)
+			{
+				if (Iteration == 0)
+				{
+					// 처음부터 닿아 있으면 떨어지거나 미끄러지는 이동은 막지 않음 (바닥 위를 걷는 경우 등)
+					if (Approach <= KINDA_SMALL_NUMBER)
+					{
+						return false;
+					}
+					OutHit.bStartPenetrating = Gap < 0.0f;
+				}
+				break;
+			}
+
+			if (Approach <= KINDA_SMALL_NUMBER)
+			{
+				return false;
+			}
+
+			// 분리 평면까지 남은 거리만큼은 충돌 없이 이동 가능. 접촉 허용 거리의 절반을 남겨 겹치지 않게 함
+			Time += (Gap - ContactTolerance * 0.5f) / Approach;
+			if (Time > MaxTime)
+			{
+				return false;
+			}
+
+			const FVector Offset = Delta * Time;
+			for (int32 i = 0; i < A.NumPoints; ++i)
+			{
+				Moving.Points[i] = A.Points[i] + Offset;
+			}
+		}
+
+		// 반복 한도에 닿으면 (스치는 곡면 등) 현재 위치를 충돌로 봄: 통과하는 쪽보다 안전
+		OutHit.Time = Time;
+		OutHit.ImpactNormal = Normal;
+		OutHit.ImpactPoint = PointB + Normal * B.Radius;
+		return true;
+	}
+}
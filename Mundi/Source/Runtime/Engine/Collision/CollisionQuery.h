@@ -0,0 +1,172 @@
+// ────────────────────────────────────────────────────────────────────────────
+// CollisionQuery.h
+// 이동용 스윕/레이 캐스트 쿼리 타입과 볼록 형상 스윕 (GJK + Conservative Advancement)
+// ────────────────────────────────────────────────────────────────────────────
+#pragma once
+#include "Vector.h"
+
+// Forward Declarations
+struct FShape;
+class UPrimitiveComponent;
+class UShapeComponent;
+class AActor;
+
+/**
+ * FCollisionShape
+ *
+ * 스윕 쿼리에 쓰는 셰이프입니다. 크기는 월드 단위(스케일 적용 후)이고, 회전은 쿼리마다 따로 넘깁니다.
+ * 레이는 반지름 0인 구와 같습니다.
+ */
+struct FCollisionShape
+{
+	enum class EKind : uint8
+	{
+		Line,
+		Sphere,
+		Capsule,
+		Box
+	};
+
+	EKind Kind = EKind::Line;
+
+	/** Sphere/Capsule 반지름 */
+	float Radius = 0.0f;
+
+	/** Capsule 반높이 (반구 포함, 로컬 Z축 방향) */
+	float HalfHeight = 0.0f;
+
+	/** Box 반크기 */
+	FVector BoxHalfExtent = FVector(0.0f, 0.0f, 0.0f);
+
+	static FCollisionShape MakeSphere(float InRadius);
+	static FCollisionShape MakeCapsule(float InRadius, float InHalfHeight);
+	static FCollisionShape MakeBox(const FVector& InHalfExtent);
+
+	/**
+	 * ShapeComponent의 셰이프를 월드 스케일을 적용해 만듭니다. (Collision::CheckOverlap과 같은 스케일 규칙)
+	 *
+	 * @param Component - 원본 컴포넌트
+	 * @return 스윕용 셰이프
+	 */
+	static FCollisionShape MakeFromComponent(const UShapeComponent* Component);
+};
+
+/**
+ * FCollisionQueryParams
+ *
+ * 스윕/레이 캐스트에서 무시할 대상과 검사 범위입니다.
+ */
+struct FCollisionQueryParams
+{
+	/** 이 액터의 컴포넌트는 모두 무시 (보통 이동하는 자기 자신) */
+	const AActor* IgnoredActor = nullptr;
+
+	/** 이 컴포넌트는 무시 */
+	const UPrimitiveComponent* IgnoredComponent = nullptr;
+
+	/** 등록된 ShapeComponent 검사 여부 (bBlockComponent인 셰이프만) */
+	bool bTraceShapes = true;
+
+	/** World Partition의 StaticMeshComponent 검사 여부 (메시 BVH 삼각형 단위) */
+	bool bTraceStaticMeshes = true;
+};
+
+/**
+ * FHitResult
+ *
+ * 스윕/레이 캐스트의 첫 번째 충돌입니다.
+ */
+struct FHitResult
+{
+	/** 충돌 여부 */
+	bool bBlockingHit = false;
+
+	/** 시작 위치에서 이미 겹쳐 있고, 그 안쪽으로 이동하려 했는지 */
+	bool bStartPenetrating = false;
+
+	/** Start ~ End 사이 충돌 시점 (0 ~ 1). 충돌이 없으면 1 */
+	float Time = 1.0f;
+
+	/** Start에서 충돌 위치까지의 거리 */
+	float Distance = 0.0f;
+
+	/** 충돌 시점의 셰이프 중심 (이동을 여기서 멈추면 됨) */
+	FVector Location = FVector(0.0f, 0.0f, 0.0f);
+
+	/** 두 형상이 맞닿은 지점 */
+	FVector ImpactPoint = FVector(0.0f, 0.0f, 0.0f);
+
+	/** 부딪힌 표면의 법선 (스윕하는 셰이프 쪽을 향함) */
+	FVector ImpactNormal = FVector(0.0f, 0.0f, 1.0f);
+
+	/** 부딪힌 컴포넌트 (UShapeComponent 또는 UStaticMeshComponent) */
+	UPrimitiveComponent* Component = nullptr;
+
+	/** 부딪힌 컴포넌트의 액터 */
+	AActor* Actor = nullptr;
+
+	/** 메시에 부딪힌 경우 삼각형 번호 (아니면 UINT32_MAX) */
+	uint32 TriangleID = UINT32_MAX;
+};
+
+/**
+ * FSweepRequest
+ *
+ * UCollisionManager::SweepBatch의 요청 하나입니다.
+ */
+struct FSweepRequest
+{
+	FVector Start = FVector(0.0f, 0.0f, 0.0f);
+	FVector End = FVector(0.0f, 0.0f, 0.0f);
+	FQuat Rotation = FQuat::Identity();
+	FCollisionShape Shape;
+	FCollisionQueryParams Params;
+};
+
+namespace CollisionQuery
+{
+	/**
+	 * 점 집합의 볼록 껍질 + 반지름으로 표현한 형상입니다.
+	 * 구 = 점 1개, 캡슐 = 선분(점 2개), 박스 = 꼭짓점 8개, 삼각형 = 점 3개
+	 */
+	struct FConvexCore
+	{
+		FVector Points[8];
+		int32 NumPoints = 0;
+		float Radius = 0.0f;
+
+		FVector Support(const FVector& Direction) const;
+	};
+
+	/** 스윕 수렴 판정 거리. 이 거리 안으로 들어오면 접촉으로 보고, 충돌 위치는 그만큼 떨어진 곳이 됨 */
+	constexpr float ContactTolerance = 1.0e-3f;
+
+	/** 쿼리 셰이프를 월드 위치/회전에 놓은 코어 */
+	void BuildCore(const FCollisionShape& Shape, const FVector& Location, const FQuat& Rotation, FConvexCore& OutCore);
+
+	/** ShapeComponent 셰이프를 월드 트랜스폼에 놓은 코어 (Collision::BuildOBB/BuildCapsule과 같은 규칙) */
+	void BuildCore(const FShape& Shape, const FTransform& Transform, FConvexCore& OutCore);
+
+	/** 월드 공간 삼각형 코어 */
+	void BuildTriangleCore(const FVector& V0, const FVector& V1, const FVector& V2, FConvexCore& OutCore);
+
+	/**
+	 * 두 코어(반지름 제외) 사이 최단 거리와 최근접점을 GJK로 구합니다.
+	 *
+	 * @return 코어 사이 거리 (겹치면 0)
+	 */
+	float ComputeDistance(const FConvexCore& A, const FConvexCore& B, FVector& OutPointA, FVector& OutPointB);
+
+	/**
+	 * 코어 A를 Delta만큼 평행 이동할 때 정지한 B에 처음 닿는 시점을 구합니다.
+	 * 최근접점 분리 평면으로 안전한 만큼씩 전진하는 Conservative Advancement라서 얇은 형상도 통과하지 않습니다.
+	 *
+	 * @param A - 시작 위치의 이동 코어
+	 * @param Delta - 이동량
+	 * @param B - 정지한 코어
+	 * @param MaxTime - 이 시점 이후의 충돌은 무시 (이미 찾은 더 가까운 충돌)
+	 * @param OutHit - 충돌 시 Time/ImpactPoint/ImpactNormal/bStartPenetrating 기록
+	 * @return MaxTime 이전에 충돌하면 true
+	 */
+	bool SweepConvex(const FConvexCore& A, const FVector& Delta, const FConvexCore& B, float MaxTime, FHitResult& OutHit);
+}
@@ -0,0 +1,1509 @@
+// ────────────────────────────────────────────────────────────────────────────
+// PhysicsScene.cpp
+// 셰이프 컴포넌트 강체 시뮬레이션 구현
+// ────────────────────────────────────────────────────────────────────────────
+#include "pch.h"
+#include "PhysicsScene.h"
+#include "ShapeComponent.h"
+#include "Collision.h"
+#include "TaskScheduler.h"
+#include "PlatformTime.h"
+#include <atomic>
+
+namespace
+{
+	/** 이 거리 안으로 가까워진 형상은 닿기 전부터 접촉점을 만들어 속도를 제한 (터널링/떨림 방지) */
+	constexpr float SpeculativeDistance = 0.02f;
+
+	/** 브로드 페이즈 AABB 여유 */
+	constexpr float BoundsMargin = 0.05f;
+
+	/** 이만큼의 침투는 밀어내지 않음 (접촉 유지용) */
+	constexpr float LinearSlop = 0.005f;
+
+	/** 침투 보정 비율 (Baumgarte) */
+	constexpr float Baumgarte = 0.2f;
+
+	/** 이보다 빠르게 부딪힐 때만 반발 적용 (m/s) */
+	constexpr float RestitutionThreshold = 1.0f;
+
+	/** 새 접촉점이 이 거리 안의 지난 접촉점 충격량을 이어받음 */
+	constexpr float WarmStartDistance = 0.05f;
+
+	constexpr float LinearDamping = 0.01f;
+	constexpr float AngularDamping = 0.05f;
+	constexpr float MaxAngularSpeed = 100.0f;
+
+	// 슬립 판정
+	constexpr float LinearSleepSpeed = 0.05f;
+	constexpr float AngularSleepSpeed = 0.05f;
+	constexpr float TimeToSleep = 0.5f;
+
+	// 박스-박스: 면 축을 우선하고, 다른 축은 이만큼 확실히 얕을 때만 선택
+	constexpr float AxisRelativeTolerance = 0.95f;
+	constexpr float AxisAbsoluteTolerance = 0.01f;
+
+	FVector ClosestPointOnSegment(const FVector& Point, const FVector& SegA, const FVector& SegB)
+	{
+		const FVector Dir = SegB - SegA;
+		const float LengthSquared = Dir.SizeSquared();
+		if (LengthSquared <= KINDA_SMALL_NUMBER)
+		{
+			return SegA;
+		}
+		const float T = std::clamp(FVector::Dot(Point - SegA, Dir) / LengthSquared, 0.0f, 1.0f);
+		return SegA + Dir * T;
+	}
+
+	/** 두 선분의 최근접점 (Real-Time Collision Detection 5.1.9) */
+	void ClosestPointsOnSegments(const FVector& P0, const FVector& P1, const FVector& Q0, const FVector& Q1,
+		FVector& OutOnP, FVector& OutOnQ)
+	{
+		const FVector D1 = P1 - P0;
+		const FVector D2 = Q1 - Q0;
+		const FVector R = P0 - Q0;
+		const float A = D1.SizeSquared();
+		const float E = D2.SizeSquared();
+		const float F = FVector::Dot(D2, R);
+
+		float S = 0.0f;
+		float T = 0.0f;
+		if (A <= KINDA_SMALL_NUMBER && E <= KINDA_SMALL_NUMBER)
+		{
+			OutOnP = P0;
+			OutOnQ = Q0;
+			return;
+		}
+		if (A <= KINDA_SMALL_NUMBER)
+		{
+			T = std::clamp(F / E, 0.0f, 1.0f);
+		}
+		else
+		{
+			const float C = FVector::Dot(D1, R);
+			if (E <= KINDA_SMALL_NUMBER)
+			{
+				S = std::clamp(-C / A, 0.0f, 1.0f);
+			}
+			else
+			{
+				const float B = FVector::Dot(D1, D2);
+				const float Denom = A * E - B * B;
+				S = Denom > KINDA_SMALL_NUMBER ? std::clamp((B * F - C * E) / Denom, 0.0f, 1.0f) : 0.0f;
+				T = (B * S + F) / E;
+				if (T < 0.0f)
+				{
+					T = 0.0f;
+					S = std::clamp(-C / A, 0.0f, 1.0f);
+				}
+				else if (T > 1.0f)
+				{
+					T = 1.0f;
+					S = std::clamp((B - C) / A, 0.0f, 1.0f);
+				}
+			}
+		}
+		OutOnP = P0 + D1 * S;
+		OutOnQ = Q0 + D2 * T;
+	}
+
+	/** 법선에 수직인 두 접선 (같은 법선이면 항상 같은 결과라 웜 스타트한 마찰 충격량 방향이 유지됨) */
+	void ComputeTangents(const FVector& Normal, FVector& OutTangent1, FVector& OutTangent2)
+	{
+		if (std::fabs(Normal.X) >= 0.57735f)
+		{
+			OutTangent1 = FVector(Normal.Y, -Normal.X, 0.0f).GetNormalized();
+		}
+		else
+		{
+			OutTangent1 = FVector(0.0f, Normal.Z, -Normal.Y).GetNormalized();
+		}
+		OutTangent2 = FVector::Cross(Normal, OutTangent1);
+	}
+
+	FVector RotateInverse(const FQuat& Rotation, const FVector& V)
+	{
+		return Rotation.Conjugate().RotateVector(V);
+	}
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 바디 등록
+// ────────────────────────────────────────────────────────────────────────────
+
+void FPhysicsScene::AddBody(UShapeComponent* Component)
+{
+	if (!Component || BodyIndices.Contains(Component))
+	{
+		return;
+	}
+
+	FRigidBody Body;
+	Body.Component = Component;
+	Body.Id = NextBodyId++;
+
+	const FTransform Transform = Component->GetWorldTransform();
+	Body.Position = Body.SyncedPosition = Transform.Translation;
+	Body.Rotation = Body.SyncedRotation = Transform.Rotation.GetNormalized();
+	UpdateAxes(Body);
+
+	BodyIndices.Add(Component, Bodies.Add(Body));
+}
+
+void FPhysicsScene::RemoveBody(UShapeComponent* Component)
+{
+	const int32* IndexPtr = BodyIndices.Find(Component);
+	if (!IndexPtr)
+	{
+		return;
+	}
+
+	const int32 Index = *IndexPtr;
+	const int32 LastIndex = Bodies.Num() - 1;
+
+	// 지난 프레임 쌍의 인덱스를 RemoveAtSwap에 맞춰 고치고, 지워지는 바디에 닿아 있던 바디는 깨움
+	for (FContactPair& Pair : Pairs)
+	{
+		if (Pair.BodyA == Index || Pair.BodyB == Index)
+		{
+			const int32 OtherIndex = Pair.BodyA == Index ? Pair.BodyB : Pair.BodyA;
+			if (OtherIndex >= 0)
+			{
+				Bodies[OtherIndex].bWakeRequested = true;
+			}
+			Pair.BodyA = Pair.BodyB = -1;
+			continue;
+		}
+		if (Pair.BodyA == LastIndex)
+		{
+			Pair.BodyA = Index;
+		}
+		if (Pair.BodyB == LastIndex)
+		{
+			Pair.BodyB = Index;
+		}
+	}
+
+	BodyIndices.Remove(Component);
+	Bodies.RemoveAtSwap(Index);
+	if (Index < Bodies.Num())
+	{
+		BodyIndices[Bodies[Index].Component] = Index;
+	}
+}
+
+void FPhysicsScene::Clear()
+{
+	Bodies.Empty();
+	BodyIndices.Empty();
+	Pairs.Empty();
+	PrevPairs.Empty();
+	Islands.Empty();
+	AwakeIslands.Empty();
+	Accumulator = 0.0f;
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 바디 조작 / 조회
+// ────────────────────────────────────────────────────────────────────────────
+
+void FPhysicsScene::AddImpulse(UShapeComponent* Component, const FVector& Impulse)
+{
+	if (const int32* Index = BodyIndices.Find(Component))
+	{
+		FRigidBody& Body = Bodies[*Index];
+		Body.PendingImpulse += Impulse;
+		Body.bWakeRequested = true;
+	}
+}
+
+void FPhysicsScene::SetLinearVelocity(UShapeComponent* Component, const FVector& Velocity)
+{
+	if (const int32* Index = BodyIndices.Find(Component))
+	{
+		FRigidBody& Body = Bodies[*Index];
+		Body.PendingVelocity = Velocity;
+		Body.PendingImpulse = FVector(0.0f, 0.0f, 0.0f);
+		Body.bHasPendingVelocity = true;
+		Body.bWakeRequested = true;
+	}
+}
+
+FVector FPhysicsScene::GetLinearVelocity(const UShapeComponent* Component) const
+{
+	const int32* Index = BodyIndices.Find(const_cast<UShapeComponent*>(Component));
+	return Index ? Bodies[*Index].LinearVelocity : FVector(0.0f, 0.0f, 0.0f);
+}
+
+FVector FPhysicsScene::GetAngularVelocity(const UShapeComponent* Component) const
+{
+	const int32* Index = BodyIndices.Find(const_cast<UShapeComponent*>(Component));
+	return Index ? Bodies[*Index].AngularVelocity : FVector(0.0f, 0.0f, 0.0f);
+}
+
+bool FPhysicsScene::IsSleeping(const UShapeComponent* Component) const
+{
+	const int32* Index = BodyIndices.Find(const_cast<UShapeComponent*>(Component));
+	return Index && Bodies[*Index].bSleeping;
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 시뮬레이션
+// ────────────────────────────────────────────────────────────────────────────
+
+void FPhysicsScene::Simulate(float DeltaSeconds)
+{
+	Stats = FPhysicsStats();
+
+	// 고정 간격 서브스텝 (밀린 시간이 최대치를 넘으면 버려서 느린 프레임이 더 느려지지 않게)
+	Accumulator += std::max(DeltaSeconds, 0.0f);
+	int32 NumSubsteps = static_cast<int32>(Accumulator / FixedTimeStep);
+	if (NumSubsteps > MaxSubsteps)
+	{
+		NumSubsteps = MaxSubsteps;
+		Accumulator = 0.0f;
+	}
+	else
+	{
+		Accumulator -= NumSubsteps * FixedTimeStep;
+	}
+
+	Stats.NumSubsteps = NumSubsteps;
+	if (NumSubsteps == 0 || Bodies.IsEmpty())
+	{
+		return;
+	}
+
+	uint64 StartCycles = FPlatformTime::Cycles64();
+	SyncBodies(NumSubsteps * FixedTimeStep);
+	BuildPairs();
+	BuildIslands();
+	Stats.BroadPhaseMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+	StartCycles = FPlatformTime::Cycles64();
+	SolveIslands(NumSubsteps);
+	Stats.SolveMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+	StartCycles = FPlatformTime::Cycles64();
+	WriteBack();
+	Stats.WriteBackMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+}
+
+void FPhysicsScene::SyncBodies(float FrameTime)
+{
+	const float GravityDrop = 0.5f * Gravity.Size() * FrameTime * FrameTime;
+
+	for (FRigidBody& Body : Bodies)
+	{
+		UShapeComponent* Component = Body.Component;
+		const bool bWasActive = Body.bActive;
+		Body.bDynamic = Component->bSimulatePhysics;
+		Body.bActive = Body.bDynamic || (Component->bPhysicsCollider && Component->bBlockComponent);
+		Body.Island = -1;
+
+		// 빠진 바디에 기대어 잠든 바디가 허공에 멈춰 있지 않도록 지난 프레임 접촉 상대를 깨움
+		Body.bWakeContacts = bWasActive && !Body.bActive;
+		if (!Body.bActive)
+		{
+			Body.bSleeping = false;
+			continue;
+		}
+
+		// 형상 (에디터/스크립트에서 크기나 스케일을 바꿀 수 있으므로 매 프레임)
+		FShape Shape;
+		Component->GetShape(Shape);
+		const FTransform Transform = Component->GetWorldTransform();
+		const FVector Scale = Collision::AbsVec(Transform.Scale3D);
+		Body.Kind = Shape.Kind;
+		switch (Shape.Kind)
+		{
+		case EShapeKind::Box:
+			Body.HalfExtent = Shape.Box.BoxExtent * Scale;
+			break;
+		case EShapeKind::Sphere:
+			Body.Radius = Shape.Sphere.SphereRadius * Collision::UniformScaleMax(Scale);
+			break;
+		case EShapeKind::Capsule:
+			Body.Radius = Shape.Capsule.CapsuleRadius * std::max(Scale.X, Scale.Y);
+			Body.HalfSegment = std::max(0.0f, Shape.Capsule.CapsuleHalfHeight - Shape.Capsule.CapsuleRadius) * Scale.Z;
+			break;
+		}
+		Body.Friction = std::max(Component->Friction, 0.0f);
+		Body.Restitution = std::clamp(Component->Restitution, 0.0f, 1.0f);
+
+		// 마지막 동기화 이후 게임플레이/에디터가 옮겼으면 그 위치로 순간 이동
+		const bool bMoved = FVector::DistSquared(Transform.Translation, Body.SyncedPosition) > 1.0e-10f
+			|| std::fabs(FQuat::Dot(Transform.Rotation, Body.SyncedRotation)) < 1.0f - 1.0e-6f;
+		if (bMoved)
+		{
+			Body.Position = Body.SyncedPosition = Transform.Translation;
+			Body.Rotation = Body.SyncedRotation = Transform.Rotation.GetNormalized();
+			Body.bWakeRequested |= Body.bDynamic;
+			Body.bWakeContacts |= !Body.bDynamic;
+		}
+		UpdateAxes(Body);
+
+		float Expansion = BoundsMargin;
+		if (Body.bDynamic)
+		{
+			ComputeMassProperties(Body, std::max(Component->Mass, 0.001f));
+
+			if (Body.bHasPendingVelocity)
+			{
+				Body.LinearVelocity = Body.PendingVelocity;
+				Body.bHasPendingVelocity = false;
+			}
+			Body.LinearVelocity += Body.PendingImpulse * Body.InvMass;
+			Body.PendingImpulse = FVector(0.0f, 0.0f, 0.0f);
+
+			if (Body.bWakeRequested)
+			{
+				Body.bSleeping = false;
+				Body.SleepTimer = 0.0f;
+				Body.bWakeRequested = false;
+			}
+
+			// 이번 프레임에 움직일 수 있는 거리만큼 AABB를 키워 서브스텝 동안 새 쌍이 생기지 않게 함
+			if (!Body.bSleeping)
+			{
+				const float BoundingRadius = Body.Kind == EShapeKind::Box
+					? Body.HalfExtent.Size()
+					: Body.Radius + Body.HalfSegment;
+				Expansion += Body.LinearVelocity.Size() * FrameTime + GravityDrop
+					+ std::min(Body.AngularVelocity.Size() * FrameTime, 1.0f) * BoundingRadius;
+			}
+		}
+		else
+		{
+			// 정적 바디: 솔버에서 읽기만 함
+			Body.InvMass = 0.0f;
+			Body.InvInertiaLocal = FVector(0.0f, 0.0f, 0.0f);
+			Body.LinearVelocity = FVector(0.0f, 0.0f, 0.0f);
+			Body.AngularVelocity = FVector(0.0f, 0.0f, 0.0f);
+			Body.PendingImpulse = FVector(0.0f, 0.0f, 0.0f);
+			Body.bHasPendingVelocity = false;
+			Body.bWakeRequested = false;
+			Body.bSleeping = false;
+		}
+
+		Body.Bounds = ComputeBounds(Body);
+		Body.Bounds.Min -= Expansion;
+		Body.Bounds.Max += Expansion;
+	}
+}
+
+void FPhysicsScene::BuildPairs()
+{
+	// 옮겨지거나 빠진 정적 바디에 지난 프레임까지 닿아 있던 바디 깨움
+	WakeContactsOfMovedBodies(Pairs);
+
+	// 지난 프레임 쌍은 웜 스타트용으로 보관
+	Pairs.swap(PrevPairs);
+	Pairs.clear();
+
+	SortedBodies.clear();
+	FVector Mean(0.0f, 0.0f, 0.0f);
+	FVector MeanSquared(0.0f, 0.0f, 0.0f);
+	for (int32 Index = 0; Index < Bodies.Num(); ++Index)
+	{
+		const FRigidBody& Body = Bodies[Index];
+		if (!Body.bActive)
+		{
+			continue;
+		}
+		SortedBodies.Add(Index);
+		const FVector Center = Body.Bounds.GetCenter();
+		Mean += Center;
+		MeanSquared += Center * Center;
+
+		++Stats.NumBodies;
+		if (Body.bDynamic)
+		{
+			++Stats.NumDynamicBodies;
+		}
+	}
+	if (SortedBodies.IsEmpty())
+	{
+		return;
+	}
+
+	// 중심이 가장 넓게 퍼진 축으로 Sweep and Prune
+	const float InvCount = 1.0f / SortedBodies.Num();
+	const FVector Variance = MeanSquared * InvCount - (Mean * InvCount) * (Mean * InvCount);
+	const int32 Axis = Variance.X >= Variance.Y ? (Variance.X >= Variance.Z ? 0 : 2) : (Variance.Y >= Variance.Z ? 1 : 2);
+	const int32 AxisB = (Axis + 1) % 3;
+	const int32 AxisC = (Axis + 2) % 3;
+
+	std::sort(SortedBodies.begin(), SortedBodies.end(), [this, Axis](int32 A, int32 B)
+	{
+		const float MinA = Bodies[A].Bounds.Min[Axis];
+		const float MinB = Bodies[B].Bounds.Min[Axis];
+		return MinA != MinB ? MinA < MinB : A < B;
+	});
+
+	for (int32 SortedIndex = 0; SortedIndex < SortedBodies.Num(); ++SortedIndex)
+	{
+		const int32 IndexA = SortedBodies[SortedIndex];
+		const FRigidBody& BodyA = Bodies[IndexA];
+		const float MaxA = BodyA.Bounds.Max[Axis];
+
+		for (int32 Other = SortedIndex + 1; Other < SortedBodies.Num(); ++Other)
+		{
+			const int32 IndexB = SortedBodies[Other];
+			const FRigidBody& BodyB = Bodies[IndexB];
+			if (BodyB.Bounds.Min[Axis] > MaxA)
+			{
+				break;
+			}
+
+			// 정적-정적은 풀 것이 없음. 잠든 바디 쌍은 아일랜드를 유지하려고 남김
+			if (!BodyA.bDynamic && !BodyB.bDynamic)
+			{
+				continue;
+			}
+			if (BodyA.Bounds.Min[AxisB] > BodyB.Bounds.Max[AxisB] || BodyB.Bounds.Min[AxisB] > BodyA.Bounds.Max[AxisB]
+				|| BodyA.Bounds.Min[AxisC] > BodyB.Bounds.Max[AxisC] || BodyB.Bounds.Min[AxisC] > BodyA.Bounds.Max[AxisC])
+			{
+				continue;
+			}
+
+			// Id가 작은 쪽을 A로 (웜 스타트 키와 LocalPointA 기준을 프레임 간에 유지)
+			const bool bSwap = BodyB.Id < BodyA.Id;
+			FContactPair& Pair = Pairs.emplace_back();
+			Pair.BodyA = bSwap ? IndexB : IndexA;
+			Pair.BodyB = bSwap ? IndexA : IndexB;
+			const uint32 IdA = Bodies[Pair.BodyA].Id;
+			const uint32 IdB = Bodies[Pair.BodyB].Id;
+			Pair.Key = (static_cast<uint64>(IdA) << 32) | IdB;
+			Pair.Friction = std::sqrt(BodyA.Friction * BodyB.Friction);
+			Pair.Restitution = std::max(BodyA.Restitution, BodyB.Restitution);
+		}
+	}
+
+	std::sort(Pairs.begin(), Pairs.end(), [](const FContactPair& A, const FContactPair& B) { return A.Key < B.Key; });
+	Stats.NumPairs = Pairs.Num();
+
+	// 옮겨진 정적 바디가 새로 닿은 잠든 바디도 깨움
+	WakeContactsOfMovedBodies(Pairs);
+
+	// 지난 프레임에도 있던 쌍은 접촉점(충격량)을 이어받음 (둘 다 Key 순 정렬)
+	int32 PrevIndex = 0;
+	for (FContactPair& Pair : Pairs)
+	{
+		while (PrevIndex < PrevPairs.Num() && PrevPairs[PrevIndex].Key < Pair.Key)
+		{
+			++PrevIndex;
+		}
+		if (PrevIndex < PrevPairs.Num() && PrevPairs[PrevIndex].Key == Pair.Key)
+		{
+			const FContactPair& Prev = PrevPairs[PrevIndex];
+			Pair.NumPoints = Prev.NumPoints;
+			for (int32 Point = 0; Point < Prev.NumPoints; ++Point)
+			{
+				Pair.Points[Point] = Prev.Points[Point];
+			}
+		}
+	}
+}
+
+void FPhysicsScene::WakeContactsOfMovedBodies(const TArray<FContactPair>& InPairs)
+{
+	for (const FContactPair& Pair : InPairs)
+	{
+		// RemoveBody로 상대가 지워진 쌍은 건너뜀
+		if (Pair.BodyA < 0 || Pair.BodyB < 0)
+		{
+			continue;
+		}
+
+		FRigidBody& BodyA = Bodies[Pair.BodyA];
+		FRigidBody& BodyB = Bodies[Pair.BodyB];
+		FRigidBody* Sleeper = BodyA.bWakeContacts ? &BodyB : (BodyB.bWakeContacts ? &BodyA : nullptr);
+		if (Sleeper && Sleeper->bDynamic && Sleeper->bSleeping)
+		{
+			Sleeper->bSleeping = false;
+			Sleeper->SleepTimer = 0.0f;
+		}
+	}
+}
+
+void FPhysicsScene::BuildIslands()
+{
+	Islands.clear();
+	IslandBodies.clear();
+	IslandPairs.clear();
+	AwakeIslands.clear();
+
+	// 동적-동적 쌍으로 Union-Find (정적 바디는 아일랜드를 잇지 않음)
+	UnionParent.SetNum(Bodies.Num());
+	for (int32 Index = 0; Index < Bodies.Num(); ++Index)
+	{
+		UnionParent[Index] = Index;
+	}
+	auto FindRoot = [this](int32 Index)
+	{
+		while (UnionParent[Index] != Index)
+		{
+			UnionParent[Index] = UnionParent[UnionParent[Index]];
+			Index = UnionParent[Index];
+		}
+		return Index;
+	};
+	for (const FContactPair& Pair : Pairs)
+	{
+		if (Bodies[Pair.BodyA].bDynamic && Bodies[Pair.BodyB].bDynamic)
+		{
+			const int32 RootA = FindRoot(Pair.BodyA);
+			const int32 RootB = FindRoot(Pair.BodyB);
+			if (RootA != RootB)
+			{
+				// 작은 인덱스를 루트로 (실행마다 같은 아일랜드 번호)
+				UnionParent[std::max(RootA, RootB)] = std::min(RootA, RootB);
+			}
+		}
+	}
+
+	// 루트마다 아일랜드 번호 (바디 인덱스 순으로 처음 만난 순서)
+	for (int32 Index = 0; Index < Bodies.Num(); ++Index)
+	{
+		FRigidBody& Body = Bodies[Index];
+		if (!Body.bActive || !Body.bDynamic)
+		{
+			continue;
+		}
+		const int32 Root = FindRoot(Index);
+		if (Root == Index)
+		{
+			Body.Island = Islands.Num();
+			FIsland& Island = Islands.emplace_back();
+			Island.bSleeping = true;
+		}
+		else
+		{
+			Body.Island = Bodies[Root].Island;
+		}
+		FIsland& Island = Islands[Body.Island];
+		++Island.NumBodies;
+		Island.bSleeping &= Body.bSleeping;
+	}
+
+	// 쌍은 동적 바디 쪽 아일랜드로
+	PairIsland.SetNum(Pairs.Num());
+	for (int32 PairIndex = 0; PairIndex < Pairs.Num(); ++PairIndex)
+	{
+		const FContactPair& Pair = Pairs[PairIndex];
+		const int32 Island = Bodies[Pair.BodyA].bDynamic ? Bodies[Pair.BodyA].Island : Bodies[Pair.BodyB].Island;
+		PairIsland[PairIndex] = Island;
+		++Islands[Island].NumPairs;
+	}
+
+	// 구간 시작 위치 (카운팅 정렬)
+	int32 BodyOffset = 0;
+	int32 PairOffset = 0;
+	for (FIsland& Island : Islands)
+	{
+		Island.FirstBody = BodyOffset;
+		Island.FirstPair = PairOffset;
+		BodyOffset += Island.NumBodies;
+		PairOffset += Island.NumPairs;
+		Island.NumBodies = 0;
+		Island.NumPairs = 0;
+	}
+	IslandBodies.SetNum(BodyOffset);
+	IslandPairs.SetNum(PairOffset);
+	for (int32 Index = 0; Index < Bodies.Num(); ++Index)
+	{
+		const FRigidBody& Body = Bodies[Index];
+		if (Body.Island >= 0)
+		{
+			FIsland& Island = Islands[Body.Island];
+			IslandBodies[Island.FirstBody + Island.NumBodies++] = Index;
+		}
+	}
+	for (int32 PairIndex = 0; PairIndex < Pairs.Num(); ++PairIndex)
+	{
+		FIsland& Island = Islands[PairIsland[PairIndex]];
+		IslandPairs[Island.FirstPair + Island.NumPairs++] = PairIndex;
+	}
+
+	// 깨어 있는 바디가 하나라도 있는 아일랜드는 전부 깨움
+	for (int32 IslandIndex = 0; IslandIndex < Islands.Num(); ++IslandIndex)
+	{
+		const FIsland& Island = Islands[IslandIndex];
+		if (Island.bSleeping)
+		{
+			continue;
+		}
+		for (int32 Offset = 0; Offset < Island.NumBodies; ++Offset)
+		{
+			FRigidBody& Body = Bodies[IslandBodies[Island.FirstBody + Offset]];
+			if (Body.bSleeping)
+			{
+				Body.bSleeping = false;
+				Body.SleepTimer = 0.0f;
+			}
+		}
+		AwakeIslands.Add(IslandIndex);
+		Stats.NumAwakeBodies += Island.NumBodies;
+	}
+	Stats.NumIslands = Islands.Num();
+	Stats.NumAwakeIslands = AwakeIslands.Num();
+
+	// 큰 아일랜드부터 가져가도록 정렬 (마지막에 큰 아일랜드 하나만 남아 한 스레드가 오래 도는 것 방지)
+	std::sort(AwakeIslands.begin(), AwakeIslands.end(), [this](int32 A, int32 B)
+	{
+		const int32 SizeA = Islands[A].NumBodies + Islands[A].NumPairs;
+		const int32 SizeB = Islands[B].NumBodies + Islands[B].NumPairs;
+		return SizeA != SizeB ? SizeA > SizeB : A < B;
+	});
+}
+
+void FPhysicsScene::SolveIslands(int32 NumSubsteps)
+{
+	const int32 NumAwake = AwakeIslands.Num();
+	if (NumAwake == 0)
+	{
+		return;
+	}
+
+	int32 NumThreads = FTaskScheduler::GetNumWorkers() + 1;
+	if (MaxThreads > 0)
+	{
+		NumThreads = std::min(NumThreads, MaxThreads);
+	}
+	NumThreads = std::min(NumThreads, NumAwake);
+
+	// 스레드마다 다음 아일랜드를 하나씩 가져감 (아일랜드 크기가 제각각이라 고정 구간 분할보다 고르게 나뉨)
+	std::atomic<int32> NextIsland{ 0 };
+	FTaskScheduler::ParallelFor(NumThreads, NumThreads, [this, &NextIsland, NumAwake, NumSubsteps](int32, int32, int32)
+	{
+		for (int32 Index = NextIsland.fetch_add(1); Index < NumAwake; Index = NextIsland.fetch_add(1))
+		{
+			SolveIsland(Islands[AwakeIslands[Index]], NumSubsteps);
+		}
+	});
+
+	for (int32 IslandIndex : AwakeIslands)
+	{
+		const FIsland& Island = Islands[IslandIndex];
+		for (int32 Offset = 0; Offset < Island.NumPairs; ++Offset)
+		{
+			Stats.NumContacts += Pairs[IslandPairs[Island.FirstPair + Offset]].NumPoints;
+		}
+	}
+}
+
+void FPhysicsScene::SolveIsland(const FIsland& Island, int32 NumSubsteps)
+{
+	const float Dt = FixedTimeStep;
+	const float InvDt = 1.0f / FixedTimeStep;
+	const int32* BodyList = IslandBodies.GetData() + Island.FirstBody;
+	const int32* PairList = IslandPairs.GetData() + Island.FirstPair;
+
+	// 정적 바디는 다른 아일랜드와 공유하므로 동적 바디에만 충격량 적용
+	auto ApplyImpulse = [](FRigidBody& Body, const FVector& Impulse, const FVector& Arm)
+	{
+		if (Body.bDynamic)
+		{
+			Body.LinearVelocity += Impulse * Body.InvMass;
+			Body.AngularVelocity += Body.ApplyInvInertia(FVector::Cross(Arm, Impulse));
+		}
+	};
+	auto RelativeVelocity = [](const FRigidBody& A, const FRigidBody& B, const FContactPoint& Point)
+	{
+		return B.LinearVelocity + FVector::Cross(B.AngularVelocity, Point.RB)
+			- A.LinearVelocity - FVector::Cross(A.AngularVelocity, Point.RA);
+	};
+	auto EffectiveMass = [](const FRigidBody& A, const FRigidBody& B, const FContactPoint& Point, const FVector& Direction)
+	{
+		const FVector CrossA = FVector::Cross(Point.RA, Direction);
+		const FVector CrossB = FVector::Cross(Point.RB, Direction);
+		const float K = A.InvMass + B.InvMass
+			+ FVector::Dot(CrossA, A.ApplyInvInertia(CrossA))
+			+ FVector::Dot(CrossB, B.ApplyInvInertia(CrossB));
+		return K > KINDA_SMALL_NUMBER ? 1.0f / K : 0.0f;
+	};
+
+	for (int32 Step = 0; Step < NumSubsteps; ++Step)
+	{
+		// 1. 속도 적분 (중력 + 감쇠)
+		const float LinearDampingScale = 1.0f / (1.0f + Dt * LinearDamping);
+		const float AngularDampingScale = 1.0f / (1.0f + Dt * AngularDamping);
+		for (int32 Offset = 0; Offset < Island.NumBodies; ++Offset)
+		{
+			FRigidBody& Body = Bodies[BodyList[Offset]];
+			Body.LinearVelocity = (Body.LinearVelocity + Gravity * Dt) * LinearDampingScale;
+			Body.AngularVelocity *= AngularDampingScale;
+		}
+
+		// 2. 접촉점 갱신 + 솔버 준비 + 웜 스타트
+		for (int32 Offset = 0; Offset < Island.NumPairs; ++Offset)
+		{
+			FContactPair& Pair = Pairs[PairList[Offset]];
+			UpdateContacts(Pair);
+
+			FRigidBody& A = Bodies[Pair.BodyA];
+			FRigidBody& B = Bodies[Pair.BodyB];
+			for (int32 PointIndex = 0; PointIndex < Pair.NumPoints; ++PointIndex)
+			{
+				FContactPoint& Point = Pair.Points[PointIndex];
+				Point.RA = Point.Position - A.Position;
+				Point.RB = Point.Position - B.Position;
+				ComputeTangents(Point.Normal, Point.Tangent1, Point.Tangent2);
+				Point.NormalMass = EffectiveMass(A, B, Point, Point.Normal);
+				Point.TangentMass1 = EffectiveMass(A, B, Point, Point.Tangent1);
+				Point.TangentMass2 = EffectiveMass(A, B, Point, Point.Tangent2);
+
+				// 떨어져 있으면 그 거리만큼만 다가오게, 파고들었으면 슬롭을 넘는 만큼 밀어냄
+				if (Point.Separation > 0.0f)
+				{
+					Point.VelocityBias = Point.Separation * InvDt;
+				}
+				else
+				{
+					Point.VelocityBias = Baumgarte * std::min(0.0f, Point.Separation + LinearSlop) * InvDt;
+				}
+
+				const float NormalVelocity = FVector::Dot(RelativeVelocity(A, B, Point), Point.Normal);
+				if (Pair.Restitution > 0.0f && NormalVelocity < -RestitutionThreshold)
+				{
+					Point.VelocityBias = std::min(Point.VelocityBias, Pair.Restitution * NormalVelocity);
+				}
+
+				const FVector Impulse = Point.Normal * Point.NormalImpulse
+					+ Point.Tangent1 * Point.TangentImpulse1
+					+ Point.Tangent2 * Point.TangentImpulse2;
+				ApplyImpulse(A, -Impulse, Point.RA);
+				ApplyImpulse(B, Impulse, Point.RB);
+			}
+		}
+
+		// 3. 속도 반복 (마찰 -> 법선)
+		for (int32 Iteration = 0; Iteration < SolverIterations; ++Iteration)
+		{
+			for (int32 Offset = 0; Offset < Island.NumPairs; ++Offset)
+			{
+				FContactPair& Pair = Pairs[PairList[Offset]];
+				FRigidBody& A = Bodies[Pair.BodyA];
+				FRigidBody& B = Bodies[Pair.BodyB];
+				for (int32 PointIndex = 0; PointIndex < Pair.NumPoints; ++PointIndex)
+				{
+					FContactPoint& Point = Pair.Points[PointIndex];
+					const float MaxFriction = Pair.Friction * Point.NormalImpulse;
+
+					float Lambda = -Point.TangentMass1 * FVector::Dot(RelativeVelocity(A, B, Point), Point.Tangent1);
+					float NewImpulse = std::clamp(Point.TangentImpulse1 + Lambda, -MaxFriction, MaxFriction);
+					FVector Impulse = Point.Tangent1 * (NewImpulse - Point.TangentImpulse1);
+					Point.TangentImpulse1 = NewImpulse;
+					ApplyImpulse(A, -Impulse, Point.RA);
+					ApplyImpulse(B, Impulse, Point.RB);
+
+					Lambda = -Point.TangentMass2 * FVector::Dot(RelativeVelocity(A, B, Point), Point.Tangent2);
+					NewImpulse = std::clamp(Point.TangentImpulse2 + Lambda, -MaxFriction, MaxFriction);
+					Impulse = Point.Tangent2 * (NewImpulse - Point.TangentImpulse2);
+					Point.TangentImpulse2 = NewImpulse;
+					ApplyImpulse(A, -Impulse, Point.RA);
+					ApplyImpulse(B, Impulse, Point.RB);
+
+					const float NormalVelocity = FVector::Dot(RelativeVelocity(A, B, Point), Point.Normal);
+					Lambda = -Point.NormalMass * (NormalVelocity + Point.VelocityBias);
+					NewImpulse = std::max(Point.NormalImpulse + Lambda, 0.0f);
+					Impulse = Point.Normal * (NewImpulse - Point.NormalImpulse);
+					Point.NormalImpulse = NewImpulse;
+					ApplyImpulse(A, -Impulse, Point.RA);
+					ApplyImpulse(B, Impulse, Point.RB);
+				}
+			}
+		}
+
+		// 4. 위치 적분
+		for (int32 Offset = 0; Offset < Island.NumBodies; ++Offset)
+		{
+			FRigidBody& Body = Bodies[BodyList[Offset]];
+			const float AngularSpeed = Body.AngularVelocity.Size();
+			if (AngularSpeed > MaxAngularSpeed)
+			{
+				Body.AngularVelocity *= MaxAngularSpeed / AngularSpeed;
+			}
+
+			Body.Position += Body.LinearVelocity * Dt;
+
+			// dq/dt = 0.5 * (w, 0) * q (월드 각속도)
+			const FQuat Spin = FQuat(Body.AngularVelocity.X, Body.AngularVelocity.Y, Body.AngularVelocity.Z, 0.0f) * Body.Rotation;
+			const float HalfDt = 0.5f * Dt;
+			Body.Rotation = FQuat(
+				Body.Rotation.X + Spin.X * HalfDt,
+				Body.Rotation.Y + Spin.Y * HalfDt,
+				Body.Rotation.Z + Spin.Z * HalfDt,
+				Body.Rotation.W + Spin.W * HalfDt).GetNormalized();
+			UpdateAxes(Body);
+		}
+	}
+
+	// 슬립: 아일랜드의 모든 바디가 TimeToSleep 동안 느렸으면 아일랜드 전체를 재움
+	float MinSleepTimer = std::numeric_limits<float>::max();
+	for (int32 Offset = 0; Offset < Island.NumBodies; ++Offset)
+	{
+		FRigidBody& Body = Bodies[BodyList[Offset]];
+		if (Body.LinearVelocity.SizeSquared() > LinearSleepSpeed * LinearSleepSpeed
+			|| Body.AngularVelocity.SizeSquared() > AngularSleepSpeed * AngularSleepSpeed)
+		{
+			Body.SleepTimer = 0.0f;
+		}
+		else
+		{
+			Body.SleepTimer += NumSubsteps * Dt;
+		}
+		MinSleepTimer = std::min(MinSleepTimer, Body.SleepTimer);
+	}
+	if (MinSleepTimer >= TimeToSleep)
+	{
+		for (int32 Offset = 0; Offset < Island.NumBodies; ++Offset)
+		{
+			FRigidBody& Body = Bodies[BodyList[Offset]];
+			Body.bSleeping = true;
+			Body.LinearVelocity = FVector(0.0f, 0.0f, 0.0f);
+			Body.AngularVelocity = FVector(0.0f, 0.0f, 0.0f);
+		}
+	}
+}
+
+void FPhysicsScene::WriteBack()
+{
+	for (FRigidBody& Body : Bodies)
+	{
+		if (!Body.bActive || !Body.bDynamic)
+		{
+			continue;
+		}
+
+		const bool bMoved = FVector::DistSquared(Body.Position, Body.SyncedPosition) > 1.0e-10f
+			|| std::fabs(FQuat::Dot(Body.Rotation, Body.SyncedRotation)) < 1.0f - 1.0e-6f;
+		if (!bMoved)
+		{
+			continue;
+		}
+
+		// 부모 트랜스폼을 거치며 생기는 오차를 순간 이동으로 보지 않도록 실제로 반영된 값을 기억
+		Body.Component->SetWorldLocationAndRotation(Body.Position, Body.Rotation);
+		const FTransform Transform = Body.Component->GetWorldTransform();
+		Body.SyncedPosition = Transform.Translation;
+		Body.SyncedRotation = Transform.Rotation;
+	}
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 접촉 생성
+// ────────────────────────────────────────────────────────────────────────────
+
+void FPhysicsScene::FManifold::AddPoint(const FVector& Position, const FVector& Normal, float Separation)
+{
+	if (Separation > SpeculativeDistance)
+	{
+		return;
+	}
+
+	// 가득 차면 가장 얕은 점과 교체
+	int32 Slot = NumPoints;
+	if (NumPoints == MaxContactPoints)
+	{
+		Slot = 0;
+		for (int32 Index = 1; Index < NumPoints; ++Index)
+		{
+			if (Points[Index].Separation > Points[Slot].Separation)
+			{
+				Slot = Index;
+			}
+		}
+		if (Points[Slot].Separation <= Separation)
+		{
+			return;
+		}
+	}
+	else
+	{
+		++NumPoints;
+	}
+
+	FContactPoint& Point = Points[Slot];
+	Point = FContactPoint();
+	Point.Position = Position;
+	Point.Normal = Normal;
+	Point.Separation = Separation;
+}
+
+namespace
+{
+	/** 구 - 구 (법선은 A에서 B 방향) */
+	template<typename TManifold>
+	void CollideSpheres(const FVector& CenterA, float RadiusA, const FVector& CenterB, float RadiusB, TManifold& Out)
+	{
+		const FVector Delta = CenterB - CenterA;
+		const float MaxDistance = RadiusA + RadiusB + SpeculativeDistance;
+		const float DistanceSquared = Delta.SizeSquared();
+		if (DistanceSquared > MaxDistance * MaxDistance)
+		{
+			return;
+		}
+
+		const float Distance = std::sqrt(DistanceSquared);
+		const FVector Normal = Distance > KINDA_SMALL_NUMBER ? Delta / Distance : FVector(0.0f, 0.0f, 1.0f);
+		const float Separation = Distance - RadiusA - RadiusB;
+		Out.AddPoint(CenterA + Normal * (RadiusA + 0.5f * Separation), Normal, Separation);
+	}
+
+	/** 박스 - 구 (법선은 박스에서 구 방향) */
+	template<typename TBody, typename TManifold>
+	void CollideBoxSphere(const TBody& Box, const FVector& Center, float Radius, TManifold& Out)
+	{
+		const FVector Delta = Center - Box.Position;
+		FVector Local;
+		FVector Clamped;
+		bool bInside = true;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			Local[Axis] = FVector::Dot(Delta, Box.Axes[Axis]);
+			Clamped[Axis] = std::clamp(Local[Axis], -Box.HalfExtent[Axis], Box.HalfExtent[Axis]);
+			bInside &= Clamped[Axis] == Local[Axis];
+		}
+
+		if (bInside)
+		{
+			// 중심이 박스 안: 가장 가까운 면으로 밀어냄
+			int32 BestAxis = 0;
+			float BestDepth = Box.HalfExtent[0] - std::fabs(Local[0]);
+			for (int32 Axis = 1; Axis < 3; ++Axis)
+			{
+				const float Depth = Box.HalfExtent[Axis] - std::fabs(Local[Axis]);
+				if (Depth < BestDepth)
+				{
+					BestDepth = Depth;
+					BestAxis = Axis;
+				}
+			}
+			const FVector Normal = Box.Axes[BestAxis] * (Local[BestAxis] >= 0.0f ? 1.0f : -1.0f);
+			const float Separation = -BestDepth - Radius;
+			Out.AddPoint(Center - Normal * (Radius + 0.5f * Separation), Normal, Separation);
+			return;
+		}
+
+		const FVector Closest = Box.Position + Box.Axes[0] * Clamped.X + Box.Axes[1] * Clamped.Y + Box.Axes[2] * Clamped.Z;
+		const FVector ToCenter = Center - Closest;
+		const float DistanceSquared = ToCenter.SizeSquared();
+		const float MaxDistance = Radius + SpeculativeDistance;
+		if (DistanceSquared > MaxDistance * MaxDistance)
+		{
+			return;
+		}
+
+		const float Distance = std::sqrt(DistanceSquared);
+		const FVector Normal = ToCenter / Distance;
+		const float Separation = Distance - Radius;
+		Out.AddPoint(Closest + Normal * (0.5f * Separation), Normal, Separation);
+	}
+
+	template<typename TBody>
+	FVector ClosestPointOnBox(const TBody& Box, const FVector& Point)
+	{
+		const FVector Delta = Point - Box.Position;
+		FVector Result = Box.Position;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const float Coordinate = std::clamp(FVector::Dot(Delta, Box.Axes[Axis]), -Box.HalfExtent[Axis], Box.HalfExtent[Axis]);
+			Result += Box.Axes[Axis] * Coordinate;
+		}
+		return Result;
+	}
+
+	/** 박스 - 캡슐: 양 끝 구 + (끝이 닿지 않으면) 선분에서 박스에 가장 가까운 점 */
+	template<typename TBody, typename TManifold>
+	void CollideBoxCapsule(const TBody& Box, const TBody& Capsule, TManifold& Out)
+	{
+		const FVector Axis = Capsule.Axes[2] * Capsule.HalfSegment;
+		const FVector P0 = Capsule.Position - Axis;
+		const FVector P1 = Capsule.Position + Axis;
+
+		CollideBoxSphere(Box, P0, Capsule.Radius, Out);
+		CollideBoxSphere(Box, P1, Capsule.Radius, Out);
+		if (Out.NumPoints >= 2)
+		{
+			return;
+		}
+
+		// 선분-박스 최근접점 (교대로 투영, 몇 번이면 충분히 수렴)
+		FVector OnSegment = ClosestPointOnSegment(Box.Position, P0, P1);
+		for (int32 Iteration = 0; Iteration < 3; ++Iteration)
+		{
+			OnSegment = ClosestPointOnSegment(ClosestPointOnBox(Box, OnSegment), P0, P1);
+		}
+
+		const float EndTolerance = 0.1f * Capsule.HalfSegment;
+		if (FVector::DistSquared(OnSegment, P0) > EndTolerance * EndTolerance
+			&& FVector::DistSquared(OnSegment, P1) > EndTolerance * EndTolerance)
+		{
+			CollideBoxSphere(Box, OnSegment, Capsule.Radius, Out);
+		}
+	}
+
+	/** 캡슐 - 캡슐: 최근접 선분 점, 거의 평행하면 양 끝점마다 (나란히 누운 캡슐이 굴러가지 않게) */
+	template<typename TBody, typename TManifold>
+	void CollideCapsules(const TBody& A, const TBody& B, TManifold& Out)
+	{
+		const FVector AxisA = A.Axes[2] * A.HalfSegment;
+		const FVector AxisB = B.Axes[2] * B.HalfSegment;
+		const FVector A0 = A.Position - AxisA, A1 = A.Position + AxisA;
+		const FVector B0 = B.Position - AxisB, B1 = B.Position + AxisB;
+
+		const float LengthProduct = AxisA.SizeSquared() * AxisB.SizeSquared();
+		const bool bParallel = LengthProduct > KINDA_SMALL_NUMBER
+			&& FVector::Cross(AxisA, AxisB).SizeSquared() < 1.0e-4f * LengthProduct;
+		if (bParallel)
+		{
+			CollideSpheres(A0, A.Radius, ClosestPointOnSegment(A0, B0, B1), B.Radius, Out);
+			CollideSpheres(A1, A.Radius, ClosestPointOnSegment(A1, B0, B1), B.Radius, Out);
+			CollideSpheres(ClosestPointOnSegment(B0, A0, A1), A.Radius, B0, B.Radius, Out);
+			CollideSpheres(ClosestPointOnSegment(B1, A0, A1), A.Radius, B1, B.Radius, Out);
+			return;
+		}
+
+		FVector OnA, OnB;
+		ClosestPointsOnSegments(A0, A1, B0, B1, OnA, OnB);
+		CollideSpheres(OnA, A.Radius, OnB, B.Radius, Out);
+	}
+
+	/** 축 위에서 박스 반지름 */
+	template<typename TBody>
+	float ProjectBox(const TBody& Box, const FVector& Axis)
+	{
+		return Box.HalfExtent.X * std::fabs(FVector::Dot(Box.Axes[0], Axis))
+			+ Box.HalfExtent.Y * std::fabs(FVector::Dot(Box.Axes[1], Axis))
+			+ Box.HalfExtent.Z * std::fabs(FVector::Dot(Box.Axes[2], Axis));
+	}
+
+	/** 다각형을 평면 Dot(P, Normal) <= Offset 쪽만 남김 (Sutherland-Hodgman) */
+	int32 ClipPolygon(const FVector* In, int32 NumIn, const FVector& Normal, float Offset, FVector* Out)
+	{
+		int32 NumOut = 0;
+		for (int32 Index = 0; Index < NumIn; ++Index)
+		{
+			const FVector& Current = In[Index];
+			const FVector& Next = In[(Index + 1) % NumIn];
+			const float DistCurrent = FVector::Dot(Current, Normal) - Offset;
+			const float DistNext = FVector::Dot(Next, Normal) - Offset;
+			if (DistCurrent <= 0.0f)
+			{
+				Out[NumOut++] = Current;
+			}
+			if ((DistCurrent <= 0.0f) != (DistNext <= 0.0f))
+			{
+				Out[NumOut++] = Current + (Next - Current) * (DistCurrent / (DistCurrent - DistNext));
+			}
+		}
+		return NumOut;
+	}
+
+	/**
+	 * 박스 - 박스: 15축 SAT로 최소 침투 축을 찾고,
+	 * 면 축이면 기준 면에 상대 박스의 면을 클리핑해 최대 4점, 모서리 축이면 두 모서리 최근접점 1점
+	 */
+	template<typename TBody, typename TManifold>
+	void CollideBoxes(const TBody& A, const TBody& B, TManifold& Out)
+	{
+		const FVector Delta = B.Position - A.Position;
+
+		enum class EAxisType : uint8 { FaceA, FaceB, Edge };
+		EAxisType BestType = EAxisType::FaceA;
+		int32 BestIndexA = 0;
+		int32 BestIndexB = 0;
+		FVector BestAxis(0.0f, 0.0f, 1.0f);
+		float BestSeparation = -std::numeric_limits<float>::max();
+
+		// 분리 축이면 false
+		auto TestAxis = [&](FVector Axis, EAxisType Type, int32 IndexA, int32 IndexB) -> bool
+		{
+			const float LengthSquared = Axis.SizeSquared();
+			if (LengthSquared < 1.0e-6f)
+			{
+				return true;	// 평행한 모서리 쌍은 면 축이 대신함
+			}
+			Axis /= std::sqrt(LengthSquared);
+
+			float Distance = FVector::Dot(Delta, Axis);
+			if (Distance < 0.0f)
+			{
+				Axis = -Axis;
+				Distance = -Distance;
+			}
+			const float Separation = Distance - ProjectBox(A, Axis) - ProjectBox(B, Axis);
+			if (Separation > SpeculativeDistance)
+			{
+				return false;
+			}
+
+			const bool bBetter = Type == EAxisType::FaceA
+				? Separation > BestSeparation
+				: Separation > AxisRelativeTolerance * BestSeparation + AxisAbsoluteTolerance;
+			if (bBetter)
+			{
+				BestType = Type;
+				BestIndexA = IndexA;
+				BestIndexB = IndexB;
+				BestAxis = Axis;
+				BestSeparation = Separation;
+			}
+			return true;
+		};
+
+		for (int32 Index = 0; Index < 3; ++Index)
+		{
+			if (!TestAxis(A.Axes[Index], EAxisType::FaceA, Index, 0))
+			{
+				return;
+			}
+		}
+		for (int32 Index = 0; Index < 3; ++Index)
+		{
+			if (!TestAxis(B.Axes[Index], EAxisType::FaceB, 0, Index))
+			{
+				return;
+			}
+		}
+		for (int32 IndexA = 0; IndexA < 3; ++IndexA)
+		{
+			for (int32 IndexB = 0; IndexB < 3; ++IndexB)
+			{
+				if (!TestAxis(FVector::Cross(A.Axes[IndexA], B.Axes[IndexB]), EAxisType::Edge, IndexA, IndexB))
+				{
+					return;
+				}
+			}
+		}
+
+		if (BestType == EAxisType::Edge)
+		{
+			// 축 방향으로 가장 튀어나온 모서리끼리
+			auto SupportEdge = [](const TBody& Box, int32 EdgeAxis, const FVector& Direction, FVector& OutStart, FVector& OutEnd)
+			{
+				FVector Center = Box.Position;
+				for (int32 Axis = 0; Axis < 3; ++Axis)
+				{
+					if (Axis != EdgeAxis)
+					{
+						Center += Box.Axes[Axis] * (FVector::Dot(Box.Axes[Axis], Direction) >= 0.0f ? Box.HalfExtent[Axis] : -Box.HalfExtent[Axis]);
+					}
+				}
+				const FVector HalfEdge = Box.Axes[EdgeAxis] * Box.HalfExtent[EdgeAxis];
+				OutStart = Center - HalfEdge;
+				OutEnd = Center + HalfEdge;
+			};
+
+			FVector A0, A1, B0, B1;
+			SupportEdge(A, BestIndexA, BestAxis, A0, A1);
+			SupportEdge(B, BestIndexB, -BestAxis, B0, B1);
+			FVector OnA, OnB;
+			ClosestPointsOnSegments(A0, A1, B0, B1, OnA, OnB);
+			Out.AddPoint((OnA + OnB) * 0.5f, BestAxis, FVector::Dot(OnB - OnA, BestAxis));
+			return;
+		}
+
+		// 기준 박스(Reference)의 면에 상대 박스(Incident)의 면을 클리핑
+		const bool bReferenceIsA = BestType == EAxisType::FaceA;
+		const TBody& Reference = bReferenceIsA ? A : B;
+		const TBody& Incident = bReferenceIsA ? B : A;
+		const int32 ReferenceAxis = bReferenceIsA ? BestIndexA : BestIndexB;
+		const FVector ReferenceNormal = bReferenceIsA ? BestAxis : -BestAxis;	// 기준 박스 바깥쪽
+
+		// 상대 박스에서 기준 면과 가장 마주 보는 면
+		int32 IncidentAxis = 0;
+		float MostOpposed = 0.0f;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const float Alignment = FVector::Dot(Incident.Axes[Axis], ReferenceNormal);
+			if (std::fabs(Alignment) > std::fabs(MostOpposed))
+			{
+				MostOpposed = Alignment;
+				IncidentAxis = Axis;
+			}
+		}
+		const FVector IncidentNormal = Incident.Axes[IncidentAxis] * (MostOpposed > 0.0f ? -1.0f : 1.0f);
+		const FVector IncidentCenter = Incident.Position + IncidentNormal * Incident.HalfExtent[IncidentAxis];
+		const int32 U = (IncidentAxis + 1) % 3;
+		const int32 V = (IncidentAxis + 2) % 3;
+		const FVector EdgeU = Incident.Axes[U] * Incident.HalfExtent[U];
+		const FVector EdgeV = Incident.Axes[V] * Incident.HalfExtent[V];
+
+		FVector Polygon[8] = {
+			IncidentCenter + EdgeU + EdgeV,
+			IncidentCenter - EdgeU + EdgeV,
+			IncidentCenter - EdgeU - EdgeV,
+			IncidentCenter + EdgeU - EdgeV
+		};
+		FVector Clipped[8];
+		int32 NumVertices = 4;
+
+		// 기준 면의 네 옆면으로 클리핑
+		for (int32 Side = 1; Side <= 2 && NumVertices > 0; ++Side)
+		{
+			const int32 SideAxis = (ReferenceAxis + Side) % 3;
+			const FVector& SideNormal = Reference.Axes[SideAxis];
+			const float CenterOffset = FVector::Dot(Reference.Position, SideNormal);
+			NumVertices = ClipPolygon(Polygon, NumVertices, SideNormal, CenterOffset + Reference.HalfExtent[SideAxis], Clipped);
+			NumVertices = ClipPolygon(Clipped, NumVertices, -SideNormal, -CenterOffset + Reference.HalfExtent[SideAxis], Polygon);
+		}
+
+		// 기준 면 아래(또는 추측 거리 안)에 있는 점만 접촉점으로
+		const FVector ContactNormal = BestAxis;	// A -> B
+		const float ReferenceOffset = FVector::Dot(Reference.Position, ReferenceNormal) + Reference.HalfExtent[ReferenceAxis];
+		FVector Candidates[8];
+		float Separations[8];
+		int32 NumCandidates = 0;
+		for (int32 Index = 0; Index < NumVertices; ++Index)
+		{
+			const float Separation = FVector::Dot(Polygon[Index], ReferenceNormal) - ReferenceOffset;
+			if (Separation <= SpeculativeDistance)
+			{
+				Candidates[NumCandidates] = Polygon[Index] - ReferenceNormal * (0.5f * Separation);
+				Separations[NumCandidates] = Separation;
+				++NumCandidates;
+			}
+		}
+		if (NumCandidates <= 4)
+		{
+			for (int32 Index = 0; Index < NumCandidates; ++Index)
+			{
+				Out.AddPoint(Candidates[Index], ContactNormal, Separations[Index]);
+			}
+			return;
+		}
+
+		// 4점으로 줄이기: 가장 깊은 점, 그 점에서 가장 먼 점, 두 점과 만드는 넓이가 양/음으로 가장 큰 점
+		bool bUsed[8] = {};
+		int32 Chosen[4];
+		Chosen[0] = 0;
+		for (int32 Index = 1; Index < NumCandidates; ++Index)
+		{
+			if (Separations[Index] < Separations[Chosen[0]])
+			{
+				Chosen[0] = Index;
+			}
+		}
+		bUsed[Chosen[0]] = true;
+
+		Chosen[1] = -1;
+		float BestDistance = -1.0f;
+		for (int32 Index = 0; Index < NumCandidates; ++Index)
+		{
+			const float Distance = FVector::DistSquared(Candidates[Index], Candidates[Chosen[0]]);
+			if (!bUsed[Index] && Distance > BestDistance)
+			{
+				BestDistance = Distance;
+				Chosen[1] = Index;
+			}
+		}
+		bUsed[Chosen[1]] = true;
+
+		Chosen[2] = -1;
+		Chosen[3] = -1;
+		float MaxArea = 0.0f;
+		float MinArea = 0.0f;
+		const FVector Edge = Candidates[Chosen[1]] - Candidates[Chosen[0]];
+		for (int32 Index = 0; Index < NumCandidates; ++Index)
+		{
+			if (bUsed[Index])
+			{
+				continue;
+			}
+			const float Area = FVector::Dot(FVector::Cross(Edge, Candidates[Index] - Candidates[Chosen[0]]), ReferenceNormal);
+			if (Area > MaxArea)
+			{
+				MaxArea = Area;
+				Chosen[2] = Index;
+			}
+			if (Area < MinArea)
+			{
+				MinArea = Area;
+				Chosen[3] = Index;
+			}
+		}
+
+		for (int32 Index : Chosen)
+		{
+			if (Index >= 0)
+			{
+				Out.AddPoint(Candidates[Index], ContactNormal, Separations[Index]);
+			}
+		}
+	}
+}
+
+void FPhysicsScene::Collide(const FRigidBody& A, const FRigidBody& B, FManifold& OutManifold) const
+{
+	// 형상 종류 순(Box < Sphere < Capsule)으로 맞춰 조합 수를 줄이고, 뒤집었으면 법선을 되돌림
+	const bool bSwap = static_cast<uint8>(A.Kind) > static_cast<uint8>(B.Kind);
+	const FRigidBody& First = bSwap ? B : A;
+	const FRigidBody& Second = bSwap ? A : B;
+
+	switch (First.Kind)
+	{
+	case EShapeKind::Box:
+		switch (Second.Kind)
+		{
+		case EShapeKind::Box:		CollideBoxes(First, Second, OutManifold); break;
+		case EShapeKind::Sphere:	CollideBoxSphere(First, Second.Position, Second.Radius, OutManifold); break;
+		case EShapeKind::Capsule:	CollideBoxCapsule(First, Second, OutManifold); break;
+		}
+		break;
+
+	case EShapeKind::Sphere:
+		if (Second.Kind == EShapeKind::Sphere)
+		{
+			CollideSpheres(First.Position, First.Radius, Second.Position, Second.Radius, OutManifold);
+		}
+		else
+		{
+			const FVector Axis = Second.Axes[2] * Second.HalfSegment;
+			const FVector OnSegment = ClosestPointOnSegment(First.Position, Second.Position - Axis, Second.Position + Axis);
+			CollideSpheres(First.Position, First.Radius, OnSegment, Second.Radius, OutManifold);
+		}
+		break;
+
+	case EShapeKind::Capsule:
+		CollideCapsules(First, Second, OutManifold);
+		break;
+	}
+
+	if (bSwap)
+	{
+		for (int32 Index = 0; Index < OutManifold.NumPoints; ++Index)
+		{
+			OutManifold.Points[Index].Normal = -OutManifold.Points[Index].Normal;
+		}
+	}
+}
+
+void FPhysicsScene::UpdateContacts(FContactPair& Pair) const
+{
+	const FRigidBody& A = Bodies[Pair.BodyA];
+	const FRigidBody& B = Bodies[Pair.BodyB];
+
+	FManifold Manifold;
+	Collide(A, B, Manifold);
+
+	// A 로컬 좌표가 가까운 지난 접촉점의 충격량을 이어받음 (웜 스타트)
+	for (int32 Index = 0; Index < Manifold.NumPoints; ++Index)
+	{
+		FContactPoint& Point = Manifold.Points[Index];
+		Point.LocalPointA = RotateInverse(A.Rotation, Point.Position - A.Position);
+
+		float BestDistance = WarmStartDistance * WarmStartDistance;
+		const FContactPoint* Match = nullptr;
+		for (int32 Prev = 0; Prev < Pair.NumPoints; ++Prev)
+		{
+			const float Distance = FVector::DistSquared(Point.LocalPointA, Pair.Points[Prev].LocalPointA);
+			if (Distance < BestDistance)
+			{
+				BestDistance = Distance;
+				Match = &Pair.Points[Prev];
+			}
+		}
+		if (Match && FVector::Dot(Match->Normal, Point.Normal) > 0.9f)
+		{
+			Point.NormalImpulse = Match->NormalImpulse;
+			Point.TangentImpulse1 = Match->TangentImpulse1;
+			Point.TangentImpulse2 = Match->TangentImpulse2;
+		}
+	}
+
+	Pair.NumPoints = Manifold.NumPoints;
+	for (int32 Index = 0; Index < Manifold.NumPoints; ++Index)
+	{
+		Pair.Points[Index] = Manifold.Points[Index];
+	}
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 바디 헬퍼
+// ────────────────────────────────────────────────────────────────────────────
+
+FVector FPhysicsScene::FRigidBody::ApplyInvInertia(const FVector& V) const
+{
+	// R * diag(InvInertiaLocal) * R^T * V
+	return Axes[0] * (InvInertiaLocal.X * FVector::Dot(Axes[0], V))
+		+ Axes[1] * (InvInertiaLocal.Y * FVector::Dot(Axes[1], V))
+		+ Axes[2] * (InvInertiaLocal.Z * FVector::Dot(Axes[2], V));
+}
+
+void FPhysicsScene::UpdateAxes(FRigidBody& Body)
+{
+	Body.Axes[0] = Body.Rotation.RotateVector(FVector(1.0f, 0.0f, 0.0f));
+	Body.Axes[1] = Body.Rotation.RotateVector(FVector(0.0f, 1.0f, 0.0f));
+	Body.Axes[2] = Body.Rotation.RotateVector(FVector(0.0f, 0.0f, 1.0f));
+}
+
+void FPhysicsScene::ComputeMassProperties(FRigidBody& Body, float Mass)
+{
+	FVector Inertia;
+	switch (Body.Kind)
+	{
+	case EShapeKind::Box:
+	{
+		const FVector& H = Body.HalfExtent;
+		Inertia = FVector(H.Y * H.Y + H.Z * H.Z, H.X * H.X + H.Z * H.Z, H.X * H.X + H.Y * H.Y) * (Mass / 3.0f);
+		break;
+	}
+	case EShapeKind::Sphere:
+	{
+		const float I = 0.4f * Mass * Body.Radius * Body.Radius;
+		Inertia = FVector(I, I, I);
+		break;
+	}
+	case EShapeKind::Capsule:
+	{
+		// 원기둥 + 양 끝 반구 (질량은 부피 비율로 나눔, 축은 로컬 Z)
+		const float R = Body.Radius;
+		const float L = 2.0f * Body.HalfSegment;
+		const float CylinderVolume = PI * R * R * L;
+		const float SphereVolume = (4.0f / 3.0f) * PI * R * R * R;
+		const float TotalVolume = std::max(CylinderVolume + SphereVolume, KINDA_SMALL_NUMBER);
+		const float CylinderMass = Mass * CylinderVolume / TotalVolume;
+		const float SphereMass = Mass - CylinderMass;
+		const float Axial = CylinderMass * R * R * 0.5f + SphereMass * R * R * 0.4f;
+		const float Lateral = CylinderMass * (L * L / 12.0f + R * R * 0.25f)
+			+ SphereMass * (R * R * 0.4f + L * L * 0.25f + 0.375f * L * R);
+		Inertia = FVector(Lateral, Lateral, Axial);
+		break;
+	}
+	}
+
+	Body.InvMass = 1.0f / Mass;
+	Body.InvInertiaLocal = FVector(
+		Inertia.X > KINDA_SMALL_NUMBER ? 1.0f / Inertia.X : 0.0f,
+		Inertia.Y > KINDA_SMALL_NUMBER ? 1.0f / Inertia.Y : 0.0f,
+		Inertia.Z > KINDA_SMALL_NUMBER ? 1.0f / Inertia.Z : 0.0f);
+}
+
+FAABB FPhysicsScene::ComputeBounds(const FRigidBody& Body)
+{
+	FVector Extent;
+	switch (Body.Kind)
+	{
+	case EShapeKind::Box:
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			Extent[Axis] = Body.HalfExtent.X * std::fabs(Body.Axes[0][Axis])
+				+ Body.HalfExtent.Y * std::fabs(Body.Axes[1][Axis])
+				+ Body.HalfExtent.Z * std::fabs(Body.Axes[2][Axis]);
+		}
+		break;
+	case EShapeKind::Sphere:
+		Extent = FVector(Body.Radius, Body.Radius, Body.Radius);
+		break;
+	case EShapeKind::Capsule:
+	{
+		const FVector Axis = Body.Axes[2] * Body.HalfSegment;
+		Extent = FVector(std::fabs(Axis.X), std::fabs(Axis.Y), std::fabs(Axis.Z)) + Body.Radius;
+		break;
+	}
+	}
+	return FAABB(Body.Position - Extent, Body.Position + Extent);
+}
@@ -0,0 +1,303 @@
+// ────────────────────────────────────────────────────────────────────────────
+// PhysicsScene.h
+// 셰이프 컴포넌트 강체 시뮬레이션 (접촉 생성 + Sequential Impulse 솔버 + 아일랜드 병렬 처리 + 슬립)
+// ────────────────────────────────────────────────────────────────────────────
+#pragma once
+#include "Vector.h"
+#include "AABB.h"
+
+// Forward Declarations
+class UShapeComponent;
+enum class EShapeKind : uint8;
+
+/**
+ * FPhysicsStats
+ *
+ * FPhysicsScene::Simulate 한 번의 통계입니다.
+ */
+struct FPhysicsStats
+{
+	int32 NumBodies = 0;			// 시뮬레이션에 참여한 바디 (동적 + 정적)
+	int32 NumDynamicBodies = 0;
+	int32 NumAwakeBodies = 0;		// 이번 프레임에 푼 동적 바디
+	int32 NumIslands = 0;
+	int32 NumAwakeIslands = 0;
+	int32 NumPairs = 0;				// 브로드 페이즈 후보 쌍
+	int32 NumContacts = 0;			// 마지막 서브스텝의 접촉점 수
+	int32 NumSubsteps = 0;
+	double BroadPhaseMS = 0.0;		// 동기화 + 후보 쌍 + 아일랜드 구성
+	double SolveMS = 0.0;			// 아일랜드 서브스텝 (병렬)
+	double WriteBackMS = 0.0;		// 컴포넌트 트랜스폼 반영
+};
+
+/**
+ * UCollisionManager::RunPhysicsBenchmark 결과 (스레드 수 하나당 한 개)
+ */
+struct FPhysicsBenchmarkSample
+{
+	int32 NumThreads = 0;
+	int32 NumBodies = 0;
+	int32 NumFrames = 0;
+	double AvgStepMS = 0.0;			// 프레임당 Simulate 평균 (서브스텝 포함)
+	double MaxStepMS = 0.0;
+	double AvgSolveMS = 0.0;		// 그중 아일랜드 병렬 구간
+	int32 NumIslands = 0;			// 마지막 프레임 기준
+	int32 NumAwakeBodies = 0;
+	int32 NumContacts = 0;
+	bool bResultsMatch = true;		// 첫 샘플(1 스레드)과 최종 위치가 같은지
+};
+
+/**
+ * FPhysicsScene
+ *
+ * UCollisionManager에 등록된 셰이프 컴포넌트(박스/구/캡슐)를 강체로 시뮬레이션합니다.
+ *
+ * - bSimulatePhysics인 셰이프는 동적 바디, bPhysicsCollider && bBlockComponent인 나머지 셰이프는 정적 바디
+ *   (움직이면 그 위치를 그대로 따르고, 닿아 있던 잠든 바디를 깨움). 트리거/겹침 전용 셰이프는 참여하지 않음
+ * - 고정 시간 간격(FixedTimeStep)으로 서브스텝하고, 남은 시간은 다음 프레임으로 넘김
+ * - 브로드 페이즈는 프레임마다 한 번: 이번 프레임 이동량만큼 키운 AABB로 Sweep and Prune
+ * - 동적 바디끼리 닿을 수 있는 후보 쌍으로 아일랜드를 나누고, 아일랜드마다 모든 서브스텝을 독립적으로 풀어
+ *   FTaskScheduler 워커에서 병렬 처리 (정적 바디는 읽기만 하므로 공유). 결과는 스레드 수와 무관하게 같음
+ * - 서브스텝마다 내로우 페이즈로 접촉점을 만들고 Sequential Impulse로 풀며, 지난 접촉의 충격량으로 웜 스타트
+ * - 아일랜드의 모든 바디가 일정 시간 느리면 아일랜드 전체를 재우고, 깨어 있는 바디가 닿거나 충격량/순간 이동이 있으면 깨움
+ */
+class FPhysicsScene
+{
+public:
+	/** 서브스텝 간격 (초) */
+	static constexpr float FixedTimeStep = 1.0f / 120.0f;
+
+	/** 프레임당 최대 서브스텝 (넘는 시간은 버림) */
+	static constexpr int32 MaxSubsteps = 8;
+
+	/** 서브스텝당 속도 반복 횟수 */
+	static constexpr int32 SolverIterations = 8;
+
+	/** 중력 가속도 (m/s^2, Z-Up) */
+	FVector Gravity = FVector(0.0f, 0.0f, -9.8f);
+
+	// ────────────────────────────────────────────────
+	// 바디 등록 (UCollisionManager가 셰이프 등록/해제 시 호출)
+	// ────────────────────────────────────────────────
+
+	void AddBody(UShapeComponent* Component);
+	void RemoveBody(UShapeComponent* Component);
+
+	/** 등록된 바디 전부 제거 */
+	void Clear();
+
+	// ────────────────────────────────────────────────
+	// 시뮬레이션
+	// ────────────────────────────────────────────────
+
+	/**
+	 * DeltaSeconds만큼 시뮬레이션하고 움직인 동적 바디의 트랜스폼을 컴포넌트에 반영합니다.
+	 * 게임 스레드에서 UCollisionManager::UpdateCollisions 전에 호출합니다.
+	 *
+	 * @param DeltaSeconds - 프레임 시간
+	 */
+	void Simulate(float DeltaSeconds);
+
+	/**
+	 * 아일랜드를 푸는 데 쓸 최대 스레드 수 (게임 스레드 포함). 0이면 워커 전부 + 게임 스레드
+	 */
+	void SetMaxThreads(int32 InMaxThreads) { MaxThreads = InMaxThreads; }
+
+	// ────────────────────────────────────────────────
+	// 바디 조작 / 조회
+	// ────────────────────────────────────────────────
+
+	/** 질량 중심에 충격량을 가하고 깨움 (다음 Simulate에서 반영, 동적 바디만) */
+	void AddImpulse(UShapeComponent* Component, const FVector& Impulse);
+
+	/** 선속도를 설정하고 깨움 (다음 Simulate에서 반영, 동적 바디만) */
+	void SetLinearVelocity(UShapeComponent* Component, const FVector& Velocity);
+
+	FVector GetLinearVelocity(const UShapeComponent* Component) const;
+	FVector GetAngularVelocity(const UShapeComponent* Component) const;
+	bool IsSleeping(const UShapeComponent* Component) const;
+
+	const FPhysicsStats& GetStats() const { return Stats; }
+	int32 GetNumBodies() const { return Bodies.Num(); }
+
+private:
+	// ────────────────────────────────────────────────
+	// 내부 타입
+	// ────────────────────────────────────────────────
+
+	/**
+	 * 강체 하나 (셰이프 컴포넌트 하나)
+	 */
+	struct FRigidBody
+	{
+		UShapeComponent* Component = nullptr;
+
+		/** 웜 스타트 캐시 키용 고유 번호 (인덱스는 RemoveBody에서 바뀜) */
+		uint32 Id = 0;
+
+		// 월드 스케일을 적용한 형상 (Collision::BuildOBB/BuildCapsule과 같은 규칙)
+		EShapeKind Kind{};
+		FVector HalfExtent = FVector(0.0f, 0.0f, 0.0f);	// Box
+		float Radius = 0.0f;								// Sphere, Capsule
+		float HalfSegment = 0.0f;							// Capsule 중심 선분 반길이 (로컬 Z축)
+
+		// 자세 (셰이프 중심 = 컴포넌트 월드 위치)
+		FVector Position = FVector(0.0f, 0.0f, 0.0f);
+		FQuat Rotation = FQuat::Identity();
+		FVector Axes[3];									// Rotation의 로컬 X/Y/Z축 (월드)
+
+		// 마지막으로 컴포넌트에서 읽거나 쓴 트랜스폼 (외부에서 옮겼는지 판단)
+		FVector SyncedPosition = FVector(0.0f, 0.0f, 0.0f);
+		FQuat SyncedRotation = FQuat::Identity();
+
+		FVector LinearVelocity = FVector(0.0f, 0.0f, 0.0f);
+		FVector AngularVelocity = FVector(0.0f, 0.0f, 0.0f);
+		FVector PendingImpulse = FVector(0.0f, 0.0f, 0.0f);
+
+		float InvMass = 0.0f;
+		FVector InvInertiaLocal = FVector(0.0f, 0.0f, 0.0f);
+		float Friction = 0.5f;
+		float Restitution = 0.0f;
+
+		FAABB Bounds;										// 이번 프레임 이동량만큼 키운 AABB
+		float SleepTimer = 0.0f;
+		int32 Island = -1;
+		bool bActive = false;								// 이번 프레임 시뮬레이션 참여 (동적이거나 정적 충돌체)
+		bool bDynamic = false;
+		bool bSleeping = false;
+		bool bWakeRequested = false;
+		bool bWakeContacts = false;							// 정적 바디가 이번 프레임에 옮겨지거나 빠짐 (닿은 바디를 깨움)
+		bool bHasPendingVelocity = false;
+		FVector PendingVelocity = FVector(0.0f, 0.0f, 0.0f);
+
+		/** 월드 공간 역관성 텐서를 V에 곱함 */
+		FVector ApplyInvInertia(const FVector& V) const;
+	};
+
+	/**
+	 * 접촉점 하나 (법선은 A에서 B 방향)
+	 */
+	struct FContactPoint
+	{
+		FVector Position = FVector(0.0f, 0.0f, 0.0f);
+		FVector Normal = FVector(0.0f, 0.0f, 1.0f);
+		float Separation = 0.0f;							// 음수면 침투 깊이
+
+		/** 웜 스타트 매칭용 A 로컬 좌표 */
+		FVector LocalPointA = FVector(0.0f, 0.0f, 0.0f);
+
+		// 솔버 상태
+		FVector RA, RB;
+		FVector Tangent1, Tangent2;
+		float NormalMass = 0.0f;
+		float TangentMass1 = 0.0f;
+		float TangentMass2 = 0.0f;
+		float VelocityBias = 0.0f;
+		float NormalImpulse = 0.0f;
+		float TangentImpulse1 = 0.0f;
+		float TangentImpulse2 = 0.0f;
+	};
+
+	static constexpr int32 MaxContactPoints = 4;
+
+	/**
+	 * 브로드 페이즈 후보 쌍. 프레임 동안 유지하며 서브스텝마다 접촉점을 다시 만듦
+	 */
+	struct FContactPair
+	{
+		int32 BodyA = -1;
+		int32 BodyB = -1;
+		uint64 Key = 0;										// (작은 Id << 32) | 큰 Id
+		float Friction = 0.5f;
+		float Restitution = 0.0f;
+		int32 NumPoints = 0;
+		FContactPoint Points[MaxContactPoints];
+	};
+
+	/**
+	 * 서로 영향을 줄 수 있는 동적 바디 묶음. IslandBodies/IslandPairs의 구간
+	 */
+	struct FIsland
+	{
+		int32 FirstBody = 0;
+		int32 NumBodies = 0;
+		int32 FirstPair = 0;
+		int32 NumPairs = 0;
+		bool bSleeping = false;
+	};
+
+	/** 내로우 페이즈 결과 (법선은 A에서 B 방향) */
+	struct FManifold
+	{
+		FContactPoint Points[MaxContactPoints];
+		int32 NumPoints = 0;
+
+		void AddPoint(const FVector& Position, const FVector& Normal, float Separation);
+	};
+
+	// ────────────────────────────────────────────────
+	// 내부 함수
+	// ────────────────────────────────────────────────
+
+	/** 컴포넌트에서 형상/질량/자세를 읽고, 외부에서 옮겼으면 순간 이동 처리 */
+	void SyncBodies(float FrameTime);
+
+	/** 키운 AABB로 Sweep and Prune 후보 쌍을 만들고 지난 프레임 접촉을 웜 스타트용으로 옮김 */
+	void BuildPairs();
+
+	/** bWakeContacts인 바디와 쌍을 이룬 동적 바디를 깨움 (BuildIslands에서 아일랜드 전체로 퍼짐) */
+	void WakeContactsOfMovedBodies(const TArray<FContactPair>& InPairs);
+
+	/** 동적-동적 후보 쌍으로 아일랜드를 나누고 잠든 아일랜드를 정함 */
+	void BuildIslands();
+
+	/** 깨어 있는 아일랜드를 병렬로 NumSubsteps만큼 풀기 */
+	void SolveIslands(int32 NumSubsteps);
+
+	/** 아일랜드 하나의 서브스텝 전부 + 슬립 판정 (워커 스레드에서 호출, 자기 바디/쌍만 수정) */
+	void SolveIsland(const FIsland& Island, int32 NumSubsteps);
+
+	/** 움직인 동적 바디의 트랜스폼을 컴포넌트에 반영 */
+	void WriteBack();
+
+	/** 쌍의 접촉점을 현재 자세로 다시 만들고 지난 충격량을 이어받음 */
+	void UpdateContacts(FContactPair& Pair) const;
+
+	/** 두 바디의 형상 조합에 맞는 접촉 생성 */
+	void Collide(const FRigidBody& A, const FRigidBody& B, FManifold& OutManifold) const;
+
+	static void UpdateAxes(FRigidBody& Body);
+	static void ComputeMassProperties(FRigidBody& Body, float Mass);
+	static FAABB ComputeBounds(const FRigidBody& Body);
+
+	// ────────────────────────────────────────────────
+	// 멤버 변수
+	// ────────────────────────────────────────────────
+
+	TArray<FRigidBody> Bodies;
+	TMap<UShapeComponent*, int32> BodyIndices;
+	uint32 NextBodyId = 1;
+
+	/** 서브스텝에 쓰고 남은 시간 */
+	float Accumulator = 0.0f;
+
+	int32 MaxThreads = 0;
+
+	/** 이번 프레임 후보 쌍 (Key 순 정렬) / 지난 프레임 쌍 (웜 스타트용) */
+	TArray<FContactPair> Pairs;
+	TArray<FContactPair> PrevPairs;
+
+	TArray<FIsland> Islands;
+	TArray<int32> IslandBodies;
+	TArray<int32> IslandPairs;
+
+	/** 깨어 있는 아일랜드 (바디 수 내림차순, 병렬 처리 순서) */
+	TArray<int32> AwakeIslands;
+
+	// 재사용 버퍼
+	TArray<int32> SortedBodies;
+	TArray<int32> UnionParent;
+	TArray<int32> PairIsland;
+
+	FPhysicsStats Stats;
+};
@@ -78,6 +78,26 @@ void UBillboardComponent::DuplicateSubObjects()
 	// Texture는 TextureName을 통해 리소스 매니저에서 가져오므로 복제하지 않음
 }
 
+void UBillboardComponent::PrepareMeshBatches(const FSceneView* View)
+{
+	// 사용할 머티리얼 결정
+	// (Fallback 머티리얼 로드는 리소스 매니저를 수정하므로 병렬 수집 전에 여기서 처리)
+	RenderMaterial = GetMaterial(0); // this->Material 반환
+	if (!IsVisible())
+	{
+		return;
+	}
+
+	if (!RenderMaterial || !RenderMaterial->GetShader())
+	{
+		// [Fallback 로직]
+		UE_LOG("UBillboardComponent: Material이 없거나 셰이더가 없어서 기본 빌보드 셰이더 사용");
+
+		// 생성자에서 사용한 경로와 동일하게 Fallback
+		RenderMaterial = UResourceManager::GetInstance().Load<UMaterial>("Shaders/UI/Billboard.hlsl");
+	}
+}
+
 void UBillboardComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
 {
 	// 1. 렌더링할 애셋이 유효한지 검사
@@ -87,32 +107,15 @@ void UBillboardComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshB
 		return; // 그릴 메시 데이터 없음
 	}
 
-	// 2. 사용할 머티리얼과 셰이더 결정
-	UMaterialInterface* MaterialToUse = GetMaterial(0); // this->Material 반환
-	UShader* ShaderToUse = nullptr;
+	// 2. 사용할 머티리얼과 셰이더 (PrepareMeshBatches에서 결정됨)
+	UMaterialInterface* MaterialToUse = RenderMaterial;
+	UShader* ShaderToUse = MaterialToUse ? MaterialToUse->GetShader() : nullptr;
 
-	if (MaterialToUse && MaterialToUse->GetShader())
-	{
-		ShaderToUse = MaterialToUse->GetShader();
-	}
-	else
+	// 기본 셰이더조차 없으면 렌더링 불가
+	if (!MaterialToUse || !ShaderToUse)
 	{
-		// [Fallback 로직]
-		UE_LOG("UBillboardComponent: Material이 없거나 셰이더가 없어서 기본 빌보드 셰이더 사용");
-
-		// 생성자에서 사용한 경로와 동일하게 Fallback
-		MaterialToUse = UResourceManager::GetInstance().Load<UMaterial>("Shaders/UI/Billboard.hlsl");
-		if (MaterialToUse)
-		{
-			ShaderToUse = MaterialToUse->GetShader();
-		}
-
-		// 기본 셰이더조차 없으면 렌더링 불가
-		if (!MaterialToUse || !ShaderToUse)
-		{
-			UE_LOG("UBillboardComponent: 기본 빌보드 머티리얼/셰이더를 찾을 수 없습니다!");
-			return;
-		}
+		UE_LOG("UBillboardComponent: 기본 빌보드 머티리얼/셰이더를 찾을 수 없습니다!");
+		return;
 	}
 
 	// 3. FMeshBatchElement 생성
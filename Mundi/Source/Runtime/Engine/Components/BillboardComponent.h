@@ -26,6 +26,7 @@ public:
     UBillboardComponent();
     ~UBillboardComponent() override = default;
 
+    void PrepareMeshBatches(const FSceneView* View) override;
     void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
 
     // Setup
@@ -50,5 +51,8 @@ private:
 
     UMaterialInterface* Material = nullptr;
     UQuad* Quad = nullptr;
+
+    // PrepareMeshBatches에서 결정한 이번 프레임의 머티리얼 (Material이 유효하지 않으면 기본 빌보드 머티리얼)
+    UMaterialInterface* RenderMaterial = nullptr;
 };
 
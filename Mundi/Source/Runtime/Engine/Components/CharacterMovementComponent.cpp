@@ -6,6 +6,9 @@
 #include "CharacterMovementComponent.h"
 #include "Character.h"
 #include "SceneComponent.h"
+#include "ShapeComponent.h"
+#include "CollisionManager.h"
+#include "World.h"
 
 // ────────────────────────────────────────────────────────────────────────────
 // 생성자 / 소멸자
@@ -23,6 +26,8 @@ UCharacterMovementComponent::UCharacterMovementComponent()
 	, GroundFriction(8.0f)
 	, AirControl(0.05f)
 	, BrakingDeceleration(20.480f)
+	, WalkableFloorZ(0.71f)
+	, GroundProbeDistance(0.1f)
 	// 중력 설정
 	, GravityScale(1.0f)
 	, GravityDirection(0.0f, 0.0f, -1.0f) // 기본값: 아래 방향
@@ -276,6 +281,38 @@ void UCharacterMovementComponent::MoveUpdatedComponent(float DeltaTime)
 	FVector Delta = Velocity * DeltaTime;
 	FVector NewLocation = UpdatedComponent->GetWorldLocation() + Delta;
 
+	if (!GetSweepCollisionManager())
+	{
+		// 충돌 없이 이동
+		UpdatedComponent->SetWorldLocation(NewLocation);
+		return;
+	}
+
+	// 스윕으로 이동하다 막히면 남은 이동을 충돌면에 투영해 미끄러지게 함
+	NewLocation = UpdatedComponent->GetWorldLocation();
+	for (int32 Iteration = 0; Iteration < MaxMoveIterations && !Delta.IsZero(); ++Iteration)
+	{
+		FHitResult Hit;
+		if (!SweepUpdatedComponent(NewLocation, Delta, Hit) || Hit.bStartPenetrating)
+		{
+			// 겹친 채로 시작한 경우는 막지 않음 (빠져나올 수 있도록)
+			NewLocation += Delta;
+			break;
+		}
+
+		NewLocation = Hit.Location;
+
+		// 충돌면 안쪽으로 향하는 속도 성분 제거
+		const float IntoSurface = FVector::Dot(Velocity, Hit.ImpactNormal);
+		if (IntoSurface < 0.0f)
+		{
+			Velocity -= Hit.ImpactNormal * IntoSurface;
+		}
+
+		const FVector Remaining = Delta * (1.0f - Hit.Time);
+		Delta = Remaining - Hit.ImpactNormal * FVector::Dot(Remaining, Hit.ImpactNormal);
+	}
+
 	// 위치 업데이트
 	UpdatedComponent->SetWorldLocation(NewLocation);
 }
@@ -287,9 +324,23 @@ bool UCharacterMovementComponent::CheckGround()
 		return false;
 	}
 
-	// 간단한 지면 체크: Z 위치가 0 이하면 지면
 	FVector Location = UpdatedComponent->GetWorldLocation();
 
+	// 중력 방향으로 짧게 스윕해 걸을 수 있는 바닥이 있으면 붙임
+	// (상승 중에는 검사하지 않음: 점프 직후 바로 다시 착지하지 않도록)
+	if (GetSweepCollisionManager() && FVector::Dot(Velocity, GravityDirection) >= 0.0f)
+	{
+		FHitResult Hit;
+		if (SweepUpdatedComponent(Location, GravityDirection * GroundProbeDistance, Hit)
+			&& -FVector::Dot(Hit.ImpactNormal, GravityDirection) >= WalkableFloorZ)
+		{
+			UpdatedComponent->SetWorldLocation(Hit.Location);
+			return true;
+		}
+	}
+
+	// 바닥 콜리전이 없는 레벨용: Z 위치가 0 이하면 지면
+
 	if (Location.Z <= 0.0f)
 	{
 		// 지면에 스냅
@@ -301,6 +352,31 @@ bool UCharacterMovementComponent::CheckGround()
 	return false;
 }
 
+bool UCharacterMovementComponent::SweepUpdatedComponent(const FVector& Start, const FVector& Delta, FHitResult& OutHit) const
+{
+	UCollisionManager* CollisionManager = GetSweepCollisionManager();
+	if (!CollisionManager)
+	{
+		return false;
+	}
+
+	const UShapeComponent* Shape = static_cast<const UShapeComponent*>(UpdatedComponent);
+	FCollisionQueryParams Params;
+	Params.IgnoredActor = Owner;
+	return CollisionManager->Sweep(Start, Start + Delta, UpdatedComponent->GetWorldRotation(),
+		FCollisionShape::MakeFromComponent(Shape), OutHit, Params);
+}
+
+UCollisionManager* UCharacterMovementComponent::GetSweepCollisionManager() const
+{
+	if (!Cast<UShapeComponent>(UpdatedComponent))
+	{
+		return nullptr;
+	}
+	UWorld* World = GetWorld();
+	return World ? World->GetCollisionManager() : nullptr;
+}
+
 // ────────────────────────────────────────────────────────────────────────────
 // 복제
 // ────────────────────────────────────────────────────────────────────────────
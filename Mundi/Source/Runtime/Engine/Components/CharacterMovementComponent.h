@@ -9,6 +9,8 @@
 
 // 전방 선언
 class ACharacter;
+class UCollisionManager;
+struct FHitResult;
 
 /**
  * EMovementMode
@@ -41,6 +43,12 @@ enum class EMovementMode : uint8
  * - 속도/가속도 기반 이동
  * - 점프
  * - 이동 모드 관리 (Walking, Falling, Flying)
+ *
+ * 충돌:
+ * - UpdatedComponent가 ShapeComponent(보통 캡슐)면 UCollisionManager::Sweep으로 이동 경로를 검사하고,
+ *   막히면 충돌면을 따라 남은 이동을 미끄러지게 함
+ * - 지면 체크도 중력 방향 스윕으로 하고, 걸을 수 있는 경사(WalkableFloorZ)면 바닥에 붙임
+ * - 충돌 매니저가 없거나 바닥을 못 찾으면 기존처럼 Z <= 0을 지면으로 처리
  */
 UCLASS(DisplayName="CharacterMovementComponent", Description="Character의 이동을 처리하는 컴포넌트입니다.")
 class UCharacterMovementComponent : public UMovementComponent
@@ -70,6 +78,12 @@ public:
 	UPROPERTY(EditAnywhere, Category="Movement", Tooltip="제동력 (급정지 시)")
 	float BrakingDeceleration;
 
+	UPROPERTY(EditAnywhere, Category="Movement", Tooltip="걸을 수 있는 바닥 법선의 최소 수직 성분 (0.71 ≈ 45도 경사)")
+	float WalkableFloorZ;
+
+	UPROPERTY(EditAnywhere, Category="Movement", Tooltip="지면 체크 스윕 거리")
+	float GroundProbeDistance;
+
 	// ────────────────────────────────────────────────
 	// 중력 설정
 	// ────────────────────────────────────────────────
@@ -196,12 +210,30 @@ protected:
 	void MoveUpdatedComponent(float DeltaTime);
 
 	/**
-	 * 지면 체크 (간단한 Z축 위치 기반)
+	 * 지면 체크 (중력 방향 스윕, 충돌 매니저가 없으면 Z축 위치 기반)
 	 *
 	 * @return 지면에 있으면 true
 	 */
 	bool CheckGround();
 
+	/**
+	 * UpdatedComponent의 셰이프를 Start에서 Delta만큼 스윕합니다. Owner 액터는 무시합니다.
+	 *
+	 * @param Start - 셰이프 중심의 시작 위치
+	 * @param Delta - 이동량
+	 * @param OutHit - 충돌 정보
+	 * @return 충돌하면 true
+	 */
+	bool SweepUpdatedComponent(const FVector& Start, const FVector& Delta, FHitResult& OutHit) const;
+
+	/**
+	 * 스윕에 쓸 충돌 매니저를 반환합니다. UpdatedComponent가 ShapeComponent가 아니면 nullptr입니다.
+	 */
+	UCollisionManager* GetSweepCollisionManager() const;
+
+	/** 한 틱에 충돌면을 따라 미끄러지는 최대 횟수 */
+	static constexpr int32 MaxMoveIterations = 4;
+
 	// ────────────────────────────────────────────────
 	// 복제
 	// ────────────────────────────────────────────────
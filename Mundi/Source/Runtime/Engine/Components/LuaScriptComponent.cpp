@@ -78,6 +78,13 @@ void ULuaScriptComponent::BeginPlay()
 	FuncOnBeginOverlap = FLuaManager::GetFunc(Env, "OnBeginOverlap");
 	FuncOnEndOverlap = FLuaManager::GetFunc(Env, "OnEndOverlap");
 	FuncEndPlay		  =	FLuaManager::GetFunc(Env, "EndPlay");
+	FuncTickBatch	  = FLuaManager::GetFunc(Env, "TickBatch");
+
+	// TickBatch를 정의한 스크립트는 같은 스크립트 인스턴스끼리 프레임당 한 번에 틱
+	if (FuncTickBatch.valid())
+	{
+		TickBatchId = LuaVM->RegisterTickBatch(ScriptFilePath);
+	}
 	
 	if (FuncBeginPlay.valid()) {
 		auto Result = FuncBeginPlay();
@@ -177,6 +184,19 @@ void ULuaScriptComponent::OnHit(UPrimitiveComponent* MyComp, UPrimitiveComponent
 
 void ULuaScriptComponent::TickComponent(float DeltaTime)
 {
+	// 배치 틱: 델타만 쌓고 FLuaManager::FlushBatchedTicks에서 한 번에 호출
+	if (TickBatchId >= 0)
+	{
+		if (TickBatchSlot < 0)
+		{
+			if (FLuaManager* LuaVM = GetWorld()->GetLuaManager())
+			{
+				TickBatchSlot = LuaVM->QueueBatchedTick(TickBatchId, this, DeltaTime);
+			}
+		}
+		return;
+	}
+
 	if (FuncTick.valid()) {
 		auto Result = FuncTick(DeltaTime);
 		if (!Result.valid()) { sol::error Err = Result; UE_LOG("[Lua][error] %s\n", Err.what()); }
@@ -224,8 +244,13 @@ void ULuaScriptComponent::CleanupLuaResources()
 		{
 			// 1. 코루틴 정리 (가장 중요. Use-After-Free 방지)
 			LuaVM->GetScheduler().CancelByOwner(this);
+
+			// 이번 프레임 배치 대기열에서 제외
+			LuaVM->CancelBatchedTick(TickBatchId, TickBatchSlot);
 		}
 	}
+	TickBatchId = -1;
+	TickBatchSlot = -1;
 
 	// 2. Lua 참조 해제
 	FuncBeginPlay = sol::nil;
@@ -234,6 +259,7 @@ void ULuaScriptComponent::CleanupLuaResources()
 	FuncOnEndOverlap = sol::nil;
 	FuncOnHit = sol::nil;
 	FuncEndPlay = sol::nil;
+	FuncTickBatch = sol::nil;
 	Env = sol::nil;
 	Lua = nullptr;
 
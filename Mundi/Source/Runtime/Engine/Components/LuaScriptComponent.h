@@ -38,6 +38,8 @@ public:
 
 	void CleanupLuaResources();
 protected:
+	friend class FLuaManager;	// 배치 틱 (Env, FuncTickBatch, TickBatchSlot)
+
 	// 이 컴포넌트가 실행할 .lua 스크립트 파일의 경로 (에디터에서 설정)
 
 	sol::state* Lua = nullptr;
@@ -50,6 +52,10 @@ protected:
 	sol::protected_function FuncOnEndOverlap{};
 	sol::protected_function FuncOnHit{};
 	sol::protected_function FuncEndPlay{};
+	sol::protected_function FuncTickBatch{};	// 있으면 Tick 대신 FLuaManager 배치 틱으로 실행
+
+	int32 TickBatchId = -1;		// FLuaManager 배치 번호 (배치 틱이 아니면 -1)
+	int32 TickBatchSlot = -1;	// 이번 프레임 배치 대기열 슬롯 (쌓이지 않았으면 -1)
 
 	FDelegateHandle BeginHandleLua{};
 	FDelegateHandle EndHandleLua{};
@@ -80,6 +80,8 @@ UParticleSystemComponent::UParticleSystemComponent()
 	bAutoActivate = true;
 	bCanEverTick = true;   // Tick 활성화
 	bTickInEditor = true;  // 에디터에서도 파티클 미리보기 가능
+	// bTickOnAnyThread는 켜지 않음: 충돌 모듈이 다른 컴포넌트의 월드 트랜스폼/AABB를 읽고,
+	// 외부 이벤트를 AParticleEventManager 델리게이트로 바로 브로드캐스트(동기화 없음)하므로 게임 스레드에서 틱
 }
 
 UParticleSystemComponent::~UParticleSystemComponent()
@@ -1210,8 +1212,13 @@ void UParticleSystemComponent::DuplicateSubObjects()
 	CachedParticleMaterials.Empty();
 }
 
-void UParticleSystemComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void UParticleSystemComponent::PrepareMeshBatches(const FSceneView* View)
 {
+	// 파티클 배치 생성은 정렬, 인스턴스 버퍼 업로드, 머티리얼 캐시 생성 등 부수 효과가 많으므로
+	// 여기서(렌더 스레드, 직렬) 배치까지 모두 만들어두고 CollectMeshBatches에서는 복사만 한다.
+	PreparedMeshBatches.Empty();
+	TArray<FMeshBatchElement>& OutMeshBatchElements = PreparedMeshBatches;
+
 	// 0. 런타임 LOD 업데이트 (카메라 거리 기반)
 	if (View)
 	{
@@ -1328,6 +1335,12 @@ void UParticleSystemComponent::CollectMeshBatches(TArray<FMeshBatchElement>& Out
 	}
 }
 
+void UParticleSystemComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+{
+	// PrepareMeshBatches에서 만든 배치를 복사만 하므로 워커 스레드에서 호출해도 안전
+	OutMeshBatchElements.Append(PreparedMeshBatches);
+}
+
 void UParticleSystemComponent::FillMeshInstanceBuffer(uint32 TotalInstances)
 {
 	if (TotalInstances == 0)
@@ -2,6 +2,7 @@
 
 #include <wrl/client.h>
 #include "PrimitiveComponent.h"
+#include "MeshBatchElement.h"
 #include "Source/Runtime/Engine/Particles/ParticleSystem.h"
 #include "Source/Runtime/Engine/Particles/ParticleEmitterInstance.h"
 #include "Source/Runtime/Engine/Particles/ParticleEventTypes.h"
@@ -155,6 +156,7 @@ public:
 	// PIE 복사 시 포인터 배열 초기화
 	virtual void DuplicateSubObjects() override;
 
+	void PrepareMeshBatches(const FSceneView* View) override;
 	void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
 
 	// 메시 파티클 인스턴싱
@@ -190,6 +192,10 @@ private:
 	TMap<UMaterialInterface*, UMaterial*> CachedParticleMaterials;
 	void ClearCachedMaterials();
 
+	// === PrepareMeshBatches에서 만든 이번 뷰의 배치 ===
+	// CollectMeshBatches는 이 배열을 복사만 하므로 병렬 수집 중에도 안전하다.
+	TArray<FMeshBatchElement> PreparedMeshBatches;
+
 	// 테스트용 디버그 파티클 시스템 생성
 	void CreateDebugMeshParticleSystem();	// 메시 파티클 테스트
 	void CreateDebugSpriteParticleSystem();	// 스프라이트 파티클 테스트
@@ -42,7 +42,12 @@ public:
 
     virtual FAABB GetWorldAABB() const { return FAABB(); }
 
+    // CollectMeshBatches 직전에 렌더 스레드에서 직렬로 호출됩니다.
+    // GPU 버퍼 갱신(Immediate Context), 리소스 로드, UObject 생성처럼 스레드 안전하지 않은 작업은 여기서 수행합니다.
+    virtual void PrepareMeshBatches(const FSceneView* View) {}
+
     // 이 프리미티브를 렌더링하는 데 필요한 FMeshBatchElement를 수집합니다.
+    // NOTE: 여러 프리미티브가 워커 스레드에서 동시에 호출되므로 자기 자신 외의 공유 상태를 수정하면 안 됩니다.
     virtual void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) {}
 
     virtual UMaterialInterface* GetMaterial(uint32 InElementIndex) const
@@ -3,6 +3,9 @@
 #include "SceneComponent.h"
 #include "Actor.h"
 #include "ObjectFactory.h"
+#include "ShapeComponent.h"
+#include "CollisionManager.h"
+#include "World.h"
 // IMPLEMENT_CLASS is now auto-generated in .generated.cpp
 UProjectileMovementComponent::UProjectileMovementComponent()
     : Gravity(-9.80f)  // Z-Up 좌표계에서 중력은 Z방향으로 -980 cm/s^2
@@ -19,6 +22,8 @@ UProjectileMovementComponent::UProjectileMovementComponent()
     , bIsActive(true)
 {
     bCanEverTick = true;
+    // bTickOnAnyThread는 켜지 않음: 스윕/레이 캐스트가 다른 셰이프의 월드 트랜스폼을, 호밍이 타겟 트랜스폼을 읽는데
+    // 같은 웨이브의 병렬 이동 컴포넌트가 그 트랜스폼을 동시에 쓸 수 있고, 수명 만료 시 액터 상태도 바꾸므로 게임 스레드에서 틱
 }
 
 UProjectileMovementComponent::~UProjectileMovementComponent()
@@ -27,7 +32,7 @@ UProjectileMovementComponent::~UProjectileMovementComponent()
 
 void UProjectileMovementComponent::TickComponent(float DeltaSeconds)
 {
-    if (!UpdatedComponent)
+    if (!UpdatedComponent || !bIsActive)
     {
         return;
     }
@@ -69,10 +74,17 @@ void UProjectileMovementComponent::TickComponent(float DeltaSeconds)
     // 5. 속도 제한
     LimitVelocity();
 
-    // 6. 위치 업데이트
+    // 6. 위치 업데이트 (충돌하면 충돌 위치에서 정지)
     FVector Delta = Velocity * DeltaSeconds;
     if (!Delta.IsZero())
     {
+        FHitResult Hit;
+        if (SweepUpdatedComponent(Delta, Hit))
+        {
+            UpdatedComponent->SetWorldLocation(Hit.Location);
+            HandleImpact(Hit);
+            return;
+        }
         UpdatedComponent->AddWorldOffset(Delta);
     }
 
@@ -83,6 +95,36 @@ void UProjectileMovementComponent::TickComponent(float DeltaSeconds)
     }
 }
 
+bool UProjectileMovementComponent::SweepUpdatedComponent(const FVector& Delta, FHitResult& OutHit) const
+{
+    UWorld* World = GetWorld();
+    UCollisionManager* CollisionManager = World ? World->GetCollisionManager() : nullptr;
+    if (!CollisionManager)
+    {
+        return false;
+    }
+
+    FCollisionQueryParams Params;
+    Params.IgnoredActor = UpdatedComponent->GetOwner();
+
+    // 셰이프가 루트면 그 모양으로 스윕, 아니면 중심점 레이 캐스트
+    const FVector Start = UpdatedComponent->GetWorldLocation();
+    if (const UShapeComponent* Shape = Cast<UShapeComponent>(UpdatedComponent))
+    {
+        return CollisionManager->Sweep(Start, Start + Delta, UpdatedComponent->GetWorldRotation(),
+            FCollisionShape::MakeFromComponent(Shape), OutHit, Params);
+    }
+    return CollisionManager->RayCast(Start, Start + Delta, OutHit, Params);
+}
+
+void UProjectileMovementComponent::HandleImpact(const FHitResult& Hit)
+{
+    // 바운스가 없으므로 UE의 기본 동작처럼 충돌하면 시뮬레이션을 멈춤
+    Velocity = FVector(0.0f, 0.0f, 0.0f);
+    Acceleration = FVector(0.0f, 0.0f, 0.0f);
+    bIsActive = false;
+}
+
 void UProjectileMovementComponent::FireInDirection(const FVector& ShootDirection)
 {
     // 방향 벡터를 정규화하고 InitialSpeed를 곱해 속도 설정
@@ -6,6 +6,7 @@
 
 class AActor;
 class USceneComponent;
+struct FHitResult;
 
 /**
  * UProjectileMovementComponent
@@ -100,6 +101,10 @@ public:
 
 protected:
     // 내부 헬퍼 함수
+    // UpdatedComponent를 Delta만큼 스윕 (ShapeComponent면 그 모양, 아니면 레이). Owner 액터는 무시
+    bool SweepUpdatedComponent(const FVector& Delta, FHitResult& OutHit) const;
+    // 막히는 충돌 처리 (현재는 정지)
+    void HandleImpact(const FHitResult& Hit);
     void LimitVelocity();
     void ComputeHomingAcceleration(float DeltaTime);
     void UpdateRotationFromVelocity();
@@ -9,6 +9,8 @@ URotatingMovementComponent::URotatingMovementComponent()
     , bRotationInLocalSpace(true)
 {
     bCanEverTick = true;
+    // UpdatedComponent 트랜스폼만 바꾸므로 다른 컴포넌트와 병렬로 틱
+    bTickOnAnyThread = true;
 }
 
 URotatingMovementComponent::~URotatingMovementComponent()
@@ -6,6 +6,7 @@
 #include "PrimitiveComponent.h"
 #include "WorldPartitionManager.h"
 #include "BillboardComponent.h"
+#include "World.h"
 // IMPLEMENT_CLASS is now auto-generated in .generated.cpp
 // USceneComponent.cpp
 TMap<uint32, USceneComponent*> USceneComponent::SceneIdMap;
@@ -410,6 +411,10 @@ void USceneComponent::OnRegister(UWorld* InWorld)
 void USceneComponent::OnTransformUpdated()
 {
     bIsTransformDirty = true;
+    if (UWorld* World = GetWorld())
+    {
+        World->MarkLevelModified(Owner);
+    }
     for (USceneComponent* Child : GetAttachChildren())
     {
         Child->OnTransformUpdated();
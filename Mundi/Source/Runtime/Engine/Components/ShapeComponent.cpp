@@ -7,6 +7,7 @@
 #include "BVHierarchy.h"
 #include "GameObject.h"
 #include "CollisionManager.h"
+#include "PhysicsScene.h"
 // IMPLEMENT_CLASS is now auto-generated in .generated.cpp
 UShapeComponent::UShapeComponent() : bShapeIsVisible(true), bShapeHiddenInGame(true)
 {
@@ -103,11 +104,6 @@ void UShapeComponent::TickComponent(float DeltaSeconds)
         bGenerateOverlapEvents = false;
     }
 
-    if (!bGenerateOverlapEvents)
-    {
-        OverlapInfos.clear();
-    }
-
     UWorld* World = GetWorld();
     if (!World) return;
 
@@ -122,116 +118,41 @@ void UShapeComponent::TickComponent(float DeltaSeconds)
         Partition->MarkDirty(this);
     }
 
-    //Test용 O(N^2) 
-    OverlapNow.clear();
-
-    for (AActor* Actor : World->GetActors())
-    {
-        if (!Actor || !Actor->IsActorActive())
-            continue;
-
-        for (USceneComponent* Comp : Actor->GetSceneComponents())
-        {
-            UShapeComponent* Other = Cast<UShapeComponent>(Comp);
-            if (!Other || Other == this) continue;
-            if (Other->GetOwner() == this->GetOwner()) continue;
-            if (!Other->bGenerateOverlapEvents) continue;
-
-            AActor* Owner = this->GetOwner();
-            AActor* OtherOwner = Other->GetOwner();
-
-            // Collision 모듈
-            if (!Collision::CheckOverlap(this, Other)) continue;
-
-            OverlapNow.Add(Other);
-            //UE_LOG("Collision!!");
-        }
-    }
+    // 겹침 검사와 Begin/End 이벤트는 UCollisionManager::UpdateCollisions에서
+    // 충돌 BVH 브로드 페이즈로 모든 셰이프를 한 번에 처리 (월드 크기에 비례하는 순회 없음)
+}
 
-    // Publish current overlaps
-    OverlapInfos.clear();
-    for (UShapeComponent* Other : OverlapNow)
-    {
-        FOverlapInfo Info;
-        Info.OtherActor = Other->GetOwner();
-        Info.Other = Other;
-        OverlapInfos.Add(Info);
-    }
+FPhysicsScene* UShapeComponent::GetPhysicsScene() const
+{
+    // USceneComponent::GetWorld는 non-const라 const 조회에서도 쓸 수 있게 소유 액터로 찾음
+    UWorld* World = GetOwner() ? GetOwner()->GetWorld() : nullptr;
+    UCollisionManager* Manager = World ? World->GetCollisionManager() : nullptr;
+    return Manager ? Manager->GetPhysicsScene() : nullptr;
+}
 
-    //Begin
-    for (UShapeComponent* Comp : OverlapNow)
+void UShapeComponent::AddImpulse(const FVector& Impulse)
+{
+    if (FPhysicsScene* Scene = GetPhysicsScene())
     {
-        if (!Comp || Comp->IsPendingDestroy())
-        {
-            continue;
-        }
-
-        if (!OverlapPrev.Contains(Comp))
-        {
-            AActor* Owner = this->GetOwner();
-            AActor* OtherOwner = Comp ? Comp->GetOwner() : nullptr;
-
-            // 이전에 호출된 적이 있는 이벤트 인지 확인
-            if (!(Owner && OtherOwner && World->TryMarkOverlapPair(Owner, OtherOwner)))
-            {
-                continue;
-            }
-
-            // 양방향 호출 
-            Owner->OnComponentBeginOverlap.Broadcast(this, Comp);
-            if (AActor* OtherOwner = Comp->GetOwner())
-            {
-                OtherOwner->OnComponentBeginOverlap.Broadcast(Comp, this);
-            }
-
-            // Hit호출 
-            Owner->OnComponentHit.Broadcast(this, Comp);
-            if (bBlockComponent)
-            {
-                if (AActor* OtherOwner = Comp->GetOwner())
-                {
-                    OtherOwner->OnComponentHit.Broadcast(Comp, this);
-                }
-            }
-        }
+        Scene->AddImpulse(this, Impulse);
     }
+}
 
-    //End
-    for (UShapeComponent* Comp : OverlapPrev)
+void UShapeComponent::SetPhysicsLinearVelocity(const FVector& Velocity)
+{
+    if (FPhysicsScene* Scene = GetPhysicsScene())
     {
-        if (!Comp || Comp->IsPendingDestroy())
-        {
-            continue;
-        }
-
-        if (!OverlapNow.Contains(Comp))
-        {
-            AActor* Owner = this->GetOwner();
-            AActor* OtherOwner = Comp ? Comp->GetOwner() : nullptr;
-
-            // 이전에 호출된 적이 있는 이벤트 인지 확인
-            if (!(Owner && OtherOwner && World->TryMarkOverlapPair(Owner, OtherOwner)))
-            {
-                continue;
-            }
-
-            // 양방향 호출
-            Owner->OnComponentEndOverlap.Broadcast(this, Comp);
-            if (AActor* OtherOwner = Comp->GetOwner())
-            {
-                OtherOwner->OnComponentEndOverlap.Broadcast(Comp, this);
-            }
-        }
+        Scene->SetLinearVelocity(this, Velocity);
     }
+}
 
-    OverlapPrev.clear();
-    for (UShapeComponent* Comp : OverlapNow)
+FVector UShapeComponent::GetPhysicsLinearVelocity() const
+{
+    if (FPhysicsScene* Scene = GetPhysicsScene())
     {
-            if (Comp && !Comp->IsPendingDestroy())
-            {
-                OverlapPrev.Add(Comp);
-            }
+        return Scene->GetLinearVelocity(this);
     }
+    return FVector(0.0f, 0.0f, 0.0f);
 }
 
 FAABB UShapeComponent::GetWorldAABB() const
@@ -3,6 +3,8 @@
 #include "PrimitiveComponent.h"
 #include "UShapeComponent.generated.h"
 
+class FPhysicsScene;
+
 enum class EShapeKind : uint8
 {
 	Box = 0,
@@ -43,8 +45,34 @@ public:
 	UPROPERTY(EditAnywhere, Category="Shape")
 	bool bShapeHiddenInGame;
 
+	// 강체 시뮬레이션 (FPhysicsScene)
+	UPROPERTY(EditAnywhere, Category="Physics", Tooltip="PIE에서 강체로 시뮬레이션")
+	bool bSimulatePhysics = false;
+
+	// bBlockComponent는 기본값이 켜져 있어 트리거까지 막게 되므로 정적 충돌체 참여는 따로 켬
+	UPROPERTY(EditAnywhere, Category="Physics", Tooltip="시뮬레이션하지 않을 때 강체를 막는 정적 충돌체로 참여 (bBlockComponent도 켜져 있어야 함)")
+	bool bPhysicsCollider = false;
+
+	UPROPERTY(EditAnywhere, Category="Physics", Tooltip="질량 (kg)")
+	float Mass = 1.0f;
+
+	UPROPERTY(EditAnywhere, Category="Physics", Tooltip="마찰 계수 (두 바디의 기하 평균 사용)")
+	float Friction = 0.5f;
+
+	UPROPERTY(EditAnywhere, Category="Physics", Tooltip="반발 계수 (0..1, 두 바디 중 큰 값 사용)")
+	float Restitution = 0.0f;
+
 	UShapeComponent();
 
+	UFUNCTION(LuaBind, DisplayName="AddImpulse", Tooltip="질량 중심에 충격량을 가함 (bSimulatePhysics일 때)")
+	void AddImpulse(const FVector& Impulse);
+
+	UFUNCTION(LuaBind, DisplayName="SetPhysicsLinearVelocity", Tooltip="강체 선속도 설정")
+	void SetPhysicsLinearVelocity(const FVector& Velocity);
+
+	UFUNCTION(LuaBind, DisplayName="GetPhysicsLinearVelocity", Tooltip="강체 선속도")
+	FVector GetPhysicsLinearVelocity() const;
+
 	virtual void TickComponent(float DeltaSeconds) override;
 
 	virtual void GetShape(FShape& OutShape) const {};
@@ -68,6 +96,12 @@ public:
 	// ㅡㅡㅡㅡㅡㅡㅡㅡㅡ디버깅용ㅡㅡㅡㅡㅡㅡㅡㅡㅡㅡ
  
 protected:
+	// OverlapNow/OverlapPrev/OverlapInfos는 UCollisionManager::UpdateOverlaps가 프레임마다 한 번에 갱신
+	friend class UCollisionManager;
+
+	/** 소유 월드의 강체 시뮬레이션 씬 (월드/매니저가 없으면 nullptr) */
+	FPhysicsScene* GetPhysicsScene() const;
+
 	mutable FAABB WorldAABB; //브로드 페이즈 용
 	TSet<UShapeComponent*> OverlapNow; // 이번 프레임에서 overlap 된 Shap Comps
 	TSet<UShapeComponent*> OverlapPrev; // 지난 프레임에서 overlap 됐으면 Cache
@@ -7,6 +7,7 @@
 #include "AnimSingleNodeInstance.h"
 #include "AnimStateMachineInstance.h"
 #include "AnimBlendSpaceInstance.h"
+#include "TickTaskManager.h"
 
 USkeletalMeshComponent::USkeletalMeshComponent()
 {
@@ -18,6 +19,9 @@ USkeletalMeshComponent::USkeletalMeshComponent()
 	UAnimationAsset* AnimationAsset = UResourceManager::GetInstance().Get<UAnimSequence>("Data/DancingRacer_mixamo.com");
     PlayAnimation(AnimationAsset, true, 1.f);
     */
+
+    // 포즈 평가/스키닝 행렬 계산은 이 컴포넌트 상태만 쓰므로 병렬 틱 (노티파이만 게임 스레드로 미룸)
+    bTickOnAnyThread = true;
 }
 
 
@@ -44,6 +48,27 @@ void USkeletalMeshComponent::TickComponent(float DeltaTime)
     }
 }
 
+void USkeletalMeshComponent::EndParallelTick()
+{
+    Super::EndParallelTick();
+
+    if (PendingAnimNotifies.IsEmpty())
+    {
+        return;
+    }
+
+    // 핸들러가 사운드 재생/Lua 호출을 할 수 있으므로 게임 스레드에서 틱 순서대로 전달
+    AActor* Owner = GetOwner();
+    if (Owner)
+    {
+        for (const FAnimNotifyEvent& NotifyEvent : PendingAnimNotifies)
+        {
+            Owner->HandleAnimNotify(NotifyEvent);
+        }
+    }
+    PendingAnimNotifies.Empty();
+}
+
 void USkeletalMeshComponent::SetSkeletalMesh(const FString& PathFileName)
 {
     Super::SetSkeletalMesh(PathFileName);
@@ -375,6 +400,12 @@ void USkeletalMeshComponent::ResetToAnimationPose()
 
 void USkeletalMeshComponent::TriggerAnimNotify(const FAnimNotifyEvent& NotifyEvent)
 {
+    if (FTickTaskManager::IsInParallelTick())
+    {
+        PendingAnimNotifies.Add(NotifyEvent);
+        return;
+    }
+
     AActor* Owner = GetOwner();
     if (Owner)
     {
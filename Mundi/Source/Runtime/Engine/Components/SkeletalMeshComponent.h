@@ -18,6 +18,7 @@ public:
     ~USkeletalMeshComponent() override = default;
 
     void TickComponent(float DeltaTime) override;
+    void EndParallelTick() override;
     void SetSkeletalMesh(const FString& PathFileName) override;
 
     // Animation Integration
@@ -88,7 +89,7 @@ public:
     TArray<FTransform> RefPose;
     TArray<FTransform> BaseAnimationPose;
 
-    // Notify
+    // Notify (병렬 틱 중에는 모아뒀다가 EndParallelTick에서 게임 스레드로 전달)
     void TriggerAnimNotify(const FAnimNotifyEvent& NotifyEvent);
 
 protected:
@@ -132,4 +133,7 @@ private:
     // Animation state
     UAnimInstance* AnimInstance = nullptr;
     bool bUseAnimation = true;
+
+    // 워커 스레드 틱에서 발생한 노티파이 (액터 핸들러는 게임 스레드에서만 호출)
+    TArray<FAnimNotifyEvent> PendingAnimNotifies;
 };
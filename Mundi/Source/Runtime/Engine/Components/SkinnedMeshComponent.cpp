@@ -90,7 +90,7 @@ void USkinnedMeshComponent::DuplicateSubObjects()
    bSkinningMatricesDirty = true;
 }
 
-void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void USkinnedMeshComponent::PrepareMeshBatches(const FSceneView* View)
 {
     if (!SkeletalMesh || !SkeletalMesh->GetSkeletalMeshData()) { return; }
 
@@ -137,6 +137,14 @@ void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMes
    {
       PerformSkinning(bUseGPU);  // 전역 모드 적용하여 GPU/CPU 처리
    }
+}
+
+void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+{
+    if (!SkeletalMesh || !SkeletalMesh->GetSkeletalMeshData()) { return; }
+
+   // 버퍼 갱신은 PrepareMeshBatches에서 끝났으므로 여기서는 읽기만 한다 (병렬 수집)
+   const bool bUseGPU = (View->RenderSettings->GetGlobalSkinningMode() == ESkinningMode::ForceGPU);
 
     const TArray<FGroupInfo>& MeshGroupInfos = SkeletalMesh->GetMeshGroupInfo();
     auto DetermineMaterialAndShader = [&](uint32 SectionIndex) -> TPair<UMaterialInterface*, UShader*>
@@ -206,9 +214,7 @@ void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMes
        // GPU 스키닝 매크로 추가 (전역 설정 적용)
        if (bUseGPU)
        {
-          FShaderMacro GPUSkinningMacro;
-          GPUSkinningMacro.Name = FName("GPU_SKINNING");
-          GPUSkinningMacro.Definition = FName("1");
+          static const FShaderMacro GPUSkinningMacro = { FName("GPU_SKINNING"), FName("1") };
           ShaderMacros.Add(GPUSkinningMacro);
        }
 
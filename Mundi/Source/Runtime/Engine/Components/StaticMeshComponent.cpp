@@ -109,6 +109,15 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 			BatchElement.VertexShader = ShaderVariant->VertexShader;
 			BatchElement.PixelShader = ShaderVariant->PixelShader;
 			BatchElement.InputLayout = ShaderVariant->InputLayout;
+
+			// 자동 인스턴싱: 렌더러가 같은 메시/머티리얼 배치를 병합할 때 사용할 variant
+			if (ShaderToUse->SupportsGPUInstancing() && View->RenderSettings->IsShowFlagEnabled(EEngineShowFlags::SF_AutoInstancing))
+			{
+				static const FShaderMacro GPUInstancingMacro = { FName("GPU_INSTANCING"), FName("1") };
+				TArray<FShaderMacro> InstancingMacros = ShaderMacros;
+				InstancingMacros.Add(GPUInstancingMacro);
+				BatchElement.InstancedShaderVariant = ShaderToUse->GetOrCompileShaderVariant(InstancingMacros);
+			}
 		}
 
 		// UMaterialInterface를 UMaterial로 캐스팅해야 할 수 있음. 렌더러가 UMaterial을 기대한다면.
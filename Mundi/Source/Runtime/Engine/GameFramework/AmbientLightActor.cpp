@@ -9,6 +9,7 @@
 AAmbientLightActor::AAmbientLightActor()
 {
 	ObjectName = "Ambient Light Actor";
+	bCanEverTick = false;
 	LightComponent = CreateDefaultSubobject<UAmbientLightComponent>("AmbientLightComponent");
 
 	RootComponent = LightComponent;
@@ -0,0 +1,624 @@
+#include "pch.h"
+#include "CookedLevel.h"
+#include "DerivedDataCache.h"
+#include "JsonSerializer.h"
+#include "JsonStream.h"
+#include "PlatformTime.h"
+#include "TaskScheduler.h"
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+
+namespace fs = std::filesystem;
+using namespace CookedLevel;
+
+namespace
+{
+	// 액터 수가 적으면 병렬 디코드 오버헤드가 더 큼
+	constexpr int32 MinActorsPerChunk = 64;
+
+	// FJsonReader 이벤트를 받아 쿠킹 파일을 조립 (원본 JSON의 DOM을 만들지 않음)
+	// 루트 노드와 액터 노드는 따로 쌓았다가 Write에서 [루트][액터...] 순서로 이어붙임
+	class FCookedLevelWriter : public IJsonHandler
+	{
+	public:
+		uint32 Intern(const char* Str, size_t Length)
+		{
+			// 키 조회용 임시 문자열 (MSVC TMap은 heterogeneous lookup이 없음)
+			LookupKey.assign(Str, Length);
+			if (const uint32* Existing = StringIndices.Find(LookupKey))
+			{
+				return *Existing;
+			}
+			const uint32 Index = static_cast<uint32>(Strings.Num());
+			StringIndices[LookupKey] = Index;
+			Strings.Add(LookupKey);
+			return Index;
+		}
+
+		bool OnNull() override { BeginValue(); WriteTag(ENodeTag::Null); EndValue(); return true; }
+		bool OnBool(bool bValue) override { BeginValue(); WriteTag(bValue ? ENodeTag::True : ENodeTag::False); EndValue(); return true; }
+		bool OnInteger(int64 Value) override { BeginValue(); WriteTag(ENodeTag::Integral); WriteValue(Value); EndValue(); return true; }
+		bool OnFloat(double Value) override { BeginValue(); WriteTag(ENodeTag::Floating); WriteValue(Value); EndValue(); return true; }
+
+		bool OnString(const char* Str, size_t Length) override
+		{
+			const bool bIsActorType = bPendingActorType;
+			BeginValue();
+			const uint32 Index = Intern(Str, Length);
+			WriteTag(ENodeTag::String);
+			WriteValue(Index);
+			if (bIsActorType)
+			{
+				ActorTable.back().TypeString = Index;
+			}
+			EndValue();
+			return true;
+		}
+
+		bool OnKey(const char* Str, size_t Length) override
+		{
+			FFrame& Top = Stack.back();
+			if (Top.bIsActorList)
+			{
+				// Actors 객체의 키 = 다음 값(액터)의 ID
+				PendingActorId = Intern(Str, Length);
+				return true;
+			}
+
+			++Top.Count;
+			WriteValue(Intern(Str, Length), *Top.Buffer);
+
+			// 루트의 "Actors" 객체는 액터 테이블로, 액터 최상위의 "Type"은 클래스 조회용으로 따로 기록
+			const FStringView Key(Str, Length);
+			bPendingActors = (Stack.Num() == 1 && Key == "Actors");
+			bPendingActorType = (ActorListDepth > 0 && Stack.Num() == ActorListDepth + 1 && Key == "Type");
+			return true;
+		}
+
+		bool OnBeginObject() override
+		{
+			if (bPendingActors)
+			{
+				// 루트에는 빈 Actors 객체만 남김 (SplitActors 결과와 같은 모양)
+				bPendingActors = false;
+				WriteTag(ENodeTag::Object);
+				WriteValue(static_cast<uint32>(0));
+				Stack.Add({ true, true, nullptr, 0, 0 });
+				ActorListDepth = Stack.Num();
+				return true;
+			}
+			BeginContainer(ENodeTag::Object, true);
+			return true;
+		}
+
+		bool OnEndObject() override
+		{
+			if (Stack.back().bIsActorList)
+			{
+				Stack.pop_back();
+				ActorListDepth = 0;
+				return true;
+			}
+			EndContainer();
+			return true;
+		}
+
+		bool OnBeginArray() override { BeginContainer(ENodeTag::Array, false); return true; }
+		bool OnEndArray() override { EndContainer(); return true; }
+
+		bool Write(const FString& FilePath)
+		{
+			// 임시 파일에 쓰고 교체 (다른 프로세스가 반쯤 쓴 파일을 매핑하지 않도록)
+			const FString TempPath = FDerivedDataCache::GetTempPath(FilePath);
+			{
+				std::ofstream File(UTF8ToWide(TempPath), std::ios::binary | std::ios::out | std::ios::trunc);
+				if (!File)
+				{
+					return false;
+				}
+				Emit([&File](const void* Data, size_t Size)
+					{
+						File.write(static_cast<const char*>(Data), static_cast<std::streamsize>(Size));
+					});
+				if (!File)
+				{
+					return false;
+				}
+			}
+			return FDerivedDataCache::CommitFile(TempPath, FilePath);
+		}
+
+		void WriteToMemory(TArray<uint8>& OutBlob)
+		{
+			OutBlob.Empty();
+			Emit([&OutBlob](const void* Data, size_t Size)
+				{
+					// 첫 섹션은 항상 헤더이므로 전체 크기를 한 번에 예약
+					if (OutBlob.IsEmpty())
+					{
+						OutBlob.Reserve(static_cast<const FHeader*>(Data)->FileSize);
+					}
+					const uint8* Bytes = static_cast<const uint8*>(Data);
+					OutBlob.insert(OutBlob.end(), Bytes, Bytes + Size);
+				});
+		}
+
+	private:
+		using FStringView = std::string_view;
+
+		// 섹션을 파일 순서대로 Sink(Data, Size)에 넘김
+		template<typename FSink>
+		void Emit(FSink&& Sink)
+		{
+			// 1. 액터를 ID 순으로 정렬 (DOM의 std::map 순서와 같게, 중복 ID는 마지막 값 사용)
+			TArray<FCookedActor> Actors = ActorTable;
+			std::stable_sort(Actors.begin(), Actors.end(), [this](const FCookedActor& A, const FCookedActor& B)
+				{
+					return Strings[A.IdString] < Strings[B.IdString];
+				});
+			TArray<FCookedActor> UniqueActors;
+			UniqueActors.Reserve(Actors.Num());
+			for (const FCookedActor& Actor : Actors)
+			{
+				if (!UniqueActors.IsEmpty() && UniqueActors.back().IdString == Actor.IdString)
+				{
+					UniqueActors.back() = Actor;
+				}
+				else
+				{
+					UniqueActors.Add(Actor);
+				}
+			}
+			for (FCookedActor& Actor : UniqueActors)
+			{
+				Actor.Node.Offset += RootNodes.size();
+			}
+
+			// 2. 문자열 테이블
+			TArray<FStringRef> StringRefs;
+			StringRefs.Reserve(Strings.Num());
+			FString StringData;
+			for (const FString& Str : Strings)
+			{
+				StringRefs.Add({ static_cast<uint32>(StringData.size()), static_cast<uint32>(Str.size()) });
+				StringData.append(Str);
+			}
+
+			// 3. 오프셋 계산
+			FHeader Header = {};
+			Header.Magic = Magic;
+			Header.Version = Version;
+			Header.NumStrings = static_cast<uint32>(Strings.Num());
+			Header.NumActors = static_cast<uint32>(UniqueActors.Num());
+			Header.StringRefsOffset = sizeof(FHeader);
+			Header.StringDataOffset = Header.StringRefsOffset + sizeof(FStringRef) * StringRefs.Num();
+			Header.StringDataSize = StringData.size();
+			Header.ActorTableOffset = Header.StringDataOffset + Header.StringDataSize;
+			Header.NodeDataOffset = Header.ActorTableOffset + sizeof(FCookedActor) * UniqueActors.Num();
+			Header.NodeDataSize = RootNodes.size() + ActorNodes.size();
+			Header.FileSize = Header.NodeDataOffset + Header.NodeDataSize;
+			Header.Root = { 0, RootNodes.size() };
+
+			// 4. 섹션 기록
+			Sink(&Header, sizeof(FHeader));
+			Sink(StringRefs.GetData(), sizeof(FStringRef) * StringRefs.Num());
+			Sink(StringData.data(), StringData.size());
+			Sink(UniqueActors.GetData(), sizeof(FCookedActor) * UniqueActors.Num());
+			Sink(RootNodes.data(), RootNodes.size());
+			Sink(ActorNodes.data(), ActorNodes.size());
+		}
+
+		struct FFrame
+		{
+			bool bIsObject;
+			bool bIsActorList;			// 루트의 Actors 객체 (자식 값마다 액터 레코드)
+			std::vector<uint8>* Buffer;	// 이 컨테이너의 노드가 쌓이는 버퍼
+			size_t CountOffset;			// 원소 개수를 나중에 채울 위치
+			uint32 Count;
+		};
+
+		// 현재 값이 기록될 버퍼
+		std::vector<uint8>& Out()
+		{
+			if (Stack.IsEmpty())
+			{
+				return RootNodes;
+			}
+			return Stack.back().bIsActorList ? ActorNodes : *Stack.back().Buffer;
+		}
+
+		void BeginValue()
+		{
+			bPendingActors = false;
+			bPendingActorType = false;
+			if (Stack.IsEmpty())
+			{
+				return;
+			}
+
+			FFrame& Top = Stack.back();
+			if (Top.bIsActorList)
+			{
+				FCookedActor Actor = {};
+				Actor.IdString = PendingActorId;
+				Actor.TypeString = Intern("", 0);
+				Actor.Node.Offset = ActorNodes.size();
+				ActorTable.Add(Actor);
+			}
+			else if (!Top.bIsObject)
+			{
+				++Top.Count;
+			}
+		}
+
+		void EndValue()
+		{
+			// Actors 바로 아래 값이 끝났으면 액터 노드 범위 확정
+			if (!Stack.IsEmpty() && Stack.back().bIsActorList)
+			{
+				FCookedActor& Actor = ActorTable.back();
+				Actor.Node.Size = ActorNodes.size() - Actor.Node.Offset;
+			}
+		}
+
+		void BeginContainer(ENodeTag Tag, bool bIsObject)
+		{
+			BeginValue();
+			std::vector<uint8>& Buffer = Out();
+			WriteTag(Tag, Buffer);
+			const size_t CountOffset = Buffer.size();
+			WriteValue(static_cast<uint32>(0), Buffer);
+			Stack.Add({ bIsObject, false, &Buffer, CountOffset, 0 });
+		}
+
+		void EndContainer()
+		{
+			const FFrame Frame = Stack.back();
+			Stack.pop_back();
+			memcpy(Frame.Buffer->data() + Frame.CountOffset, &Frame.Count, sizeof(uint32));
+			EndValue();
+		}
+
+		template<typename T>
+		static void WriteValue(const T& Value, std::vector<uint8>& Buffer)
+		{
+			const uint8* Bytes = reinterpret_cast<const uint8*>(&Value);
+			Buffer.insert(Buffer.end(), Bytes, Bytes + sizeof(T));
+		}
+
+		template<typename T>
+		void WriteValue(const T& Value) { WriteValue(Value, Out()); }
+
+		static void WriteTag(ENodeTag Tag, std::vector<uint8>& Buffer) { Buffer.push_back(static_cast<uint8>(Tag)); }
+		void WriteTag(ENodeTag Tag) { WriteTag(Tag, Out()); }
+
+		TMap<FString, uint32> StringIndices;
+		TArray<FString> Strings;
+		FString LookupKey;
+		TArray<FCookedActor> ActorTable;
+		std::vector<uint8> RootNodes;
+		std::vector<uint8> ActorNodes;
+
+		TArray<FFrame> Stack;
+		int32 ActorListDepth = 0;		// Actors 객체 프레임까지의 스택 깊이 (0이면 밖)
+		uint32 PendingActorId = 0;
+		bool bPendingActors = false;
+		bool bPendingActorType = false;
+	};
+
+	// 노드 범위 하나를 JSON DOM으로 복원. 스레드마다 별도 인스턴스를 사용 (문자열 테이블은 읽기 전용 공유)
+	class FCookedNodeReader
+	{
+	public:
+		FCookedNodeReader(const uint8* InBegin, uint64 InSize, const TArray<FString>& InStrings)
+			: Cursor(InBegin), End(InBegin + InSize), Strings(InStrings)
+		{
+		}
+
+		void ReadNode(JSON& Out)
+		{
+			switch (static_cast<ENodeTag>(ReadValue<uint8>()))
+			{
+			case ENodeTag::Null:
+				Out = JSON();
+				break;
+			case ENodeTag::False:
+				Out = false;
+				break;
+			case ENodeTag::True:
+				Out = true;
+				break;
+			case ENodeTag::Integral:
+				Out = static_cast<long>(ReadValue<int64>());
+				break;
+			case ENodeTag::Floating:
+				Out = ReadValue<double>();
+				break;
+			case ENodeTag::String:
+				Out = ReadString();
+				break;
+			case ENodeTag::Array:
+			{
+				Out = JSON::Make(JSON::Class::Array);
+				const uint32 Count = ReadValue<uint32>();
+				for (uint32 Index = 0; Index < Count; ++Index)
+				{
+					ReadNode(Out[Index]);
+				}
+				break;
+			}
+			case ENodeTag::Object:
+			{
+				Out = JSON::Make(JSON::Class::Object);
+				const uint32 Count = ReadValue<uint32>();
+				for (uint32 Index = 0; Index < Count; ++Index)
+				{
+					const FString& Key = ReadString();
+					ReadNode(Out[Key]);
+				}
+				break;
+			}
+			default:
+				throw std::runtime_error("Cache corrupt: Unknown node tag.");
+			}
+		}
+
+	private:
+		template<typename T>
+		T ReadValue()
+		{
+			if (static_cast<size_t>(End - Cursor) < sizeof(T))
+			{
+				throw std::runtime_error("Cache corrupt: Node stream overrun.");
+			}
+			T Value;
+			memcpy(&Value, Cursor, sizeof(T));
+			Cursor += sizeof(T);
+			return Value;
+		}
+
+		const FString& ReadString()
+		{
+			const uint32 Index = ReadValue<uint32>();
+			if (Index >= static_cast<uint32>(Strings.Num()))
+			{
+				throw std::runtime_error("Cache corrupt: String index out of range.");
+			}
+			return Strings[Index];
+		}
+
+		const uint8* Cursor;
+		const uint8* End;
+		const TArray<FString>& Strings;
+	};
+
+	bool IsValidRange(const FNodeRange& Range, uint64 NodeDataSize)
+	{
+		return Range.Offset <= NodeDataSize && Range.Size <= NodeDataSize - Range.Offset;
+	}
+}
+
+bool FCookedLevelSerializer::Cook(const FWideString& SourcePath, const FString& EntryPath)
+{
+	FCookedLevelWriter Writer;
+	if (!FJsonReader::ParseFile(SourcePath, Writer))
+	{
+		return false;
+	}
+	return Writer.Write(EntryPath);
+}
+
+bool FCookedLevelSerializer::CookToMemory(const JSON& Document, TArray<uint8>& OutBlob)
+{
+	FCookedLevelWriter Writer;
+	if (!FJsonReader::VisitDom(Document, Writer))
+	{
+		return false;
+	}
+	Writer.WriteToMemory(OutBlob);
+	return true;
+}
+
+const char* FCookedLevelSerializer::Load(const FString& FilePath, FLevelDocument& OutDocument)
+{
+	FWindowsMappedFile File;
+	if (!File.Open(FilePath))
+	{
+		return "Failed to map cooked level file.";
+	}
+	// 디코드 결과는 매핑과 독립 (문자열은 모두 복사됨)
+	return LoadFromMemory(File.GetData(), File.GetSize(), OutDocument);
+}
+
+const char* FCookedLevelSerializer::LoadFromMemory(const uint8* Data, uint64 FileSize, FLevelDocument& OutDocument)
+{
+	if (!Data || FileSize < sizeof(FHeader))
+	{
+		return "Cache corrupt: File is smaller than the header.";
+	}
+
+	const FHeader& Header = *reinterpret_cast<const FHeader*>(Data);
+	if (Header.Magic != Magic)
+	{
+		return "Cache incompatible: Not a cooked level file.";
+	}
+	if (Header.Version != Version)
+	{
+		return "Cache incompatible: Cooked level version mismatch.";
+	}
+
+	// 섹션 범위 검증 (섹션은 헤더에 기록된 순서대로 연속 배치)
+	if (Header.FileSize != FileSize
+		|| Header.StringRefsOffset != sizeof(FHeader)
+		|| Header.StringDataOffset != Header.StringRefsOffset + sizeof(FStringRef) * static_cast<uint64>(Header.NumStrings)
+		|| Header.ActorTableOffset != Header.StringDataOffset + Header.StringDataSize
+		|| Header.NodeDataOffset != Header.ActorTableOffset + sizeof(FCookedActor) * static_cast<uint64>(Header.NumActors)
+		|| Header.NodeDataOffset + Header.NodeDataSize != FileSize
+		|| !IsValidRange(Header.Root, Header.NodeDataSize))
+	{
+		return "Cache corrupt: Section layout mismatch.";
+	}
+
+	const uint8* Base = Data;
+	const FStringRef* StringRefs = reinterpret_cast<const FStringRef*>(Base + Header.StringRefsOffset);
+	const char* StringData = reinterpret_cast<const char*>(Base + Header.StringDataOffset);
+	const FCookedActor* ActorTable = reinterpret_cast<const FCookedActor*>(Base + Header.ActorTableOffset);
+	const uint8* NodeData = Base + Header.NodeDataOffset;
+
+	// 1. 문자열 테이블 (키/값 모두 여기서 한 번만 만들어짐)
+	TArray<FString>& Strings = OutDocument.Strings;
+	Strings.Empty();
+	Strings.Reserve(Header.NumStrings);
+	for (uint32 Index = 0; Index < Header.NumStrings; ++Index)
+	{
+		const FStringRef& Ref = StringRefs[Index];
+		if (Ref.Offset > Header.StringDataSize || Ref.Length > Header.StringDataSize - Ref.Offset)
+		{
+			return "Cache corrupt: String reference out of range.";
+		}
+		Strings.emplace_back(StringData + Ref.Offset, Ref.Length);
+	}
+
+	for (uint32 Index = 0; Index < Header.NumActors; ++Index)
+	{
+		const FCookedActor& Actor = ActorTable[Index];
+		if (Actor.IdString >= Header.NumStrings || Actor.TypeString >= Header.NumStrings
+			|| !IsValidRange(Actor.Node, Header.NodeDataSize))
+		{
+			return "Cache corrupt: Invalid actor entry.";
+		}
+	}
+
+	try
+	{
+		// 2. 루트 (카메라 등 레벨 설정, 또는 프리팹 액터)
+		FCookedNodeReader RootReader(NodeData + Header.Root.Offset, Header.Root.Size, Strings);
+		RootReader.ReadNode(OutDocument.Root);
+
+		// 3. 액터 서브트리는 서로 독립이므로 워커에서 병렬 디코드
+		//    (UObject 생성/리소스 로드는 하지 않는 순수 CPU 작업)
+		TArray<FLevelActorRecord>& Actors = OutDocument.Actors;
+		Actors.Empty();
+		Actors.SetNum(static_cast<int32>(Header.NumActors));
+
+		std::atomic<bool> bCorrupt{ false };
+		const int32 NumActors = static_cast<int32>(Header.NumActors);
+		FTaskScheduler::ParallelFor(NumActors, FTaskScheduler::ComputeNumChunks(NumActors, MinActorsPerChunk),
+			[&](int32 ChunkIndex, int32 Begin, int32 End)
+			{
+				for (int32 Index = Begin; Index < End && !bCorrupt.load(std::memory_order_relaxed); ++Index)
+				{
+					const FCookedActor& Entry = ActorTable[Index];
+					FLevelActorRecord& Record = Actors[Index];
+					Record.Id = Strings[Entry.IdString];
+					Record.Type = Strings[Entry.TypeString];
+					try
+					{
+						FCookedNodeReader Reader(NodeData + Entry.Node.Offset, Entry.Node.Size, Strings);
+						Reader.ReadNode(Record.Data);
+					}
+					catch (const std::exception&)
+					{
+						bCorrupt = true;
+					}
+				}
+			});
+
+		if (bCorrupt)
+		{
+			return "Cache corrupt: Invalid actor node stream.";
+		}
+	}
+	catch (const std::exception&)
+	{
+		return "Cache corrupt: Invalid root node stream.";
+	}
+
+	return nullptr;
+}
+
+bool FCookedLevelSerializer::LoadOrCook(const FWideString& SourcePath, FLevelDocument& OutDocument)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	const FString SourcePathUTF8 = WideToUTF8(SourcePath);
+
+	FDerivedDataCache& DDC = FDerivedDataCache::GetInstance();
+	FDerivedDataKeyBuilder KeyBuilder(EDerivedDataType::Level, Version);
+	KeyBuilder.AddSourceFile(SourcePathUTF8);
+
+	// 원본이 없으면 쿠킹 엔트리가 남아 있어도 로드하지 않음 (기존 JSON 로드와 같은 실패 처리)
+	if (!KeyBuilder.HasAllSources())
+	{
+		return false;
+	}
+
+	const FString EntryPath = DDC.GetEntryPath(EDerivedDataType::Level, KeyBuilder.Build(), ".level");
+
+	std::error_code ErrorCode;
+	if (fs::exists(fs::path(UTF8ToWide(EntryPath)), ErrorCode))
+	{
+		const char* Error = Load(EntryPath, OutDocument);
+		if (!Error)
+		{
+			DDC.RecordLookup(EDerivedDataType::Level, true);
+			OutDocument.bFromCache = true;
+			UE_LOG("CookedLevel: %s loaded from cache (%d actors, %d strings) in %.1f ms", SourcePathUTF8.c_str(),
+				OutDocument.Actors.Num(), OutDocument.Strings.Num(), FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+			return true;
+		}
+		UE_LOG("[warning] CookedLevel: %s (%s) - recooking", Error, SourcePathUTF8.c_str());
+	}
+
+	// 미스: 원본 JSON을 DOM 없이 바로 쿠킹한 뒤 쿠킹 파일을 로드 (히트 경로와 같은 디코드)
+	DDC.RecordLookup(EDerivedDataType::Level, false);
+	OutDocument = FLevelDocument();
+	if (Cook(SourcePath, EntryPath) && !Load(EntryPath, OutDocument))
+	{
+		UE_LOG("CookedLevel: %s cooked (%d actors) in %.1f ms", SourcePathUTF8.c_str(),
+			OutDocument.Actors.Num(), FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+		return true;
+	}
+
+	// 쿠킹 파일을 쓸 수 없으면 (읽기 전용 DDC 등) 원본 JSON DOM에서 바로 분리
+	UE_LOG("[warning] CookedLevel: Failed to cook %s - loading JSON directly", SourcePathUTF8.c_str());
+	OutDocument = FLevelDocument();
+	if (!FJsonSerializer::LoadJsonFromFile(OutDocument.Root, SourcePath))
+	{
+		return false;
+	}
+	SplitActors(OutDocument.Root, OutDocument.Actors);
+
+	UE_LOG("CookedLevel: %s parsed (%d actors) in %.1f ms", SourcePathUTF8.c_str(),
+		OutDocument.Actors.Num(), FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+	return true;
+}
+
+void FCookedLevelSerializer::SplitActors(JSON& InOutRoot, TArray<FLevelActorRecord>& OutActors)
+{
+	OutActors.Empty();
+	if (InOutRoot.JSONType() != JSON::Class::Object || !InOutRoot.hasKey("Actors"))
+	{
+		return;
+	}
+
+	JSON& ActorList = InOutRoot["Actors"];
+	if (ActorList.JSONType() != JSON::Class::Object)
+	{
+		return;
+	}
+
+	OutActors.Reserve(ActorList.size());
+	for (auto& Pair : ActorList.ObjectRange())
+	{
+		FLevelActorRecord& Record = OutActors.emplace_back();
+		Record.Id = Pair.first;
+		FJsonSerializer::ReadString(Pair.second, "Type", Record.Type, "", false);
+		Record.Data = std::move(Pair.second);
+	}
+
+	// 쿠킹 파일의 루트와 같은 모양으로 (Actors는 빈 객체)
+	ActorList = JSON::Make(JSON::Class::Object);
+}
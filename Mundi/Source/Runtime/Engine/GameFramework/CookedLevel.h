@@ -0,0 +1,121 @@
+#pragma once
+#include "UEContainer.h"
+#include "WindowsMappedFile.h"
+#include "nlohmann/json.hpp"
+
+using JSON = json::JSON;
+
+/**
+ * 쿠킹된 레벨/프리팹 포맷 (DDC/Level/<키>.level)
+ *
+ * [FHeader 96B][FStringRef x NumStrings][문자열 데이터][FCookedActor x NumActors][노드 스트림]
+ *
+ * - 원본은 계속 JSON(.scene / .prefab)이고, 쿠킹 파일은 원본 내용 해시로 키를 잡는 DDC 엔트리
+ * - 키/문자열 값은 문자열 테이블에 한 번만 저장하고 노드에서는 인덱스로 참조
+ * - 레벨의 "Actors" 객체는 액터 테이블로 분리되어 액터마다 독립된 노드 범위를 가짐
+ *   -> 액터 서브트리를 FTaskScheduler로 병렬 디코드
+ * - 노드: [ENodeTag 1B][페이로드] (Integral=int64, Floating=double, String=uint32 인덱스,
+ *          Array=uint32 개수 + 원소, Object=uint32 개수 + (uint32 키 인덱스, 값))
+ */
+namespace CookedLevel
+{
+	constexpr uint32 Magic = 0x4B434C4D;	// 'MLCK'
+	constexpr uint32 Version = 1;
+
+	enum class ENodeTag : uint8
+	{
+		Null = 0,
+		False,
+		True,
+		Integral,
+		Floating,
+		String,
+		Array,
+		Object,
+	};
+
+	struct FStringRef
+	{
+		uint32 Offset = 0;
+		uint32 Length = 0;
+	};
+
+	struct FNodeRange
+	{
+		uint64 Offset = 0;		// 노드 스트림 시작 기준
+		uint64 Size = 0;
+	};
+
+	struct FHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		uint64 FileSize;
+		uint32 NumStrings;
+		uint32 NumActors;
+		uint64 StringRefsOffset;
+		uint64 StringDataOffset;
+		uint64 StringDataSize;
+		uint64 ActorTableOffset;
+		uint64 NodeDataOffset;
+		uint64 NodeDataSize;
+		FNodeRange Root;		// "Actors"를 제외한 루트 객체
+		uint32 Reserved[2];
+	};
+	static_assert(sizeof(FHeader) == 96, "Cooked level header must stay 96 bytes");
+
+	struct FCookedActor
+	{
+		uint32 IdString;		// "Actors" 객체의 키 (액터 ID)
+		uint32 TypeString;		// "Type" 값 (없으면 빈 문자열)
+		FNodeRange Node;
+	};
+}
+
+/**
+ * @struct FLevelActorRecord
+ * @brief 디코드된 액터 한 개입니다. Data는 원본 JSON의 Actors[Id]와 같은 DOM입니다.
+ */
+struct FLevelActorRecord
+{
+	FString Id;
+	FString Type;
+	JSON Data;
+};
+
+/**
+ * @struct FLevelDocument
+ * @brief 쿠킹 파일(또는 원본 JSON)에서 읽은 레벨/프리팹 문서입니다.
+ */
+struct FLevelDocument
+{
+	JSON Root;							// "Actors"를 제외한 루트 (프리팹이면 액터 자체)
+	TArray<FLevelActorRecord> Actors;	// 레벨의 Actors 객체 (키 순서)
+	TArray<FString> Strings;			// 문서에 등장한 모든 키/문자열 (중복 없음, 에셋 프리페치용)
+	bool bFromCache = false;
+};
+
+/**
+ * @class FCookedLevelSerializer
+ * @brief JSON 레벨/프리팹을 쿠킹 포맷으로 저장하고 로드합니다.
+ *        로드 실패(없음/버전 불일치/손상)는 false를 반환하며, 호출자는 원본 JSON에서 다시 쿠킹합니다.
+ */
+class FCookedLevelSerializer
+{
+public:
+	/** 원본 JSON을 FJsonReader 이벤트로 바로 쿠킹 (중간 DOM 없음) */
+	static bool Cook(const FWideString& SourcePath, const FString& EntryPath);
+
+	/** JSON DOM을 메모리 내 쿠킹 블롭으로 변환 (PIE 스냅샷 등 파일로 남기지 않는 용도) */
+	static bool CookToMemory(const JSON& Document, TArray<uint8>& OutBlob);
+
+	/** @return 실패 이유 (성공이면 nullptr) */
+	static const char* Load(const FString& FilePath, FLevelDocument& OutDocument);
+	static const char* LoadFromMemory(const uint8* Data, uint64 FileSize, FLevelDocument& OutDocument);
+
+	/** 원본 JSON을 DDC 엔트리에서 로드. 엔트리가 없거나 원본 내용이 바뀌었으면 다시 쿠킹 */
+	static bool LoadOrCook(const FWideString& SourcePath, FLevelDocument& OutDocument);
+
+	/** 원본 JSON DOM을 (루트, 액터 레코드)로 분리. 서브트리는 복사하지 않고 이동 */
+	static void SplitActors(JSON& InOutRoot, TArray<FLevelActorRecord>& OutActors);
+};
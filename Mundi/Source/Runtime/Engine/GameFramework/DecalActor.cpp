@@ -9,6 +9,7 @@
 ADecalActor::ADecalActor()
 {
 	ObjectName = "Static Mesh Actor";
+	bCanEverTick = false;
 	DecalComponent = CreateDefaultSubobject<UDecalComponent>("DecalComponent");
 
 	RootComponent = DecalComponent;
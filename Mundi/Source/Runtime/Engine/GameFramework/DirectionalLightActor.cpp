@@ -9,6 +9,7 @@
 ADirectionalLightActor::ADirectionalLightActor()
 {
 	ObjectName = "Directional Light Actor";
+	bCanEverTick = false;
 	LightComponent = CreateDefaultSubobject<UDirectionalLightComponent>("DirectionalLightComponent");
 
 	RootComponent = LightComponent;
@@ -3,10 +3,13 @@
 #include "SlateManager.h"
 #include "SelectionManager.h"
 #include "FAudioDevice.h"
+#include "TaskScheduler.h"
 #include "FbxLoader.h"
 #include "PlatformCrashHandler.h"
 #include "GameUI/SGameHUD.h"
 #include <ObjManager.h>
+#include "AssetPreloader.h"
+#include "AssetStreamer.h"
 
 float UEditorEngine::ClientWidth = 1024.0f;
 float UEditorEngine::ClientHeight = 1024.0f;
@@ -175,6 +178,35 @@ bool UEditorEngine::CreateMainWindow(HINSTANCE hInstance)
     return true;
 }
 
+bool UEditorEngine::StartupHeadless(uint32 Width, uint32 Height, bool bNullDriver)
+{
+    bHeadless = true;
+
+    ClientWidth = static_cast<float>(Width);
+    ClientHeight = static_cast<float>(Height);
+    extern float CLIENTWIDTH;
+    extern float CLIENTHEIGHT;
+    CLIENTWIDTH = ClientWidth;
+    CLIENTHEIGHT = ClientHeight;
+
+    // 워커 스레드 풀 (병렬 배치 수집 등)
+    FTaskScheduler::Initialize();
+
+    // 창이 없으므로 스왑체인 없이 디바이스 생성
+    if (!RHIDevice.InitializeHeadless(Width, Height, bNullDriver))
+    {
+        return false;
+    }
+    Renderer = std::make_unique<URenderer>(&RHIDevice);
+
+    // 측정 중 메시 로드가 끼어들지 않도록 미리 로드
+    FAssetPreloadOptions PreloadOptions;
+    PreloadOptions.bSounds = false;
+    FAssetPreloader::Preload(PreloadOptions);
+
+    return true;
+}
+
 bool UEditorEngine::Startup(HINSTANCE hInstance)
 {
     LoadIniFile();
@@ -182,6 +214,9 @@ bool UEditorEngine::Startup(HINSTANCE hInstance)
     if (!CreateMainWindow(hInstance))
         return false;
 
+    // 워커 스레드 풀 (병렬 배치 수집 등)
+    FTaskScheduler::Initialize();
+
     //디바이스 리소스 및 렌더러 생성
     RHIDevice.Initialize(HWnd);
     Renderer = std::make_unique<URenderer>(&RHIDevice);
@@ -193,10 +228,13 @@ bool UEditorEngine::Startup(HINSTANCE hInstance)
     UI.Initialize(HWnd, RHIDevice.GetDevice(), RHIDevice.GetDeviceContext());
     INPUT.Initialize(HWnd);
 
-    FObjManager::Preload(); 
-    UFbxLoader::PreLoad();
+    // 에디터는 기본으로 전부 상주 (editor.ini의 AssetStreaming=1이면 온디맨드 스트리밍)
+    FAssetStreamer::Initialize(FAssetStreamer::LoadSettingsFromIni(false));
 
-    FAudioDevice::Preload();
+    // OBJ/FBX/텍스처/사운드 프리로드 (파싱은 워커 스레드, GPU 리소스 생성은 이 스레드)
+    FAssetPreloadOptions PreloadOptions;
+    PreloadOptions.bStreamOnDemand = FAssetStreamer::IsEnabled();
+    FAssetPreloader::Preload(PreloadOptions);
 
     ///////////////////////////////////
     WorldContexts.Add(FWorldContext(NewObject<UWorld>(), EWorldType::Editor));
@@ -334,6 +372,9 @@ void UEditorEngine::MainLoop()
         // Shader Hot Reloading - Call AFTER render to avoid mid-frame resource conflicts
         // This ensures all GPU commands are submitted before we check for shader updates
         UResourceManager::GetInstance().CheckAndReloadShaders(DeltaSeconds);
+
+        // 비동기 로드 마무리 + 참조 없는 메시 해제
+        FAssetStreamer::Tick();
     }
 }
 
@@ -346,10 +387,17 @@ void UEditorEngine::Shutdown()
     }
     WorldContexts.clear();
 
-    // Release ImGui first (it may hold D3D11 resources)
-    UUIManager::GetInstance().Release();
+    // 헤드리스 모드에서는 UI/슬레이트를 초기화하지 않았음
+    if (!bHeadless)
+    {
+        // Release ImGui first (it may hold D3D11 resources)
+        UUIManager::GetInstance().Release();
+
+        USlateManager::GetInstance().Shutdown();
+    }
+    // 진행 중인 비동기 로드를 정리한 뒤 해제 (DeleteAll 중 상주 갱신 방지)
+    FAssetStreamer::Shutdown();
 
-    USlateManager::GetInstance().Shutdown();
     // Delete all UObjects (Components, Actors, Resources)
     // Resource destructors will properly release D3D resources
     ObjectFactory::DeleteAll(true);
@@ -362,6 +410,9 @@ void UEditorEngine::Shutdown()
 
     // AudioDevice 종료
     FAudioDevice::Shutdown();
+
+    // 워커 스레드 종료 (대기 중인 작업을 모두 처리한 뒤 join)
+    FTaskScheduler::Shutdown();
      
     // IMPORTANT: Explicitly release Renderer before RHIDevice destructor runs
     // Renderer may hold references to D3D resources
@@ -370,7 +421,11 @@ void UEditorEngine::Shutdown()
     // Explicitly release D3D11RHI resources before global destruction
     RHIDevice.Release();
 
-    SaveIniFile();
+    // 헤드리스 모드는 editor.ini를 읽지 않았으므로 덮어쓰지 않음
+    if (!bHeadless)
+    {
+        SaveIniFile();
+    }
 }
 
 
@@ -26,6 +26,8 @@ public:
     ~UEditorEngine();
 
     bool Startup(HINSTANCE hInstance);
+    // 창/UI 없이 RHI와 렌더러만 초기화 (헤드리스 렌더 벤치마크용, FRenderBenchmark 참고)
+    bool StartupHeadless(uint32 Width, uint32 Height, bool bNullDriver);
     void MainLoop();
     void Shutdown();
 
@@ -71,6 +73,7 @@ private:
 
     //틱 상태
     bool bRunning = false;
+    bool bHeadless = false;
     bool bUVScrollPaused = true;
     bool bPIEActive = false;
     float UVScrollTime = 0.0f;
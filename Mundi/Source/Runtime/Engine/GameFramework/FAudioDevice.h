@@ -22,9 +22,6 @@ public:
     static void SetListenerPosition(const FVector& Position, const FVector& ForwardVec, const FVector& UpVec);
     static void UpdateSoundPosition(IXAudio2SourceVoice* pSourceVoice, const FVector& EmitterPosition);
 
-    // Loads .wav files under GDataDir/Audio into resource manager
-    static void Preload();
-
 private:
     static IXAudio2*                pXAudio2;
     static IXAudio2MasteringVoice*  pMasteringVoice;
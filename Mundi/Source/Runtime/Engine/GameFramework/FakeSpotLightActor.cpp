@@ -10,6 +10,7 @@
 AFakeSpotLightActor::AFakeSpotLightActor()
 {
 	ObjectName = "Fake Spot Light Actor";
+	bCanEverTick = false;
 	BillboardComponent = CreateDefaultSubobject<UBillboardComponent>("BillboardComponent");
 	BillboardComponent->SetEditability(false);
 	DecalComponent = CreateDefaultSubobject<UPerspectiveDecalComponent>("DecalComponent");
@@ -6,6 +6,9 @@
 #include "PlayerCameraManager.h"
 #include <ObjManager.h>
 #include "FAudioDevice.h"
+#include "AssetPreloader.h"
+#include "AssetStreamer.h"
+#include "TaskScheduler.h"
 #include "GameUI/SGameHUD.h"
 #include <sol/sol.hpp>
 
@@ -170,6 +173,36 @@ bool UGameEngine::CreateMainWindow(HINSTANCE hInstance)
     return true;
 }
 
+bool UGameEngine::StartupHeadless(uint32 Width, uint32 Height, bool bNullDriver)
+{
+    bHeadless = true;
+
+    ClientWidth = static_cast<float>(Width);
+    ClientHeight = static_cast<float>(Height);
+    extern float CLIENTWIDTH;
+    extern float CLIENTHEIGHT;
+    CLIENTWIDTH = ClientWidth;
+    CLIENTHEIGHT = ClientHeight;
+
+    // 워커 스레드 풀 (병렬 배치 수집 등)
+    FTaskScheduler::Initialize();
+
+    // 창이 없으므로 스왑체인 없이 디바이스 생성
+    if (!RHIDevice.InitializeHeadless(Width, Height, bNullDriver))
+    {
+        return false;
+    }
+    Renderer = std::make_unique<URenderer>(&RHIDevice);
+
+    // 측정 중 메시 로드가 끼어들지 않도록 미리 로드
+    FAssetPreloadOptions PreloadOptions;
+    PreloadOptions.bSkeletalMeshes = false;
+    PreloadOptions.bSounds = false;
+    FAssetPreloader::Preload(PreloadOptions);
+
+    return true;
+}
+
 bool UGameEngine::Startup(HINSTANCE hInstance)
 {
     LoadIniFile();
@@ -177,6 +210,9 @@ bool UGameEngine::Startup(HINSTANCE hInstance)
     if (!CreateMainWindow(hInstance))
         return false;
 
+    // 워커 스레드 풀 (병렬 배치 수집 등)
+    FTaskScheduler::Initialize();
+
     // 디바이스 리소스 및 렌더러 생성
     RHIDevice.Initialize(HWnd);
     Renderer = std::make_unique<URenderer>(&RHIDevice);
@@ -195,10 +231,14 @@ bool UGameEngine::Startup(HINSTANCE hInstance)
     // 매니저 초기화
     INPUT.Initialize(HWnd);
 
-    FObjManager::Preload();
+    // 게임은 기본으로 온디맨드 스트리밍: 레벨이 참조하는 메시/텍스처만 로드 (editor.ini의 AssetStreaming=0이면 전부 프리로드)
+    FAssetStreamer::Initialize(FAssetStreamer::LoadSettingsFromIni(true));
 
-    // Preload audio assets
-    FAudioDevice::Preload();
+    // OBJ/텍스처/사운드 프리로드 (파싱은 워커 스레드, GPU 리소스 생성은 이 스레드)
+    FAssetPreloadOptions PreloadOptions;
+    PreloadOptions.bSkeletalMeshes = false;
+    PreloadOptions.bStreamOnDemand = FAssetStreamer::IsEnabled();
+    FAssetPreloader::Preload(PreloadOptions);
 
     ///////////////////////////////////
     WorldContexts.Add(FWorldContext(NewObject<UWorld>(), EWorldType::Game));
@@ -338,6 +378,9 @@ void UGameEngine::MainLoop()
         // Shader Hot Reloading - Call AFTER render to avoid mid-frame resource conflicts
         // This ensures all GPU commands are submitted before we check for shader updates
         UResourceManager::GetInstance().CheckAndReloadShaders(DeltaSeconds);
+
+        // 비동기 로드 마무리 + 참조 없는 메시 해제
+        FAssetStreamer::Tick();
     }
 }
 
@@ -350,6 +393,9 @@ void UGameEngine::Shutdown()
     }
     WorldContexts.clear();
 
+    // 진행 중인 비동기 로드를 정리한 뒤 해제 (DeleteAll 중 상주 갱신 방지)
+    FAssetStreamer::Shutdown();
+
     // Delete all UObjects (Components, Actors, Resources)
     // Resource destructors will properly release D3D resources
     ObjectFactory::DeleteAll(true);
@@ -367,8 +413,15 @@ void UGameEngine::Shutdown()
     // Shutdown audio device
     FAudioDevice::Shutdown();
 
+    // 워커 스레드 종료 (대기 중인 작업을 모두 처리한 뒤 join)
+    FTaskScheduler::Shutdown();
+
     // Explicitly release D3D11RHI resources before global destruction
     RHIDevice.Release();
 
-    SaveIniFile();
+    // 헤드리스 모드는 editor.ini를 읽지 않았으므로 덮어쓰지 않음
+    if (!bHeadless)
+    {
+        SaveIniFile();
+    }
 }
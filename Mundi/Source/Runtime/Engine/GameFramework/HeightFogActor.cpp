@@ -9,6 +9,7 @@
 AHeightFogActor::AHeightFogActor()
 {
 	ObjectName = "Height Fog Actor";
+	bCanEverTick = false;
 	RootComponent = CreateDefaultSubobject<UHeightFogComponent>("HeightFogComponent");
 
 }
@@ -12,6 +12,7 @@
 #include "World.h"
 #include "JsonSerializer.h"
 #include "SceneComponent.h"
+#include "CookedLevel.h"
 
 static inline FString RemoveObjExtension(const FString& FileName)
 {
@@ -96,47 +97,16 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
             }
         }
 
-        // Actors 정보
-        JSON ActorListJson;
-        if (FJsonSerializer::ReadObject(InOutHandle, "Actors", ActorListJson))
+        // Actors 정보 (쿠킹된 문서의 루트는 빈 Actors 객체를 가짐)
+        if (InOutHandle.hasKey("Actors"))
         {
-            // ObjectRange()를 사용하여 Primitives 객체의 모든 키-값 쌍을 순회
-            for (auto& Pair : ActorListJson.ObjectRange())
-            {
-                // Pair.first는 ID 문자열, Pair.second는 단일 프리미티브의 JSON 데이터입니다.
-                const FString& IdString = Pair.first;
-                JSON& ActorDataJson = Pair.second;
-
-                FString TypeString;
-                FJsonSerializer::ReadString(ActorDataJson, "Type", TypeString);
-
-                //UClass* NewClass = FActorTypeMapper::TypeToActor(TypeString);
-                UClass* NewClass = UClass::FindClass(TypeString);
-
-                UWorld* World = GWorld;
-
-                // 유효성 검사: Class가 유효하고 AActor를 상속했는지 확인
-                if (!NewClass || !NewClass->IsChildOf(AActor::StaticClass()))
-                {
-                    UE_LOG("SpawnActor failed: Invalid class provided.");
-                    return;
-                }
-
-                // ObjectFactory를 통해 UClass*로부터 객체 인스턴스 생성
-                AActor* NewActor = Cast<AActor>(ObjectFactory::NewObject(NewClass));
-                if (!NewActor)
-                {
-                    UE_LOG("SpawnActor failed: ObjectFactory could not create an instance of");
-                    return;
-                }
-
-                AddActor(NewActor);
-
-                if (NewActor)
-                {
-                    NewActor->Serialize(bInIsLoading, ActorDataJson);
-                }
-            }
+            TArray<FLevelActorRecord> Records;
+            FCookedLevelSerializer::SplitActors(InOutHandle, Records);
+            SpawnActorsFromRecords(Records);
+        }
+        else
+        {
+            UE_LOG("[JsonSerializer] Actors Object 파싱에 실패했습니다 (기본값 사용)");
         }
     }
     else
@@ -183,3 +153,62 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
         InOutHandle["Actors"] = ActorListJson;
     }
 }
+
+void ULevel::LoadFromDocument(FLevelDocument& Document)
+{
+    Serialize(true, Document.Root);
+    SpawnActorsFromRecords(Document.Actors);
+}
+
+void ULevel::SpawnActorsFromRecords(TArray<FLevelActorRecord>& Records)
+{
+    // 1. 액터 일괄 생성 (같은 타입은 UClass를 한 번만 조회)
+    TMap<FString, UClass*> ClassCache;
+    TArray<AActor*> NewActors;
+    NewActors.SetNum(static_cast<int32>(Records.size()), nullptr);
+    Actors.Reserve(Actors.Num() + static_cast<int32>(Records.size()));
+
+    for (int32 Index = 0; Index < static_cast<int32>(Records.size()); ++Index)
+    {
+        const FString& TypeString = Records[Index].Type;
+
+        UClass* NewClass = nullptr;
+        if (UClass** Cached = ClassCache.Find(TypeString))
+        {
+            NewClass = *Cached;
+        }
+        else
+        {
+            NewClass = UClass::FindClass(TypeString);
+            ClassCache[TypeString] = NewClass;
+        }
+
+        // 유효성 검사: Class가 유효하고 AActor를 상속했는지 확인
+        if (!NewClass || !NewClass->IsChildOf(AActor::StaticClass()))
+        {
+            UE_LOG("SpawnActor failed: Invalid class provided. (%s, Id: %s)", TypeString.c_str(), Records[Index].Id.c_str());
+            continue;
+        }
+
+        // ObjectFactory를 통해 UClass*로부터 객체 인스턴스 생성
+        AActor* NewActor = Cast<AActor>(ObjectFactory::NewObject(NewClass));
+        if (!NewActor)
+        {
+            UE_LOG("SpawnActor failed: ObjectFactory could not create an instance of %s", TypeString.c_str());
+            continue;
+        }
+
+        AddActor(NewActor);
+        NewActors[Index] = NewActor;
+    }
+
+    // 2. 역직렬화: 컴포넌트 생성/리소스 로드/SceneIdMap 등록이 전역 상태를 건드리므로 소유 스레드에서 순서대로
+    //    (JSON 파싱/디코드는 FCookedLevelSerializer가 이미 병렬로 끝낸 상태)
+    for (int32 Index = 0; Index < static_cast<int32>(Records.size()); ++Index)
+    {
+        if (NewActors[Index])
+        {
+            NewActors[Index]->Serialize(true, Records[Index].Data);
+        }
+    }
+}
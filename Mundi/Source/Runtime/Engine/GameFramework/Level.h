@@ -4,6 +4,9 @@
 #include "Actor.h"
 #include <algorithm>
 
+struct FLevelActorRecord;
+struct FLevelDocument;
+
 class ULevel : public UObject
 {
 public:
@@ -22,7 +25,14 @@ public:
     }
     void Clear() { Actors.Empty(); }
 
+    /** 로드 시 InOutHandle의 Actors 서브트리는 액터 레코드로 이동됩니다. (복사 없음) */
     void Serialize(const bool bInIsLoading, JSON& InOutHandle);
+
+    /** FCookedLevelSerializer로 읽은 문서에서 레벨 설정과 액터를 불러옴 */
+    void LoadFromDocument(FLevelDocument& Document);
+
+    /** 액터를 일괄 생성한 뒤 레코드 순서대로 역직렬화 (클래스 조회는 타입당 한 번) */
+    void SpawnActorsFromRecords(TArray<FLevelActorRecord>& Records);
 private:
     TArray<AActor*> Actors;
 };
@@ -9,6 +9,7 @@
 APointLightActor::APointLightActor()
 {
 	ObjectName = "Point Light Actor";
+	bCanEverTick = false;
 	LightComponent = CreateDefaultSubobject<UPointLightComponent>("PointLightComponent");
 
 	RootComponent = LightComponent;
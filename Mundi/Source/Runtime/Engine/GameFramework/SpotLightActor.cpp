@@ -9,6 +9,7 @@
 ASpotLightActor::ASpotLightActor()
 {
 	ObjectName = "Spot Light Actor";
+	bCanEverTick = false;
 	LightComponent = CreateDefaultSubobject<USpotLightComponent>("SpotLightComponent");
 
 	RootComponent = LightComponent;
@@ -12,6 +12,7 @@
 AStaticMeshActor::AStaticMeshActor()
 {
     ObjectName = "Static Mesh Actor";
+    bCanEverTick = false; // 액터 자체 Tick 로직이 없어 틱 목록에 등록하지 않음 (컴포넌트 틱은 별도)
     StaticMeshComponent = CreateDefaultSubobject<UStaticMeshComponent>("StaticMeshComponent");
     
     // 루트 교체
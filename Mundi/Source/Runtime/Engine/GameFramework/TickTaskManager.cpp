@@ -0,0 +1,429 @@
+#include "pch.h"
+#include "TickTaskManager.h"
+#include "World.h"
+#include "Actor.h"
+#include "TaskScheduler.h"
+#include "PlatformTime.h"
+#include <algorithm>
+
+namespace
+{
+	// 병렬 틱 청크당 최소 컴포넌트 수 (스켈레탈 애니메이션처럼 무거운 틱도 있어서 작게 유지)
+	constexpr int32 MinParallelTicksPerChunk = 2;
+
+	thread_local bool bTickingInParallel = false;
+}
+
+void FTickTaskManager::BeginFrame()
+{
+	ApplyPendingTicks();
+
+	CurrentStats = FTickFrameStats();
+	CurrentStats.NumRegisteredActors = ActorTicks.Num();
+	CurrentStats.NumRegisteredComponents = ComponentTicks.Num();
+	bInFrame = true;
+}
+
+void FTickTaskManager::RunTickGroup(ETickingGroup Group)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	if (Group == ETickingGroup::PrePhysics)
+	{
+		TickActors();
+		BuildSchedule();
+	}
+
+	const int32 GroupIndex = static_cast<int32>(Group);
+	const TArray<int32>& Order = GroupOrder[GroupIndex];
+	FTickGroupStats& Stats = CurrentStats.Groups[GroupIndex];
+
+	int32 WaveBegin = 0;
+	while (WaveBegin < Order.Num())
+	{
+		const int32 Wave = Entries[Order[WaveBegin]].Wave;
+		int32 WaveEnd = WaveBegin;
+		while (WaveEnd < Order.Num() && Entries[Order[WaveEnd]].Wave == Wave)
+		{
+			++WaveEnd;
+		}
+
+		// 게임 스레드 컴포넌트는 직렬로, 병렬 컴포넌트는 모아서 한 번에
+		ParallelScratch.Empty();
+		for (int32 i = WaveBegin; i < WaveEnd; ++i)
+		{
+			const int32 EntryIndex = Order[i];
+			if (Entries[EntryIndex].bParallel)
+			{
+				ParallelScratch.Add(EntryIndex);
+			}
+			else
+			{
+				TickEntry(Entries[EntryIndex]);
+			}
+		}
+
+		if (!ParallelScratch.IsEmpty())
+		{
+			const int32 NumParallel = ParallelScratch.Num();
+			FTaskScheduler::ParallelFor(NumParallel, FTaskScheduler::ComputeNumChunks(NumParallel, MinParallelTicksPerChunk),
+				[this](int32 /*ChunkIndex*/, int32 Begin, int32 End)
+				{
+					bTickingInParallel = true;
+					for (int32 i = Begin; i < End; ++i)
+					{
+						TickEntry(Entries[ParallelScratch[i]]);
+					}
+					bTickingInParallel = false;
+				});
+
+			// 워커에서 미뤄둔 이벤트는 웨이브가 끝난 뒤 게임 스레드에서 처리
+			for (int32 EntryIndex : ParallelScratch)
+			{
+				if (UActorComponent* Component = Entries[EntryIndex].Component)
+				{
+					Component->EndParallelTick();
+				}
+			}
+			Stats.NumParallel += NumParallel;
+		}
+
+		++Stats.NumWaves;
+		WaveBegin = WaveEnd;
+	}
+
+	Stats.NumComponents += Order.Num();
+	Stats.TimeMS += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+}
+
+void FTickTaskManager::EndFrame()
+{
+	LastFrameStats = CurrentStats;
+
+	Entries.Empty();
+	PrerequisiteIndices.Empty();
+	EntryIndexMap.Empty();
+	for (TArray<int32>& Order : GroupOrder)
+	{
+		Order.Empty();
+	}
+	bInFrame = false;
+}
+
+void FTickTaskManager::RegisterActorTick(AActor* Actor)
+{
+	if (!Actor || !Actor->CanEverTick() || ActorTickIndices.Contains(Actor))
+	{
+		return;
+	}
+	ActorTickIndices.Add(Actor, PendingTickIndex);
+	PendingActorTicks.Add(Actor);
+}
+
+void FTickTaskManager::UnregisterActorTick(AActor* Actor)
+{
+	const int32* Found = ActorTickIndices.Find(Actor);
+	if (!Found)
+	{
+		return;
+	}
+
+	// 대기 목록의 항목은 ApplyPendingTicks에서 인덱스 맵에 없으면 버려짐
+	if (*Found != PendingTickIndex)
+	{
+		ActorTicks[*Found] = nullptr;
+		bActorTicksDirty = true;
+	}
+	ActorTickIndices.Remove(Actor);
+}
+
+void FTickTaskManager::RegisterComponentTick(UActorComponent* Component)
+{
+	if (!Component || !Component->CanEverTick() || ComponentTickIndices.Contains(Component))
+	{
+		return;
+	}
+	ComponentTickIndices.Add(Component, PendingTickIndex);
+	PendingComponentTicks.Add(Component);
+}
+
+void FTickTaskManager::UnregisterComponentTick(UActorComponent* Component)
+{
+	const int32* Found = ComponentTickIndices.Find(Component);
+	if (!Found)
+	{
+		return;
+	}
+
+	if (*Found != PendingTickIndex)
+	{
+		ComponentTicks[*Found] = nullptr;
+		bComponentTicksDirty = true;
+	}
+	ComponentTickIndices.Remove(Component);
+
+	// 이번 프레임에 스케줄된 틱도 취소 (해제된 포인터를 틱하지 않도록)
+	if (bInFrame)
+	{
+		if (const int32* EntryIndex = EntryIndexMap.Find(Component))
+		{
+			Entries[*EntryIndex].Component = nullptr;
+		}
+	}
+}
+
+bool FTickTaskManager::IsInParallelTick()
+{
+	return bTickingInParallel;
+}
+
+const char* FTickTaskManager::GetTickGroupName(ETickingGroup Group)
+{
+	switch (Group)
+	{
+	case ETickingGroup::PrePhysics:		return "PrePhysics";
+	case ETickingGroup::DuringPhysics:	return "DuringPhysics";
+	case ETickingGroup::PostPhysics:	return "PostPhysics";
+	case ETickingGroup::PostUpdateWork:	return "PostUpdateWork";
+	default:							return "Unknown";
+	}
+}
+
+bool FTickTaskManager::ShouldTickActor(AActor* Actor) const
+{
+	// 액터 Tick과 그 액터의 컴포넌트 틱 공통 조건 (Preview World는 항상 틱)
+	// bCanEverTick은 액터 자신의 Tick에만 해당하므로 등록 시점에 거름
+	return Actor && Actor->IsActorActive()
+		&& (Actor->CanTickInEditor() || World->bPie || World->IsPreviewWorld());
+}
+
+void FTickTaskManager::ApplyPendingTicks()
+{
+	// 대기 항목 중 아직 인덱스 맵에 대기 상태로 남아 있는 것만 붙임 (사이에 해제됐거나 중복 등록된 항목 제외)
+	auto TakePending = [](auto& Pending, auto& Indices, auto& Ticks)
+	{
+		for (auto* Item : Pending)
+		{
+			auto* Found = Indices.Find(Item);
+			if (Found && *Found == PendingTickIndex)
+			{
+				*Found = Ticks.Num();
+				Ticks.Add(Item);
+			}
+		}
+		Pending.Empty();
+	};
+
+	if (bActorTicksDirty || !PendingActorTicks.IsEmpty())
+	{
+		ActorTicks.erase(std::remove(ActorTicks.begin(), ActorTicks.end(), nullptr), ActorTicks.end());
+		TakePending(PendingActorTicks, ActorTickIndices, ActorTicks);
+
+		for (int32 i = 0; i < ActorTicks.Num(); ++i)
+		{
+			ActorTickIndices[ActorTicks[i]] = i;
+		}
+		bActorTicksDirty = false;
+	}
+
+	if (bComponentTicksDirty || !PendingComponentTicks.IsEmpty())
+	{
+		ComponentTicks.erase(std::remove(ComponentTicks.begin(), ComponentTicks.end(), nullptr), ComponentTicks.end());
+		TakePending(PendingComponentTicks, ComponentTickIndices, ComponentTicks);
+
+		// 같은 클래스끼리 모아서 가상 호출 대상이 연속되도록 (클래스 안에서는 등록 순서 유지)
+		std::stable_sort(ComponentTicks.begin(), ComponentTicks.end(), [](UActorComponent* A, UActorComponent* B)
+		{
+			return A->GetClass() < B->GetClass();
+		});
+
+		for (int32 i = 0; i < ComponentTicks.Num(); ++i)
+		{
+			ComponentTickIndices[ComponentTicks[i]] = i;
+		}
+		bComponentTicksDirty = false;
+	}
+}
+
+void FTickTaskManager::TickActors()
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	const float GameDeltaSeconds = World->GetDeltaTime(EDeltaTime::Game);
+	const bool bEditorTick = !World->bPie && !World->IsPreviewWorld();
+
+	// 1. 기본 설정 컴포넌트 (그룹/병렬/선행 조건이 있는 컴포넌트는 BuildSchedule에서 따로 처리)
+	// 틱 도중 해제된 칸은 nullptr가 되므로 인덱스로 순회
+	int32 NumComponentsTicked = 0;
+	for (int32 i = 0; i < ComponentTicks.Num(); ++i)
+	{
+		UActorComponent* Component = ComponentTicks[i];
+		if (!Component || !Component->IsComponentTickEnabled() || Component->RequiresTickScheduling())
+		{
+			continue;
+		}
+		if (bEditorTick && !Component->CanTickInEditor())
+		{
+			continue;
+		}
+
+		AActor* Owner = Component->GetOwner();
+		if (!ShouldTickActor(Owner))
+		{
+			continue;
+		}
+
+		Component->TickComponent(GameDeltaSeconds * Owner->GetCustomTimeDillation());
+		++NumComponentsTicked;
+	}
+	CurrentStats.Groups[static_cast<int32>(ETickingGroup::PrePhysics)].NumComponents += NumComponentsTicked;
+
+	// 2. 액터 Tick
+	for (int32 i = 0; i < ActorTicks.Num(); ++i)
+	{
+		AActor* Actor = ActorTicks[i];
+		if (ShouldTickActor(Actor))
+		{
+			Actor->Tick(GameDeltaSeconds * Actor->GetCustomTimeDillation());
+			++CurrentStats.NumActors;
+		}
+	}
+
+	CurrentStats.ActorTickMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+}
+
+void FTickTaskManager::BuildSchedule()
+{
+	Entries.Empty();
+	PrerequisiteIndices.Empty();
+	EntryIndexMap.Empty();
+	for (TArray<int32>& Order : GroupOrder)
+	{
+		Order.Empty();
+	}
+
+	// 1. 스케줄할 컴포넌트 수집 (액터 Tick이 끝난 시점의 활성 상태 기준)
+	const float GameDeltaSeconds = World->GetDeltaTime(EDeltaTime::Game);
+	const bool bEditorTick = !World->bPie && !World->IsPreviewWorld();
+	for (UActorComponent* Component : ComponentTicks)
+	{
+		if (!Component || !Component->RequiresTickScheduling() || !Component->IsComponentTickEnabled())
+		{
+			continue;
+		}
+		if (bEditorTick && !Component->CanTickInEditor())
+		{
+			continue;
+		}
+
+		AActor* Owner = Component->GetOwner();
+		if (!ShouldTickActor(Owner))
+		{
+			continue;
+		}
+
+		FTickEntry Entry;
+		Entry.Component = Component;
+		Entry.DeltaSeconds = GameDeltaSeconds * Owner->GetCustomTimeDillation();
+		Entry.Group = Component->GetTickGroup();
+		Entry.bParallel = Component->CanTickOnAnyThread();
+		EntryIndexMap.Add(Component, Entries.Add(Entry));
+	}
+
+	if (Entries.IsEmpty())
+	{
+		return;
+	}
+
+	// 2. 선행 조건을 이번 프레임 인덱스로 변환 (틱하지 않거나 기본 설정으로 이미 틱한 대상은 충족된 것으로 봄)
+	for (FTickEntry& Entry : Entries)
+	{
+		Entry.FirstPrerequisite = PrerequisiteIndices.Num();
+		for (UActorComponent* Prerequisite : Entry.Component->GetTickPrerequisites())
+		{
+			if (const int32* Found = EntryIndexMap.Find(Prerequisite))
+			{
+				PrerequisiteIndices.Add(*Found);
+			}
+		}
+		Entry.NumPrerequisites = PrerequisiteIndices.Num() - Entry.FirstPrerequisite;
+	}
+
+	// 3. 실제 그룹과 웨이브 계산
+	for (int32 i = 0; i < Entries.Num(); ++i)
+	{
+		ResolveEntry(i);
+	}
+
+	if (CurrentStats.NumCycleBreaks > 0)
+	{
+		static bool bLoggedCycle = false;
+		if (!bLoggedCycle)
+		{
+			UE_LOG("[warning] TickTaskManager: %d tick prerequisite cycle(s) ignored", CurrentStats.NumCycleBreaks);
+			bLoggedCycle = true;
+		}
+	}
+
+	// 4. 그룹별로 웨이브 순 정렬 (같은 웨이브는 수집 순서 유지)
+	for (int32 i = 0; i < Entries.Num(); ++i)
+	{
+		GroupOrder[static_cast<int32>(Entries[i].Group)].Add(i);
+	}
+	for (TArray<int32>& Order : GroupOrder)
+	{
+		std::stable_sort(Order.begin(), Order.end(), [this](int32 A, int32 B)
+		{
+			return Entries[A].Wave < Entries[B].Wave;
+		});
+	}
+}
+
+void FTickTaskManager::ResolveEntry(int32 EntryIndex)
+{
+	FTickEntry& Entry = Entries[EntryIndex];
+	if (Entry.VisitState != 0)
+	{
+		return;
+	}
+	Entry.VisitState = 1;
+
+	// 선행 컴포넌트를 먼저 확정하고, 더 늦은 그룹이면 그 그룹으로 미룸
+	for (int32 i = 0; i < Entry.NumPrerequisites; ++i)
+	{
+		const int32 PrerequisiteIndex = PrerequisiteIndices[Entry.FirstPrerequisite + i];
+		if (Entries[PrerequisiteIndex].VisitState == 1)
+		{
+			// 순환: 방문 중인 조상으로 돌아가는 간선은 무시
+			++CurrentStats.NumCycleBreaks;
+			continue;
+		}
+		ResolveEntry(PrerequisiteIndex);
+
+		if (Entries[PrerequisiteIndex].Group > Entry.Group)
+		{
+			Entry.Group = Entries[PrerequisiteIndex].Group;
+		}
+	}
+
+	// 같은 그룹의 선행 컴포넌트보다 한 웨이브 뒤 (앞선 그룹의 선행 컴포넌트는 이미 끝남)
+	for (int32 i = 0; i < Entry.NumPrerequisites; ++i)
+	{
+		const FTickEntry& Prerequisite = Entries[PrerequisiteIndices[Entry.FirstPrerequisite + i]];
+		if (Prerequisite.VisitState == 2 && Prerequisite.Group == Entry.Group)
+		{
+			Entry.Wave = std::max(Entry.Wave, Prerequisite.Wave + 1);
+		}
+	}
+
+	Entry.VisitState = 2;
+}
+
+void FTickTaskManager::TickEntry(const FTickEntry& Entry) const
+{
+	// 앞선 틱에서 비활성화/해제됐을 수 있으므로 실행 시점에 다시 확인
+	UActorComponent* Component = Entry.Component;
+	if (Component && Component->IsComponentTickEnabled())
+	{
+		Component->TickComponent(Entry.DeltaSeconds);
+	}
+}
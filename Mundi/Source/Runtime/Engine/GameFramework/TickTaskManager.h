@@ -0,0 +1,129 @@
+#pragma once
+#include "UEContainer.h"
+#include "ActorComponent.h"
+
+class UWorld;
+class AActor;
+
+/**
+ * @struct FTickGroupStats
+ * @brief 틱 그룹 하나의 프레임 통계입니다.
+ */
+struct FTickGroupStats
+{
+	double TimeMS = 0.0;		// 그룹 전체 시간 (PrePhysics는 액터 Tick 포함)
+	int32 NumComponents = 0;	// 틱한 컴포넌트 수 (PrePhysics는 기본 설정 컴포넌트 포함)
+	int32 NumParallel = 0;		// 그중 워커 스레드에서 병렬로 틱한 수
+	int32 NumWaves = 0;			// 선행 조건으로 나뉜 단계 수
+};
+
+/**
+ * @struct FTickFrameStats
+ * @brief UWorld::Tick 한 번의 그룹별 틱 통계입니다. (STAT TICK)
+ */
+struct FTickFrameStats
+{
+	FTickGroupStats Groups[static_cast<int32>(ETickingGroup::Max)];
+	int32 NumActors = 0;				// Tick을 호출한 액터 수
+	int32 NumRegisteredActors = 0;		// 틱 목록에 등록된 액터 수 (bCanEverTick)
+	int32 NumRegisteredComponents = 0;	// 틱 목록에 등록된 컴포넌트 수 (bCanEverTick)
+	double ActorTickMS = 0.0;			// PrePhysics 중 기본 설정 컴포넌트 틱 + 액터 Tick 시간
+	double PhysicsMS = 0.0;		// 물리 단계 (강체 시뮬레이션 + 충돌 BVH 갱신 + 겹침 이벤트)
+	int32 NumCycleBreaks = 0;	// 순환 선행 조건이라 무시한 간선 수
+};
+
+/**
+ * @class FTickTaskManager
+ * @brief UWorld의 틱 그룹 실행기입니다. 액터 Tick과 컴포넌트 틱을 그룹 순서대로 돌립니다.
+ *
+ * - 틱할 수 있는 액터/컴포넌트(bCanEverTick)만 월드 진입/컴포넌트 등록 시 틱 목록에 등록하므로
+ *   틱하지 않는 액터는 매 프레임 비용이 없음. 등록/해제는 다음 프레임 시작(BeginFrame) 때 목록에 반영하고,
+ *   해제된 항목은 그 즉시 이번 프레임의 남은 틱에서 제외
+ * - 컴포넌트 목록은 클래스별로 모아 두어 같은 TickComponent가 연속으로 호출됨
+ * - PrePhysics: 기본 설정 컴포넌트 틱 -> 액터 Tick (액터 Tick 안의 Super::Tick이 컴포넌트 틱보다 뒤인 기존 순서와 같음)
+ * - 그 외 컴포넌트(다른 그룹, bTickOnAnyThread, 선행 조건 있음)는 액터 Tick이 끝난 뒤 한 번에 모아
+ *   선행 조건 깊이(웨이브)로 정렬하고, 그룹마다 웨이브 순서대로 실행
+ * - 한 웨이브 안에서는 게임 스레드 컴포넌트를 먼저 직렬로, bTickOnAnyThread 컴포넌트는 FTaskScheduler::ParallelFor로 병렬 실행한 뒤
+ *   게임 스레드에서 EndParallelTick 호출
+ * - 선행 컴포넌트가 더 늦은 그룹이면 뒤 컴포넌트를 그 그룹으로 미루고, 순환은 간선을 끊고 경고
+ */
+class FTickTaskManager
+{
+public:
+	explicit FTickTaskManager(UWorld* InWorld) : World(InWorld) {}
+
+	/** 프레임 시작. 지난 프레임 동안 쌓인 등록/해제를 틱 목록에 반영 (틱 중 스폰된 액터는 다음 프레임부터) */
+	void BeginFrame();
+
+	/** 그룹 하나 실행. PrePhysics는 액터 Tick 후 월드가 틱할 컴포넌트의 실행 순서를 정함 */
+	void RunTickGroup(ETickingGroup Group);
+
+	/** 물리 단계 시간 기록 (UWorld::Tick에서 PostPhysics 전에 호출) */
+	void AddPhysicsTime(double InMilliseconds) { CurrentStats.PhysicsMS += InMilliseconds; }
+
+	/** 프레임 종료. 통계를 확정하고 이번 프레임 목록을 비움 */
+	void EndFrame();
+
+	/** 레벨에 들어온 액터를 틱 목록에 등록 (bCanEverTick이 아니면 무시) */
+	void RegisterActorTick(AActor* Actor);
+
+	/** 레벨에서 빠지는 액터를 틱 목록에서 해제 */
+	void UnregisterActorTick(AActor* Actor);
+
+	/** 컴포넌트를 틱 목록에 등록 (UActorComponent::RegisterComponent에서 호출) */
+	void RegisterComponentTick(UActorComponent* Component);
+
+	/** 컴포넌트를 틱 목록에서 해제. 틱 도중이면 이번 프레임의 남은 틱에서도 제외 (UActorComponent::UnregisterComponent에서 호출) */
+	void UnregisterComponentTick(UActorComponent* Component);
+
+	/** 지금 스레드가 병렬 틱 중인지 (워커에서 게임 스레드 전용 작업을 미룰 때 사용) */
+	static bool IsInParallelTick();
+
+	const FTickFrameStats& GetFrameStats() const { return LastFrameStats; }
+	static const char* GetTickGroupName(ETickingGroup Group);
+
+private:
+	struct FTickEntry
+	{
+		UActorComponent* Component = nullptr;
+		float DeltaSeconds = 0.0f;
+		ETickingGroup Group = ETickingGroup::PrePhysics;	// 선행 조건으로 밀려난 실제 그룹
+		int32 Wave = 0;										// 그룹 안에서의 선행 조건 깊이
+		int32 FirstPrerequisite = 0;						// PrerequisiteIndices 범위
+		int32 NumPrerequisites = 0;
+		uint8 VisitState = 0;								// 0: 미방문, 1: 방문 중, 2: 완료
+		bool bParallel = false;
+	};
+
+	// 등록 대기 중인 항목의 인덱스 값
+	static constexpr int32 PendingTickIndex = -1;
+
+	bool ShouldTickActor(AActor* Actor) const;
+	void ApplyPendingTicks();
+	void TickActors();
+	void BuildSchedule();
+	void ResolveEntry(int32 EntryIndex);
+	void TickEntry(const FTickEntry& Entry) const;
+
+	UWorld* World = nullptr;
+	bool bInFrame = false;
+
+	// 틱 목록. 해제된 칸은 nullptr로 두었다가 BeginFrame에서 압축
+	TArray<AActor*> ActorTicks;							// 레벨 추가 순서
+	TArray<UActorComponent*> ComponentTicks;			// 클래스별로 정렬
+	TMap<AActor*, int32> ActorTickIndices;				// 목록 인덱스 (등록 대기 중이면 PendingTickIndex)
+	TMap<UActorComponent*, int32> ComponentTickIndices;
+	TArray<AActor*> PendingActorTicks;
+	TArray<UActorComponent*> PendingComponentTicks;
+	bool bActorTicksDirty = false;
+	bool bComponentTicksDirty = false;
+
+	TArray<FTickEntry> Entries;
+	TArray<int32> PrerequisiteIndices;
+	TMap<UActorComponent*, int32> EntryIndexMap;
+	TArray<int32> GroupOrder[static_cast<int32>(ETickingGroup::Max)];	// 그룹별 Entries 인덱스 (웨이브 순)
+	TArray<int32> ParallelScratch;
+
+	FTickFrameStats CurrentStats;
+	FTickFrameStats LastFrameStats;
+};
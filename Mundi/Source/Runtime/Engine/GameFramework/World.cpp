@@ -33,6 +33,11 @@
 #include "PlayerCameraManager.h"
 #include "Hash.h"
 #include "ParticleEventManager.h"
+#include "AssetStreamer.h"
+#include "CookedLevel.h"
+#include "WorldSnapshot.h"
+#include "TickTaskManager.h"
+#include "PlatformTime.h"
 
 IMPLEMENT_CLASS(UWorld)
 
@@ -44,6 +49,7 @@ UWorld::UWorld() : Partition(nullptr)  // Will be created in Initialize() based
 	LightManager = std::make_unique<FLightManager>();
 	LightManager->SetOwningWorld(this);  // Set owning world for optimization decisions
 	LuaManager = std::make_unique<FLuaManager>();
+	TickTaskManager = std::make_unique<FTickTaskManager>(this);
 
 	UnscaledDelta = 0;
 	SlomoOnlyDelta = 0;
@@ -154,11 +160,17 @@ bool UWorld::TryLoadLastUsedLevel()
 bool UWorld::LoadLevelFromFile(const FWideString& Path)
 {
 	std::unique_ptr<ULevel> NewLevel = ULevelService::CreateDefaultLevel();
-	JSON LevelJsonData;
+	FLevelDocument LevelDocument;
 
-	if (FJsonSerializer::LoadJsonFromFile(LevelJsonData, Path))
+	// 원본 JSON이 바뀌지 않았으면 쿠킹된 바이너리에서 로드 (액터 서브트리는 병렬 디코드)
+	if (FCookedLevelSerializer::LoadOrCook(Path, LevelDocument))
 	{
-		NewLevel->Serialize(true, LevelJsonData);
+		// 스트리밍 모드: 레벨이 참조하는 메시/텍스처만 워커에서 병렬로 미리 로드
+		if (FAssetStreamer::IsEnabled())
+		{
+			FAssetStreamer::PrefetchReferencedAssets(LevelDocument.Strings);
+		}
+		NewLevel->LoadFromDocument(LevelDocument);
 	}
 	else
 	{
@@ -168,6 +180,9 @@ bool UWorld::LoadLevelFromFile(const FWideString& Path)
 
 	SetLevel(std::move(NewLevel));
 
+	// 이전 레벨에서만 쓰던 메시는 다음 Tick에서 예산에 맞춰 해제
+	FAssetStreamer::RequestResidencyUpdate();
+
 	UE_LOG("UWorld: Scene loaded successfully: %s", WideToUTF8(Path).c_str());
 	return true;
 }
@@ -241,25 +256,18 @@ void UWorld::Tick(float DeltaSeconds)
         Partition->Update(DeltaSeconds, /*budget*/256);
     }
 
-	if (Level)
-	{
-		// Tick 중에 새로운 actor가 추가될 수도 있어서 복사 후 호출
-		TArray<AActor*> LevelActors = Level->GetActors();
+	// 지난 프레임 동안의 틱 등록/해제 반영 (Tick 중에 스폰된 액터는 다음 프레임부터 틱)
+	TickTaskManager->BeginFrame();
 
-		for (AActor* Actor : LevelActors)
-		{
-			if (Actor && Actor->IsActorActive())
-			{
-				if (Actor->CanEverTick())
-				{
-					if (Actor->CanTickInEditor() || bPie || IsPreviewWorld())
-					{
-						Actor->Tick(GetDeltaTime(EDeltaTime::Game) * Actor->GetCustomTimeDillation());
-					}
-				}
-			}
-		}
-    }
+	// 액터 Tick + PrePhysics/DuringPhysics 컴포넌트
+	TickTaskManager->RunTickGroup(ETickingGroup::PrePhysics);
+	TickTaskManager->RunTickGroup(ETickingGroup::DuringPhysics);
+
+	// 배치 틱 Lua 스크립트 (위 그룹에서 쌓인 인스턴스를 스크립트 종류별로 한 번에)
+	if (LuaManager)
+	{
+		LuaManager->FlushBatchedTicks();
+	}
 
     for (AActor* EditorActor : EditorActors)
     {
@@ -278,11 +286,27 @@ void UWorld::Tick(float DeltaSeconds)
 	// 지연 삭제 처리
 	ProcessPendingKillActors();
 
-	// 충돌 BVH 업데이트 (에디터/PIE 모두에서 호출 - Partition과 동일)
+	// 물리 단계: 강체 시뮬레이션(PIE만) 후 충돌 BVH 업데이트 (에디터/PIE 모두에서 호출 - Partition과 동일)
 	if (CollisionManager)
 	{
+		const uint64 PhysicsStartCycles = FPlatformTime::Cycles64();
+		if (bPie)
+		{
+			// 고정 서브스텝으로 시뮬레이션하고 움직인 셰이프 트랜스폼을 반영 (겹침 이벤트는 그 결과 기준)
+			CollisionManager->SimulatePhysics(GetDeltaTime(EDeltaTime::Game));
+		}
 		CollisionManager->UpdateCollisions(GetDeltaTime(EDeltaTime::Game));
+		TickTaskManager->AddPhysicsTime(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - PhysicsStartCycles));
+	}
+
+	// 충돌/겹침 결과를 읽는 컴포넌트
+	TickTaskManager->RunTickGroup(ETickingGroup::PostPhysics);
+	TickTaskManager->RunTickGroup(ETickingGroup::PostUpdateWork);
+	if (LuaManager)
+	{
+		LuaManager->FlushBatchedTicks();
 	}
+	TickTaskManager->EndFrame();
 }
 
 UWorld* UWorld::DuplicateWorldForPIE(UWorld* InEditorWorld)
@@ -311,6 +335,31 @@ UWorld* UWorld::DuplicateWorldForPIE(UWorld* InEditorWorld)
 	// PIE 월드에 파티클 이벤트 매니저 생성
 	PIEWorld->ParticleEventManager = PIEWorld->SpawnActor<AParticleEventManager>();
 
+	// 에디터 월드가 지난 PIE 이후 바뀌지 않았으면 스냅샷을 그대로 재사용
+	// (ParticleEventManager는 위에서 이미 생성했으므로 스냅샷에서 제외)
+	if (!InEditorWorld->PIESnapshot)
+	{
+		InEditorWorld->PIESnapshot = std::make_unique<FWorldSnapshot>();
+	}
+	FWorldSnapshot& Snapshot = *InEditorWorld->PIESnapshot;
+	const bool bReused = Snapshot.IsUpToDate(InEditorWorld);
+	if ((bReused || Snapshot.Capture(InEditorWorld, InEditorWorld->ParticleEventManager)) && Snapshot.Instantiate(PIEWorld))
+	{
+		UE_LOG("[info] PIE: World created from %s snapshot (%d actors)", bReused ? "cached" : "new", Snapshot.GetNumActors());
+		PIEWorld->PlayerCameraManager = PIEWorld->FindActor<APlayerCameraManager>();
+	}
+	else
+	{
+		UE_LOG("[warning] PIE: Snapshot unavailable - duplicating actors");
+		Snapshot.Reset();
+		DuplicateActorsForPIE(InEditorWorld, PIEWorld);
+	}
+
+	return PIEWorld;
+}
+
+void UWorld::DuplicateActorsForPIE(UWorld* InEditorWorld, UWorld* PIEWorld)
+{
 	const TArray<AActor*>& SourceActors = InEditorWorld->GetLevel()->GetActors();
 	for (AActor* SourceActor : SourceActors)
 	{
@@ -345,8 +394,22 @@ UWorld* UWorld::DuplicateWorldForPIE(UWorld* InEditorWorld)
 
 		PIEWorld->AddActorToLevel(NewActor);
 	}
+}
 
-	return PIEWorld;
+void UWorld::MarkLevelModified(const AActor* ChangedActor)
+{
+	if (bPie)
+	{
+		return;
+	}
+
+	// 기즈모/그리드/에디터 카메라는 레벨에 저장되지 않으므로 매 프레임 움직여도 스냅샷을 무효화하지 않음
+	if (ChangedActor && (ChangedActor == MainEditorCameraActor
+		|| std::find(EditorActors.begin(), EditorActors.end(), ChangedActor) != EditorActors.end()))
+	{
+		return;
+	}
+	LevelRevision.fetch_add(1, std::memory_order_relaxed);
 }
 
 float UWorld::GetDeltaTime(EDeltaTime type)
@@ -411,12 +474,17 @@ bool UWorld::DestroyActor(AActor* Actor)
 	// 선택/UI 해제
 	if (SelectionMgr) SelectionMgr->DeselectActor(Actor);
 
+	// 틱 목록에서 제외 (이번 프레임에 남은 틱 포함)
+	TickTaskManager->UnregisterActorTick(Actor);
+
 	// 컴포넌트 정리 (등록 해제 → 파괴)
 	Actor->DestroyAllComponents();
 
 	// 레벨에서 제거 시도
 	if (Level && Level->RemoveActor(Actor))
 	{
+		MarkLevelModified();
+
 		// 메모리 해제
 		ObjectFactory::DeleteObject(Actor);
 		return true; // 성공적으로 삭제
@@ -503,6 +571,7 @@ void UWorld::SetLevel(std::unique_ptr<ULevel> InLevel)
     {
         for (AActor* Actor : Level->GetActors())
         {
+            TickTaskManager->UnregisterActorTick(Actor);
             ObjectFactory::DeleteObject(Actor);
         }
         Level->Clear();
@@ -514,14 +583,15 @@ void UWorld::SetLevel(std::unique_ptr<ULevel> InLevel)
     }
 
     Level = std::move(InLevel);
+	MarkLevelModified();
 
     // Adopt actors: set world and register
     if (Level)
     {
-		// Bulk register only if partition exists
-		if (Partition)
+		// 충돌 BVH는 등록을 모았다가 한 번에 재구축
+		if (CollisionManager)
 		{
-			Partition->BulkRegister(Level->GetActors());
+			CollisionManager->BeginBulkRegister();
 		}
         for (AActor* Actor : Level->GetActors())
         {
@@ -529,8 +599,19 @@ void UWorld::SetLevel(std::unique_ptr<ULevel> InLevel)
 			{
 				Actor->SetWorld(this);
 				Actor->RegisterAllComponents(this);
-}
+				TickTaskManager->RegisterActorTick(Actor);
+			}
         }
+		if (CollisionManager)
+		{
+			CollisionManager->EndBulkRegister();
+		}
+		// Bulk register only if partition exists
+		// (컴포넌트 등록 후에 호출해야 OnRegister가 쌓은 Dirty 큐가 비워져 다음 틱에 다시 갱신하지 않음)
+		if (Partition)
+		{
+			Partition->BulkRegister(Level->GetActors());
+		}
     }
 
 	// 씬에서 PCM 검색
@@ -564,6 +645,10 @@ void UWorld::AddActorToLevel(AActor* Actor)
 		Actor->SetWorld(this);
 
 		Actor->RegisterAllComponents(this);
+
+		TickTaskManager->RegisterActorTick(Actor);
+
+		MarkLevelModified();
 	}
 }
 
@@ -692,10 +777,12 @@ AActor* UWorld::SpawnPrefabActor(const FWideString& PrefabPath)
 		return nullptr;
 	}
 
-	JSON ActorDataJson;
+	FLevelDocument PrefabDocument;
 
-	if (FJsonSerializer::LoadJsonFromFile(ActorDataJson, PrefabPath))
+	if (FCookedLevelSerializer::LoadOrCook(PrefabPath, PrefabDocument))
 	{
+		JSON& ActorDataJson = PrefabDocument.Root;
+
 		// Pair.first는 ID 문자열, Pair.second는 단일 프리미티브의 JSON 데이터입니다.
 
 		FString TypeString;
@@ -5,6 +5,7 @@
 #include "Level.h"
 #include "Gizmo/GizmoActor.h"
 #include "LightManager.h"
+#include <atomic>
 
 // Forward Declarations
 class UResourceManager;
@@ -29,6 +30,8 @@ class FOcclusionCullingManagerCPU;
 class APlayerCameraManager;
 class AParticleEventManager;
 class UCollisionManager;
+class FWorldSnapshot;
+class FTickTaskManager;
 
 struct FTransform;
 struct FSceneCompData;
@@ -130,10 +133,16 @@ public:
     UWorldPartitionManager* GetPartitionManager() { return Partition.get(); }
     AParticleEventManager* GetParticleEventManager() { return ParticleEventManager; }
     UCollisionManager* GetCollisionManager() { return CollisionManager.get(); }
+    FTickTaskManager* GetTickTaskManager() { return TickTaskManager.get(); }
 
     // PIE용 World 생성
     static UWorld* DuplicateWorldForPIE(UWorld* InEditorWorld);
 
+    /** === 레벨 리비전 (PIE 스냅샷 재사용 판단) === */
+    // 레벨 액터 추가/삭제, 트랜스폼/프로퍼티 편집 시 증가 (에디터 전용 액터와 PIE 월드는 무시)
+    void MarkLevelModified(const AActor* ChangedActor = nullptr);
+    uint64 GetLevelRevision() const { return LevelRevision.load(std::memory_order_relaxed); }
+
     /** Timing Function */
     float GetDeltaTime(EDeltaTime type);
 
@@ -144,6 +153,9 @@ public:
 private:
     bool DestroyActor(AActor* Actor);   // 즉시 삭제
 
+    // 스냅샷을 쓸 수 없을 때의 기존 경로 (액터마다 Duplicate)
+    static void DuplicateActorsForPIE(UWorld* InEditorWorld, UWorld* PIEWorld);
+
 private:
     /** === 에디터 특수 액터 관리 === */
     TArray<AActor*> EditorActors;
@@ -176,6 +188,9 @@ private:
     // Collision Manager (ShapeComponent용 BVH)
     std::unique_ptr<UCollisionManager> CollisionManager;
 
+    // 틱 그룹 실행기 (액터/컴포넌트 틱 순서와 병렬 틱)
+    std::unique_ptr<FTickTaskManager> TickTaskManager;
+
     // Per-world selection manager
     std::unique_ptr<USelectionManager> SelectionMgr;
 
@@ -195,6 +210,9 @@ private:
 
     bool bIsTearingDown = false;    // 월드가 파괴 중임을 알리는 플래그
 
+    std::atomic<uint64> LevelRevision{ 0 };  // 병렬 틱 중 트랜스폼 변경에서도 증가
+    std::unique_ptr<FWorldSnapshot> PIESnapshot;  // 에디터 월드만 사용 (PIE 세션 간 재사용)
+
     EWorldType WorldType = EWorldType::Editor;  // Default to editor world
 };
 template<class T>
@@ -61,11 +61,13 @@ void UWorldPartitionManager::BulkRegister(const TArray<AActor*>& Actors)
 	TArray<UPrimitiveComponent*> StaticMeshComponents;
 	StaticMeshComponents.Reserve(Actors.size());
 
+	// 에디터 액터 목록은 한 번만 복사 (액터마다 복사/선형 탐색하면 대형 레벨에서 O(N*M))
+	const TArray<AActor*> EditorActorList = GWorld->GetEditorActors();
+	const TSet<AActor*> EditorActors(EditorActorList.begin(), EditorActorList.end());
+
 	for (AActor* Actor : Actors)
 	{
-		TArray<AActor*> EditorActors = GWorld->GetEditorActors();
-		auto it = std::find(EditorActors.begin(), EditorActors.end(), Actor);
-		if (it != EditorActors.end())
+		if (EditorActors.count(Actor) > 0)
 			continue; // 에디터 액터는 포함하지 않는다.
 
 		const TArray<USceneComponent*> Components = Actor->GetSceneComponents();
@@ -129,6 +131,7 @@ void UWorldPartitionManager::MarkDirty(UPrimitiveComponent* Smc)
 
 	// second: 새로운 요소가 성공적으로 삽입되었으면 true, 이미 요소가 존재하여 삽입에 실패했으면 false
 	// DirtyQueue 중복 삽입 방지 로직
+	std::lock_guard<std::mutex> Lock(DirtyMutex);
 	if (ComponentDirtySet.insert(Smc).second)
 	{
 		ComponentDirtyQueue.push(Smc);
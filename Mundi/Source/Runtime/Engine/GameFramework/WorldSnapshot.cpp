@@ -0,0 +1,128 @@
+#include "pch.h"
+#include "WorldSnapshot.h"
+#include "World.h"
+#include "Level.h"
+#include "CookedLevel.h"
+#include "CollisionManager.h"
+#include "WorldPartitionManager.h"
+#include "TickTaskManager.h"
+#include "SceneComponent.h"
+#include "PlatformTime.h"
+#include <cstdio>
+
+bool FWorldSnapshot::Capture(UWorld* SourceWorld, const AActor* ExcludedActor)
+{
+	Reset();
+	if (!SourceWorld || !SourceWorld->GetLevel())
+	{
+		return false;
+	}
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	// 레벨 저장과 같은 액터 Serialize (리플렉션 프로퍼티 + 클래스별 오버라이드)
+	// 카메라 등 레벨 설정은 PIE에 필요 없으므로 Actors만 기록
+	JSON Root = json::Object();
+	JSON& ActorList = Root["Actors"];
+	ActorList = json::Object();
+
+	int32 Order = 0;
+	char IdBuffer[16];
+	for (AActor* Actor : SourceWorld->GetLevel()->GetActors())
+	{
+		if (!Actor || Actor == ExcludedActor || Actor->IsPendingDestroy())
+		{
+			continue;
+		}
+
+		// 쿠킹 포맷은 액터를 ID 문자열 순으로 정렬하므로 0 패딩 인덱스로 레벨 순서를 유지
+		snprintf(IdBuffer, sizeof(IdBuffer), "%08d", Order++);
+		JSON& ActorJson = ActorList[IdBuffer];
+		ActorJson = json::Object();
+		ActorJson["Type"] = Actor->GetClass()->Name;
+		Actor->Serialize(false, ActorJson);
+	}
+
+	if (!FCookedLevelSerializer::CookToMemory(Root, Blob))
+	{
+		Reset();
+		return false;
+	}
+
+	CapturedWorld = SourceWorld;
+	CapturedRevision = SourceWorld->GetLevelRevision();
+	NumActors = Order;
+
+	UE_LOG("WorldSnapshot: Captured %d actors (%.1f KB) in %.1f ms", NumActors, Blob.Num() / 1024.0,
+		FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+	return true;
+}
+
+bool FWorldSnapshot::Instantiate(UWorld* TargetWorld) const
+{
+	if (!TargetWorld || !TargetWorld->GetLevel() || Blob.IsEmpty())
+	{
+		return false;
+	}
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	// 1. 액터 서브트리 병렬 디코드 (UObject는 아직 만들지 않음)
+	FLevelDocument Document;
+	if (const char* Error = FCookedLevelSerializer::LoadFromMemory(Blob.GetData(), Blob.Num(), Document))
+	{
+		UE_LOG("[error] WorldSnapshot: %s", Error);
+		return false;
+	}
+
+	// 2. 액터 생성 + 역직렬화 (레벨 로드와 같은 경로, 부모 연결용 SceneIdMap은 새로 시작)
+	ULevel* Level = TargetWorld->GetLevel();
+	const int32 FirstNewActor = Level->GetActors().Num();
+	USceneComponent::GetSceneIdMap().clear();
+	Level->SpawnActorsFromRecords(Document.Actors);
+	USceneComponent::GetSceneIdMap().clear();
+
+	const TArray<AActor*>& LevelActors = Level->GetActors();
+	TArray<AActor*> NewActors(LevelActors.begin() + FirstNewActor, LevelActors.end());
+
+	// 3. 일괄 등록: 충돌 BVH는 한 번에 재구축, 파티션은 컴포넌트 등록 후 BulkRegister, 액터 틱 등록 (UWorld::SetLevel과 같은 순서)
+	UCollisionManager* CollisionManager = TargetWorld->GetCollisionManager();
+	FTickTaskManager* TickTaskManager = TargetWorld->GetTickTaskManager();
+	if (CollisionManager)
+	{
+		CollisionManager->BeginBulkRegister();
+	}
+	for (AActor* Actor : NewActors)
+	{
+		Actor->SetWorld(TargetWorld);
+		Actor->RegisterAllComponents(TargetWorld);
+		TickTaskManager->RegisterActorTick(Actor);
+	}
+	if (CollisionManager)
+	{
+		CollisionManager->EndBulkRegister();
+	}
+	if (UWorldPartitionManager* Partition = TargetWorld->GetPartitionManager())
+	{
+		Partition->BulkRegister(NewActors);
+	}
+
+	UE_LOG("WorldSnapshot: Instantiated %d actors in %.1f ms", NewActors.Num(),
+		FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+	return true;
+}
+
+bool FWorldSnapshot::IsUpToDate(const UWorld* SourceWorld) const
+{
+	return !Blob.IsEmpty() && SourceWorld && CapturedWorld == SourceWorld
+		&& CapturedRevision == SourceWorld->GetLevelRevision();
+}
+
+void FWorldSnapshot::Reset()
+{
+	Blob.Empty();
+	Blob.shrink_to_fit();
+	CapturedWorld = nullptr;
+	CapturedRevision = 0;
+	NumActors = 0;
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include "UEContainer.h"
+
+class UWorld;
+class AActor;
+
+/**
+ * @class FWorldSnapshot
+ * @brief 에디터 월드의 레벨 액터를 직렬화해 둔 메모리 블롭입니다. PIE 월드는 액터마다 Duplicate()하는 대신 여기서 일괄 생성합니다.
+ *
+ * - 블롭은 쿠킹 레벨 포맷(FCookedLevelSerializer)과 같음: 문자열 테이블 + 액터별 노드 범위
+ *   -> 인스턴스화 시 액터 서브트리를 병렬 디코드하고, 생성/역직렬화 후 충돌 BVH/파티션에 한 번에 등록
+ * - 액터 ID는 레벨 내 순서(0 패딩 인덱스)라서 PIE 월드의 액터 순서가 에디터와 같음
+ * - 에디터 월드의 LevelRevision이 캡처 시점과 같으면 다음 PIE에서도 다시 캡처하지 않고 재사용
+ * - 저장/로드와 같은 Serialize 경로를 쓰므로 PIE 월드는 "지금 레벨을 저장했다 다시 연 것"과 같은 상태로 시작
+ */
+class FWorldSnapshot
+{
+public:
+	/** SourceWorld 레벨의 액터를 직렬화 (ExcludedActor는 제외, PIE 월드가 따로 만드는 액터용) */
+	bool Capture(UWorld* SourceWorld, const AActor* ExcludedActor);
+
+	/** 스냅샷의 액터를 TargetWorld 레벨에 생성하고 일괄 등록. 실패하면 액터를 만들지 않음 */
+	bool Instantiate(UWorld* TargetWorld) const;
+
+	/** 캡처 이후 SourceWorld가 바뀌지 않았으면 true */
+	bool IsUpToDate(const UWorld* SourceWorld) const;
+
+	void Reset();
+
+	uint64 GetSize() const { return static_cast<uint64>(Blob.Num()); }
+	int32 GetNumActors() const { return NumActors; }
+
+private:
+	TArray<uint8> Blob;
+	const UWorld* CapturedWorld = nullptr;
+	uint64 CapturedRevision = 0;
+	int32 NumActors = 0;
+};
@@ -119,6 +119,19 @@ static void AddAlias(sol::table& T, const char* Alias, void(C::*Method)(P...))
 
 // ===== 프로퍼티 바인딩 헬퍼 함수들 =====
 
+// 빠른 경로 타입(bool/int32/float/FVector/FQuat)이면 디스크립터에 타입과 오프셋을 기록
+// LuaComponentProxy가 (클래스, 키)별로 캐시해 get/set 호출 없이 오프셋으로 직접 읽고 씀
+template<typename C, typename PropType>
+static void SetFastPropertyInfo(sol::table& PropDesc, PropType C::*MemberPtr)
+{
+    constexpr ELuaFastPropertyType FastType = GetLuaFastPropertyType<PropType>();
+    if constexpr (FastType != ELuaFastPropertyType::None)
+    {
+        PropDesc["fast_type"] = static_cast<int32>(FastType);
+        PropDesc["offset"] = static_cast<int64>(GetMemberOffset(MemberPtr));
+    }
+}
+
 // 기본 프로퍼티 바인딩 (읽기/쓰기)
 template<typename C, typename PropType>
 static void AddProperty(sol::table& T, const char* Name, PropType C::*MemberPtr)
@@ -145,6 +158,7 @@ static void AddProperty(sol::table& T, const char* Name, PropType C::*MemberPtr)
         static_cast<C*>(Proxy.Instance)->*MemberPtr = Value;
     };
 
+    SetFastPropertyInfo(PropDesc, MemberPtr);
     T[Name] = PropDesc;
 }
 
@@ -166,6 +180,7 @@ static void AddReadOnlyProperty(sol::table& T, const char* Name, PropType C::*Me
         return static_cast<C*>(Proxy.Instance)->*MemberPtr;
     };
 
+    SetFastPropertyInfo(PropDesc, MemberPtr);
     T[Name] = PropDesc;
 }
 
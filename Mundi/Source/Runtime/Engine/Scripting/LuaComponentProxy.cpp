@@ -9,6 +9,8 @@
 // Global bound classes map for reflection-based access
 TMap<UClass*, FBoundClassDesc> GBoundClasses;
 
+bool LuaComponentProxy::bUseAccessorCache = true;
+
 // External function from LuaManager.cpp
 extern sol::object MakeCompProxy(sol::state_view SolState, UObject* Instance, UClass* Class);
 
@@ -42,83 +44,27 @@ bool LuaComponentProxy::IsValid() const
     return IsValidUObject(Instance);
 }
 
-// ===== Index (Property/Method Access) =====
+// ===== Reflection Read/Write =====
 
-sol::object LuaComponentProxy::Index(sol::this_state LuaState, LuaComponentProxy& Self, const char* Key)
+static sol::object ReadReflectedProperty(sol::state_view LuaView, UObject* Instance, const FProperty* Property)
 {
-    if (!Self.Instance)
-    {
-        UE_LOG("[LuaProxy] Index: Instance is null for key '%s'", Key);
-        return sol::nil;
-    }
-
-    sol::state_view LuaView(LuaState);
-
-    // Build bound class for reflection fallback
-    BuildBoundClass(Self.Class);
-
-    // ===== 1. Registry-based lookup (LuaBindHelpers bindings) =====
-    // Search inheritance chain for methods
-    for (const UClass* CurrentClass = Self.Class; CurrentClass != nullptr; CurrentClass = CurrentClass->Super)
-    {
-        sol::table& BindTable = FLuaBindRegistry::Get().EnsureTable(LuaView, CurrentClass);
-        if (!BindTable.valid()) continue;
-
-        sol::object Result = BindTable[Key];
-        if (!Result.valid()) continue;
-
-        // Check if it's a property descriptor
-        if (Result.is<sol::table>())
-        {
-            sol::table propDesc = Result.as<sol::table>();
-            sol::optional<bool> isProperty = propDesc["is_property"];
-
-            if (isProperty && *isProperty)
-            {
-                // Property - call getter
-                sol::object getterObj = propDesc["get"];
-                if (getterObj.valid())
-                {
-                    sol::protected_function getter = getterObj.as<sol::protected_function>();
-                    auto pfr = getter(Self);
-                    if (pfr.valid())
-                        return pfr.get<sol::object>();
-                }
-                return sol::nil;
-            }
-        }
-
-        // Function - return directly
-        if (Result.get_type() == sol::type::function)
-            return Result;
-    }
-
-    // ===== 2. Reflection-based fallback (LuaReadWrite metadata) =====
-    auto It = GBoundClasses.find(Self.Class);
-    if (It == GBoundClasses.end()) return sol::nil;
-
-    auto ItProp = It->second.PropsByName.find(Key);
-    if (ItProp == It->second.PropsByName.end()) return sol::nil;
-
-    const FProperty* Property = ItProp->second.Property;
-
     switch (Property->Type)
     {
     case EPropertyType::Bool:
-        return sol::make_object(LuaView, *Property->GetValuePtr<bool>(Self.Instance));
+        return sol::make_object(LuaView, *Property->GetValuePtr<bool>(Instance));
     case EPropertyType::Float:
-        return sol::make_object(LuaView, *Property->GetValuePtr<float>(Self.Instance));
+        return sol::make_object(LuaView, *Property->GetValuePtr<float>(Instance));
     case EPropertyType::Int32:
-        return sol::make_object(LuaView, *Property->GetValuePtr<int>(Self.Instance));
+        return sol::make_object(LuaView, *Property->GetValuePtr<int>(Instance));
     case EPropertyType::FString:
     case EPropertyType::ScriptFile:
-        return sol::make_object(LuaView, *Property->GetValuePtr<FString>(Self.Instance));
+        return sol::make_object(LuaView, *Property->GetValuePtr<FString>(Instance));
     case EPropertyType::FVector:
-        return sol::make_object(LuaView, *Property->GetValuePtr<FVector>(Self.Instance));
+        return sol::make_object(LuaView, *Property->GetValuePtr<FVector>(Instance));
     case EPropertyType::FLinearColor:
-        return sol::make_object(LuaView, *Property->GetValuePtr<FLinearColor>(Self.Instance));
+        return sol::make_object(LuaView, *Property->GetValuePtr<FLinearColor>(Instance));
     case EPropertyType::FName:
-        return sol::make_object(LuaView, Property->GetValuePtr<FName>(Self.Instance)->ToString());
+        return sol::make_object(LuaView, Property->GetValuePtr<FName>(Instance)->ToString());
 
     // UObject pointer types (supports recursive access)
     case EPropertyType::ObjectPtr:
@@ -128,7 +74,7 @@ sol::object LuaComponentProxy::Index(sol::this_state LuaState, LuaComponentProxy
     case EPropertyType::Material:
     case EPropertyType::Sound:
     {
-        UObject** ObjPtr = Property->GetValuePtr<UObject*>(Self.Instance);
+        UObject** ObjPtr = Property->GetValuePtr<UObject*>(Instance);
         if (!ObjPtr || !IsValidUObject(*ObjPtr))
             return sol::nil;
 
@@ -138,11 +84,11 @@ sol::object LuaComponentProxy::Index(sol::this_state LuaState, LuaComponentProxy
 
     // Array types - return LuaArrayProxy
     case EPropertyType::Array:
-        return sol::make_object(LuaView, LuaArrayProxy(Self.Instance, Property));
+        return sol::make_object(LuaView, LuaArrayProxy(Instance, Property));
 
     // Map types - return LuaMapProxy
     case EPropertyType::Map:
-        return sol::make_object(LuaView, LuaMapProxy(Self.Instance, Property));
+        return sol::make_object(LuaView, LuaMapProxy(Instance, Property));
 
     // Struct types - return LuaStructProxy for recursive access
     case EPropertyType::Struct:
@@ -154,7 +100,7 @@ sol::object LuaComponentProxy::Index(sol::this_state LuaState, LuaComponentProxy
             return sol::nil;
         }
 
-        void* StructInstance = (char*)Self.Instance + Property->Offset;
+        void* StructInstance = (char*)Instance + Property->Offset;
         return sol::make_object(LuaView, LuaStructProxy(StructInstance, StructType));
     }
 
@@ -163,80 +109,31 @@ sol::object LuaComponentProxy::Index(sol::this_state LuaState, LuaComponentProxy
     }
 }
 
-// ===== NewIndex (Property Assignment) =====
-
-void LuaComponentProxy::NewIndex(LuaComponentProxy& Self, const char* Key, sol::object Obj)
+static void WriteReflectedProperty(UObject* Instance, const FProperty* Property, const sol::object& Obj)
 {
-    if (!Self.Instance || !Self.Class) return;
-
-    sol::state_view LuaView = Obj.lua_state();
-
-    // Build bound class for reflection fallback
-    BuildBoundClass(Self.Class);
-
-    // ===== 1. Registry-based lookup first =====
-    sol::table& BindTable = FLuaBindRegistry::Get().EnsureTable(LuaView, Self.Class);
-    if (BindTable.valid())
-    {
-        sol::object Property = BindTable[Key];
-        if (Property.valid() && Property.is<sol::table>())
-        {
-            sol::table propDesc = Property.as<sol::table>();
-            sol::optional<bool> isProperty = propDesc["is_property"];
-
-            if (isProperty && *isProperty)
-            {
-                // Check read-only
-                sol::optional<bool> readOnly = propDesc["read_only"];
-                if (readOnly && *readOnly)
-                {
-                    UE_LOG("[LuaProxy] Attempted to set read-only property: %s", Key);
-                    return;
-                }
-
-                // Call setter
-                sol::optional<sol::function> setter = propDesc["set"];
-                if (setter)
-                {
-                    (*setter)(Self, Obj);
-                }
-                return;
-            }
-        }
-    }
-
-    // ===== 2. Reflection-based fallback =====
-    auto IterateClass = GBoundClasses.find(Self.Class);
-    if (IterateClass == GBoundClasses.end()) return;
-
-    auto It = IterateClass->second.PropsByName.find(Key);
-    if (It == IterateClass->second.PropsByName.end()) return;
-
-    const FProperty* Property = It->second.Property;
-
     switch (Property->Type)
     {
     case EPropertyType::Bool:
         if (Obj.get_type() == sol::type::boolean)
-            *Property->GetValuePtr<bool>(Self.Instance) = Obj.as<bool>();
+            *Property->GetValuePtr<bool>(Instance) = Obj.as<bool>();
         break;
     case EPropertyType::Float:
         if (Obj.get_type() == sol::type::number)
-            *Property->GetValuePtr<float>(Self.Instance) = static_cast<float>(Obj.as<double>());
+            *Property->GetValuePtr<float>(Instance) = static_cast<float>(Obj.as<double>());
         break;
     case EPropertyType::Int32:
         if (Obj.get_type() == sol::type::number)
-            *Property->GetValuePtr<int>(Self.Instance) = static_cast<int>(Obj.as<double>());
+            *Property->GetValuePtr<int>(Instance) = static_cast<int>(Obj.as<double>());
         break;
     case EPropertyType::FString:
     case EPropertyType::ScriptFile:
         if (Obj.get_type() == sol::type::string)
-            *Property->GetValuePtr<FString>(Self.Instance) = Obj.as<FString>();
+            *Property->GetValuePtr<FString>(Instance) = Obj.as<FString>();
         break;
     case EPropertyType::FVector:
         if (Obj.is<FVector>())
         {
-            *Property->GetValuePtr<FVector>(Self.Instance) = Obj.as<FVector>();
+            *Property->GetValuePtr<FVector>(Instance) = Obj.as<FVector>();
         }
         else if (Obj.get_type() == sol::type::table)
         {
@@ -246,13 +143,13 @@ void LuaComponentProxy::NewIndex(LuaComponentProxy& Self, const char* Key, sol::
                 static_cast<float>(t.get_or("Y", 0.0)),
                 static_cast<float>(t.get_or("Z", 0.0))
             };
-            *Property->GetValuePtr<FVector>(Self.Instance) = tmp;
+            *Property->GetValuePtr<FVector>(Instance) = tmp;
         }
         break;
     case EPropertyType::FLinearColor:
         if (Obj.is<FLinearColor>())
         {
-            *Property->GetValuePtr<FLinearColor>(Self.Instance) = Obj.as<FLinearColor>();
+            *Property->GetValuePtr<FLinearColor>(Instance) = Obj.as<FLinearColor>();
         }
         else if (Obj.get_type() == sol::type::table)
         {
@@ -263,12 +160,12 @@ void LuaComponentProxy::NewIndex(LuaComponentProxy& Self, const char* Key, sol::
                 static_cast<float>(t.get_or("B", 1.0)),
                 static_cast<float>(t.get_or("A", 1.0))
             };
-            *Property->GetValuePtr<FLinearColor>(Self.Instance) = tmp;
+            *Property->GetValuePtr<FLinearColor>(Instance) = tmp;
         }
         break;
     case EPropertyType::FName:
         if (Obj.get_type() == sol::type::string)
-            *Property->GetValuePtr<FName>(Self.Instance) = FName(Obj.as<FString>());
+            *Property->GetValuePtr<FName>(Instance) = FName(Obj.as<FString>());
         break;
 
     // UObject pointer types
@@ -279,7 +176,7 @@ void LuaComponentProxy::NewIndex(LuaComponentProxy& Self, const char* Key, sol::
     case EPropertyType::Material:
     case EPropertyType::Sound:
     {
-        UObject** ObjPtr = Property->GetValuePtr<UObject*>(Self.Instance);
+        UObject** ObjPtr = Property->GetValuePtr<UObject*>(Instance);
         if (!ObjPtr) break;
 
         // nil assignment
@@ -333,7 +230,7 @@ void LuaComponentProxy::NewIndex(LuaComponentProxy& Self, const char* Key, sol::
         if (!IsObjectPointerType(Property->InnerType))
             break;
 
-        TArray<UObject*>* ArrayPtr = Property->GetValuePtr<TArray<UObject*>>(Self.Instance);
+        TArray<UObject*>* ArrayPtr = Property->GetValuePtr<TArray<UObject*>>(Instance);
         if (!ArrayPtr) break;
 
         // nil → clear
@@ -387,10 +284,380 @@ void LuaComponentProxy::NewIndex(LuaComponentProxy& Self, const char* Key, sol::
 
     // Struct - cannot replace directly
     case EPropertyType::Struct:
-        UE_LOG("[Lua][warning] Cannot assign to struct property '%s' directly. Modify its fields instead.", Key);
+        UE_LOG("[Lua][warning] Cannot assign to struct property '%s' directly. Modify its fields instead.", Property->Name);
+        break;
+
+    default:
         break;
+    }
+}
+
+// ===== Uncached Lookup (resolves every access; used when bUseAccessorCache is off) =====
+
+static sol::object IndexUncached(sol::state_view LuaView, LuaComponentProxy& Self, const char* Key)
+{
+    // Build bound class for reflection fallback
+    BuildBoundClass(Self.Class);
+
+    // ===== 1. Registry-based lookup (LuaBindHelpers bindings) =====
+    // Search inheritance chain for methods
+    for (const UClass* CurrentClass = Self.Class; CurrentClass != nullptr; CurrentClass = CurrentClass->Super)
+    {
+        sol::table& BindTable = FLuaBindRegistry::Get().EnsureTable(LuaView, CurrentClass);
+        if (!BindTable.valid()) continue;
+
+        sol::object Result = BindTable[Key];
+        if (!Result.valid()) continue;
+
+        // Check if it's a property descriptor
+        if (Result.is<sol::table>())
+        {
+            sol::table propDesc = Result.as<sol::table>();
+            sol::optional<bool> isProperty = propDesc["is_property"];
+
+            if (isProperty && *isProperty)
+            {
+                // Property - call getter
+                sol::object getterObj = propDesc["get"];
+                if (getterObj.valid())
+                {
+                    sol::protected_function getter = getterObj.as<sol::protected_function>();
+                    auto pfr = getter(Self);
+                    if (pfr.valid())
+                        return pfr.get<sol::object>();
+                }
+                return sol::nil;
+            }
+        }
+
+        // Function - return directly
+        if (Result.get_type() == sol::type::function)
+            return Result;
+    }
+
+    // ===== 2. Reflection-based fallback (LuaReadWrite metadata) =====
+    auto It = GBoundClasses.find(Self.Class);
+    if (It == GBoundClasses.end()) return sol::nil;
+
+    auto ItProp = It->second.PropsByName.find(Key);
+    if (ItProp == It->second.PropsByName.end()) return sol::nil;
+
+    return ReadReflectedProperty(LuaView, Self.Instance, ItProp->second.Property);
+}
+
+static void NewIndexUncached(sol::state_view LuaView, LuaComponentProxy& Self, const char* Key, const sol::object& Obj)
+{
+    // Build bound class for reflection fallback
+    BuildBoundClass(Self.Class);
+
+    // ===== 1. Registry-based lookup first =====
+    sol::table& BindTable = FLuaBindRegistry::Get().EnsureTable(LuaView, Self.Class);
+    if (BindTable.valid())
+    {
+        sol::object Property = BindTable[Key];
+        if (Property.valid() && Property.is<sol::table>())
+        {
+            sol::table propDesc = Property.as<sol::table>();
+            sol::optional<bool> isProperty = propDesc["is_property"];
+
+            if (isProperty && *isProperty)
+            {
+                // Check read-only
+                sol::optional<bool> readOnly = propDesc["read_only"];
+                if (readOnly && *readOnly)
+                {
+                    UE_LOG("[LuaProxy] Attempted to set read-only property: %s", Key);
+                    return;
+                }
+
+                // Call setter
+                sol::optional<sol::function> setter = propDesc["set"];
+                if (setter)
+                {
+                    (*setter)(Self, Obj);
+                }
+                return;
+            }
+        }
+    }
+
+    // ===== 2. Reflection-based fallback =====
+    auto IterateClass = GBoundClasses.find(Self.Class);
+    if (IterateClass == GBoundClasses.end()) return;
+
+    auto It = IterateClass->second.PropsByName.find(Key);
+    if (It == IterateClass->second.PropsByName.end()) return;
+
+    WriteReflectedProperty(Self.Instance, It->second.Property, Obj);
+}
+
+// ===== Resolved Accessor Cache =====
+
+/**
+ * What a (class, key) lookup resolved to. Built on first access and reused until ResetAccessorCache.
+ * Registry entries win over reflection, in the same order as IndexUncached/NewIndexUncached.
+ */
+struct FLuaResolvedAccessor
+{
+    enum class EKind : uint8
+    {
+        Missing,        // nil
+        Method,         // registry function
+        BoundProperty,  // registry property descriptor (get/set)
+        Reflected       // reflection only
+    };
+
+    EKind Kind = EKind::Missing;
+    ELuaFastPropertyType FastType = ELuaFastPropertyType::None;
+    bool bReadOnly = false;
+    size_t Offset = 0;
+    const FProperty* Property = nullptr;    // Reflected property with this name (also the write target when Kind is Method)
+    sol::object Method;
+    sol::object Getter;
+    sol::object Setter;
+};
+
+static TMap<UClass*, TMap<FString, FLuaResolvedAccessor>> GResolvedAccessors;
+
+static ELuaFastPropertyType GetFastTypeForProperty(EPropertyType Type)
+{
+    switch (Type)
+    {
+    case EPropertyType::Bool:    return ELuaFastPropertyType::Bool;
+    case EPropertyType::Int32:   return ELuaFastPropertyType::Int32;
+    case EPropertyType::Float:   return ELuaFastPropertyType::Float;
+    case EPropertyType::FVector: return ELuaFastPropertyType::FVector;
+    default:                     return ELuaFastPropertyType::None;
+    }
+}
+
+static FLuaResolvedAccessor ResolveAccessor(sol::state_view LuaView, UClass* Class, const char* Key)
+{
+    FLuaResolvedAccessor Accessor;
+
+    BuildBoundClass(Class);
+    if (auto It = GBoundClasses.find(Class); It != GBoundClasses.end())
+    {
+        if (auto ItProp = It->second.PropsByName.find(Key); ItProp != It->second.PropsByName.end())
+            Accessor.Property = ItProp->second.Property;
+    }
+
+    // ===== 1. Registry-based lookup =====
+    for (const UClass* CurrentClass = Class; CurrentClass != nullptr; CurrentClass = CurrentClass->Super)
+    {
+        sol::table& BindTable = FLuaBindRegistry::Get().EnsureTable(LuaView, CurrentClass);
+        if (!BindTable.valid()) continue;
+
+        sol::object Result = BindTable[Key];
+        if (!Result.valid()) continue;
+
+        if (Result.is<sol::table>())
+        {
+            sol::table PropDesc = Result.as<sol::table>();
+            sol::optional<bool> isProperty = PropDesc["is_property"];
+
+            if (isProperty && *isProperty)
+            {
+                Accessor.Kind = FLuaResolvedAccessor::EKind::BoundProperty;
+                Accessor.Getter = PropDesc["get"];
+                Accessor.Setter = PropDesc["set"];
+                Accessor.bReadOnly = PropDesc.get_or("read_only", false);
+                Accessor.FastType = static_cast<ELuaFastPropertyType>(PropDesc.get_or("fast_type", 0));
+                Accessor.Offset = static_cast<size_t>(PropDesc.get_or<int64>("offset", 0));
+                return Accessor;
+            }
+        }
+
+        if (Result.get_type() == sol::type::function)
+        {
+            Accessor.Kind = FLuaResolvedAccessor::EKind::Method;
+            Accessor.Method = Result;
+            return Accessor;
+        }
+    }
+
+    // ===== 2. Reflection-based fallback =====
+    if (Accessor.Property)
+    {
+        Accessor.Kind = FLuaResolvedAccessor::EKind::Reflected;
+        Accessor.FastType = GetFastTypeForProperty(Accessor.Property->Type);
+        Accessor.Offset = Accessor.Property->Offset;
+    }
+    return Accessor;
+}
+
+static const FLuaResolvedAccessor& FindOrResolveAccessor(lua_State* L, UClass* Class, const char* Key)
+{
+    TMap<FString, FLuaResolvedAccessor>& ClassAccessors = GResolvedAccessors[Class];
+
+    FString KeyString(Key);
+    auto It = ClassAccessors.find(KeyString);
+    if (It == ClassAccessors.end())
+        It = ClassAccessors.emplace(std::move(KeyString), ResolveAccessor(sol::state_view(L), Class, Key)).first;
+    return It->second;
+}
+
+static int PushFastValue(lua_State* L, ELuaFastPropertyType Type, const void* Value)
+{
+    switch (Type)
+    {
+    case ELuaFastPropertyType::Bool:
+        lua_pushboolean(L, *static_cast<const bool*>(Value) ? 1 : 0);
+        return 1;
+    case ELuaFastPropertyType::Int32:
+        lua_pushinteger(L, *static_cast<const int32*>(Value));
+        return 1;
+    case ELuaFastPropertyType::Float:
+        lua_pushnumber(L, *static_cast<const float*>(Value));
+        return 1;
+    case ELuaFastPropertyType::FVector:
+        return sol::stack::push(L, *static_cast<const FVector*>(Value));
+    case ELuaFastPropertyType::FQuat:
+        return sol::stack::push(L, *static_cast<const FQuat*>(Value));
+    default:
+        lua_pushnil(L);
+        return 1;
+    }
+}
+
+// Only exact Lua types take the fast path. Anything else goes through the setter/reflection write so conversions stay the same
+static bool TryWriteFastValue(lua_State* L, int ValueIndex, ELuaFastPropertyType Type, void* Value)
+{
+    switch (Type)
+    {
+    case ELuaFastPropertyType::Bool:
+        if (lua_type(L, ValueIndex) != LUA_TBOOLEAN) return false;
+        *static_cast<bool*>(Value) = lua_toboolean(L, ValueIndex) != 0;
+        return true;
+    case ELuaFastPropertyType::Int32:
+        if (!lua_isinteger(L, ValueIndex)) return false;
+        *static_cast<int32*>(Value) = static_cast<int32>(lua_tointeger(L, ValueIndex));
+        return true;
+    case ELuaFastPropertyType::Float:
+        if (lua_type(L, ValueIndex) != LUA_TNUMBER) return false;
+        *static_cast<float*>(Value) = static_cast<float>(lua_tonumber(L, ValueIndex));
+        return true;
+    case ELuaFastPropertyType::FVector:
+        if (!sol::stack::check<FVector>(L, ValueIndex, &sol::no_panic)) return false;
+        *static_cast<FVector*>(Value) = sol::stack::get<FVector>(L, ValueIndex);
+        return true;
+    case ELuaFastPropertyType::FQuat:
+        if (!sol::stack::check<FQuat>(L, ValueIndex, &sol::no_panic)) return false;
+        *static_cast<FQuat*>(Value) = sol::stack::get<FQuat>(L, ValueIndex);
+        return true;
+    default:
+        return false;
+    }
+}
+
+void LuaComponentProxy::ResetAccessorCache()
+{
+    GResolvedAccessors.Empty();
+}
+
+// ===== Index (Property/Method Access) =====
+
+int LuaComponentProxy::Index(lua_State* L)
+{
+    LuaComponentProxy& Self = sol::stack::get<LuaComponentProxy&>(L, 1);
+    const char* Key = lua_tostring(L, 2);
+
+    if (!Self.Instance)
+    {
+        UE_LOG("[LuaProxy] Index: Instance is null for key '%s'", Key ? Key : "");
+        lua_pushnil(L);
+        return 1;
+    }
+    if (!Key)
+    {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    if (!bUseAccessorCache)
+        return sol::stack::push(L, IndexUncached(sol::state_view(L), Self, Key));
+
+    const FLuaResolvedAccessor& Accessor = FindOrResolveAccessor(L, Self.Class, Key);
+    void* ValuePtr = reinterpret_cast<char*>(Self.Instance) + Accessor.Offset;
+
+    switch (Accessor.Kind)
+    {
+    case FLuaResolvedAccessor::EKind::Method:
+        return Accessor.Method.push(L);
+
+    case FLuaResolvedAccessor::EKind::BoundProperty:
+        if (Accessor.FastType != ELuaFastPropertyType::None)
+            return PushFastValue(L, Accessor.FastType, ValuePtr);
+        if (!Accessor.Getter.valid())
+            break;
+
+        // Call the getter on the calling thread; errors read as nil (same as the protected call before)
+        Accessor.Getter.push(L);
+        lua_pushvalue(L, 1);
+        if (lua_pcall(L, 1, 1, 0) != LUA_OK)
+        {
+            lua_pop(L, 1);
+            break;
+        }
+        return 1;
+
+    case FLuaResolvedAccessor::EKind::Reflected:
+        if (Accessor.FastType != ELuaFastPropertyType::None)
+            return PushFastValue(L, Accessor.FastType, ValuePtr);
+        return sol::stack::push(L, ReadReflectedProperty(sol::state_view(L), Self.Instance, Accessor.Property));
 
     default:
         break;
     }
+
+    lua_pushnil(L);
+    return 1;
+}
+
+// ===== NewIndex (Property Assignment) =====
+
+int LuaComponentProxy::NewIndex(lua_State* L)
+{
+    LuaComponentProxy& Self = sol::stack::get<LuaComponentProxy&>(L, 1);
+    const char* Key = lua_tostring(L, 2);
+
+    if (!Self.Instance || !Self.Class || !Key) return 0;
+
+    if (!bUseAccessorCache)
+    {
+        NewIndexUncached(sol::state_view(L), Self, Key, sol::stack::get<sol::object>(L, 3));
+        return 0;
+    }
+
+    const FLuaResolvedAccessor& Accessor = FindOrResolveAccessor(L, Self.Class, Key);
+    void* ValuePtr = reinterpret_cast<char*>(Self.Instance) + Accessor.Offset;
+
+    if (Accessor.Kind == FLuaResolvedAccessor::EKind::BoundProperty)
+    {
+        if (Accessor.bReadOnly)
+        {
+            UE_LOG("[LuaProxy] Attempted to set read-only property: %s", Key);
+            return 0;
+        }
+        if (Accessor.FastType != ELuaFastPropertyType::None && TryWriteFastValue(L, 3, Accessor.FastType, ValuePtr))
+            return 0;
+
+        if (Accessor.Setter.valid())
+        {
+            Accessor.Setter.push(L);
+            lua_pushvalue(L, 1);
+            lua_pushvalue(L, 3);
+            lua_call(L, 2, 0);
+        }
+        return 0;
+    }
+
+    if (!Accessor.Property) return 0;
+
+    if (Accessor.Kind == FLuaResolvedAccessor::EKind::Reflected && Accessor.FastType != ELuaFastPropertyType::None
+        && TryWriteFastValue(L, 3, Accessor.FastType, ValuePtr))
+        return 0;
+
+    WriteReflectedProperty(Self.Instance, Accessor.Property, sol::stack::get<sol::object>(L, 3));
+    return 0;
 }
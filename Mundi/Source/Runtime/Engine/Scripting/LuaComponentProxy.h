@@ -22,6 +22,40 @@ extern TMap<UClass*, FBoundClassDesc> GBoundClasses;
 
 void BuildBoundClass(UClass* Class);
 
+// ===== Typed Fast Paths =====
+
+/**
+ * Value types the proxy reads/writes by offset instead of calling the bound getter/setter.
+ * AddProperty records it in the descriptor ("fast_type", "offset"); reflected properties map from EPropertyType.
+ */
+enum class ELuaFastPropertyType : uint8
+{
+    None,
+    Bool,
+    Int32,
+    Float,
+    FVector,
+    FQuat
+};
+
+template<typename T>
+constexpr ELuaFastPropertyType GetLuaFastPropertyType()
+{
+    if constexpr (std::is_same_v<T, bool>) return ELuaFastPropertyType::Bool;
+    else if constexpr (std::is_same_v<T, int32>) return ELuaFastPropertyType::Int32;
+    else if constexpr (std::is_same_v<T, float>) return ELuaFastPropertyType::Float;
+    else if constexpr (std::is_same_v<T, FVector>) return ELuaFastPropertyType::FVector;
+    else if constexpr (std::is_same_v<T, FQuat>) return ELuaFastPropertyType::FQuat;
+    else return ELuaFastPropertyType::None;
+}
+
+// Byte offset of a data member (UObject classes use single non-virtual inheritance)
+template<typename C, typename T>
+size_t GetMemberOffset(T C::*MemberPtr)
+{
+    return reinterpret_cast<size_t>(&(reinterpret_cast<const volatile C*>(0)->*MemberPtr));
+}
+
 // ===== Main Proxy Class =====
 
 /**
@@ -41,6 +75,14 @@ struct LuaComponentProxy
     // Get raw UObject pointer
     UObject* Get() const { return Instance; }
 
-    static sol::object Index(sol::this_state LuaState, LuaComponentProxy& Self, const char* Key);
-    static void        NewIndex(LuaComponentProxy& Self, const char* Key, sol::object Obj);
+    // __index / __newindex (raw lua_CFunction: proxy at 1, key at 2, value at 3)
+    // Lookups are resolved once per (class, key) and cached; common value types skip sol::object and the bound getter/setter
+    static int Index(lua_State* L);
+    static int NewIndex(lua_State* L);
+
+    // Drop cached accessors (they hold Lua references). Called with FLuaBindRegistry::Reset before the state closes
+    static void ResetAccessorCache();
+
+    // false = resolve every access through the registry tables like before (benchmark comparison only)
+    static bool bUseAccessorCache;
 };
@@ -10,7 +10,13 @@ void FLuaCoroutineScheduler::ShutdownBeforeLuaClose()
 			Task.Co.abandon(); // Lua쪽 Coroutine 무력화 필수
 		}
 	}
-	Tasks.Empty(); 
+	Tasks.Empty();
+	FreeSlots.Empty();
+	ReadyTasks.Empty();
+	TimerQueue.Empty();
+	PredicateWaiters.Empty();
+	EventWaiters.Empty();
+	ResumeScratch.Empty();
 }
 
 FLuaCoroutineScheduler::FLuaCoroutineScheduler()
@@ -20,13 +26,32 @@ FLuaCoroutineScheduler::FLuaCoroutineScheduler()
 
 FLuaCoroHandle FLuaCoroutineScheduler::Register(sol::thread&& Thread, sol::coroutine&& Co, void* Owner)
 {
-	FCoroTask Task;
+	// 끝난 태스크 슬롯 재사용
+	int32 Slot = 0;
+	if (FreeSlots.Num() > 0)
+	{
+		Slot = FreeSlots.Pop();
+	}
+	else
+	{
+		Slot = Tasks.Num();
+		Tasks.Add(FCoroTask());
+	}
+
+	if (++NextId == 0)
+	{
+		++NextId;
+	}
+
+	FCoroTask& Task = Tasks[Slot];
 	Task.Thread = std::move(Thread); /* Thread Anchoring */
 	Task.Co     = std::move(Co);
 	Task.Owner  = Owner;
-	Task.Id     = ++NextId;
-	Tasks.push_back(std::move(Task));
-	
+	Task.Id     = NextId;
+
+	// 첫 재개는 다음 Process에서
+	ReadyTasks.Add({ Slot, Task.Id });
+
 	return FLuaCoroHandle{ Task.Id };
 }
 
@@ -38,113 +63,235 @@ void FLuaCoroutineScheduler::Tick(double DeltaTime)
 
 	Process(NowSeconds);
 }
+
 void FLuaCoroutineScheduler::Process(double Now)
 {
-	for (auto& task : Tasks)
+	// 이번 프레임에 재개할 태스크만 모음. 시간/이벤트 대기 중인 태스크는 보지 않음
+	ResumeScratch.Empty();
+
+	// 1. 새로 등록됐거나 대기 조건 없이 yield한 태스크
+	for (const FCoroWaiter& Waiter : ReadyTasks)
 	{
-		if (task.Finished)
+		if (IsWaiting(Waiter, EWaitType::None))
+		{
+			ResumeScratch.Add(Waiter);
+		}
+	}
+	ReadyTasks.Empty();
+
+	// 2. 깨어날 시간이 된 태스크만 힙에서 꺼냄
+	while (!TimerQueue.IsEmpty() && TimerQueue.top().WakeTime <= Now)
+	{
+		const FCoroWaiter Waiter = TimerQueue.top().Waiter;
+		TimerQueue.pop();
+		if (IsWaiting(Waiter, EWaitType::Time))
+		{
+			ResumeScratch.Add(Waiter);
+		}
+	}
+
+	// 3. 조건 대기: 조건을 만족했거나 취소된 태스크는 목록에서 뺌
+	for (int32 i = 0; i < PredicateWaiters.Num();)
+	{
+		const FCoroWaiter Waiter = PredicateWaiters[i];
+		if (!IsWaiting(Waiter, EWaitType::Predicate))
+		{
+			PredicateWaiters.RemoveAtSwap(i);
 			continue;
+		}
 
-		// 조건 충족 여부
-		switch (task.WaitType)
+		// 조건 람다가 Lua를 호출하는 동안 Tasks가 재할당될 수 있으므로 꺼내서 호출
+		std::function<bool()> Predicate = std::move(Tasks[Waiter.Slot].Predicate);
+		const bool bSatisfied = !Predicate || Predicate();
+		if (Tasks[Waiter.Slot].Id == Waiter.Id)
 		{
-		case EWaitType::Time:
-			// UE_LOG("Now=%.3f Wake=%.3f", TotalTime, task.WakeTime);
-			if (task.WakeTime > Now) continue;
-			break;
-		case EWaitType::Predicate:
-			// 람다 함수가 있지만, 조건이 달성 안 됐을 때
-			if (task.Predicate && !task.Predicate()) continue; 
-			break;
-			// case EWaitType::Event: // Event "Trigger"는 Tick 함수 내에서 조건 확인하지 않음
+			Tasks[Waiter.Slot].Predicate = std::move(Predicate);
+		}
+
+		if (!bSatisfied)
+		{
+			++i;
+			continue;
+		}
+		ResumeScratch.Add(Waiter);
+		PredicateWaiters.RemoveAtSwap(i);
+	}
+
+	// 4. 재개 (앞선 재개에서 취소된 태스크는 건너뜀)
+	for (const FCoroWaiter& Waiter : ResumeScratch)
+	{
+		const FCoroTask& Task = Tasks[Waiter.Slot];
+		if (Task.Id != Waiter.Id || Task.Finished)
+		{
+			continue;
 		}
+		Resume(Waiter, Now);
+	}
+}
+
+void FLuaCoroutineScheduler::Resume(const FCoroWaiter& Waiter, double Now)
+{
+	// 재개 중 새 코루틴이 등록되면 Tasks가 재할당될 수 있으므로 코루틴 핸들을 복사해서 호출
+	sol::coroutine Co = Tasks[Waiter.Slot].Co;
+	Tasks[Waiter.Slot].WaitType = EWaitType::None;
 
-		// 조건 충족 시 resume 실행
-		sol::protected_function_result Result = task.Co();
-		if (!Result.valid())
+	bool bFinished = false;
+	{
+		const int32 PrevRunningSlot = RunningSlot;
+		RunningSlot = Waiter.Slot;
+		sol::protected_function_result Result = Co();
+		RunningSlot = PrevRunningSlot;
+
+		FCoroTask& Task = Tasks[Waiter.Slot];
+		if (Task.Finished)
+		{
+			// 재개 중 CancelByOwner로 취소됨
+			bFinished = true;
+		}
+		else if (!Result.valid())
 		{
 			sol::error Err = Result;
 			UE_LOG("[Lua][error] Coroutine error: %s\n", Err.what());
-			task.Finished = true;
-			continue;
+			bFinished = true;
 		}
-		
 		// 이후 yield가 다시 올 경우, 다음 조건 실행 = 재세팅
-		if (Result.status() == sol::call_status::yielded)
+		else if (Result.status() == sol::call_status::yielded)
 		{
 			std::string Tag = Result.get<FString>(0); // 해당 Co의 첫번째 string 매개변수
 			if (Tag == "wait_time")
 			{
 				double Sec = Result.get<double>(1);
-				task.WaitType = EWaitType::Time;
-				task.WakeTime = Now + Sec;
+				Task.WaitType = EWaitType::Time;
+				Task.WakeTime = Now + Sec;
+				TimerQueue.Enqueue({ Task.WakeTime, Waiter });
 			}
 			else if (Tag == "wait_predicate")
 			{
-				sol::function Condition = Result.get<sol::function>(1); 
-				task.WaitType = EWaitType::Predicate;
-				task.Predicate = [Condition]()
+				sol::function Condition = Result.get<sol::function>(1);
+				Task.WaitType = EWaitType::Predicate;
+				Task.Predicate = [Condition]()
 				{
 					sol::protected_function_result Result = Condition();
-					if (!Result.valid()) return false; 
+					if (!Result.valid()) return false;
 					return Result.get<bool>();
 				};
+				PredicateWaiters.Add(Waiter);
 			}
 			else if (Tag == "wait_event")
 			{
-				task.WaitType = EWaitType::Event;
-				task.EventName = Result.get<FString>(1);
+				Task.WaitType = EWaitType::Event;
+				Task.EventName = Result.get<FString>(1);
+				EventWaiters[Task.EventName].Add(Waiter);
 			}
 			else
 			{
-				task.WaitType = EWaitType::None;
+				Task.WaitType = EWaitType::None;
+				ReadyTasks.Add(Waiter);
 			}
 		}
-		else if (Result.status() == sol::call_status::runtime)
+		else
 		{
-			task.Finished = true;
-		}
-		else if (Result.status() == sol::call_status::ok)
-		{
-			task.Finished = true;
-		}
-		else if (Result.status() == sol::call_status::file)
-		{
-			task.Finished = true;
-		}
-		else if (Result.status() == sol::call_status::memory)
-		{
-			task.Finished = true;
+			// ok / runtime / file / memory 등: 종료
+			bFinished = true;
 		}
 	}
+
+	if (bFinished)
+	{
+		ReleaseTask(Waiter.Slot);
+	}
 }
 
+bool FLuaCoroutineScheduler::IsWaiting(const FCoroWaiter& Waiter, EWaitType WaitType) const
+{
+	if (Waiter.Slot < 0 || Waiter.Slot >= Tasks.Num())
+	{
+		return false;
+	}
+
+	const FCoroTask& Task = Tasks[Waiter.Slot];
+	return Task.Id == Waiter.Id && !Task.Finished && Task.WaitType == WaitType;
+}
+
+void FLuaCoroutineScheduler::ReleaseTask(int32 Slot)
+{
+	Tasks[Slot] = FCoroTask(); // 참조 해제, Id = 0
+	FreeSlots.Add(Slot);
+}
 
 void FLuaCoroutineScheduler::AddCoroutine(sol::coroutine&& Co)
 {
-	Tasks.push_back({std::move(Co)});
+	Register(sol::thread(), std::move(Co), nullptr);
 }
 
 void FLuaCoroutineScheduler::TriggerEvent(const FString& EventName)
 {
-	for (auto& task : Tasks)
+	TArray<FCoroWaiter>* Found = EventWaiters.Find(EventName);
+	if (!Found)
 	{
-		if (task.Finished) continue;
-		if (task.WaitType != EWaitType::Event) continue;
-		if (task.EventName == EventName)
+		return;
+	}
+
+	// 재개 중 같은 이벤트를 다시 기다릴 수 있으므로 목록을 떼어 낸 뒤 재개
+	TArray<FCoroWaiter> Waiters = std::move(*Found);
+	EventWaiters.Remove(EventName);
+
+	for (const FCoroWaiter& Waiter : Waiters)
+	{
+		if (IsWaiting(Waiter, EWaitType::Event) && Tasks[Waiter.Slot].EventName == EventName)
 		{
-			task.WaitType = EWaitType::None;
-			task.Co(); // resume
+			Resume(Waiter, NowSeconds);
 		}
 	}
 }
 
 void FLuaCoroutineScheduler::CancelByOwner(void* Owner)
 {
-	for (auto& Task : Tasks) {
-		if (Task.Owner == Owner && !Task.Finished) {
+	for (int32 Slot = 0; Slot < Tasks.Num(); ++Slot)
+	{
+		FCoroTask& Task = Tasks[Slot];
+		if (Task.Id == 0 || Task.Finished || Task.Owner != Owner)
+		{
+			continue;
+		}
+
+		if (Slot == RunningSlot)
+		{
+			// 재개 중인 자기 자신: Resume이 끝난 뒤 슬롯 반환
 			Task.Finished = true;
-			Task.Co = sol::coroutine(); // 참조 해제
+			continue;
+		}
+
+		// 이벤트 대기 목록은 TriggerEvent에서만 비워지므로, 오지 않는 이벤트라면 여기서 빼지 않으면 영원히 남음
+		if (Task.WaitType == EWaitType::Event)
+		{
+			RemoveEventWaiter(Task.EventName, { Slot, Task.Id });
+		}
+		ReleaseTask(Slot);
+	}
+}
+
+void FLuaCoroutineScheduler::RemoveEventWaiter(const FString& EventName, const FCoroWaiter& Waiter)
+{
+	// TriggerEvent가 목록을 떼어 낸 뒤 재개 중이면 여기엔 없음 (떼어 낸 목록은 IsWaiting으로 걸러짐)
+	TArray<FCoroWaiter>* Found = EventWaiters.Find(EventName);
+	if (!Found)
+	{
+		return;
+	}
+
+	for (int32 Index = 0; Index < Found->Num(); ++Index)
+	{
+		const FCoroWaiter& Entry = (*Found)[Index];
+		if (Entry.Slot == Waiter.Slot && Entry.Id == Waiter.Id)
+		{
+			Found->RemoveAt(Index);	// 깨우는 순서 유지
+			break;
 		}
 	}
+
+	if (Found->IsEmpty())
+	{
+		EventWaiters.Remove(EventName);
+	}
 }
@@ -25,9 +25,32 @@ struct FCoroTask
     std::function<bool()> Predicate;// wait_until()
     std::string EventName;			// wait_event("Test")
     bool Finished = false;
+    uint32 Id = 0;                  // 0이면 빈 슬롯
+};
+
+// 대기 목록 항목. 슬롯은 재사용되므로 Id로 아직 같은 태스크인지 확인
+struct FCoroWaiter
+{
+    int32 Slot = -1;
     uint32 Id = 0;
 };
 
+struct FCoroTimer
+{
+    double WakeTime = 0.0;
+    FCoroWaiter Waiter;
+};
+
+// WakeTime이 빠른 순 (같으면 먼저 등록한 순)
+struct FCoroTimerCompare
+{
+    bool operator()(const FCoroTimer& A, const FCoroTimer& B) const
+    {
+        if (A.WakeTime != B.WakeTime) return A.WakeTime > B.WakeTime;
+        return A.Waiter.Id > B.Waiter.Id;
+    }
+};
+
 class FLuaCoroutineScheduler
 {
 public:
@@ -46,8 +69,25 @@ public:
 private:
     void Process(double Now);
 
+    // 태스크 재개 후 yield 태그에 맞는 대기 목록에 넣음. 끝났으면 슬롯 반환
+    void Resume(const FCoroWaiter& Waiter, double Now);
+
+    bool IsWaiting(const FCoroWaiter& Waiter, EWaitType WaitType) const;
+    void ReleaseTask(int32 Slot);
+
+    // 취소된 태스크를 이벤트 대기 목록에서 제거 (목록이 비면 이벤트 항목도 제거)
+    void RemoveEventWaiter(const FString& EventName, const FCoroWaiter& Waiter);
+
 private:
-    TArray<FCoroTask> Tasks;
+    // 대기 종류별로 따로 모아 두고 깨울 태스크만 찾으므로, 멈춰 있는 코루틴은 프레임 비용이 없음
+    TArray<FCoroTask> Tasks;                            // 슬롯 배열. 끝난 태스크 슬롯은 FreeSlots로 재사용
+    TArray<int32> FreeSlots;
+    TArray<FCoroWaiter> ReadyTasks;                     // 다음 Process에서 바로 재개 (새로 등록 / 대기 조건 없이 yield)
+    TQueue<FCoroTimer, EQueueMode::Priority, FCoroTimerCompare> TimerQueue;    // wait_time (WakeTime 최소 힙)
+    TArray<FCoroWaiter> PredicateWaiters;               // wait_predicate (매 프레임 조건 평가)
+    TMap<FString, TArray<FCoroWaiter>> EventWaiters;    // wait_event (TriggerEvent에서만 깨움)
+    TArray<FCoroWaiter> ResumeScratch;
+    int32 RunningSlot = -1;                             // 지금 재개 중인 슬롯 (자기 자신을 취소하면 재개가 끝난 뒤 반환)
     uint32 NextId = 0;
     
     double NowSeconds = 0.0;
@@ -9,7 +9,20 @@
 #include "CameraActor.h"
 #include "CameraComponent.h"
 #include "PlayerCameraManager.h"
+#include "PointLightComponent.h"
+#include "LuaScriptComponent.h"
+#include "DerivedDataCache.h"
+#include "PlatformTime.h"
+#include "WindowsMappedFile.h"
+#include "WindowsBinWriter.h"
 #include <tuple>
+#include <fstream>
+
+namespace
+{
+    // 바이트코드 엔트리 형식이 바뀌면 올림 (Lua 버전/타입 크기는 키에 따로 섞음)
+    constexpr uint32 LuaBytecodeCookVersion = 1;
+}
 
 sol::object MakeCompProxy(sol::state_view SolState, UObject* Instance, UClass* Class) {
     LuaComponentProxy Proxy;
@@ -631,7 +644,11 @@ void FLuaManager::ExposeGlobalFunctions()
 }
 
 bool FLuaManager::LoadScriptInto(sol::environment& Env, const FString& Path) {
-    auto Chunk = Lua->load_file(Path);
+    const FCompiledChunk* Compiled = FindOrCompileChunk(Path);
+    if (!Compiled) { return false; }
+
+    // 인스턴스마다 바이트코드에서 새 클로저를 만듦 (파일 읽기/파싱/컴파일 없음)
+    auto Chunk = Lua->load(Compiled->Bytecode.as_string_view(), Compiled->ChunkName, sol::load_mode::binary);
     if (!Chunk.valid()) { sol::error Err = Chunk; UE_LOG("[Lua][error] %s", Err.what()); return false; }
     
     sol::protected_function ProtectedFunc = Chunk;
@@ -641,6 +658,509 @@ bool FLuaManager::LoadScriptInto(sol::environment& Env, const FString& Path) {
     return true;
 }
 
+FString FLuaManager::GetBytecodeCachePath(const FString& Path)
+{
+    FDerivedDataKeyBuilder KeyBuilder(EDerivedDataType::LuaScript, LuaBytecodeCookVersion);
+    KeyBuilder.AddString(LUA_RELEASE);
+    KeyBuilder.AddUInt32(static_cast<uint32>(sizeof(lua_Integer) | (sizeof(lua_Number) << 8) | (sizeof(void*) << 16)));
+    KeyBuilder.AddString(Path);         // 청크 이름(에러 메시지의 파일명)이 바이트코드에 들어가므로 경로도 키에 포함
+    KeyBuilder.AddSourceFile(Path);
+    if (!KeyBuilder.HasAllSources())
+    {
+        return FString();
+    }
+    return FDerivedDataCache::GetInstance().GetEntryPath(EDerivedDataType::LuaScript, KeyBuilder.Build(), ".luac");
+}
+
+const FLuaManager::FCompiledChunk* FLuaManager::FindOrCompileChunk(const FString& Path)
+{
+    if (const FCompiledChunk* Found = CompiledChunks.Find(Path))
+    {
+        return Found;
+    }
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+
+    FCompiledChunk Compiled;
+    Compiled.ChunkName = "@" + Path;
+
+    // 1. DDC: 원본 내용이 같으면 저장해 둔 바이트코드를 그대로 사용 (로드만 해서 깨진 엔트리 확인)
+    const FString EntryPath = GetBytecodeCachePath(Path);
+    bool bFromCache = false;
+    std::error_code ErrorCode;
+    if (!EntryPath.empty() && fs::exists(fs::path(UTF8ToWide(EntryPath)), ErrorCode))
+    {
+        FWindowsMappedFile File(EntryPath);
+        if (File.IsOpen() && File.GetSize() > 0)
+        {
+            const std::byte* Data = reinterpret_cast<const std::byte*>(File.GetData());
+            Compiled.Bytecode = sol::bytecode(Data, Data + File.GetSize());
+            bFromCache = Lua->load(Compiled.Bytecode.as_string_view(), Compiled.ChunkName, sol::load_mode::binary).valid();
+        }
+        if (!bFromCache)
+        {
+            UE_LOG("[warning] [Lua] Cache corrupt: %s - recompiling", Path.c_str());
+        }
+    }
+
+    // 2. 미스: 원본을 컴파일하고 바이트코드를 DDC에 저장 (원본이 없으면 load_file 에러를 그대로 보고)
+    if (!bFromCache)
+    {
+        auto Chunk = Lua->load_file(Path);
+        if (!Chunk.valid()) { sol::error Err = Chunk; UE_LOG("[Lua][error] %s", Err.what()); return nullptr; }
+
+        sol::protected_function Function = Chunk;
+        Compiled.Bytecode = Function.dump();    // 디버그 정보는 유지 (에러 줄 번호)
+
+        if (!EntryPath.empty())
+        {
+            const FString TempPath = FDerivedDataCache::GetTempPath(EntryPath);
+            {
+                FWindowsBinWriter Writer(TempPath);
+                Writer.Serialize(const_cast<std::byte*>(Compiled.Bytecode.data()), static_cast<int64>(Compiled.Bytecode.size()));
+                Writer.Close();
+            }
+            FDerivedDataCache::CommitFile(TempPath, EntryPath);
+        }
+    }
+    FDerivedDataCache::GetInstance().RecordLookup(EDerivedDataType::LuaScript, bFromCache);
+
+    UE_LOG("[Lua] %s %s (%zu bytes) in %.2f ms", Path.c_str(), bFromCache ? "loaded from bytecode cache" : "compiled",
+        Compiled.Bytecode.size(), FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+
+    FCompiledChunk& Stored = CompiledChunks[Path];
+    Stored = std::move(Compiled);
+    return &Stored;
+}
+
+FLuaSpawnBenchmarkResult FLuaManager::RunSpawnBenchmark(int32 NumInstances)
+{
+    FLuaSpawnBenchmarkResult Result;
+    Result.NumInstances = std::max(NumInstances, 1);
+
+    // 1. 합성 스크립트: 게임플레이 스크립트처럼 함수/테이블 정의 위주 (최상위에서 엔진 API는 부르지 않음)
+    constexpr int32 NumHelpers = 120;
+    FString Source = "local Speed = 100\nState = { Count = 0, Items = {} }\n\n";
+    char Line[256];
+    for (int32 i = 0; i < NumHelpers; ++i)
+    {
+        snprintf(Line, sizeof(Line),
+            "function Helper%d(A, B)\n"
+            "    local Sum = 0\n"
+            "    for K = 1, A do Sum = Sum + (K * B + %d) %% 7 end\n"
+            "    if Sum > Speed then return Sum - Speed end\n"
+            "    return Sum + %d\n"
+            "end\n\n", i, i, i);
+        Source += Line;
+    }
+    Source += "function GetValue()\n    local Total = 0\n";
+    for (int32 i = 0; i < NumHelpers; ++i)
+    {
+        snprintf(Line, sizeof(Line), "    Total = Total + Helper%d(4, %d)\n", i, i + 1);
+        Source += Line;
+    }
+    Source += "    return Total\nend\n\n"
+        "function Bump()\n    State.Count = State.Count + 1\n    return State.Count\nend\n";
+    Result.ScriptBytes = static_cast<int32>(Source.size());
+
+    const FString ScriptPath = GCacheDir + "/LuaSpawnBenchmark.lua";
+    {
+        std::error_code ErrorCode;
+        fs::create_directories(fs::path(UTF8ToWide(GCacheDir)), ErrorCode);
+        std::ofstream File(UTF8ToWide(ScriptPath), std::ios::binary);
+        File.write(Source.data(), static_cast<std::streamsize>(Source.size()));
+    }
+
+    auto Call = [](sol::environment& Env, const char* Name) -> double
+    {
+        sol::protected_function Function = FLuaManager::GetFunc(Env, Name);
+        if (!Function.valid())
+        {
+            return -1.0;
+        }
+        auto CallResult = Function();
+        return CallResult.valid() ? CallResult.get<double>() : -1.0;
+    };
+
+    // 2. 기존 방식: 인스턴스마다 load_file (파일 읽기 + 컴파일)
+    sol::environment LegacyEnv;
+    uint64 Start = FPlatformTime::Cycles64();
+    for (int32 i = 0; i < Result.NumInstances; ++i)
+    {
+        LegacyEnv = CreateEnvironment();
+        auto Chunk = Lua->load_file(ScriptPath);
+        if (!Chunk.valid())
+        {
+            return Result;
+        }
+        sol::protected_function Function = Chunk;
+        sol::set_environment(LegacyEnv, Function);
+        Function();
+    }
+    Result.LegacyMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+    // 3. 캐시 미스 (DDC 엔트리를 지우고 컴파일) / DDC 히트 (메모리 캐시만 비우고 다시 찾음)
+    CompiledChunks.Remove(ScriptPath);
+    const FString EntryPath = GetBytecodeCachePath(ScriptPath);
+    {
+        std::error_code ErrorCode;
+        fs::remove(fs::path(UTF8ToWide(EntryPath)), ErrorCode);
+    }
+    Start = FPlatformTime::Cycles64();
+    const FCompiledChunk* Compiled = FindOrCompileChunk(ScriptPath);
+    Result.CompileMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+    if (!Compiled)
+    {
+        return Result;
+    }
+    Result.BytecodeBytes = static_cast<int32>(Compiled->Bytecode.size());
+
+    CompiledChunks.Remove(ScriptPath);
+    Start = FPlatformTime::Cycles64();
+    FindOrCompileChunk(ScriptPath);
+    Result.DiskCacheMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+    // 4. 캐시 사용: ULuaScriptComponent::BeginPlay와 같은 경로 (환경 생성 + LoadScriptInto)
+    sol::environment FirstEnv;
+    sol::environment CachedEnv;
+    Start = FPlatformTime::Cycles64();
+    for (int32 i = 0; i < Result.NumInstances; ++i)
+    {
+        CachedEnv = CreateEnvironment();
+        LoadScriptInto(CachedEnv, ScriptPath);
+        if (i == 0)
+        {
+            FirstEnv = CachedEnv;
+        }
+    }
+    Result.CachedMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+    // 5. 검증: 같은 값 + 인스턴스 환경이 서로 분리되어 있음 (한쪽 State 변경이 다른 쪽에 보이지 않아야 함)
+    const double LegacyValue = Call(LegacyEnv, "GetValue");
+    const double CachedValue = Call(CachedEnv, "GetValue");
+    Call(FirstEnv, "Bump");
+    Call(FirstEnv, "Bump");
+    const bool bIsolated = Result.NumInstances == 1 || (Call(CachedEnv, "Bump") == 1.0 && Call(FirstEnv, "Bump") == 3.0);
+    Result.bResultsMatch = LegacyValue >= 0.0 && LegacyValue == CachedValue && bIsolated;
+
+    CompiledChunks.Remove(ScriptPath);
+    return Result;
+}
+
+FLuaPropertyBenchmarkResult FLuaManager::RunPropertyBenchmark(int32 NumReads)
+{
+    FLuaPropertyBenchmarkResult Result;
+
+    // 반복 한 번에 프로퍼티 4개 (FVector, float, int, bool)
+    const int32 NumIterations = std::max(NumReads / 4, 1);
+    Result.NumReads = NumIterations * 4;
+
+    auto Chunk = Lua->load(
+        "local C, N = ...\n"
+        "local Sum = 0\n"
+        "for I = 1, N do\n"
+        "    local Location = C.RelativeLocation\n"
+        "    Sum = Sum + Location.X + C.Intensity + C.ShadowResolutionScale\n"
+        "    if C.bIsVisible then Sum = Sum + 1 end\n"
+        "end\n"
+        "return Sum\n",
+        "=LuaPropertyBenchmark");
+    if (!Chunk.valid())
+    {
+        return Result;
+    }
+    sol::protected_function ReadLoop = Chunk;
+
+    UPointLightComponent* Light = ObjectFactory::NewObject<UPointLightComponent>();
+    Light->RelativeLocation = FVector(1.0f, 2.0f, 3.0f);     // 월드 없이 쓰므로 트랜스폼 갱신 없이 값만
+    Light->SetIntensity(2.5f);
+    sol::object Proxy = MakeCompProxy(*Lua, Light, Light->GetClass());
+
+    auto Run = [&](bool bUseCache, double& OutMilliseconds) -> double
+    {
+        LuaComponentProxy::bUseAccessorCache = bUseCache;
+        const uint64 Start = FPlatformTime::Cycles64();
+        auto CallResult = ReadLoop(Proxy, NumIterations);
+        OutMilliseconds = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+        return CallResult.valid() ? CallResult.get<double>() : -1.0;
+    };
+
+    const double LegacySum = Run(false, Result.LegacyMS);
+    const double CachedSum = Run(true, Result.CachedMS);
+    LuaComponentProxy::bUseAccessorCache = true;
+    Result.bResultsMatch = LegacySum >= 0.0 && LegacySum == CachedSum;
+
+    Proxy = sol::nil;
+    ObjectFactory::DeleteObject(Light);
+    return Result;
+}
+
+int32 FLuaManager::RegisterTickBatch(const FString& ScriptPath)
+{
+    if (const int32* Found = TickBatchIndices.Find(ScriptPath))
+    {
+        return *Found;
+    }
+
+    FLuaTickBatch Batch;
+    Batch.ScriptPath = ScriptPath;
+    Batch.Instances = Lua->create_table();
+    Batch.DeltaTimes = Lua->create_table();
+    Batch.Locations = Lua->create_table();
+
+    const int32 BatchId = TickBatches.Emplace(std::move(Batch));
+    TickBatchIndices.Add(ScriptPath, BatchId);
+    return BatchId;
+}
+
+int32 FLuaManager::QueueBatchedTick(int32 BatchId, ULuaScriptComponent* Component, float DeltaSeconds)
+{
+    if (BatchId < 0 || BatchId >= TickBatches.Num())
+    {
+        return -1;
+    }
+    return TickBatches[BatchId].Queued.Add({ Component, DeltaSeconds });
+}
+
+void FLuaManager::CancelBatchedTick(int32 BatchId, int32 Slot)
+{
+    if (BatchId < 0 || BatchId >= TickBatches.Num())
+    {
+        return;
+    }
+
+    TArray<FLuaQueuedTick>& Queued = TickBatches[BatchId].Queued;
+    if (Slot >= 0 && Slot < Queued.Num())
+    {
+        Queued[Slot].Component = nullptr;
+    }
+}
+
+void FLuaManager::FlushBatchedTicks()
+{
+    // 스크립트가 SpawnPrefab 등으로 새 배치를 등록하면 TickBatches가 재할당되므로 인덱스로 순회
+    for (int32 BatchId = 0; BatchId < TickBatches.Num(); ++BatchId)
+    {
+        if (!TickBatches[BatchId].Queued.IsEmpty())
+        {
+            RunTickBatch(BatchId);
+        }
+    }
+}
+
+void FLuaManager::RunTickBatch(int32 BatchId)
+{
+    // 1. 살아 있는 인스턴스를 1..N으로 패킹 (TickBatch 함수는 첫 인스턴스 것)
+    sol::protected_function TickBatch;
+    FLuaTickBatch& Batch = TickBatches[BatchId];
+    Batch.PackedSlots.Empty();
+    Batch.PackedLocations.Empty();
+
+    const int32 NumQueued = Batch.Queued.Num();
+    for (int32 Slot = 0; Slot < NumQueued; ++Slot)
+    {
+        ULuaScriptComponent* Component = Batch.Queued[Slot].Component;
+        if (!Component)
+        {
+            continue;
+        }
+
+        AActor* Owner = Component->GetOwner();
+        const FVector Location = Owner ? Owner->GetActorLocation() : FVector(0.0f, 0.0f, 0.0f);
+        const int32 Index = Batch.PackedSlots.Add(Slot) + 1;
+
+        Batch.Instances.raw_set(Index, Component->Env);
+        Batch.DeltaTimes.raw_set(Index, Batch.Queued[Slot].DeltaSeconds);
+        Batch.Locations.raw_set(Index * 3 - 2, Location.X, Index * 3 - 1, Location.Y, Index * 3, Location.Z);
+        Batch.PackedLocations.Add(Location);
+
+        if (!TickBatch.valid())
+        {
+            TickBatch = Component->FuncTickBatch;
+        }
+    }
+
+    const int32 Count = Batch.PackedSlots.Num();
+    for (int32 Index = Count + 1; Index <= Batch.NumPacked; ++Index)
+    {
+        Batch.Instances.raw_set(Index, sol::lua_nil);
+        Batch.DeltaTimes.raw_set(Index, sol::lua_nil);
+        Batch.Locations.raw_set(Index * 3 - 2, sol::lua_nil, Index * 3 - 1, sol::lua_nil, Index * 3, sol::lua_nil);
+    }
+    Batch.NumPacked = Count;
+
+    // 2. 스크립트 종류당 한 번 호출
+    // 호출 중 스크립트가 스폰(BeginPlay -> RegisterTickBatch/QueueBatchedTick)하면 TickBatches나 Queued가
+    // 재할당될 수 있으므로 호출 뒤에는 Batch 참조를 버리고 BatchId로 다시 찾음
+    if (Count > 0 && TickBatch.valid())
+    {
+        sol::table Locations = Batch.Locations;
+        auto Result = TickBatch(Batch.Instances, Batch.DeltaTimes, Locations, Count);
+        FLuaTickBatch& CalledBatch = TickBatches[BatchId];
+        if (!Result.valid())
+        {
+            sol::error Err = Result;
+            UE_LOG("[Lua][error] %s (TickBatch: %s)\n", Err.what(), CalledBatch.ScriptPath.c_str());
+        }
+        else
+        {
+            // 3. 바뀐 위치만 한 번에 반영
+            // 호출 중 파괴된 인스턴스는 CleanupLuaResources -> CancelBatchedTick이 슬롯을 nullptr로 지우고,
+            // 파괴 예약만 된 액터(IsPendingDestroy)도 건너뜀
+            for (int32 i = 0; i < Count; ++i)
+            {
+                ULuaScriptComponent* Component = CalledBatch.Queued[CalledBatch.PackedSlots[i]].Component;
+                AActor* Owner = Component ? Component->GetOwner() : nullptr;
+                if (!Owner || Owner->IsPendingDestroy())
+                {
+                    continue;
+                }
+
+                const int32 Index = i + 1;
+                const FVector OldLocation = CalledBatch.PackedLocations[i];
+                const FVector NewLocation(
+                    Locations.raw_get<sol::optional<float>>(Index * 3 - 2).value_or(OldLocation.X),
+                    Locations.raw_get<sol::optional<float>>(Index * 3 - 1).value_or(OldLocation.Y),
+                    Locations.raw_get<sol::optional<float>>(Index * 3).value_or(OldLocation.Z));
+                if (NewLocation.X != OldLocation.X || NewLocation.Y != OldLocation.Y || NewLocation.Z != OldLocation.Z)
+                {
+                    Owner->SetActorLocation(NewLocation);
+                }
+            }
+        }
+    }
+
+    // 4. 이번 호출분만 대기열에서 비움 (다음 프레임 TickComponent가 다시 쌓음)
+    // 호출 중에 쌓인 항목은 앞으로 당겨 다음 Flush에서 처리
+    TArray<FLuaQueuedTick>& Queued = TickBatches[BatchId].Queued;
+    for (int32 Slot = 0; Slot < NumQueued; ++Slot)
+    {
+        if (Queued[Slot].Component)
+        {
+            Queued[Slot].Component->TickBatchSlot = -1;
+        }
+    }
+    Queued.erase(Queued.begin(), Queued.begin() + NumQueued);
+    for (int32 Slot = 0; Slot < Queued.Num(); ++Slot)
+    {
+        if (Queued[Slot].Component)
+        {
+            Queued[Slot].Component->TickBatchSlot = Slot;
+        }
+    }
+}
+
+bool FLuaManager::RunTickBatchReentrancySelfTest()
+{
+    // 인스턴스 4개 배치. TickBatch 안에서
+    //   - SpawnPrefab의 BeginPlay처럼 새 스크립트 경로 배치를 여러 개 등록 (TickBatches 재할당)
+    //   - 같은 스크립트 인스턴스를 하나 스폰해 대기열에 추가 (Queued 재할당)
+    //   - 2번 인스턴스를 파괴 (EndPlay -> CleanupLuaResources와 같은 순서로 CancelBatchedTick 후 삭제)
+    // 한 뒤 모든 인스턴스 Z를 1 올림. 살아 있는 원래 인스턴스만 이동하고 스폰한 인스턴스는 다음 Flush 대기열에 남아야 함
+    constexpr int32 NumInstances = 4;
+    constexpr int32 DestroyedIndex = 1;
+    const int32 NumBatchesBefore = TickBatches.Num();
+
+    TArray<AActor*> Actors;
+    TArray<ULuaScriptComponent*> Components;
+    auto SpawnInstance = [&]() -> ULuaScriptComponent*
+    {
+        AActor* Actor = ObjectFactory::NewObject<AActor>();
+        Actor->CreateDefaultSubobject<USceneComponent>("Root");
+        ULuaScriptComponent* Component = Actor->CreateDefaultSubobject<ULuaScriptComponent>("Script");
+        Component->Env = sol::environment(*Lua, sol::create, Lua->globals());
+        Actors.Add(Actor);
+        Components.Add(Component);
+        return Component;
+    };
+
+    const FString TestPath = "__TickBatchReentrancyTest__";
+    const int32 BatchId = RegisterTickBatch(TestPath);
+    ULuaScriptComponent* SpawnedComponent = nullptr;
+    bool bDestroyed = false;
+
+    std::function<void()> Reenter = [&]()
+    {
+        for (int32 Index = 0; Index < 64; ++Index)
+        {
+            RegisterTickBatch(TestPath + "/Spawned" + std::to_string(Index));
+        }
+
+        SpawnedComponent = SpawnInstance();
+        SpawnedComponent->FuncTickBatch = Components[0]->FuncTickBatch;
+        SpawnedComponent->TickBatchId = BatchId;
+        SpawnedComponent->TickBatchSlot = QueueBatchedTick(BatchId, SpawnedComponent, 0.0f);
+
+        ULuaScriptComponent* Victim = Components[DestroyedIndex];
+        CancelBatchedTick(Victim->TickBatchId, Victim->TickBatchSlot);
+        Victim->TickBatchId = -1;
+        Victim->TickBatchSlot = -1;
+        ObjectFactory::DeleteObject(Actors[DestroyedIndex]);
+        Actors[DestroyedIndex] = nullptr;
+        bDestroyed = true;
+    };
+
+    auto Chunk = Lua->load(
+        "local Reenter = ...\n"
+        "return function(Instances, DeltaTimes, Locations, Count)\n"
+        "    Reenter()\n"
+        "    for I = 1, Count do Locations[I * 3] = Locations[I * 3] + 1 end\n"
+        "end\n",
+        "=TickBatchReentrancyTest");
+    bool bPassed = Chunk.valid();
+    if (bPassed)
+    {
+        sol::protected_function Factory = Chunk;
+        auto FactoryResult = Factory(Reenter);
+        bPassed = FactoryResult.valid();
+        if (bPassed)
+        {
+            const sol::protected_function TickBatchFunc = FactoryResult;
+            for (int32 Index = 0; Index < NumInstances; ++Index)
+            {
+                ULuaScriptComponent* Component = SpawnInstance();
+                Component->FuncTickBatch = TickBatchFunc;
+                Component->TickBatchId = BatchId;
+                Component->TickBatchSlot = QueueBatchedTick(BatchId, Component, 1.0f / 60.0f);
+                Actors[Index]->SetActorLocation(FVector(static_cast<float>(Index), 0.0f, 0.0f));
+            }
+
+            RunTickBatch(BatchId);
+
+            bPassed = bDestroyed && SpawnedComponent && TickBatches.Num() > NumBatchesBefore + 64;
+            for (int32 Index = 0; Index < NumInstances && bPassed; ++Index)
+            {
+                if (Index != DestroyedIndex)
+                {
+                    bPassed = Actors[Index]->GetActorLocation().Z == 1.0f && Components[Index]->TickBatchSlot == -1;
+                }
+            }
+
+            // 호출 중 스폰한 인스턴스만 0번 슬롯으로 남아 있어야 함
+            const TArray<FLuaQueuedTick>& Queued = TickBatches[BatchId].Queued;
+            bPassed = bPassed && Queued.Num() == 1 && Queued[0].Component == SpawnedComponent
+                && SpawnedComponent->TickBatchSlot == 0 && Actors.Last()->GetActorLocation().Z == 0.0f;
+        }
+    }
+
+    // 정리 (테스트 배치 제거)
+    for (int32 Index = NumBatchesBefore; Index < TickBatches.Num(); ++Index)
+    {
+        TickBatchIndices.Remove(TickBatches[Index].ScriptPath);
+    }
+    TickBatches.SetNum(NumBatchesBefore);
+    for (int32 Index = 0; Index < Actors.Num(); ++Index)
+    {
+        if (Actors[Index])
+        {
+            Components[Index]->TickBatchId = -1;
+            Components[Index]->TickBatchSlot = -1;
+            ObjectFactory::DeleteObject(Actors[Index]);
+        }
+    }
+    return bPassed;
+}
+
 void FLuaManager::Tick(double DeltaSeconds)
 {
     CoroutineSchedular.Tick(DeltaSeconds);
@@ -651,6 +1171,20 @@ void FLuaManager::ShutdownBeforeLuaClose()
     CoroutineSchedular.ShutdownBeforeLuaClose();
     
     FLuaBindRegistry::Get().Reset();
+    LuaComponentProxy::ResetAccessorCache();
+
+    for (FLuaTickBatch& Batch : TickBatches)
+    {
+        for (FLuaQueuedTick& Queued : Batch.Queued)
+        {
+            if (Queued.Component)
+            {
+                Queued.Component->TickBatchSlot = -1;
+            }
+        }
+    }
+    TickBatches.Empty();
+    TickBatchIndices.Empty();
     
     SharedLib = sol::nil;
 }
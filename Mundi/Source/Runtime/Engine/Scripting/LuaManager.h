@@ -5,6 +5,36 @@
 namespace sol { class state; }
 using state = sol::state;
 
+class ULuaScriptComponent;
+
+/**
+ * @struct FLuaSpawnBenchmarkResult
+ * @brief FLuaManager::RunSpawnBenchmark 결과입니다. (같은 스크립트를 쓰는 인스턴스 N개의 BeginPlay 로드 비용)
+ */
+struct FLuaSpawnBenchmarkResult
+{
+    int32 NumInstances = 0;
+    int32 ScriptBytes = 0;
+    int32 BytecodeBytes = 0;
+    double LegacyMS = 0.0;          // 인스턴스마다 load_file (파일 읽기 + 컴파일)
+    double CompileMS = 0.0;         // 캐시 미스: 컴파일 + 바이트코드 DDC 저장 (경로당 한 번)
+    double DiskCacheMS = 0.0;       // DDC 히트: 바이트코드 파일 읽기 (다음 PIE/실행의 첫 로드)
+    double CachedMS = 0.0;          // 인스턴스마다 메모리 바이트코드 로드
+    bool bResultsMatch = false;     // 두 방식의 인스턴스가 같은 값을 돌려주고 환경이 서로 분리되어 있는지
+};
+
+/**
+ * @struct FLuaPropertyBenchmarkResult
+ * @brief FLuaManager::RunPropertyBenchmark 결과입니다. (Lua에서 컴포넌트 프로퍼티 N번 읽기)
+ */
+struct FLuaPropertyBenchmarkResult
+{
+    int32 NumReads = 0;
+    double LegacyMS = 0.0;          // 접근마다 바인딩 테이블 탐색 + 리플렉션 조회
+    double CachedMS = 0.0;          // (클래스, 키)별 캐시 + 오프셋 직접 읽기
+    bool bResultsMatch = false;     // 두 방식의 읽은 값 합이 같은지
+};
+
 class FLuaManager
 {
 public:
@@ -18,6 +48,7 @@ public:
     void ExposeAllComponentsToLua();
     void ExposeGlobalFunctions();
 
+    // Path 스크립트를 Env에서 실행. 컴파일은 경로당 한 번만 하고 인스턴스마다 바이트코드에서 새 청크를 만듦
     bool LoadScriptInto(sol::environment& Env, const FString& Path);
     
     // Env 테이블에서 Name(함수 이름) 키를 조회해서 함수로 캐스팅
@@ -28,11 +59,85 @@ public:
     
     class FLuaCoroutineScheduler& GetScheduler() { return CoroutineSchedular; }
 
+    /** @brief 합성 스크립트로 인스턴스마다 load_file 하던 기존 방식과 바이트코드 캐시의 스폰 시 로드 비용을 비교합니다. */
+    FLuaSpawnBenchmarkResult RunSpawnBenchmark(int32 NumInstances = 1000);
+
+    /** @brief 라이트 컴포넌트의 float/int/bool/FVector 프로퍼티를 Lua에서 읽는 비용을 접근자 캐시 유무로 비교합니다. */
+    FLuaPropertyBenchmarkResult RunPropertyBenchmark(int32 NumReads = 10000000);
+
+    /**
+     * 배치 틱 (스크립트가 TickBatch를 정의하면 사용, 같은 AI 스크립트를 쓰는 군중용)
+     * 인스턴스마다 Tick을 부르지 않고, 스크립트 경로별로 프레임당 한 번
+     *   TickBatch(Instances, DeltaTimes, Locations, Count)
+     * 를 호출. Instances[i]는 인스턴스 환경(Obj 등), DeltaTimes[i]는 그 인스턴스의 델타,
+     * Locations[3i-2 .. 3i]는 액터 위치(x, y, z)이고 바꾼 위치는 호출이 끝난 뒤 한 번에 SetActorLocation
+     * TickBatch의 _ENV는 첫 인스턴스 환경이므로 인스턴스 상태는 전역 대신 Instances[i]에서 읽고 씀
+     */
+    int32 RegisterTickBatch(const FString& ScriptPath);                                            // 배치 번호
+    int32 QueueBatchedTick(int32 BatchId, ULuaScriptComponent* Component, float DeltaSeconds);     // 이번 프레임 대기열 슬롯
+    void CancelBatchedTick(int32 BatchId, int32 Slot);                                             // 대기열에서 제외 (호출 전/중 파괴)
+
+    /** 쌓인 배치 틱을 스크립트 종류별로 한 번씩 호출 (UWorld::Tick에서 틱 그룹 뒤에 호출) */
+    void FlushBatchedTicks();
+
+    /**
+     * @brief TickBatch 호출 중 스폰(새 배치 등록 + 대기열 추가)과 인스턴스 파괴가 일어나도
+     *        위치 반영이 살아 있는 인스턴스에만 되고 대기열이 올바르게 남는지 검사합니다. (월드 없이 임시 액터 사용)
+     */
+    bool RunTickBatchReentrancySelfTest();
+
 private:
+    /**
+     * 경로별 컴파일 결과. Lua 5.4는 청크의 _ENV가 클로저 간에 공유되는 업밸류라서
+     * 함수 객체 하나를 여러 환경이 같이 쓸 수 없음 -> 바이트코드를 보관하고 인스턴스마다 load(binary)
+     */
+    struct FCompiledChunk
+    {
+        sol::bytecode Bytecode;
+        FString ChunkName;      // "@경로" (에러 메시지용)
+    };
+
+    /** 메모리 캐시 -> DDC(원본 내용 해시 키) -> 컴파일 순으로 찾음. 실패하면 nullptr */
+    const FCompiledChunk* FindOrCompileChunk(const FString& Path);
+
+    /** Path 스크립트의 DDC 바이트코드 엔트리 경로 (원본이 없으면 빈 문자열) */
+    static FString GetBytecodeCachePath(const FString& Path);
+
+    /**
+     * 대기열 항목. 컴포넌트는 파괴될 때 CleanupLuaResources에서 CancelBatchedTick을 불러야 하며,
+     * 그러면 TickBatch 호출 중이라도 이 포인터가 nullptr가 되어 위치 반영에서 빠짐
+     */
+    struct FLuaQueuedTick
+    {
+        ULuaScriptComponent* Component = nullptr;    // 호출 전/중에 파괴되면 nullptr
+        float DeltaSeconds = 0.0f;
+    };
+
+    /** 스크립트 경로 하나의 배치. Lua 테이블은 프레임마다 다시 만들지 않고 덮어씀 */
+    struct FLuaTickBatch
+    {
+        FString ScriptPath;
+        TArray<FLuaQueuedTick> Queued;
+        TArray<int32> PackedSlots;          // 패킹된 i번째 인스턴스의 Queued 인덱스
+        TArray<FVector> PackedLocations;    // 호출 전 위치 (바뀐 것만 반영)
+        sol::table Instances;
+        sol::table DeltaTimes;
+        sol::table Locations;
+        int32 NumPacked = 0;                // 지난 호출의 인스턴스 수 (남은 꼬리를 nil로 지움)
+    };
+
+    /** 배치 하나 호출. Lua가 TickBatches를 재할당할 수 있으므로 참조 대신 번호로 받음 */
+    void RunTickBatch(int32 BatchId);
+
     sol::state* Lua = nullptr;
     sol::table SharedLib;                         // 공용 유틸 테이블
 
     FLuaCoroutineScheduler CoroutineSchedular;    // 씬 단위 Coroutine Manager
+
+    TMap<FString, FCompiledChunk> CompiledChunks;   // 월드(PIE 세션) 단위라 세션 중에는 다시 검사하지 않음
+
+    TArray<FLuaTickBatch> TickBatches;
+    TMap<FString, int32> TickBatchIndices;          // 스크립트 경로 -> TickBatches 인덱스
 };
 
 // Helper function to wrap C++ object pointers in LuaComponentProxy for Lua
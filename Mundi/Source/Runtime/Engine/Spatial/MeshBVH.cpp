@@ -1,333 +1,927 @@
 ﻿#include "pch.h"
 #include "MeshBVH.h"
+#include "TaskScheduler.h"
+#include "PlatformTime.h"
+#include <immintrin.h>
+#include <random>
 
-void FMeshBVH::Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
+namespace
 {
-	TriIndices.Empty();
-	Nodes.Empty();
-	uint32 TriCount = Indices.Num() / 3;
-	if (TriCount == 0) return;
+	constexpr uint32 NumBins = 16;
+	constexpr uint32 LeafSize = 4;			// 이하이면 항상 리프
+	constexpr uint32 MaxLeafSize = 8;		// SAH가 분할보다 싸다고 판단하면 이 크기까지 리프 허용
+	constexpr float TraversalCost = 1.0f;	// 노드 방문 비용 (삼각형 교차 1회 기준)
+	constexpr uint32 MinTrisPerTask = 4096;	// 이보다 작은 서브트리는 한 태스크에서 직렬 빌드
+	constexpr int32 MinTrisPerChunk = 8192;
+	constexpr int32 MinNodesPerChunk = 4096;
+	constexpr int32 MinRaysPerChunk = 256;
+
+	// 빌드 중에만 쓰는 포인터 기반 노드 (평탄화 전)
+	struct FBuildNode
+	{
+		FAABB Bounds;
+		int32 Left = -1;
+		int32 Right = -1;
+		uint32 Start = 0;
+		uint32 Count = 0;
+		int32 SubtreeTask = -1;		// 병렬 빌드로 넘긴 서브트리 (상위 트리에서만 사용)
+	};
 
-	TriIndices.Reserve(TriCount);
-	for (uint32 t = 0; t < TriCount; ++t)
-		TriIndices.Add(t);
+	struct FSubtreeTask
+	{
+		uint32 Start;
+		uint32 Count;
+		uint32 Depth;
+		TArray<FBuildNode> Nodes;
+	};
 
-	BuildRecursive(0, TriCount, Vertices, Indices);
-}
+	struct FBin
+	{
+		FAABB Bounds;
+		uint32 Count = 0;
+	};
 
-// 삼각형과 맞을 경우 , BVH를 따라 내려가면서 교차 가능성 있는 노드만 검사한다. 
-// Möller–Trumbore로 교차 체크 ! 
-bool FMeshBVH::IntersectRay(const FRay& InLocalRay,
-	const TArray<FNormalVertex>& InVertices,
-	const TArray<uint32>& InIndices,
-	float& OutHitDistance)
-{
-	if (Nodes.Num() == 0)
+	inline FAABB MakeEmptyBounds()
 	{
-		return false;
+		return FAABB(FVector(FLT_MAX, FLT_MAX, FLT_MAX), FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX));
 	}
 
-	float RootEntry, RootExit;
-	if (!Nodes[0].Bounds.IntersectsRay(InLocalRay, RootEntry, RootExit))
+	inline void GrowBounds(FAABB& Bounds, const FAABB& Other)
 	{
-		return false;
+		Bounds.Min = Bounds.Min.ComponentMin(Other.Min);
+		Bounds.Max = Bounds.Max.ComponentMax(Other.Max);
 	}
 
-	struct FHeapItem
+	inline void GrowBounds(FAABB& Bounds, const FVector& Point)
 	{
-		int NodeIndex;
-		float EntryDistance;
+		Bounds.Min = Bounds.Min.ComponentMin(Point);
+		Bounds.Max = Bounds.Max.ComponentMax(Point);
+	}
 
-		bool operator>(const FHeapItem& Other) const
+	inline float SurfaceArea(const FAABB& Bounds)
+	{
+		const FVector Size = Bounds.Max - Bounds.Min;
+		if (Size.X < 0.0f || Size.Y < 0.0f || Size.Z < 0.0f)
 		{
-			return EntryDistance > Other.EntryDistance; // 최소 힙
+			return 0.0f;
 		}
-	};
-
-	std::priority_queue<FHeapItem, TArray<FHeapItem>, std::greater<FHeapItem>> Heap;
-	Heap.push({ 0, RootEntry });
+		return 2.0f * (Size.X * Size.Y + Size.Y * Size.Z + Size.Z * Size.X);
+	}
 
-	while (!Heap.empty())
+	class FMeshBVHBuilder
 	{
-		FHeapItem Current = Heap.top();
-		Heap.pop();
+	public:
+		FMeshBVHBuilder(TArray<uint32>& InTriIndices, const TArray<FAABB>& InTriBounds, const TArray<FVector>& InTriCenters)
+			: TriIndices(InTriIndices), TriBounds(InTriBounds), TriCenters(InTriCenters)
+		{
+		}
 
-		const FMeshBVHNode& Node = Nodes[Current.NodeIndex];
-		if (Node.IsLeaf())
+		// [Start, Start + Count) 범위의 서브트리를 OutNodes에 만들고 루트 인덱스를 반환
+		// OutTasks가 있으면 ParallelThreshold 이하 서브트리는 태스크로 넘기고 자리표시 노드만 남김
+		int32 BuildNode(TArray<FBuildNode>& OutNodes, uint32 Start, uint32 Count, uint32 Depth,
+			TArray<FSubtreeTask>* OutTasks = nullptr, uint32 ParallelThreshold = 0)
 		{
-			for (uint32 TriOffset = 0; TriOffset < Node.Count; ++TriOffset)
+			FBuildNode Node;
+			Node.Start = Start;
+			Node.Count = Count;
+
+			const int32 NodeIndex = OutNodes.Num();
+			if (OutTasks && Count <= ParallelThreshold)
 			{
-				const uint32 TriangleID = TriIndices[Node.Start + TriOffset];
-				const uint32 V0 = InIndices[3 * TriangleID + 0];
-				const uint32 V1 = InIndices[3 * TriangleID + 1];
-				const uint32 V2 = InIndices[3 * TriangleID + 2];
+				Node.SubtreeTask = OutTasks->Num();
+				OutTasks->Add({ Start, Count, Depth, {} });
+				OutNodes.Add(Node);
+				return NodeIndex;
+			}
 
-				const FVector& A = InVertices[V0].pos;
-				const FVector& B = InVertices[V1].pos;
-				const FVector& C = InVertices[V2].pos;
+			// 노드/중심 AABB (삼각형 AABB는 미리 계산되어 있음)
+			FAABB CenterBounds = MakeEmptyBounds();
+			Node.Bounds = MakeEmptyBounds();
+			for (uint32 Offset = 0; Offset < Count; ++Offset)
+			{
+				const uint32 TriangleID = TriIndices[Start + Offset];
+				GrowBounds(Node.Bounds, TriBounds[TriangleID]);
+				GrowBounds(CenterBounds, TriCenters[TriangleID]);
+			}
+			OutNodes.Add(Node);
 
-				float HitT = 0.0f;
-				if (IntersectRayTriangleMT(InLocalRay, A, B, C, HitT))
+			uint32 Mid = 0;
+			if (Count <= LeafSize || !FindSplit(Start, Count, Node.Bounds, CenterBounds, Depth, Mid))
+			{
+				return NodeIndex;
+			}
+
+			// 재귀 중 OutNodes가 재할당될 수 있으므로 인덱스로 기록
+			OutNodes[NodeIndex].Count = 0;
+			const int32 Left = BuildNode(OutNodes, Start, Mid - Start, Depth + 1, OutTasks, ParallelThreshold);
+			const int32 Right = BuildNode(OutNodes, Mid, Start + Count - Mid, Depth + 1, OutTasks, ParallelThreshold);
+			OutNodes[NodeIndex].Left = Left;
+			OutNodes[NodeIndex].Right = Right;
+			return NodeIndex;
+		}
+
+	private:
+		// @return false면 리프로 남김
+		bool FindSplit(uint32 Start, uint32 Count, const FAABB& NodeBounds, const FAABB& CenterBounds, uint32 Depth, uint32& OutMid)
+		{
+			const FVector CenterExtent = CenterBounds.Max - CenterBounds.Min;
+			const float NodeArea = SurfaceArea(NodeBounds);
+
+			if (Depth < FMeshBVH::MaxSahDepth && NodeArea > 0.0f)
+			{
+				float BestCost = FLT_MAX;
+				int32 BestAxis = -1;
+				uint32 BestSplit = 0;
+
+				for (int32 Axis = 0; Axis < 3; ++Axis)
 				{
-					OutHitDistance = HitT;
-					return true; // 🚀 첫 번째 히트 → 바로 종료
+					const float Extent = CenterExtent[Axis];
+					if (Extent <= KINDA_SMALL_NUMBER)
+					{
+						continue;
+					}
+
+					// 1. 중심 좌표로 구간에 삼각형 분배
+					FBin Bins[NumBins];
+					for (FBin& Bin : Bins)
+					{
+						Bin.Bounds = MakeEmptyBounds();
+					}
+					const float Scale = NumBins / Extent;
+					for (uint32 Offset = 0; Offset < Count; ++Offset)
+					{
+						const uint32 TriangleID = TriIndices[Start + Offset];
+						const uint32 BinIndex = std::min(NumBins - 1, static_cast<uint32>((TriCenters[TriangleID][Axis] - CenterBounds.Min[Axis]) * Scale));
+						Bins[BinIndex].Count++;
+						GrowBounds(Bins[BinIndex].Bounds, TriBounds[TriangleID]);
+					}
+
+					// 2. 왼쪽/오른쪽 누적으로 NumBins - 1개 분할면의 비용 계산
+					float LeftArea[NumBins - 1];
+					uint32 LeftCount[NumBins - 1];
+					FAABB Accum = MakeEmptyBounds();
+					uint32 AccumCount = 0;
+					for (uint32 Split = 0; Split < NumBins - 1; ++Split)
+					{
+						GrowBounds(Accum, Bins[Split].Bounds);
+						AccumCount += Bins[Split].Count;
+						LeftArea[Split] = SurfaceArea(Accum);
+						LeftCount[Split] = AccumCount;
+					}
+
+					Accum = MakeEmptyBounds();
+					AccumCount = 0;
+					for (uint32 Split = NumBins - 1; Split > 0; --Split)
+					{
+						GrowBounds(Accum, Bins[Split].Bounds);
+						AccumCount += Bins[Split].Count;
+						if (LeftCount[Split - 1] == 0 || AccumCount == 0)
+						{
+							continue;
+						}
+
+						const float Cost = TraversalCost + (LeftCount[Split - 1] * LeftArea[Split - 1] + AccumCount * SurfaceArea(Accum)) / NodeArea;
+						if (Cost < BestCost)
+						{
+							BestCost = Cost;
+							BestAxis = Axis;
+							BestSplit = Split;
+						}
+					}
 				}
+
+				if (BestAxis >= 0)
+				{
+					// 분할해도 더 싸지 않으면 리프 (리프 비용 = 삼각형 수)
+					if (Count <= MaxLeafSize && BestCost >= static_cast<float>(Count))
+					{
+						return false;
+					}
+
+					const float Scale = NumBins / CenterExtent[BestAxis];
+					const float AxisMin = CenterBounds.Min[BestAxis];
+					auto MidIt = std::partition(TriIndices.begin() + Start, TriIndices.begin() + Start + Count,
+						[&](uint32 TriangleID)
+						{
+							const uint32 BinIndex = std::min(NumBins - 1, static_cast<uint32>((TriCenters[TriangleID][BestAxis] - AxisMin) * Scale));
+							return BinIndex < BestSplit;
+						});
+					OutMid = static_cast<uint32>(MidIt - TriIndices.begin());
+					if (OutMid != Start && OutMid != Start + Count)
+					{
+						return true;
+					}
+				}
+			}
+
+			// 중앙값 분할: 깊이 제한 초과, 중심이 모두 한 점, 또는 SAH 분할이 한쪽으로 쏠린 경우
+			int32 Axis = 0;
+			if (CenterExtent.Y > CenterExtent.X && CenterExtent.Y >= CenterExtent.Z)
+			{
+				Axis = 1;
+			}
+			else if (CenterExtent.Z > CenterExtent.X && CenterExtent.Z >= CenterExtent.Y)
+			{
+				Axis = 2;
 			}
+
+			OutMid = Start + Count / 2;
+			std::nth_element(TriIndices.begin() + Start, TriIndices.begin() + OutMid, TriIndices.begin() + Start + Count,
+				[&](uint32 A, uint32 B)
+				{
+					return TriCenters[A][Axis] < TriCenters[B][Axis];
+				});
+			return true;
 		}
-		else
+
+		TArray<uint32>& TriIndices;
+		const TArray<FAABB>& TriBounds;
+		const TArray<FVector>& TriCenters;
+	};
+
+	// 빌드 트리를 DFS 순서로 평탄화 (왼쪽 자식 = 바로 다음 노드)
+	void Flatten(const TArray<FBuildNode>& SourceNodes, int32 SourceIndex, const TArray<FSubtreeTask>& Tasks, TArray<FMeshBVHNode>& OutNodes)
+	{
+		const FBuildNode& Source = SourceNodes[SourceIndex];
+		if (Source.SubtreeTask >= 0)
+		{
+			Flatten(Tasks[Source.SubtreeTask].Nodes, 0, Tasks, OutNodes);
+			return;
+		}
+
+		const uint32 OutIndex = static_cast<uint32>(OutNodes.Num());
+		FMeshBVHNode Node;
+		Node.Bounds = Source.Bounds;
+		Node.RightOrStart = Source.Start;
+		Node.Count = Source.Count;
+		OutNodes.Add(Node);
+
+		if (Source.Count > 0)
 		{
-			if (Node.Left >= 0)
+			return;
+		}
+
+		Flatten(SourceNodes, Source.Left, Tasks, OutNodes);
+		OutNodes[OutIndex].RightOrStart = static_cast<uint32>(OutNodes.Num());
+		Flatten(SourceNodes, Source.Right, Tasks, OutNodes);
+	}
+}
+
+namespace
+{
+	// 레이마다 한 번만 계산하는 순회 상수 (역방향, SSE 브로드캐스트)
+	struct FRayTraversalContext
+	{
+		FVector Origin;
+		FVector InvDirection;
+		__m128 OriginX, OriginY, OriginZ;
+		__m128 DirectionX, DirectionY, DirectionZ;
+
+		explicit FRayTraversalContext(const FRay& Ray)
+			: Origin(Ray.Origin)
+		{
+			// 0 성분은 아주 작은 값으로 바꿔 0 * inf = NaN을 피함
+			auto SafeInverse = [](float Value)
+				{
+					return 1.0f / (std::fabs(Value) > 1e-20f ? Value : std::copysign(1e-20f, Value));
+				};
+			InvDirection = FVector(SafeInverse(Ray.Direction.X), SafeInverse(Ray.Direction.Y), SafeInverse(Ray.Direction.Z));
+			OriginX = _mm_set1_ps(Ray.Origin.X);
+			OriginY = _mm_set1_ps(Ray.Origin.Y);
+			OriginZ = _mm_set1_ps(Ray.Origin.Z);
+			DirectionX = _mm_set1_ps(Ray.Direction.X);
+			DirectionY = _mm_set1_ps(Ray.Direction.Y);
+			DirectionZ = _mm_set1_ps(Ray.Direction.Z);
+		}
+	};
+
+	// 슬랩 테스트. [0, MaxDistance] 구간과 겹치면 진입 거리를 반환
+	inline bool IntersectBounds(const FAABB& Bounds, const FRayTraversalContext& Ray, float MaxDistance, float& OutEntry)
+	{
+		float TMin = 0.0f;
+		float TMax = MaxDistance;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			float T0 = (Bounds.Min[Axis] - Ray.Origin[Axis]) * Ray.InvDirection[Axis];
+			float T1 = (Bounds.Max[Axis] - Ray.Origin[Axis]) * Ray.InvDirection[Axis];
+			if (T0 > T1)
+			{
+				std::swap(T0, T1);
+			}
+			TMin = std::max(TMin, T0);
+			TMax = std::min(TMax, T1);
+		}
+		OutEntry = TMin;
+		return TMin <= TMax;
+	}
+
+	inline __m128 Dot3(__m128 AX, __m128 AY, __m128 AZ, __m128 BX, __m128 BY, __m128 BZ)
+	{
+		return _mm_add_ps(_mm_add_ps(_mm_mul_ps(AX, BX), _mm_mul_ps(AY, BY)), _mm_mul_ps(AZ, BZ));
+	}
+
+	// 삼각형 4개 Möller–Trumbore (IntersectRayTriangleMT와 같은 Epsilon 판정)
+	inline void IntersectPacket(const FMeshBVHTrianglePacket& Packet, const FRayTraversalContext& Ray, FMeshBVHHit& InOutHit)
+	{
+		const __m128 Epsilon = _mm_set1_ps(KINDA_SMALL_NUMBER);
+		const __m128 NegEpsilon = _mm_set1_ps(-KINDA_SMALL_NUMBER);
+		const __m128 OnePlusEpsilon = _mm_set1_ps(1.0f + KINDA_SMALL_NUMBER);
+
+		const __m128 Edge1X = _mm_load_ps(Packet.Edge1[0]);
+		const __m128 Edge1Y = _mm_load_ps(Packet.Edge1[1]);
+		const __m128 Edge1Z = _mm_load_ps(Packet.Edge1[2]);
+		const __m128 Edge2X = _mm_load_ps(Packet.Edge2[0]);
+		const __m128 Edge2Y = _mm_load_ps(Packet.Edge2[1]);
+		const __m128 Edge2Z = _mm_load_ps(Packet.Edge2[2]);
+
+		// P = Direction x Edge2, Determinant = Edge1 . P
+		const __m128 PX = _mm_sub_ps(_mm_mul_ps(Ray.DirectionY, Edge2Z), _mm_mul_ps(Ray.DirectionZ, Edge2Y));
+		const __m128 PY = _mm_sub_ps(_mm_mul_ps(Ray.DirectionZ, Edge2X), _mm_mul_ps(Ray.DirectionX, Edge2Z));
+		const __m128 PZ = _mm_sub_ps(_mm_mul_ps(Ray.DirectionX, Edge2Y), _mm_mul_ps(Ray.DirectionY, Edge2X));
+		const __m128 Determinant = Dot3(Edge1X, Edge1Y, Edge1Z, PX, PY, PZ);
+		__m128 Mask = _mm_or_ps(_mm_cmpgt_ps(Determinant, Epsilon), _mm_cmplt_ps(Determinant, NegEpsilon));
+		if (_mm_movemask_ps(Mask) == 0)
+		{
+			return;
+		}
+		const __m128 InvDeterminant = _mm_div_ps(_mm_set1_ps(1.0f), Determinant);
+
+		const __m128 SX = _mm_sub_ps(Ray.OriginX, _mm_load_ps(Packet.V0[0]));
+		const __m128 SY = _mm_sub_ps(Ray.OriginY, _mm_load_ps(Packet.V0[1]));
+		const __m128 SZ = _mm_sub_ps(Ray.OriginZ, _mm_load_ps(Packet.V0[2]));
+		const __m128 U = _mm_mul_ps(Dot3(SX, SY, SZ, PX, PY, PZ), InvDeterminant);
+		Mask = _mm_and_ps(Mask, _mm_and_ps(_mm_cmpge_ps(U, NegEpsilon), _mm_cmple_ps(U, OnePlusEpsilon)));
+
+		// Q = S x Edge1
+		const __m128 QX = _mm_sub_ps(_mm_mul_ps(SY, Edge1Z), _mm_mul_ps(SZ, Edge1Y));
+		const __m128 QY = _mm_sub_ps(_mm_mul_ps(SZ, Edge1X), _mm_mul_ps(SX, Edge1Z));
+		const __m128 QZ = _mm_sub_ps(_mm_mul_ps(SX, Edge1Y), _mm_mul_ps(SY, Edge1X));
+		const __m128 V = _mm_mul_ps(Dot3(Ray.DirectionX, Ray.DirectionY, Ray.DirectionZ, QX, QY, QZ), InvDeterminant);
+		Mask = _mm_and_ps(Mask, _mm_and_ps(_mm_cmpge_ps(V, NegEpsilon), _mm_cmple_ps(_mm_add_ps(U, V), OnePlusEpsilon)));
+
+		const __m128 T = _mm_mul_ps(Dot3(Edge2X, Edge2Y, Edge2Z, QX, QY, QZ), InvDeterminant);
+		Mask = _mm_and_ps(Mask, _mm_and_ps(_mm_cmpgt_ps(T, Epsilon), _mm_cmplt_ps(T, _mm_set1_ps(InOutHit.Distance))));
+
+		int32 LaneMask = _mm_movemask_ps(Mask);
+		if (LaneMask == 0)
+		{
+			return;
+		}
+
+		alignas(16) float Distances[4];
+		_mm_store_ps(Distances, T);
+		for (int32 Lane = 0; LaneMask != 0; ++Lane, LaneMask >>= 1)
+		{
+			if ((LaneMask & 1) && Distances[Lane] < InOutHit.Distance)
+			{
+				InOutHit.Distance = Distances[Lane];
+				InOutHit.TriangleID = Packet.TriangleIDs[Lane];
+			}
+		}
+	}
+
+	// 기존 방식 (벤치마크 비교용): 레이마다 힙을 할당하는 priority_queue 순회 + 삼각형마다 간접 참조, 첫 히트에서 종료
+	bool IntersectRayLegacy(const TArray<FMeshBVHNode>& Nodes, const TArray<uint32>& TriIndices,
+		const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices, const FRay& Ray, float& OutHitDistance)
+	{
+		FAABB RootBounds = Nodes[0].Bounds;
+		float RootEntry, RootExit;
+		if (!RootBounds.IntersectsRay(Ray, RootEntry, RootExit))
+		{
+			return false;
+		}
+
+		struct FHeapItem
+		{
+			uint32 NodeIndex;
+			float EntryDistance;
+
+			bool operator>(const FHeapItem& Other) const { return EntryDistance > Other.EntryDistance; }
+		};
+
+		std::priority_queue<FHeapItem, TArray<FHeapItem>, std::greater<FHeapItem>> Heap;
+		Heap.push({ 0, RootEntry });
+		while (!Heap.empty())
+		{
+			const FHeapItem Current = Heap.top();
+			Heap.pop();
+
+			const FMeshBVHNode& Node = Nodes[Current.NodeIndex];
+			if (Node.IsLeaf())
 			{
-				float ChildEntry, ChildExit;
-				if (Nodes[Node.Left].Bounds.IntersectsRay(InLocalRay, ChildEntry, ChildExit))
+				for (uint32 TriOffset = 0; TriOffset < Node.Count; ++TriOffset)
 				{
-					Heap.push({ Node.Left, ChildEntry });
+					const uint32 TriangleID = TriIndices[Node.RightOrStart + TriOffset];
+					float HitT = 0.0f;
+					if (IntersectRayTriangleMT(Ray, Vertices[Indices[3 * TriangleID + 0]].pos,
+						Vertices[Indices[3 * TriangleID + 1]].pos, Vertices[Indices[3 * TriangleID + 2]].pos, HitT))
+					{
+						OutHitDistance = HitT;
+						return true;
+					}
 				}
 			}
-			if (Node.Right >= 0)
+			else
 			{
-				float ChildEntry, ChildExit;
-				if (Nodes[Node.Right].Bounds.IntersectsRay(InLocalRay, ChildEntry, ChildExit))
+				const uint32 Children[2] = { Node.GetLeft(Current.NodeIndex), Node.GetRight() };
+				for (const uint32 Child : Children)
 				{
-					Heap.push({ Node.Right, ChildEntry });
+					FAABB ChildBounds = Nodes[Child].Bounds;
+					float ChildEntry, ChildExit;
+					if (ChildBounds.IntersectsRay(Ray, ChildEntry, ChildExit))
+					{
+						Heap.push({ Child, ChildEntry });
+					}
 				}
 			}
 		}
+		return false;
+	}
+}
+
+
+void FMeshBVH::Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
+{
+	TriIndices.Empty();
+	Nodes.Empty();
+	const uint32 TriCount = Indices.Num() / 3;
+	if (TriCount == 0) return;
+
+	// 1. 삼각형 AABB/중심을 한 번만 계산 (노드마다 정점을 다시 읽지 않음)
+	TArray<FAABB> TriBounds;
+	TArray<FVector> TriCenters;
+	TriBounds.SetNum(TriCount);
+	TriCenters.SetNum(TriCount);
+	TriIndices.SetNum(TriCount);
+
+	const int32 NumTris = static_cast<int32>(TriCount);
+	FTaskScheduler::ParallelFor(NumTris, FTaskScheduler::ComputeNumChunks(NumTris, MinTrisPerChunk),
+		[&](int32 ChunkIndex, int32 Begin, int32 End)
+		{
+			for (int32 TriangleID = Begin; TriangleID < End; ++TriangleID)
+			{
+				const FVector& A = Vertices[Indices[3 * TriangleID + 0]].pos;
+				const FVector& B = Vertices[Indices[3 * TriangleID + 1]].pos;
+				const FVector& C = Vertices[Indices[3 * TriangleID + 2]].pos;
+
+				FAABB Bounds(A, A);
+				GrowBounds(Bounds, B);
+				GrowBounds(Bounds, C);
+				TriBounds[TriangleID] = Bounds;
+				TriCenters[TriangleID] = (Bounds.Min + Bounds.Max) * 0.5f;
+				TriIndices[TriangleID] = static_cast<uint32>(TriangleID);
+			}
+		});
+
+	// 2. 상위 트리는 직렬로 분할하고, 충분히 작아진 서브트리는 태스크로 넘김
+	//    서브트리들은 TriIndices의 서로 겹치지 않는 구간만 재배치하므로 잠금 없이 병렬 빌드 가능
+	FMeshBVHBuilder Builder(TriIndices, TriBounds, TriCenters);
+	TArray<FBuildNode> TopNodes;
+	TArray<FSubtreeTask> Tasks;
+
+	const uint32 NumThreads = static_cast<uint32>(FTaskScheduler::GetNumWorkers()) + 1;
+	if (NumThreads > 1 && TriCount >= 2 * MinTrisPerTask)
+	{
+		const uint32 ParallelThreshold = std::max(MinTrisPerTask, TriCount / (4 * NumThreads));
+		Builder.BuildNode(TopNodes, 0, TriCount, 0, &Tasks, ParallelThreshold);
+
+		const int32 NumTasks = Tasks.Num();
+		FTaskScheduler::ParallelFor(NumTasks, FTaskScheduler::ComputeNumChunks(NumTasks, 1),
+			[&](int32 ChunkIndex, int32 Begin, int32 End)
+			{
+				for (int32 TaskIndex = Begin; TaskIndex < End; ++TaskIndex)
+				{
+					FSubtreeTask& Task = Tasks[TaskIndex];
+					Builder.BuildNode(Task.Nodes, Task.Start, Task.Count, Task.Depth);
+				}
+			});
+	}
+	else
+	{
+		Builder.BuildNode(TopNodes, 0, TriCount, 0);
 	}
 
-	return false;
+	// 3. DFS 순서로 평탄화
+	size_t TotalNodes = TopNodes.size();
+	for (const FSubtreeTask& Task : Tasks)
+	{
+		TotalNodes += Task.Nodes.size();
+	}
+	Nodes.Reserve(static_cast<int32>(TotalNodes));
+	Flatten(TopNodes, 0, Tasks, Nodes);
+
+	BuildPackets(Vertices, Indices);
 }
-//bool FMeshBVH::IntersectRay(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance)
-//{
-//	if (Nodes.Num() == 0)
-//	{
-//		return false;
-//	}
-//
-//	TArray<FStackItem> NodeStack;
-//
-//	float RootEntryDistance, RootExitDistance;
-//	// 루트 노드가 안맞으면 바로 리턴 
-//	if (!Nodes[0].Bounds.RayAABB_IntersectT(InLocalRay, RootEntryDistance, RootExitDistance))
-//	{
-//		return false;
-//	}
-//	// 가장 늦게 나간 RootEntryDistance
-//	// 삼각형 리스트 인덱스 , 디스턴스 값 저장 
-//	NodeStack.Add({ 0, RootEntryDistance });
-//	bool bHasHit = false;
-//	float ClosestHitDistance = std::numeric_limits<float>::infinity();
-//
-//	// 깊이 우선 탐색 (DFS). 
-//	// 이미 더 가까운 교차가 있으면 멀리 있는 노드는 스킵.
-//	while (!NodeStack.IsEmpty())
-//	{
-//		const FStackItem CurrentItem = NodeStack.Pop();
-//		// 이미 가까운 교차가 있으면 무시 
-//		if (CurrentItem.EntryDistance > ClosestHitDistance)
-//		{
-//			continue;
-//		}
-//
-//		const FMeshBVHNode& CurrentNode = Nodes[CurrentItem.NodeIndex];
-//		if (CurrentNode.IsLeaf())
-//		{
-//			// 총 삼각형의 개수 만큼 돈다. 
-//			for (uint32 TriangleOffset = 0; TriangleOffset < CurrentNode.Count; ++TriangleOffset)
-//			{
-//				// 삼각형 배열에서 시작 위치 Start, TriangleOffset 삼각형의 총 개수만큼 돈다. 
-//				// 그쪽 영역의 삼각형이기 때문이다
-//				const uint32 TriangleID = TriIndices[CurrentNode.Start + TriangleOffset];
-//
-//				const uint32 VertexIndex0 = InIndices[3 * TriangleID + 0];
-//				const uint32 VertexIndex1 = InIndices[3 * TriangleID + 1];
-//				const uint32 VertexIndex2 = InIndices[3 * TriangleID + 2];
-//
-//				const FVector& VertexA = InVertices[VertexIndex0].pos;
-//				const FVector& VertexB = InVertices[VertexIndex1].pos;
-//				const FVector& VertexC = InVertices[VertexIndex2].pos;
-//
-//				float HitDistance = 0.0f;
-//				if (IntersectRayTriangleMT(InLocalRay, VertexA, VertexB, VertexC, HitDistance))
-//				{
-//					if (HitDistance < ClosestHitDistance)
-//					{
-//						ClosestHitDistance = HitDistance;
-//						bHasHit = true;
-//					}
-//				}
-//			}
-//			continue;
-//		}
-//
-//		// 내부 노드 → 자식 검사
-//		// 삼각형에 맞으면, 검사 영역에 넣어주고 맞지 않으면 넣어주지 않는다. 
-//		if (CurrentNode.Left >= 0)
-//		{
-//			float ChildEntry, ChildExit;
-//			if (Nodes[CurrentNode.Left].Bounds.RayAABB_IntersectT(InLocalRay, ChildEntry, ChildExit))
-//			{
-//				NodeStack.Add({ CurrentNode.Left, ChildEntry });
-//			}
-//		}
-//		if (CurrentNode.Right >= 0)
-//		{
-//			float ChildEntry, ChildExit;
-//			if (Nodes[CurrentNode.Right].Bounds.RayAABB_IntersectT(InLocalRay, ChildEntry, ChildExit))
-//			{
-//				NodeStack.Add({ CurrentNode.Right, ChildEntry });
-//			}
-//		}
-//	}
-//
-//	if (bHasHit)
-//	{
-//		OutHitDistance = ClosestHitDistance;
-//		return true;
-//	}
-//	return false;
-//}
-
-FAABB FMeshBVH::ComputeTriBounds(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const
+
+bool FMeshBVH::InitializeFromCooked(const FMeshBVHNode* InNodes, uint32 NumNodes, const uint32* InTriIndices, uint32 NumTriIndices,
+	const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
 {
-	// TriangleID : 몇 번째 삼각형인지 (0번, 1번 , 2번)
-	uint32 VertexIndex0, VertexIndex1, VertexIndex2;
-
-	// 순차적으로 꺼내온다. 
-	VertexIndex0 = Indices[3 * TriangleID + 0];
-	VertexIndex1 = Indices[3 * TriangleID + 1];
-	VertexIndex2 = Indices[3 * TriangleID + 2];
-
-
-	// 실제 정점 좌표들을 가져온다. 
-	const FVector& VertexA = Vertices[VertexIndex0].pos;
-	const FVector& VertexB = Vertices[VertexIndex1].pos;
-	const FVector& VertexC = Vertices[VertexIndex2].pos;
-
-	// AABB 최소/최대 좌표 계산
-	FVector MinCorner(
-		std::min({ VertexA.X, VertexB.X, VertexC.X }),
-		std::min({ VertexA.Y, VertexB.Y, VertexC.Y }),
-		std::min({ VertexA.Z, VertexB.Z, VertexC.Z })
-	);
-
-	FVector MaxCorner(
-		std::max({ VertexA.X, VertexB.X, VertexC.X }),
-		std::max({ VertexA.Y, VertexB.Y, VertexC.Y }),
-		std::max({ VertexA.Z, VertexB.Z, VertexC.Z })
-	);
-
-	// 삼각형의 바운딩 박스 반환
-	return FAABB(MinCorner, MaxCorner);
+	Nodes.Empty();
+	TriIndices.Empty();
+	Packets.Empty();
+	LeafPacketStart.Empty();
+
+	const uint32 NumTriangles = static_cast<uint32>(Indices.Num() / 3);
+	if (!InNodes || !InTriIndices || NumNodes == 0 || NumTriIndices != NumTriangles)
+	{
+		return false;
+	}
+
+	// 손상된 캐시로 범위 밖을 읽지 않도록 구조 검증 (자식은 항상 뒤쪽 인덱스)
+	// 깊이도 MaxDepth 이하여야 순회 스택이 넘치지 않음
+	TArray<uint8> Depths;
+	Depths.SetNum(static_cast<int32>(NumNodes));
+	for (uint32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+	{
+		const FMeshBVHNode& Node = InNodes[NodeIndex];
+		if (Node.IsLeaf())
+		{
+			if (Node.RightOrStart > NumTriIndices || Node.Count > NumTriIndices - Node.RightOrStart)
+			{
+				return false;
+			}
+			continue;
+		}
+
+		if (NodeIndex + 1 >= NumNodes || Node.RightOrStart <= NodeIndex + 1 || Node.RightOrStart >= NumNodes
+			|| Depths[NodeIndex] >= MaxDepth)
+		{
+			return false;
+		}
+		const uint8 ChildDepth = static_cast<uint8>(Depths[NodeIndex] + 1);
+		Depths[NodeIndex + 1] = std::max(Depths[NodeIndex + 1], ChildDepth);
+		Depths[Node.RightOrStart] = std::max(Depths[Node.RightOrStart], ChildDepth);
+	}
+	for (uint32 Index = 0; Index < NumTriIndices; ++Index)
+	{
+		if (InTriIndices[Index] >= NumTriangles)
+		{
+			return false;
+		}
+	}
+
+	Nodes.assign(InNodes, InNodes + NumNodes);
+	TriIndices.assign(InTriIndices, InTriIndices + NumTriIndices);
+	BuildPackets(Vertices, Indices);
+	return true;
+}
+
+void FMeshBVH::BuildPackets(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
+{
+	// 리프마다 (Count + 3) / 4개 패킷. DFS 순서로 오프셋을 매긴 뒤 채우기는 병렬
+	const int32 NumNodes = Nodes.Num();
+	LeafPacketStart.SetNum(NumNodes);
+	uint32 NumPackets = 0;
+	for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+	{
+		LeafPacketStart[NodeIndex] = NumPackets;
+		if (Nodes[NodeIndex].IsLeaf())
+		{
+			NumPackets += (Nodes[NodeIndex].Count + 3) / 4;
+		}
+	}
+	Packets.Empty();
+	Packets.SetNum(static_cast<int32>(NumPackets));
+
+	FTaskScheduler::ParallelFor(NumNodes, FTaskScheduler::ComputeNumChunks(NumNodes, MinNodesPerChunk),
+		[&](int32 ChunkIndex, int32 Begin, int32 End)
+		{
+			for (int32 NodeIndex = Begin; NodeIndex < End; ++NodeIndex)
+			{
+				const FMeshBVHNode& Node = Nodes[NodeIndex];
+				if (!Node.IsLeaf())
+				{
+					continue;
+				}
+
+				const uint32 NumLanes = ((Node.Count + 3) / 4) * 4;
+				for (uint32 Lane = 0; Lane < NumLanes; ++Lane)
+				{
+					FMeshBVHTrianglePacket& Packet = Packets[LeafPacketStart[NodeIndex] + Lane / 4];
+					const uint32 PacketLane = Lane % 4;
+					if (Lane >= Node.Count)
+					{
+						// 빈 레인: 0으로 초기화된 Edge라 행렬식이 0 -> 교차하지 않음
+						Packet.TriangleIDs[PacketLane] = UINT32_MAX;
+						continue;
+					}
+
+					const uint32 TriangleID = TriIndices[Node.RightOrStart + Lane];
+					const FVector& A = Vertices[Indices[3 * TriangleID + 0]].pos;
+					const FVector Edge1 = Vertices[Indices[3 * TriangleID + 1]].pos - A;
+					const FVector Edge2 = Vertices[Indices[3 * TriangleID + 2]].pos - A;
+					for (int32 Axis = 0; Axis < 3; ++Axis)
+					{
+						Packet.V0[Axis][PacketLane] = A[Axis];
+						Packet.Edge1[Axis][PacketLane] = Edge1[Axis];
+						Packet.Edge2[Axis][PacketLane] = Edge2[Axis];
+					}
+					Packet.TriangleIDs[PacketLane] = TriangleID;
+				}
+			}
+		});
 }
 
-FVector FMeshBVH::ComputeTriCenter(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const
+// 가까운 자식부터 내려가는 고정 스택 순회. 먼 자식은 진입 거리와 함께 스택에 넣고,
+// 꺼낼 때 이미 찾은 최근접 히트보다 멀면 버린다.
+bool FMeshBVH::IntersectRay(const FRay& InLocalRay, FMeshBVHHit& OutHit) const
 {
-	// 삼각형을 구성하는 세 개의 정점 인덱스
-	const uint32 VertexIndex0 = Indices[TriangleID * 3 + 0];
-	const uint32 VertexIndex1 = Indices[TriangleID * 3 + 1];
-	const uint32 VertexIndex2 = Indices[TriangleID * 3 + 2];
+	OutHit = FMeshBVHHit();
+	if (Nodes.IsEmpty())
+	{
+		return false;
+	}
+
+	const FRayTraversalContext Ray(InLocalRay);
+	float RootEntry;
+	if (!IntersectBounds(Nodes[0].Bounds, Ray, FLT_MAX, RootEntry))
+	{
+		return false;
+	}
 
-	// 실제 좌표
-	const FVector& Position0 = Vertices[VertexIndex0].pos;
-	const FVector& Position1 = Vertices[VertexIndex1].pos;
-	const FVector& Position2 = Vertices[VertexIndex2].pos;
+	struct FStackEntry
+	{
+		uint32 NodeIndex;
+		float EntryDistance;
+	};
+	FStackEntry Stack[MaxDepth];
+	int32 StackSize = 0;
+	uint32 NodeIndex = 0;
 
-	// 중심점(무게중심) 계산
+	while (true)
+	{
+		const FMeshBVHNode& Node = Nodes[NodeIndex];
+		if (Node.IsLeaf())
+		{
+			const uint32 FirstPacket = LeafPacketStart[NodeIndex];
+			const uint32 EndPacket = FirstPacket + (Node.Count + 3) / 4;
+			for (uint32 PacketIndex = FirstPacket; PacketIndex < EndPacket; ++PacketIndex)
+			{
+				IntersectPacket(Packets[PacketIndex], Ray, OutHit);
+			}
+		}
+		else
+		{
+			const uint32 Left = Node.GetLeft(NodeIndex);
+			const uint32 Right = Node.GetRight();
+			float LeftEntry, RightEntry;
+			const bool bHitLeft = IntersectBounds(Nodes[Left].Bounds, Ray, OutHit.Distance, LeftEntry);
+			const bool bHitRight = IntersectBounds(Nodes[Right].Bounds, Ray, OutHit.Distance, RightEntry);
+
+			if (bHitLeft && bHitRight)
+			{
+				const bool bLeftFirst = LeftEntry <= RightEntry;
+				Stack[StackSize++] = bLeftFirst ? FStackEntry{ Right, RightEntry } : FStackEntry{ Left, LeftEntry };
+				NodeIndex = bLeftFirst ? Left : Right;
+				continue;
+			}
+			if (bHitLeft || bHitRight)
+			{
+				NodeIndex = bHitLeft ? Left : Right;
+				continue;
+			}
+		}
 
-	const FVector TriangleCenter = (Position0 + Position1 + Position2) / 3.0f;
+		// 스택에서 최근접 히트보다 가까운 노드를 꺼냄
+		bool bHasNext = false;
+		while (StackSize > 0)
+		{
+			const FStackEntry& Entry = Stack[--StackSize];
+			if (Entry.EntryDistance < OutHit.Distance)
+			{
+				NodeIndex = Entry.NodeIndex;
+				bHasNext = true;
+				break;
+			}
+		}
+		if (!bHasNext)
+		{
+			break;
+		}
+	}
 
-	return TriangleCenter;
+	return OutHit.IsHit();
 }
 
-// 여러 삼각형을 한 번에 감싸는 AABB를 계산 
-FAABB FMeshBVH::ComputeBounds(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const
+bool FMeshBVH::IntersectRay(const FRay& InLocalRay, float& OutHitDistance) const
 {
-	// 첫 번째 삼각형 ID로 AABB 초기화 
-	FAABB Bounds = ComputeTriBounds(TriIndices[Start], Vertices, Indices);
-	// Start+1 ~ Start+Count-1 까지 모든 삼각형에 대해 반복 
-	// 가장 큰 MIN , MAX 찾아낸다. 
-	for (uint32 i = 1; i < Count; i++)
+	FMeshBVHHit Hit;
+	if (!IntersectRay(InLocalRay, Hit))
 	{
-		FAABB TB = ComputeTriBounds(TriIndices[Start + i], Vertices, Indices);
-		Bounds.Min = Bounds.Min.ComponentMin(TB.Min);
-		Bounds.Max = Bounds.Max.ComponentMax(TB.Max);
+		return false;
 	}
-	return Bounds;
+	OutHitDistance = Hit.Distance;
+	return true;
 }
 
-// BVH 트리 -> 재귀 구축 
-int FMeshBVH::BuildRecursive(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
+int32 FMeshBVH::IntersectRays(const FRay* InLocalRays, int32 NumRays, FMeshBVHHit* OutHits) const
 {
-	FMeshBVHNode Node;
-	Node.Start = Start;
-	Node.Count = Count;
-
-	// 이 노드가 감싸는 AABB 계산
-	Node.Bounds = ComputeBounds(Start, Count, Vertices, Indices);
-
-	// 현재 노드 인덱스 확보 & 추가 -> 자식으로 쪼갤 때 사용 
-	int NodeIndex = Nodes.Num();
-	Nodes.Add(Node);
-
-	// 리프 조건: 삼각형 개수가 LeafSize 이하
-	if (Count <= LeafSize)
-	{
-		return NodeIndex;
-	}
-
-	// -------------------------------
-	// 분할 축 선택 (가장 긴 축)
-	// -------------------------------
-	FVector Extent = Node.Bounds.GetHalfExtent();
-	EAxis Axis = EAxis::X;
-
-	if (Extent.Y > Extent.X && Extent.Y >= Extent.Z)
-		Axis = EAxis::Y;
-	else if (Extent.Z > Extent.X && Extent.Z >= Extent.Y)
-		Axis = EAxis::Z;
-
-	// 중간 지점 -> 반으로 쪼갤 준비하기 
-	uint32 Mid = Start + Count / 2;
-
-	// -------------------------------
-	// 삼각형 중심 좌표 기준으로 분할
-	// -------------------------------
-	// 오른쪽 왼쪽으로 나누기 좋은 
-	// nth_element 가이드 
-	// nth_element(first, nth, last, comp)
-	// nth 위치에 "정렬했을 때 올 원소"를 제자리에 넣음
-	// 왼쪽 구간 [first, nth) 에는 그 원소보다 "작은 것들"만
-	// 오른쪽 구간 [nth+1, last) 에는 "큰 것들"만 놓음
-
-	// 선택된 Axis를 방향으로 왼쪽과 오른쪽으로 나눈다. 
-	// 전체를 정렬하지 않고, n번째 작은 원소를 찾아서 놓는다. 
-	std::nth_element(
-		TriIndices.begin() + Start, // 분할할 구간 시작
-		TriIndices.begin() + Mid, // 중간 값의 위치 
-		TriIndices.begin() + Start + Count, // 분할할 구간의 끝 
-		[&](uint32 A, uint32 B)			// 비교함수 
-		{
-			FVector CenterA = ComputeTriCenter(A, Vertices, Indices);
-			FVector CenterB = ComputeTriCenter(B, Vertices, Indices);
-
-			switch (Axis)
+	if (NumRays <= 0)
+	{
+		return 0;
+	}
+
+	const int32 NumChunks = FTaskScheduler::ComputeNumChunks(NumRays, MinRaysPerChunk);
+	TArray<int32> ChunkHits(NumChunks, 0);
+	FTaskScheduler::ParallelFor(NumRays, NumChunks,
+		[&](int32 ChunkIndex, int32 Begin, int32 End)
+		{
+			int32 NumHits = 0;
+			for (int32 RayIndex = Begin; RayIndex < End; ++RayIndex)
 			{
-			case EAxis::X: return CenterA.X < CenterB.X;
-			case EAxis::Y: return CenterA.Y < CenterB.Y;
-			case EAxis::Z: return CenterA.Z < CenterB.Z;
-			default:       return CenterA.X < CenterB.X;
+				NumHits += IntersectRay(InLocalRays[RayIndex], OutHits[RayIndex]) ? 1 : 0;
 			}
+			ChunkHits[ChunkIndex] = NumHits;
 		});
 
-	// -------------------------------
-	// 내부 노드로 전환 & 자식 생성
-	// -------------------------------
-	// 자식 생성으로 본인 Count 초기화.
-	// Left, Right에 자식 달기 
-	Nodes[NodeIndex].Count = 0;
-	Nodes[NodeIndex].Left = BuildRecursive(Start, Mid - Start, Vertices, Indices);
-	Nodes[NodeIndex].Right = BuildRecursive(Mid, Start + Count - Mid, Vertices, Indices);
+	int32 TotalHits = 0;
+	for (const int32 NumHits : ChunkHits)
+	{
+		TotalHits += NumHits;
+	}
+	return TotalHits;
+}
+
+void FMeshBVH::QueryTriangles(const FAABB& InLocalBounds, TArray<uint32>& OutTriangleIDs) const
+{
+	if (Nodes.IsEmpty() || !Nodes[0].Bounds.Intersects(InLocalBounds))
+	{
+		return;
+	}
+
+	uint32 Stack[MaxDepth];
+	int32 StackSize = 0;
+	Stack[StackSize++] = 0;
+
+	while (StackSize > 0)
+	{
+		const uint32 NodeIndex = Stack[--StackSize];
+		const FMeshBVHNode& Node = Nodes[NodeIndex];
+		if (!Node.IsLeaf())
+		{
+			const uint32 Left = Node.GetLeft(NodeIndex);
+			const uint32 Right = Node.GetRight();
+			if (Nodes[Left].Bounds.Intersects(InLocalBounds)) Stack[StackSize++] = Left;
+			if (Nodes[Right].Bounds.Intersects(InLocalBounds)) Stack[StackSize++] = Right;
+			continue;
+		}
+
+		// 리프 삼각형마다 패킷의 꼭짓점으로 AABB를 다시 검사 (리프 AABB만으로는 후보가 많음)
+		const uint32 FirstPacket = LeafPacketStart[NodeIndex];
+		const uint32 EndPacket = FirstPacket + (Node.Count + 3) / 4;
+		for (uint32 PacketIndex = FirstPacket; PacketIndex < EndPacket; ++PacketIndex)
+		{
+			const FMeshBVHTrianglePacket& Packet = Packets[PacketIndex];
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				if (Packet.TriangleIDs[Lane] == UINT32_MAX)
+				{
+					continue;
+				}
+
+				bool bOverlaps = true;
+				for (int32 Axis = 0; Axis < 3 && bOverlaps; ++Axis)
+				{
+					const float V0 = Packet.V0[Axis][Lane];
+					const float V1 = V0 + Packet.Edge1[Axis][Lane];
+					const float V2 = V0 + Packet.Edge2[Axis][Lane];
+					const float Min = std::min({ V0, V1, V2 });
+					const float Max = std::max({ V0, V1, V2 });
+					bOverlaps = Min <= InLocalBounds.Max[Axis] && Max >= InLocalBounds.Min[Axis];
+				}
+				if (bOverlaps)
+				{
+					OutTriangleIDs.Add(Packet.TriangleIDs[Lane]);
+				}
+			}
+		}
+	}
+}
+
+FMeshBVHBenchmarkResult FMeshBVH::RunBenchmark(int32 NumTriangles, int32 NumRays)
+{
+	FMeshBVHBenchmarkResult Result;
+	if (NumTriangles <= 0 || NumRays <= 0)
+	{
+		return Result;
+	}
+
+	// 1. 합성 메시: 반지름 100인 UV 구 (Rings x Segments x 2 삼각형)
+	const int32 Segments = std::max(4, static_cast<int32>(std::sqrt(NumTriangles)));
+	const int32 Rings = std::max(2, NumTriangles / (2 * Segments));
+	TArray<FNormalVertex> Vertices;
+	TArray<uint32> Indices;
+	Vertices.SetNum((Rings + 1) * (Segments + 1));
+	for (int32 Ring = 0; Ring <= Rings; ++Ring)
+	{
+		const float Theta = PI * Ring / Rings;
+		for (int32 Segment = 0; Segment <= Segments; ++Segment)
+		{
+			const float Phi = 2.0f * PI * Segment / Segments;
+			Vertices[Ring * (Segments + 1) + Segment].pos = FVector(
+				100.0f * std::sin(Theta) * std::cos(Phi), 100.0f * std::sin(Theta) * std::sin(Phi), 100.0f * std::cos(Theta));
+		}
+	}
+	Indices.Reserve(Rings * Segments * 6);
+	for (int32 Ring = 0; Ring < Rings; ++Ring)
+	{
+		for (int32 Segment = 0; Segment < Segments; ++Segment)
+		{
+			const uint32 I0 = Ring * (Segments + 1) + Segment;
+			const uint32 I1 = I0 + Segments + 1;
+			Indices.Add(I0); Indices.Add(I1); Indices.Add(I0 + 1);
+			Indices.Add(I0 + 1); Indices.Add(I1); Indices.Add(I1 + 1);
+		}
+	}
+	Result.NumTriangles = Indices.Num() / 3;
+	Result.NumRays = NumRays;
+
+	FMeshBVH BVH;
+	{
+		const uint64 Start = FPlatformTime::Cycles64();
+		BVH.Build(Vertices, Indices);
+		Result.BuildMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	}
+	Result.NumNodes = BVH.Nodes.Num();
+
+	// 2. 구 바깥 임의 지점에서 구 내부 임의 지점을 향하는 레이 (대부분 히트, 일부는 빗나감)
+	std::mt19937 Random(12345);
+	std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+	TArray<FRay> Rays;
+	Rays.SetNum(NumRays);
+	for (FRay& Ray : Rays)
+	{
+		FVector Origin(Unit(Random), Unit(Random), Unit(Random));
+		Origin = Origin.GetSafeNormal() * 300.0f;
+		const FVector Target(Unit(Random) * 120.0f, Unit(Random) * 120.0f, Unit(Random) * 120.0f);
+		Ray.Origin = Origin;
+		Ray.Direction = (Target - Origin).GetSafeNormal();
+	}
+
+	auto ToMRaysPerSec = [NumRays](double Milliseconds)
+		{
+			return Milliseconds > 0.0 ? NumRays / (Milliseconds * 1000.0) : 0.0;
+		};
+
+	// 3. 기존 priority_queue 순회
+	{
+		float HitDistance = 0.0f;
+		const uint64 Start = FPlatformTime::Cycles64();
+		for (const FRay& Ray : Rays)
+		{
+			IntersectRayLegacy(BVH.Nodes, BVH.TriIndices, Vertices, Indices, Ray, HitDistance);
+		}
+		Result.LegacyMRaysPerSec = ToMRaysPerSec(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start));
+	}
+
+	// 4. 스택 + 패킷 (단일 스레드)
+	TArray<FMeshBVHHit> SingleHits;
+	SingleHits.SetNum(NumRays);
+	{
+		const uint64 Start = FPlatformTime::Cycles64();
+		for (int32 RayIndex = 0; RayIndex < NumRays; ++RayIndex)
+		{
+			BVH.IntersectRay(Rays[RayIndex], SingleHits[RayIndex]);
+		}
+		Result.StackMRaysPerSec = ToMRaysPerSec(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start));
+	}
+
+	// 5. 배치 API
+	TArray<FMeshBVHHit> BatchHits;
+	BatchHits.SetNum(NumRays);
+	{
+		const uint64 Start = FPlatformTime::Cycles64();
+		Result.NumHits = BVH.IntersectRays(Rays.GetData(), NumRays, BatchHits.GetData());
+		Result.BatchMRaysPerSec = ToMRaysPerSec(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start));
+	}
+
+	// 6. 검증: 단일/배치 동일 + 앞쪽 레이 일부는 전수 검사 최근접과 비교
+	Result.bResultsMatch = true;
+	for (int32 RayIndex = 0; RayIndex < NumRays && Result.bResultsMatch; ++RayIndex)
+	{
+		Result.bResultsMatch = SingleHits[RayIndex].TriangleID == BatchHits[RayIndex].TriangleID
+			&& SingleHits[RayIndex].Distance == BatchHits[RayIndex].Distance;
+	}
+
+	const int32 NumVerifiedRays = std::min(NumRays, 64);
+	for (int32 RayIndex = 0; RayIndex < NumVerifiedRays && Result.bResultsMatch; ++RayIndex)
+	{
+		float BestDistance = FLT_MAX;
+		for (int32 TriangleID = 0; TriangleID < Result.NumTriangles; ++TriangleID)
+		{
+			float HitT = 0.0f;
+			if (IntersectRayTriangleMT(Rays[RayIndex], Vertices[Indices[3 * TriangleID + 0]].pos,
+				Vertices[Indices[3 * TriangleID + 1]].pos, Vertices[Indices[3 * TriangleID + 2]].pos, HitT))
+			{
+				BestDistance = std::min(BestDistance, HitT);
+			}
+		}
+
+		const FMeshBVHHit& Hit = SingleHits[RayIndex];
+		const bool bBruteForceHit = BestDistance < FLT_MAX;
+		Result.bResultsMatch = bBruteForceHit == Hit.IsHit()
+			&& (!bBruteForceHit || std::fabs(BestDistance - Hit.Distance) <= 1e-3f * std::max(1.0f, BestDistance));
+	}
 
-	return NodeIndex;
+	return Result;
 }
@@ -1,47 +1,104 @@
 ﻿#pragma once
 #include "AABB.h"
 
+// 깊이 우선(DFS) 순서로 평탄화된 노드. 왼쪽 자식은 항상 바로 다음 인덱스
 struct FMeshBVHNode
 {
-	FAABB Bounds;     // 이 노드가 감싸는 AABB
-	int Left = -1;     // 왼쪽 자식 인덱스
-	int Right = -1;    // 오른쪽 자식 인덱스
-	uint32 Start = 0;  // TriIndices 배열에서 시작 위치
-	uint32 Count = 0;  // 리프 노드라면 포함된 삼각형 개수 
+	FAABB Bounds;			// 이 노드가 감싸는 AABB
+	uint32 RightOrStart = 0; // 내부 노드: 오른쪽 자식 인덱스 / 리프: TriIndices 시작 위치
+	uint32 Count = 0;		// 리프 노드라면 포함된 삼각형 개수 (0이면 내부 노드)
 
 	bool IsLeaf() const { return Count > 0; }
+	uint32 GetLeft(uint32 NodeIndex) const { return NodeIndex + 1; }
+	uint32 GetRight() const { return RightOrStart; }
 };
+static_assert(sizeof(FMeshBVHNode) == 32, "FMeshBVHNode is stored as-is in the cooked mesh cache");
 
-struct FStackItem
+// 리프 삼각형 4개를 SoA로 미리 모아둔 패킷. Möller–Trumbore를 SSE로 4개 동시에 검사
+// (TriIndices -> Indices -> Vertices 간접 참조 없이 리프당 연속 메모리만 읽음)
+struct alignas(16) FMeshBVHTrianglePacket
 {
-	int32 NodeIndex;
-	float EntryDistance;
+	float V0[3][4];			// [축][레인]
+	float Edge1[3][4];
+	float Edge2[3][4];
+	uint32 TriangleIDs[4];	// 빈 레인은 UINT32_MAX (Edge가 0이라 교차하지 않음)
 };
+static_assert(sizeof(FMeshBVHTrianglePacket) == 160, "FMeshBVHTrianglePacket must stay 160 bytes (16-byte aligned lanes)");
+
+struct FMeshBVHHit
+{
+	float Distance = FLT_MAX;
+	uint32 TriangleID = UINT32_MAX;
+
+	bool IsHit() const { return TriangleID != UINT32_MAX; }
+};
+
+/**
+ * @struct FMeshBVHBenchmarkResult
+ * @brief FMeshBVH::RunBenchmark 결과입니다. 처리량은 초당 백만 레이(MRays/s)
+ */
+struct FMeshBVHBenchmarkResult
+{
+	int32 NumTriangles = 0;
+	int32 NumRays = 0;
+	int32 NumNodes = 0;
+	double BuildMS = 0.0;
+	double LegacyMRaysPerSec = 0.0;	// 기존 방식: priority_queue + 간접 참조 + 스칼라 삼각형 검사
+	double StackMRaysPerSec = 0.0;	// 고정 스택 + 가까운 자식 우선 + SoA 패킷 (단일 스레드)
+	double BatchMRaysPerSec = 0.0;	// IntersectRays (ParallelFor)
+	int32 NumHits = 0;
+	bool bResultsMatch = false;		// 단일/배치 결과가 같고, 일부 레이가 전수 검사 최근접과 같은지
+};
+
+/**
+ * @class FMeshBVH
+ * @brief 메시 피킹용 삼각형 BVH입니다.
+ *
+ * - Binned SAH(축마다 16개 구간)로 분할. 삼각형 AABB/중심은 빌드 시작 시 한 번만 계산
+ * - 큰 서브트리는 FTaskScheduler로 병렬 빌드한 뒤 DFS 순서로 평탄화
+ * - 노드/삼각형 순서 배열은 POD라서 쿠킹 메시 캐시(FCookedMeshSerializer)에 그대로 저장되고,
+ *   캐시 로드 시 빌드 없이 바로 사용
+ * - 레이 검사는 MaxDepth 크기 고정 스택으로 가까운 자식부터 내려가며, 현재 최근접 히트보다 먼 노드는 건너뜀
+ * - 리프 삼각형은 빌드/로드 시 FMeshBVHTrianglePacket으로 미리 모아둠 (캐시에는 저장하지 않음)
+ */
 class FMeshBVH
 {
 public:
+	// SAH 분할 최대 깊이. 이보다 깊으면 중앙값 분할로 전환해 트리 깊이를 MaxDepth 이하로 제한
+	static constexpr uint32 MaxSahDepth = 32;
+	static constexpr uint32 MaxDepth = 64;
 
 	void Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
 
-	bool IntersectRay(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance);
+	/** 쿠킹 캐시에서 읽은 노드/삼각형 순서로 초기화 (트리 빌드 없음, 삼각형 패킷만 다시 모음) */
+	bool InitializeFromCooked(const FMeshBVHNode* InNodes, uint32 NumNodes, const uint32* InTriIndices, uint32 NumTriIndices,
+		const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
 
+	/** 메시 로컬 공간 레이의 최근접 교차. 여러 스레드에서 동시에 호출 가능 */
+	bool IntersectRay(const FRay& InLocalRay, FMeshBVHHit& OutHit) const;
+	bool IntersectRay(const FRay& InLocalRay, float& OutHitDistance) const;
 
-private:
-	// Helper 함수들
-	FAABB ComputeTriBounds(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const;
+	/** 레이 여러 개를 한 번에 검사 (다중 피킹/파티클 충돌용). 많으면 FTaskScheduler로 나눠 처리. @return 히트 수 */
+	int32 IntersectRays(const FRay* InLocalRays, int32 NumRays, FMeshBVHHit* OutHits) const;
 
-	FVector ComputeTriCenter(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const;
+	/** 메시 로컬 공간 AABB와 겹치는 삼각형 ID를 OutTriangleIDs 뒤에 추가 (셰이프 스윕의 브로드 페이즈). 여러 스레드에서 동시에 호출 가능 */
+	void QueryTriangles(const FAABB& InLocalBounds, TArray<uint32>& OutTriangleIDs) const;
 
-	FAABB ComputeBounds(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const;
+	const TArray<FMeshBVHNode>& GetNodes() const { return Nodes; }
+	const TArray<uint32>& GetTriIndices() const { return TriIndices; }
+	bool IsEmpty() const { return Nodes.IsEmpty(); }
 
-	int BuildRecursive(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
+	/** @brief 합성 구 메시로 기존 priority_queue 순회와 스택/패킷 순회, 배치 API의 레이 처리량을 비교합니다. */
+	static FMeshBVHBenchmarkResult RunBenchmark(int32 NumTriangles = 1000000, int32 NumRays = 1000000);
 
 private:
+	void BuildPackets(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
 
 	TArray<FMeshBVHNode> Nodes;
-	//삼각형 ID(번호) 목록 , 삼각형의 인덱스를 의미한다. 
+	//삼각형 ID(번호) 목록 , 삼각형의 인덱스를 의미한다.
 	//삼각형 순서만 재배치  , 정점 좌표와 인덱스 버퍼를 직접적으로 건들면 안되기 때문이다.
 	TArray<uint32> TriIndices;
-	const uint32 LeafSize = 4;
-};
 
+	TArray<FMeshBVHTrianglePacket> Packets;
+	TArray<uint32> LeafPacketStart;	// 노드별 첫 패킷 인덱스 (리프만 유효, 패킷 수 = (Count + 3) / 4)
+};
@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "Object.h"
 #include "Vector.h"
+#include <mutex>
 
 class UPrimitiveComponent;
 class AStaticMeshActor;
@@ -56,6 +57,7 @@ private:
 	
 	TQueue<UPrimitiveComponent*> ComponentDirtyQueue; // 추가 혹은 갱신이 필요한 요소의 대기 큐
 	TSet<UPrimitiveComponent*> ComponentDirtySet;     // 더티 큐 중복 추가를 막기 위한 Set
+	std::mutex DirtyMutex;                             // 병렬 틱 중 MarkDirty 보호 (Update/Unregister는 게임 스레드에서만)
 	FOctree* SceneOctree = nullptr;
 	FBVHierarchy* BVH = nullptr;
 };
@@ -0,0 +1,95 @@
+#include "pch.h"
+#include "D3D11ParallelCommandBackend.h"
+#include "D3D11RHI.h"
+
+FD3D11ParallelCommandBackend::FD3D11ParallelCommandBackend(ID3D11Device* InDevice, ID3D11DeviceContext* InImmediateContext)
+	: Device(InDevice)
+	, ImmediateContext(InImmediateContext)
+{
+	if (!Device || !ImmediateContext)
+	{
+		return;
+	}
+
+	// 드라이버가 커맨드 리스트를 지원하지 않아도 런타임이 에뮬레이션하므로 녹화 자체는 가능하다.
+	// 에뮬레이션 시에는 제출 단계에서 재생 비용이 들기 때문에 로그로 남긴다.
+	D3D11_FEATURE_DATA_THREADING Threading = {};
+	if (SUCCEEDED(Device->CheckFeatureSupport(D3D11_FEATURE_THREADING, &Threading, sizeof(Threading))) && !Threading.DriverCommandLists)
+	{
+		UE_LOG("D3D11ParallelCommandBackend: 드라이버 커맨드 리스트 미지원 (런타임 에뮬레이션 사용)");
+	}
+	bSupported = true;
+}
+
+FD3D11ParallelCommandBackend::~FD3D11ParallelCommandBackend()
+{
+	Release();
+}
+
+void FD3D11ParallelCommandBackend::ResetPasses(int32 NumPasses, int32 NumSlots)
+{
+	// 슬롯 수만큼 Deferred Context 확보 (한번 만든 컨텍스트는 계속 재사용)
+	while (DeferredContexts.Num() < NumSlots)
+	{
+		ID3D11DeviceContext* DeferredContext = nullptr;
+		if (FAILED(Device->CreateDeferredContext(0, &DeferredContext)))
+		{
+			UE_LOG("D3D11ParallelCommandBackend: Deferred Context 생성 실패");
+			bSupported = false;
+			return;
+		}
+		DeferredContexts.Add(DeferredContext);
+	}
+
+	for (ID3D11CommandList*& CommandList : CommandLists)
+	{
+		if (CommandList) { CommandList->Release(); CommandList = nullptr; }
+	}
+	CommandLists.SetNum(NumPasses);
+	for (ID3D11CommandList*& CommandList : CommandLists)
+	{
+		CommandList = nullptr;
+	}
+}
+
+void FD3D11ParallelCommandBackend::BeginPassRecording(int32 PassIndex, int32 SlotIndex)
+{
+	D3D11RHI::SetThreadRecordingContext(DeferredContexts[SlotIndex]);
+}
+
+void FD3D11ParallelCommandBackend::EndPassRecording(int32 PassIndex, int32 SlotIndex)
+{
+	// FALSE: 다음 패스는 기본 상태에서 녹화를 시작한다 (패스마다 상태를 직접 설정하므로 복원 비용이 필요 없음)
+	DeferredContexts[SlotIndex]->FinishCommandList(FALSE, &CommandLists[PassIndex]);
+	D3D11RHI::SetThreadRecordingContext(nullptr);
+}
+
+void FD3D11ParallelCommandBackend::ExecutePass(int32 PassIndex)
+{
+	ID3D11CommandList*& CommandList = CommandLists[PassIndex];
+	if (!CommandList)
+	{
+		return;
+	}
+
+	// TRUE: 실행 후 Immediate Context의 기존 상태를 복원 (이후 직렬 패스가 이전 상태를 그대로 사용)
+	ImmediateContext->ExecuteCommandList(CommandList, TRUE);
+	CommandList->Release();
+	CommandList = nullptr;
+}
+
+void FD3D11ParallelCommandBackend::Release()
+{
+	for (ID3D11CommandList*& CommandList : CommandLists)
+	{
+		if (CommandList) { CommandList->Release(); CommandList = nullptr; }
+	}
+	CommandLists.Empty();
+
+	for (ID3D11DeviceContext*& DeferredContext : DeferredContexts)
+	{
+		if (DeferredContext) { DeferredContext->Release(); DeferredContext = nullptr; }
+	}
+	DeferredContexts.Empty();
+	bSupported = false;
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include "RHIPassScheduler.h"
+#include <d3d11.h>
+
+/**
+ * @class FD3D11ParallelCommandBackend
+ * @brief D3D11 Deferred Context로 패스를 녹화하는 백엔드입니다.
+ *        녹화 슬롯마다 Deferred Context를 하나씩 풀링하여 재사용하고,
+ *        패스마다 FinishCommandList로 만든 ID3D11CommandList를 Immediate Context에서 순서대로 실행합니다.
+ *
+ * 녹화 중인 스레드는 D3D11RHI::GetDeviceContext()가 해당 Deferred Context를 반환하므로
+ * 기존 RHI 헬퍼(RSSetState, SetAndUpdateConstantBuffer 등)를 그대로 사용할 수 있습니다.
+ */
+class FD3D11ParallelCommandBackend : public IRHIParallelCommandBackend
+{
+public:
+	FD3D11ParallelCommandBackend(ID3D11Device* InDevice, ID3D11DeviceContext* InImmediateContext);
+	~FD3D11ParallelCommandBackend() override;
+
+	bool SupportsParallelRecording() const override { return bSupported; }
+	void ResetPasses(int32 NumPasses, int32 NumSlots) override;
+	void BeginPassRecording(int32 PassIndex, int32 SlotIndex) override;
+	void EndPassRecording(int32 PassIndex, int32 SlotIndex) override;
+	void ExecutePass(int32 PassIndex) override;
+
+	void Release();
+
+private:
+	ID3D11Device* Device = nullptr;
+	ID3D11DeviceContext* ImmediateContext = nullptr;
+	bool bSupported = false;
+
+	TArray<ID3D11DeviceContext*> DeferredContexts;	// 슬롯별 (풀링)
+	TArray<ID3D11CommandList*> CommandLists;		// 패스별 (제출 후 해제)
+};
@@ -2,6 +2,7 @@
 #include "StatsOverlayD2D.h"
 #include "GameUI/SGameHUD.h"
 #include "Color.h"
+#include "D3D11ParallelCommandBackend.h"
 
 void D3D11RHI::Initialize(HWND hWindow)
 {
@@ -17,6 +18,9 @@ void D3D11RHI::Initialize(HWND hWindow)
 	CreateSamplerState();
     UResourceManager::GetInstance().Initialize(Device,DeviceContext);
 
+    // 패스 병렬 녹화용 Deferred Context 풀
+    ParallelCommandBackend = new FD3D11ParallelCommandBackend(Device, DeviceContext);
+
     // Initialize Direct2D overlay after device/swapchain ready
     UStatsOverlayD2D::Get().Initialize(Device, DeviceContext, SwapChain);
 
@@ -24,6 +28,30 @@ void D3D11RHI::Initialize(HWND hWindow)
     SGameHUD::Get().Initialize(Device, DeviceContext, SwapChain);
 }
 
+bool D3D11RHI::InitializeHeadless(UINT Width, UINT Height, bool bNullDriver)
+{
+    if (!CreateHeadlessDevice(Width, Height, bNullDriver))
+    {
+        return false;
+    }
+    bHeadless = true;
+
+    CreateFrameBuffer();
+    CreateIdBuffer();
+    CreateRasterizerState();
+    CreateBlendState();
+    CONSTANT_BUFFER_LIST(CREATE_CONSTANT_BUFFER);
+
+    CreateDepthStencilState();
+    CreateSamplerState();
+    UResourceManager::GetInstance().Initialize(Device, DeviceContext);
+
+    ParallelCommandBackend = new FD3D11ParallelCommandBackend(Device, DeviceContext);
+
+    // D2D 오버레이와 Game HUD는 스왑체인이 필요하므로 초기화하지 않음
+    return true;
+}
+
 void D3D11RHI::Release()
 {
     // Prevent double Release() calls
@@ -36,6 +64,13 @@ void D3D11RHI::Release()
     // Direct2D 오버레이를 먼저 정리하여 D3D 리소스에 대한 참조를 제거
     UStatsOverlayD2D::Get().Shutdown();
 
+    // Deferred Context / 커맨드 리스트는 디바이스보다 먼저 해제
+    if (ParallelCommandBackend)
+    {
+        delete ParallelCommandBackend;
+        ParallelCommandBackend = nullptr;
+    }
+
     if (DeviceContext)
     {
         // 파이프라인에서 바인딩된 상태/리소스를 명시적으로 해제
@@ -93,16 +128,16 @@ void D3D11RHI::ClearAllBuffer()
 {
     float ClearColor[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
     float ClearId[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
-    DeviceContext->ClearRenderTargetView(BackBufferRTV, ClearColor);
-    DeviceContext->ClearRenderTargetView(GetCurrentTargetRTV(), ClearId);
-    DeviceContext->ClearRenderTargetView(IdBufferRTV, ClearId);
+    GetDeviceContext()->ClearRenderTargetView(BackBufferRTV, ClearColor);
+    GetDeviceContext()->ClearRenderTargetView(GetCurrentTargetRTV(), ClearId);
+    GetDeviceContext()->ClearRenderTargetView(IdBufferRTV, ClearId);
     
     ClearDepthBuffer(1.0f, 0);                 // 깊이값 초기화
 }
 
 void D3D11RHI::ClearDepthBuffer(float Depth, UINT Stencil)
 {
-    DeviceContext->ClearDepthStencilView(DepthStencilView, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, Depth, Stencil);
+    GetDeviceContext()->ClearDepthStencilView(DepthStencilView, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, Depth, Stencil);
 }
 
 void D3D11RHI::CreateBlendState()
@@ -344,18 +379,23 @@ void D3D11RHI::ConstantBufferSet(ID3D11Buffer* ConstantBuffer, uint32 Slot, bool
 {
     if (bIsVS)
     {
-        DeviceContext->VSSetConstantBuffers(Slot, 1, &ConstantBuffer);
+        GetDeviceContext()->VSSetConstantBuffers(Slot, 1, &ConstantBuffer);
     }
     if (bIsPS)
     {
-        DeviceContext->PSSetConstantBuffers(Slot, 1, &ConstantBuffer);
+        GetDeviceContext()->PSSetConstantBuffers(Slot, 1, &ConstantBuffer);
     }
 }
 
 
 void D3D11RHI::IASetPrimitiveTopology()
 {
-    DeviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    GetDeviceContext()->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+}
+
+IRHIParallelCommandBackend* D3D11RHI::GetParallelCommandBackend()
+{
+    return ParallelCommandBackend;
 }
 
 void D3D11RHI::RSSetState(ERasterizerMode ViewMode)
@@ -363,38 +403,38 @@ void D3D11RHI::RSSetState(ERasterizerMode ViewMode)
 	switch (ViewMode)
 	{
 	case ERasterizerMode::Solid:
-		DeviceContext->RSSetState(DefaultRasterizerState);
+		GetDeviceContext()->RSSetState(DefaultRasterizerState);
         break;
 
 	case ERasterizerMode::Wireframe:
-		DeviceContext->RSSetState(WireFrameRasterizerState);
+		GetDeviceContext()->RSSetState(WireFrameRasterizerState);
         break;
 
 	case ERasterizerMode::Solid_NoCull:
-		DeviceContext->RSSetState(NoCullRasterizerState);
+		GetDeviceContext()->RSSetState(NoCullRasterizerState);
         break;
 
 	case ERasterizerMode::Wireframe_NoCull:
-		DeviceContext->RSSetState(WireFrameNoCullRasterizerState);
+		GetDeviceContext()->RSSetState(WireFrameNoCullRasterizerState);
         break;
 
 	case ERasterizerMode::Decal:
-		DeviceContext->RSSetState(DecalRasterizerState);
+		GetDeviceContext()->RSSetState(DecalRasterizerState);
         break;
 
 	case ERasterizerMode::Shadows:
-		DeviceContext->RSSetState(ShadowRasterizerState);
+		GetDeviceContext()->RSSetState(ShadowRasterizerState);
         break;
 
 	default:
-		DeviceContext->RSSetState(DefaultRasterizerState);
+		GetDeviceContext()->RSSetState(DefaultRasterizerState);
         break;
 	}
 }
 
 void D3D11RHI::RSSetViewport()
 {
-    DeviceContext->RSSetViewports(1, &ViewportInfo);
+    GetDeviceContext()->RSSetViewports(1, &ViewportInfo);
 }
 
 void D3D11RHI::SwapRenderTargets() // 이전의 SwapPostProcessTextures
@@ -438,7 +478,7 @@ ID3D11ShaderResourceView* D3D11RHI::GetSRV(RHI_SRV_Index SRVIndex) const
 
 void D3D11RHI::OMSetCustomRenderTargets(UINT NumRTVs, ID3D11RenderTargetView** RTVs, ID3D11DepthStencilView* DSV)
 {
-    DeviceContext->OMSetRenderTargets(NumRTVs, RTVs, DSV);
+    GetDeviceContext()->OMSetRenderTargets(NumRTVs, RTVs, DSV);
 }
 
 void D3D11RHI::SetViewportRenderTargetOverride(ID3D11RenderTargetView* RTV, ID3D11DepthStencilView* DSV)
@@ -461,46 +501,46 @@ void D3D11RHI::OMSetRenderTargets(ERTVMode RTVMode)
         // 뷰포트 렌더 타겟 오버라이드가 설정되어 있으면 그것을 사용
         if (ViewportRTVOverride)
         {
-            DeviceContext->OMSetRenderTargets(1, &ViewportRTVOverride, ViewportDSVOverride);
+            GetDeviceContext()->OMSetRenderTargets(1, &ViewportRTVOverride, ViewportDSVOverride);
         }
         else
         {
-            DeviceContext->OMSetRenderTargets(1, &BackBufferRTV, DepthStencilView);
+            GetDeviceContext()->OMSetRenderTargets(1, &BackBufferRTV, DepthStencilView);
         }
         break;
     case ERTVMode::BackBufferWithoutDepth:
         // 뷰포트 렌더 타겟 오버라이드가 설정되어 있으면 그것을 사용
         if (ViewportRTVOverride)
         {
-            DeviceContext->OMSetRenderTargets(1, &ViewportRTVOverride, nullptr);
+            GetDeviceContext()->OMSetRenderTargets(1, &ViewportRTVOverride, nullptr);
         }
         else
         {
-            DeviceContext->OMSetRenderTargets(1, &BackBufferRTV, nullptr);
+            GetDeviceContext()->OMSetRenderTargets(1, &BackBufferRTV, nullptr);
         }
         break;
     case ERTVMode::SceneColorTarget:
     {
         ID3D11RenderTargetView* CurrentTargetRTV = GetCurrentTargetRTV();
-        DeviceContext->OMSetRenderTargets(1, &CurrentTargetRTV, DepthStencilView);
+        GetDeviceContext()->OMSetRenderTargets(1, &CurrentTargetRTV, DepthStencilView);
         break;
     }
     case ERTVMode::SceneIdTarget:
     {
         ID3D11RenderTargetView* RTVList[2]{ nullptr, IdBufferRTV };
-        DeviceContext->OMSetRenderTargets(2, RTVList, DepthStencilView);
+        GetDeviceContext()->OMSetRenderTargets(2, RTVList, DepthStencilView);
         break;
     }
     case ERTVMode::SceneColorTargetWithId:
     {
         ID3D11RenderTargetView* RTVList[2]{ GetCurrentTargetRTV(), IdBufferRTV };
-        DeviceContext->OMSetRenderTargets(2, RTVList, DepthStencilView);
+        GetDeviceContext()->OMSetRenderTargets(2, RTVList, DepthStencilView);
         break;
     }
     case ERTVMode::SceneColorTargetWithoutDepth:
     {
         ID3D11RenderTargetView* CurrentTargetRTV = GetCurrentTargetRTV();
-        DeviceContext->OMSetRenderTargets(1, &CurrentTargetRTV, nullptr);
+        GetDeviceContext()->OMSetRenderTargets(1, &CurrentTargetRTV, nullptr);
         break;
     }
     default:
@@ -513,11 +553,11 @@ void D3D11RHI::OMSetBlendState(bool bIsBlendMode)
     if (bIsBlendMode == true)
     {
         float blendFactor[4] = { 0, 0, 0, 0 };
-        DeviceContext->OMSetBlendState(BlendStateTransparent, blendFactor, 0xffffffff);
+        GetDeviceContext()->OMSetBlendState(BlendStateTransparent, blendFactor, 0xffffffff);
     }
     else
     {
-        DeviceContext->OMSetBlendState(BlendStateOpaque, nullptr, 0xffffffff);
+        GetDeviceContext()->OMSetBlendState(BlendStateOpaque, nullptr, 0xffffffff);
     }
 }
 
@@ -526,13 +566,13 @@ void D3D11RHI::DrawFullScreenQuad()
 {
     // 1. 입력 버퍼를 사용하지 않겠다고 명시적으로 설정합니다.
     //    Input Assembler (IA) 단계가 사실상 생략됩니다.
-    DeviceContext->IASetVertexBuffers(0, 0, nullptr, nullptr, nullptr);
-    DeviceContext->IASetIndexBuffer(nullptr, DXGI_FORMAT_UNKNOWN, 0);
-    DeviceContext->IASetInputLayout(nullptr); // Input Layout도 필요 없습니다.
-    DeviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    GetDeviceContext()->IASetVertexBuffers(0, 0, nullptr, nullptr, nullptr);
+    GetDeviceContext()->IASetIndexBuffer(nullptr, DXGI_FORMAT_UNKNOWN, 0);
+    GetDeviceContext()->IASetInputLayout(nullptr); // Input Layout도 필요 없습니다.
+    GetDeviceContext()->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
     // 2. 정점 셰이더를 6번 실행하여 큰 삼각형 2개를 그리도록 명령합니다.
-    DeviceContext->Draw(6, 0);
+    GetDeviceContext()->Draw(6, 0);
 }
 
 void D3D11RHI::Present()
@@ -540,6 +580,12 @@ void D3D11RHI::Present()
     // Game HUD 렌더링 (Update는 SViewportWindow에서 처리)
     SGameHUD::Get().Render();
 
+    // 헤드리스: 화면 출력 없음
+    if (bHeadless)
+    {
+        return;
+    }
+
     // Draw any Direct2D overlays before present
     UStatsOverlayD2D::Get().Draw();
     SwapChain->Present(0, 0); // vsync on
@@ -579,13 +625,68 @@ void D3D11RHI::CreateDeviceAndSwapChain(HWND hWindow)
     ViewportInfo = { 0.0f, 0.0f, (float)swapchaindesc.BufferDesc.Width, (float)swapchaindesc.BufferDesc.Height, 0.0f, 1.0f };
 }
 
+bool D3D11RHI::CreateHeadlessDevice(UINT Width, UINT Height, bool bNullDriver)
+{
+    D3D_FEATURE_LEVEL featurelevels[] = { D3D_FEATURE_LEVEL_11_0 };
+    UINT createDeviceFlags = D3D11_CREATE_DEVICE_BGRA_SUPPORT;
+
+    // NULL 드라이버는 GPU 작업을 전혀 하지 않으므로 렌더 스레드 CPU 비용만 측정할 수 있다.
+    // NULL 드라이버는 SDK 레이어가 있어야 생성되므로 실패하면 WARP(CPU 래스터라이저)로 대체한다.
+    TArray<D3D_DRIVER_TYPE> DriverTypes;
+    if (bNullDriver)
+    {
+        DriverTypes.Add(D3D_DRIVER_TYPE_NULL);
+    }
+    DriverTypes.Add(D3D_DRIVER_TYPE_WARP);
+
+    HRESULT hr = E_FAIL;
+    for (D3D_DRIVER_TYPE Type : DriverTypes)
+    {
+        hr = D3D11CreateDevice(nullptr, Type, nullptr, createDeviceFlags,
+            featurelevels, ARRAYSIZE(featurelevels), D3D11_SDK_VERSION,
+            &Device, nullptr, &DeviceContext);
+        if (SUCCEEDED(hr))
+        {
+            DriverType = Type;
+            break;
+        }
+        UE_LOG("D3D11RHI: Headless device creation failed (DriverType: %d, hr: 0x%08X)", (int)Type, (unsigned)hr);
+    }
+    if (FAILED(hr))
+    {
+        return false;
+    }
+
+    // 스왑체인 백 버퍼 대신 사용할 오프스크린 텍스처 (SRGB RTV를 만들 수 있도록 TYPELESS)
+    D3D11_TEXTURE2D_DESC FrameBufferDesc = {};
+    FrameBufferDesc.Width = Width;
+    FrameBufferDesc.Height = Height;
+    FrameBufferDesc.MipLevels = 1;
+    FrameBufferDesc.ArraySize = 1;
+    FrameBufferDesc.Format = DXGI_FORMAT_B8G8R8A8_TYPELESS;
+    FrameBufferDesc.SampleDesc.Count = 1;
+    FrameBufferDesc.Usage = D3D11_USAGE_DEFAULT;
+    FrameBufferDesc.BindFlags = D3D11_BIND_RENDER_TARGET | D3D11_BIND_SHADER_RESOURCE;
+    if (FAILED(Device->CreateTexture2D(&FrameBufferDesc, nullptr, &FrameBuffer)))
+    {
+        UE_LOG("D3D11RHI: Headless FrameBuffer 생성 실패");
+        return false;
+    }
+
+    ViewportInfo = { 0.0f, 0.0f, (float)Width, (float)Height, 0.0f, 1.0f };
+    return true;
+}
+
 void D3D11RHI::CreateFrameBuffer()
 {
-    DXGI_SWAP_CHAIN_DESC swapDesc;
-    SwapChain->GetDesc(&swapDesc);
+    // 백 버퍼 가져오기 (헤드리스는 CreateHeadlessDevice에서 이미 생성)
+    if (SwapChain)
+    {
+        SwapChain->GetBuffer(0, __uuidof(ID3D11Texture2D), (void**)&FrameBuffer);
+    }
 
-    // 백 버퍼 가져오기
-    SwapChain->GetBuffer(0, __uuidof(ID3D11Texture2D), (void**)&FrameBuffer);
+    D3D11_TEXTURE2D_DESC FrameBufferDesc;
+    FrameBuffer->GetDesc(&FrameBufferDesc);
 
     // 렌더 타겟 뷰 생성
     D3D11_RENDER_TARGET_VIEW_DESC framebufferRTVdesc = {};
@@ -598,8 +699,8 @@ void D3D11RHI::CreateFrameBuffer()
     // 핑퐁(ping-pong) 버퍼 텍스처 생성 (SRV 지원)
     // =====================================
     D3D11_TEXTURE2D_DESC SceneDesc = {};
-    SceneDesc.Width = swapDesc.BufferDesc.Width;
-    SceneDesc.Height = swapDesc.BufferDesc.Height;
+    SceneDesc.Width = FrameBufferDesc.Width;
+    SceneDesc.Height = FrameBufferDesc.Height;
     SceneDesc.MipLevels = 1;
     SceneDesc.ArraySize = 1;
     SceneDesc.Format = DXGI_FORMAT_B8G8R8A8_TYPELESS;
@@ -649,8 +750,8 @@ void D3D11RHI::CreateFrameBuffer()
     // =====================================
 
     D3D11_TEXTURE2D_DESC depthDesc = {};
-    depthDesc.Width = swapDesc.BufferDesc.Width;
-    depthDesc.Height = swapDesc.BufferDesc.Height;
+    depthDesc.Width = FrameBufferDesc.Width;
+    depthDesc.Height = FrameBufferDesc.Height;
     depthDesc.MipLevels = 1;
     depthDesc.ArraySize = 1;
     depthDesc.Format = DXGI_FORMAT_R24G8_TYPELESS; // Typeless 포맷으로 변경
@@ -681,16 +782,16 @@ void D3D11RHI::CreateFrameBuffer()
 
 void D3D11RHI::CreateIdBuffer()
 {
-
-    DXGI_SWAP_CHAIN_DESC SwapDesc;
-    SwapChain->GetDesc(&SwapDesc);
+    // 백 버퍼와 같은 크기 (헤드리스 모드에서도 동일하게 동작하도록 스왑체인 대신 백 버퍼 텍스처에서 조회)
+    D3D11_TEXTURE2D_DESC FrameBufferDesc;
+    FrameBuffer->GetDesc(&FrameBufferDesc);
 
     D3D11_TEXTURE2D_DESC TextureDesc{};
     TextureDesc.Format = DXGI_FORMAT_R32_UINT;
     TextureDesc.CPUAccessFlags = 0;
     TextureDesc.Usage = D3D11_USAGE_DEFAULT;
-    TextureDesc.Width = SwapDesc.BufferDesc.Width;
-    TextureDesc.Height = SwapDesc.BufferDesc.Height;
+    TextureDesc.Width = FrameBufferDesc.Width;
+    TextureDesc.Height = FrameBufferDesc.Height;
     TextureDesc.MipLevels = 1;
     TextureDesc.ArraySize = 1;
     TextureDesc.SampleDesc.Count = 1;
@@ -796,11 +897,11 @@ void D3D11RHI::UpdateUVScrollConstantBuffers(const FVector2D& Speed, float TimeS
     struct { float x; float y; float t; float pad; } data { Speed.X, Speed.Y, TimeSec, 0.0f };
 
     D3D11_MAPPED_SUBRESOURCE mapped;
-    if (SUCCEEDED(DeviceContext->Map(UVScrollCB, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped)))
+    if (SUCCEEDED(GetDeviceContext()->Map(UVScrollCB, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped)))
     {
         memcpy(mapped.pData, &data, sizeof(data));
-        DeviceContext->Unmap(UVScrollCB, 0);
-        DeviceContext->PSSetConstantBuffers(5, 1, &UVScrollCB);
+        GetDeviceContext()->Unmap(UVScrollCB, 0);
+        GetDeviceContext()->PSSetConstantBuffers(5, 1, &UVScrollCB);
     }
 }
 
@@ -997,16 +1098,16 @@ void D3D11RHI::OMSetDepthStencilState(EComparisonFunc Func)
     switch (Func)
     {
     case EComparisonFunc::Always:
-        DeviceContext->OMSetDepthStencilState(DepthStencilStateAlwaysNoWrite, 0);
+        GetDeviceContext()->OMSetDepthStencilState(DepthStencilStateAlwaysNoWrite, 0);
         break;
     case EComparisonFunc::LessEqual:
-        DeviceContext->OMSetDepthStencilState(DepthStencilStateLessEqualWrite, 0);
+        GetDeviceContext()->OMSetDepthStencilState(DepthStencilStateLessEqualWrite, 0);
         break;
     case EComparisonFunc::GreaterEqual:
-        DeviceContext->OMSetDepthStencilState(DepthStencilStateGreaterEqualWrite, 0);
+        GetDeviceContext()->OMSetDepthStencilState(DepthStencilStateGreaterEqualWrite, 0);
         break;
     case EComparisonFunc::LessEqualReadOnly:
-        DeviceContext->OMSetDepthStencilState(DepthStencilStateLessEqualReadOnly, 0);
+        GetDeviceContext()->OMSetDepthStencilState(DepthStencilStateLessEqualReadOnly, 0);
         break;
     }
 }
@@ -1014,13 +1115,13 @@ void D3D11RHI::OMSetDepthStencilState(EComparisonFunc Func)
 void D3D11RHI::OMSetDepthStencilState_OverlayWriteStencil()
 {
     // Stencil ref = 1 (overlay marks)
-    DeviceContext->OMSetDepthStencilState(DepthStencilStateOverlayWriteStencil, 1);
+    GetDeviceContext()->OMSetDepthStencilState(DepthStencilStateOverlayWriteStencil, 1);
 }
 
 void D3D11RHI::OMSetDepthStencilState_StencilRejectOverlay()
 {
     // Stencil ref = 0 (draw only where overlay not marked)
-    DeviceContext->OMSetDepthStencilState(DepthStencilStateStencilRejectOverlay, 0);
+    GetDeviceContext()->OMSetDepthStencilState(DepthStencilStateStencilRejectOverlay, 0);
 }
 
 void D3D11RHI::CreateShader(ID3D11InputLayout** SimpleInputLayout, ID3D11VertexShader** SimpleVertexShader, ID3D11PixelShader** SimplePixelShader)
@@ -1171,17 +1272,17 @@ void D3D11RHI::SetViewport(UINT width, UINT height)
     ViewportInfo.MinDepth = 0.0f;
     ViewportInfo.MaxDepth = 1.0f;
 
-    DeviceContext->RSSetViewports(1, &ViewportInfo);
+    GetDeviceContext()->RSSetViewports(1, &ViewportInfo);
 }
 
 void D3D11RHI::PSSetDefaultSampler(UINT StartSlot)
 {
-	DeviceContext->PSSetSamplers(StartSlot, 1, &DefaultSamplerState);
+	GetDeviceContext()->PSSetSamplers(StartSlot, 1, &DefaultSamplerState);
 }
 
 void D3D11RHI::PSSetClampSampler(UINT StartSlot)
 {
-    DeviceContext->PSSetSamplers(StartSlot, 1, &LinearClampSamplerState);
+    GetDeviceContext()->PSSetSamplers(StartSlot, 1, &LinearClampSamplerState);
 }
 
 ID3D11SamplerState* D3D11RHI::GetSamplerState(RHI_Sampler_Index SamplerIndex) const
@@ -1276,10 +1377,10 @@ void D3D11RHI::UpdateStructuredBuffer(ID3D11Buffer* InBuffer, const void* InData
         return;
 
     D3D11_MAPPED_SUBRESOURCE mappedResource;
-    HRESULT hr = DeviceContext->Map(InBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
+    HRESULT hr = GetDeviceContext()->Map(InBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
     if (SUCCEEDED(hr))
     {
         memcpy(mappedResource.pData, InData, InDataSize);
-        DeviceContext->Unmap(InBuffer, 0);
+        GetDeviceContext()->Unmap(InBuffer, 0);
     }
 }
@@ -31,6 +31,8 @@ CreateConstantBuffer(&TYPE##Buffer, sizeof(TYPE));
 
 
 struct FLinearColor;
+class IRHIParallelCommandBackend;
+class FD3D11ParallelCommandBackend;
 
 enum class EComparisonFunc
 {
@@ -52,6 +54,16 @@ public:
 public:
 	void Initialize(HWND hWindow);
 
+	/**
+	 * @brief 창/스왑체인 없이 초기화합니다 (헤드리스 벤치마크용).
+	 *        백 버퍼는 오프스크린 텍스처로 대체하고, D2D 오버레이/HUD는 초기화하지 않습니다.
+	 * @param bNullDriver true면 D3D_DRIVER_TYPE_NULL(리소스 생성/API 호출만 처리, 래스터화 없음)을 사용하고,
+	 *        NULL 드라이버를 만들 수 없으면(SDK 레이어 미설치) WARP로 대체합니다.
+	 */
+	bool InitializeHeadless(UINT Width, UINT Height, bool bNullDriver);
+	bool IsHeadless() const { return bHeadless; }
+	D3D_DRIVER_TYPE GetDriverType() const { return DriverType; }
+
 	void Release();
 
 
@@ -93,21 +105,21 @@ public:
 		if (Data.empty()) { return; }
 
 		D3D11_MAPPED_SUBRESOURCE MSR;
-		DeviceContext->Map(VertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MSR);
+		GetDeviceContext()->Map(VertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MSR);
 
 		const size_t DataSizeInBytes = Data.size() * sizeof(TVertex);
 		memcpy(MSR.pData, Data.data(), DataSizeInBytes);
 
-		DeviceContext->Unmap(VertexBuffer, 0);
+		GetDeviceContext()->Unmap(VertexBuffer, 0);
 	}
 	template <typename T>
 	void ConstantBufferUpdate(ID3D11Buffer* ConstantBuffer, T& Data)
 	{
 		D3D11_MAPPED_SUBRESOURCE MSR;
 
-		DeviceContext->Map(ConstantBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MSR);
+		GetDeviceContext()->Map(ConstantBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MSR);
 		memcpy(MSR.pData, &Data, sizeof(T));
-		DeviceContext->Unmap(ConstantBuffer, 0);
+		GetDeviceContext()->Unmap(ConstantBuffer, 0);
 	}
 	template <typename T>
 	void ConstantBufferSetUpdate(ID3D11Buffer* ConstantBuffer, T& Data, const uint32 Slot, const bool bIsVS, const bool bIsPS)
@@ -186,10 +198,20 @@ public:
 	{
 		return Device;
 	}
+	// 현재 스레드가 패스를 녹화 중이면 그 Deferred Context를, 아니면 Immediate Context를 반환합니다.
+	// 상태 설정 헬퍼(RSSetState, SetAndUpdateConstantBuffer 등)가 모두 이 함수를 거치므로
+	// 기존 패스 코드를 그대로 워커 스레드에서 녹화할 수 있습니다.
 	inline ID3D11DeviceContext* GetDeviceContext()
 	{
-		return DeviceContext;
+		return ThreadRecordingContext ? ThreadRecordingContext : DeviceContext;
+	}
+	// FD3D11ParallelCommandBackend가 패스 녹화 시작/종료 시 호출
+	static void SetThreadRecordingContext(ID3D11DeviceContext* InContext)
+	{
+		ThreadRecordingContext = InContext;
 	}
+	// 패스 병렬 녹화 백엔드 (Deferred Context 풀)
+	IRHIParallelCommandBackend* GetParallelCommandBackend();
 	inline IDXGISwapChain* GetSwapChain()
 	{
 		return SwapChain;
@@ -200,6 +222,7 @@ public:
 
 private:
 	void CreateDeviceAndSwapChain(HWND hWindow); // 여기서 디바이스, 디바이스 컨택스트, 스왑체인, 뷰포트를 초기화한다
+	bool CreateHeadlessDevice(UINT Width, UINT Height, bool bNullDriver); // 스왑체인 대신 오프스크린 백 버퍼 생성
 	void CreateFrameBuffer();
 	void CreateIdBuffer();
 	void CreateRasterizerState();
@@ -286,7 +309,14 @@ private:
 
 	UShader* PreShader = nullptr; // Shaders, Inputlayout
 
+	// 스레드별 녹화 컨텍스트 (nullptr이면 Immediate Context 사용)
+	static inline thread_local ID3D11DeviceContext* ThreadRecordingContext = nullptr;
+
+	FD3D11ParallelCommandBackend* ParallelCommandBackend = nullptr;
+
 	bool bReleased = false; // Prevent double Release() calls
+	bool bHeadless = false; // 스왑체인 없이 초기화됨 (Present 생략)
+	D3D_DRIVER_TYPE DriverType = D3D_DRIVER_TYPE_HARDWARE;
 };
 
 
@@ -381,10 +411,28 @@ inline HRESULT D3D11RHI::CreateVertexBuffer<FVertexSimple>(ID3D11Device* device,
 }
 
 // PositionColorTextureNormal
+// FNormalVertex와 FVertexDynamic은 메모리 배치가 같으므로 변환 배열 없이 원본(쿠킹 캐시에서 읽은 배열)으로 바로 생성
 template<>
 inline HRESULT D3D11RHI::CreateVertexBuffer<FVertexDynamic>(ID3D11Device* device, const std::vector<FNormalVertex>& srcVertices, ID3D11Buffer** outBuffer)
 {
-	return CreateVertexBufferImpl<FVertexDynamic>(device, srcVertices, outBuffer, D3D11_USAGE_DEFAULT, 0);
+	static_assert(sizeof(FVertexDynamic) == sizeof(FNormalVertex)
+		&& offsetof(FVertexDynamic, Position) == offsetof(FNormalVertex, pos)
+		&& offsetof(FVertexDynamic, Normal) == offsetof(FNormalVertex, normal)
+		&& offsetof(FVertexDynamic, UV) == offsetof(FNormalVertex, tex)
+		&& offsetof(FVertexDynamic, Tangent) == offsetof(FNormalVertex, Tangent)
+		&& offsetof(FVertexDynamic, Color) == offsetof(FNormalVertex, color),
+		"FVertexDynamic must match FNormalVertex layout");
+
+	D3D11_BUFFER_DESC BufferDesc = {};
+	BufferDesc.Usage = D3D11_USAGE_DEFAULT;
+	BufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+	BufferDesc.CPUAccessFlags = 0;
+	BufferDesc.ByteWidth = static_cast<UINT>(sizeof(FNormalVertex) * srcVertices.size());
+
+	D3D11_SUBRESOURCE_DATA InitData = {};
+	InitData.pSysMem = srcVertices.data();
+
+	return device->CreateBuffer(&BufferDesc, &InitData, outBuffer);
 }
 
 // Billboard
@@ -0,0 +1,95 @@
+#include "pch.h"
+#include "RHIPassScheduler.h"
+#include "TaskScheduler.h"
+#include "PlatformTime.h"
+
+void FRHIPassScheduler::AddPass(const char* InName, FRHIPassFunction InFunction)
+{
+	FPass Pass;
+	Pass.Name = InName;
+	Pass.Function = std::move(InFunction);
+	Passes.Add(std::move(Pass));
+}
+
+void FRHIPassScheduler::Execute(IRHIParallelCommandBackend* Backend, bool bParallel)
+{
+	const int32 NumPasses = Passes.Num();
+	bLastExecutionParallel = false;
+	LastNumSlots = 0;
+	LastRecordMS = 0.0;
+	LastSubmitMS = 0.0;
+
+	if (NumPasses == 0)
+	{
+		return;
+	}
+
+	// 패스가 하나뿐이거나, 워커가 없거나, 병렬 녹화를 쓸 수 없으면 녹화/제출 비용 없이 즉시 실행
+	const int32 NumSlots = FTaskScheduler::ComputeNumChunks(NumPasses, 1);
+	bool bCanRecordInParallel = bParallel && Backend && Backend->SupportsParallelRecording() && NumSlots > 1;
+	if (bCanRecordInParallel)
+	{
+		// 슬롯 확보에 실패하면 백엔드가 SupportsParallelRecording()을 false로 바꾼다
+		Backend->ResetPasses(NumPasses, NumSlots);
+		bCanRecordInParallel = Backend->SupportsParallelRecording();
+	}
+
+	if (!bCanRecordInParallel)
+	{
+		const uint64 Start = FPlatformTime::Cycles64();
+		for (FPass& Pass : Passes)
+		{
+			Pass.Function();
+		}
+		LastRecordMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+		Passes.Empty();
+		return;
+	}
+
+	// 1. 녹화: 청크 하나가 녹화 슬롯 하나를 사용 (슬롯 안에서는 패스를 순서대로 녹화)
+	const uint64 RecordStart = FPlatformTime::Cycles64();
+	FTaskScheduler::ParallelFor(NumPasses, NumSlots, [this, Backend](int32 SlotIndex, int32 Begin, int32 End)
+	{
+		for (int32 PassIndex = Begin; PassIndex < End; ++PassIndex)
+		{
+			Backend->BeginPassRecording(PassIndex, SlotIndex);
+			Passes[PassIndex].Function();
+			Backend->EndPassRecording(PassIndex, SlotIndex);
+		}
+	});
+	const uint64 SubmitStart = FPlatformTime::Cycles64();
+
+	// 2. 제출: 등록 순서대로 (직렬 실행과 같은 결과)
+	for (int32 PassIndex = 0; PassIndex < NumPasses; ++PassIndex)
+	{
+		Backend->ExecutePass(PassIndex);
+	}
+
+	LastRecordMS = FPlatformTime::ToMilliseconds(SubmitStart - RecordStart);
+	LastSubmitMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - SubmitStart);
+	bLastExecutionParallel = true;
+	LastNumSlots = NumSlots;
+	Passes.Empty();
+}
+
+bool FRHIPassScheduler::RunNullBackendSelfTest(int32 NumPasses)
+{
+	FNullParallelCommandBackend Backend;
+	FRHIPassScheduler Scheduler;
+
+	// 각 패스는 자신의 칸에만 쓰므로 병렬 실행해도 경쟁이 없음
+	TArray<int32> Visited;
+	Visited.SetNum(NumPasses);
+	for (int32 PassIndex = 0; PassIndex < NumPasses; ++PassIndex)
+	{
+		Visited[PassIndex] = 0;
+		Scheduler.AddPass("NullPass", [&Visited, PassIndex]() { ++Visited[PassIndex]; });
+	}
+	Scheduler.Execute(&Backend, true);
+
+	for (int32 Count : Visited)
+	{
+		if (Count != 1) return false;
+	}
+	return NumPasses <= 1 || Backend.IsSubmissionOrderValid();
+}
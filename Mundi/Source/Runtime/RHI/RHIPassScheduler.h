@@ -0,0 +1,128 @@
+#pragma once
+#include "UEContainer.h"
+#include <functional>
+#include <mutex>
+
+/**
+ * @class IRHIParallelCommandBackend
+ * @brief 패스 단위 병렬 녹화를 지원하는 RHI 백엔드 인터페이스입니다.
+ *        FRHIPassScheduler는 이 인터페이스만 알고 있으므로, D3D11(Deferred Context)과
+ *        Null 백엔드(헤드리스 테스트용)를 같은 스케줄링 코드로 구동할 수 있습니다.
+ *
+ * 호출 순서 (한 번의 Execute 기준):
+ *   ResetPasses(NumPasses, NumSlots)
+ *   워커 스레드에서: BeginPassRecording(Pass, Slot) → 패스 본문 → EndPassRecording(Pass, Slot)
+ *   호출 스레드에서: ExecutePass(0) ... ExecutePass(NumPasses - 1)  (제출 순서 보장)
+ *
+ * 같은 Slot은 한 번에 하나의 스레드만 사용합니다.
+ */
+class IRHIParallelCommandBackend
+{
+public:
+	virtual ~IRHIParallelCommandBackend() = default;
+
+	virtual bool SupportsParallelRecording() const = 0;
+	virtual void ResetPasses(int32 NumPasses, int32 NumSlots) = 0;
+	virtual void BeginPassRecording(int32 PassIndex, int32 SlotIndex) = 0;
+	virtual void EndPassRecording(int32 PassIndex, int32 SlotIndex) = 0;
+	virtual void ExecutePass(int32 PassIndex) = 0;
+};
+
+/**
+ * @class FNullParallelCommandBackend
+ * @brief GPU 없이 스케줄러를 검증하기 위한 백엔드입니다.
+ *        실제 명령은 기록하지 않고 호출 횟수와 제출 순서만 기록합니다.
+ */
+class FNullParallelCommandBackend : public IRHIParallelCommandBackend
+{
+public:
+	bool SupportsParallelRecording() const override { return true; }
+
+	void ResetPasses(int32 NumPasses, int32 NumSlots) override
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		RecordedPasses.SetNum(NumPasses);
+		for (int32& Recorded : RecordedPasses) { Recorded = 0; }
+		ExecutedPasses.Empty();
+		NumSlotsUsed = NumSlots;
+	}
+
+	void BeginPassRecording(int32 PassIndex, int32 SlotIndex) override {}
+
+	void EndPassRecording(int32 PassIndex, int32 SlotIndex) override
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		++RecordedPasses[PassIndex];
+	}
+
+	void ExecutePass(int32 PassIndex) override
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		ExecutedPasses.Add(PassIndex);
+	}
+
+	/** @brief 모든 패스가 정확히 한 번 녹화되고 0..N-1 순서로 제출되었는지 확인합니다. */
+	bool IsSubmissionOrderValid() const
+	{
+		if (ExecutedPasses.Num() != RecordedPasses.Num()) return false;
+		for (int32 Index = 0; Index < ExecutedPasses.Num(); ++Index)
+		{
+			if (ExecutedPasses[Index] != Index || RecordedPasses[Index] != 1) return false;
+		}
+		return true;
+	}
+
+	int32 GetNumSlotsUsed() const { return NumSlotsUsed; }
+
+private:
+	std::mutex Mutex;
+	TArray<int32> RecordedPasses;
+	TArray<int32> ExecutedPasses;
+	int32 NumSlotsUsed = 0;
+};
+
+using FRHIPassFunction = std::function<void()>;
+
+/**
+ * @class FRHIPassScheduler
+ * @brief 서로 독립적인 렌더 패스들을 모아 두었다가 한 번에 녹화/제출합니다.
+ *        병렬 모드에서는 FTaskScheduler 워커들이 패스를 백엔드의 녹화 슬롯에 기록하고,
+ *        호출 스레드가 등록 순서대로 제출합니다. 병렬 녹화를 쓰지 않으면 등록 순서대로 즉시 실행합니다.
+ *
+ * NOTE: 패스 본문은 자신이 사용하는 파이프라인 상태(RT/DSV, 뷰포트, 래스터라이저, 셰이더, 상수 버퍼)를
+ *       모두 직접 설정해야 합니다. 녹화 컨텍스트는 기본 상태에서 시작합니다.
+ */
+class FRHIPassScheduler
+{
+public:
+	void AddPass(const char* InName, FRHIPassFunction InFunction);
+
+	/**
+	 * @brief 등록된 패스를 실행하고 목록을 비웁니다.
+	 * @param Backend 병렬 녹화 백엔드 (nullptr이면 즉시 실행)
+	 * @param bParallel false면 백엔드와 상관없이 호출 스레드에서 순서대로 실행
+	 */
+	void Execute(IRHIParallelCommandBackend* Backend, bool bParallel);
+
+	int32 GetNumPasses() const { return Passes.Num(); }
+	bool WasLastExecutionParallel() const { return bLastExecutionParallel; }
+	int32 GetLastNumSlots() const { return LastNumSlots; }
+	double GetLastRecordMS() const { return LastRecordMS; }
+	double GetLastSubmitMS() const { return LastSubmitMS; }
+
+	/** @brief Null 백엔드로 빈 패스 NumPasses개를 병렬 실행하여 녹화/제출 순서를 검증합니다. */
+	static bool RunNullBackendSelfTest(int32 NumPasses = 64);
+
+private:
+	struct FPass
+	{
+		const char* Name = nullptr;
+		FRHIPassFunction Function;
+	};
+
+	TArray<FPass> Passes;
+	bool bLastExecutionParallel = false;
+	int32 LastNumSlots = 0;
+	double LastRecordMS = 0.0;
+	double LastSubmitMS = 0.0;
+};
@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include <atomic>
 #define CASCADED_MAX 8
 
 class UAmbientLightComponent;
@@ -176,9 +177,10 @@ public:
     void ClearAllLightList();
 
 private:
-    bool bHaveToUpdate = true;
-    bool bPointLightDirty = true;
-    bool bSpotLightDirty = true;
+    // UpdateLight는 병렬 틱(트랜스폼 변경)에서도 호출되므로 atomic
+    std::atomic<bool> bHaveToUpdate{ true };
+    std::atomic<bool> bPointLightDirty{ true };
+    std::atomic<bool> bSpotLightDirty{ true };
     bool bShadowDataDirty = true;
 
     // --- 섀도우 리소스 ---
@@ -4,6 +4,7 @@
 // 전방 선언
 class UShader;
 class UMaterial;
+struct FShaderVariant;
 
 /**
  * @enum EBatchRenderMode
@@ -72,6 +73,10 @@ struct FMeshBatchElement
 	// 여러 이미터가 하나의 인스턴스 버퍼를 공유할 때 각 이미터의 시작 위치를 지정합니다.
 	uint32 StartInstanceLocation = 0;
 
+	// 자동 인스턴싱 시 사용할 GPU_INSTANCING 셰이더 variant입니다.
+	// nullptr이면 렌더러가 이 배치를 다른 배치와 병합하지 않습니다.
+	FShaderVariant* InstancedShaderVariant = nullptr;
+
 
 	// --- 4. 오브젝트별 데이터 (Per-Object Data) ---
 	// 드로우 콜마다 고유하게 설정되는 데이터입니다. (정렬 키가 아님)
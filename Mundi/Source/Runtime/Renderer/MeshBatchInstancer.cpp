@@ -0,0 +1,171 @@
+#include "pch.h"
+#include "MeshBatchInstancer.h"
+#include "MeshBatchElement.h"
+#include "Shader.h"
+#include "RenderStats.h"
+
+FMeshBatchInstancer::~FMeshBatchInstancer()
+{
+	if (InstanceBuffer)
+	{
+		InstanceBuffer->Release();
+		InstanceBuffer = nullptr;
+	}
+	AllocatedInstanceCount = 0;
+}
+
+bool FMeshBatchInstancer::CanMerge(const FMeshBatchElement& A, const FMeshBatchElement& B)
+{
+	// 인스턴싱 variant가 없거나 이미 인스턴스/본 버퍼를 쓰는 배치(파티클, 스키닝)는 병합 대상이 아님
+	if (!A.InstancedShaderVariant || A.InstancedShaderVariant != B.InstancedShaderVariant)
+	{
+		return false;
+	}
+	if (A.InstanceBuffer || B.InstanceBuffer || A.BoneMatricesBuffer || B.BoneMatricesBuffer)
+	{
+		return false;
+	}
+
+	return A.VertexShader == B.VertexShader
+		&& A.PixelShader == B.PixelShader
+		&& A.Material == B.Material
+		&& A.InstanceShaderResourceView == B.InstanceShaderResourceView
+		&& A.VertexBuffer == B.VertexBuffer
+		&& A.IndexBuffer == B.IndexBuffer
+		&& A.VertexStride == B.VertexStride
+		&& A.IndexCount == B.IndexCount
+		&& A.StartIndex == B.StartIndex
+		&& A.BaseVertexIndex == B.BaseVertexIndex
+		&& A.PrimitiveTopology == B.PrimitiveTopology
+		&& A.RenderMode == B.RenderMode
+		&& A.InstanceColor == B.InstanceColor;
+}
+
+void FMeshBatchInstancer::MergeInstances(ID3D11Device* Device, ID3D11DeviceContext* Context, TArray<FMeshBatchElement>& InOutMeshBatches, TArray<FMeshBatchSortKey>& InOutDrawOrder)
+{
+	const int32 NumDraws = InOutDrawOrder.Num();
+	const int32 NumSourceBatches = InOutMeshBatches.Num();	// 이 인덱스 이후는 병합으로 추가된 배치
+
+	InstanceData.Empty();
+	MergedDrawOrder.Empty();
+	MergedDrawOrder.Reserve(NumDraws);
+
+	uint32 InstancedDrawCount = 0;
+	uint32 MergedInstanceCount = 0;
+
+	int32 RunStart = 0;
+	while (RunStart < NumDraws)
+	{
+		// 1. 정렬 순서상 연속된 병합 가능 구간 [RunStart, RunEnd) 탐색
+		const FMeshBatchElement& First = InOutMeshBatches[InOutDrawOrder[RunStart].Index];
+		int32 RunEnd = RunStart + 1;
+		while (RunEnd < NumDraws && CanMerge(First, InOutMeshBatches[InOutDrawOrder[RunEnd].Index]))
+		{
+			++RunEnd;
+		}
+
+		const int32 RunLength = RunEnd - RunStart;
+		if (RunLength < MinInstancesToMerge)
+		{
+			MergedDrawOrder.Add(InOutDrawOrder[RunStart]);
+			RunStart = RunEnd;
+			continue;
+		}
+
+		// 2. 구간의 월드 행렬을 인스턴스 데이터로 패킹
+		const uint32 StartInstance = static_cast<uint32>(InstanceData.Num());
+		for (int32 DrawIndex = RunStart; DrawIndex < RunEnd; ++DrawIndex)
+		{
+			const FMeshBatchElement& Batch = InOutMeshBatches[InOutDrawOrder[DrawIndex].Index];
+			const FMatrix NormalMatrix = Batch.WorldMatrix.InverseAffine().Transpose();
+
+			FStaticMeshInstanceData& Instance = InstanceData[InstanceData.Emplace()];
+			Instance.WorldMatrix = Batch.WorldMatrix;
+			Instance.NormalMatrixRows[0] = NormalMatrix.VRows[0];
+			Instance.NormalMatrixRows[1] = NormalMatrix.VRows[1];
+			Instance.NormalMatrixRows[2] = NormalMatrix.VRows[2];
+			Instance.ObjectID = Batch.ObjectID;
+		}
+
+		// 3. 첫 배치를 복사해 인스턴싱 배치 생성 (InstanceBuffer는 업로드 후 채움)
+		FMeshBatchElement Merged = First;
+		Merged.VertexShader = First.InstancedShaderVariant->VertexShader;
+		Merged.PixelShader = First.InstancedShaderVariant->PixelShader;
+		Merged.InputLayout = First.InstancedShaderVariant->InputLayout;
+		Merged.InstanceStride = sizeof(FStaticMeshInstanceData);
+		Merged.NumInstances = static_cast<uint32>(RunLength);
+		Merged.StartInstanceLocation = StartInstance;
+
+		FMeshBatchSortKey MergedKey = InOutDrawOrder[RunStart];
+		MergedKey.Index = static_cast<uint32>(InOutMeshBatches.Add(Merged));
+		MergedDrawOrder.Add(MergedKey);
+
+		++InstancedDrawCount;
+		MergedInstanceCount += static_cast<uint32>(RunLength);
+		RunStart = RunEnd;
+	}
+
+	if (InstancedDrawCount == 0)
+	{
+		FRenderStatManager::GetInstance().AddInstancingResult(NumDraws, NumDraws, 0, 0);
+		return;
+	}
+
+	// 4. 인스턴스 데이터 업로드. 실패하면 병합하지 않은 원래 순서로 그림
+	if (!UploadInstanceData(Device, Context))
+	{
+		FRenderStatManager::GetInstance().AddInstancingResult(NumDraws, NumDraws, 0, 0);
+		return;
+	}
+
+	for (int32 BatchIndex = NumSourceBatches; BatchIndex < InOutMeshBatches.Num(); ++BatchIndex)
+	{
+		InOutMeshBatches[BatchIndex].InstanceBuffer = InstanceBuffer;
+	}
+
+	FRenderStatManager::GetInstance().AddInstancingResult(NumDraws, MergedDrawOrder.Num(), InstancedDrawCount, MergedInstanceCount);
+
+	// vector swap은 할당 없이 버퍼만 교환
+	InOutDrawOrder.swap(MergedDrawOrder);
+}
+
+bool FMeshBatchInstancer::UploadInstanceData(ID3D11Device* Device, ID3D11DeviceContext* Context)
+{
+	const uint32 NumInstances = static_cast<uint32>(InstanceData.Num());
+
+	// 인스턴스 버퍼 생성/리사이즈
+	if (NumInstances > AllocatedInstanceCount)
+	{
+		if (InstanceBuffer)
+		{
+			InstanceBuffer->Release();
+			InstanceBuffer = nullptr;
+		}
+		AllocatedInstanceCount = 0;
+
+		uint32 NewCount = FMath::Max(NumInstances * 2, 256u);
+		D3D11_BUFFER_DESC Desc = {};
+		Desc.ByteWidth = NewCount * sizeof(FStaticMeshInstanceData);
+		Desc.Usage = D3D11_USAGE_DYNAMIC;
+		Desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+		Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+		if (FAILED(Device->CreateBuffer(&Desc, nullptr, &InstanceBuffer)))
+		{
+			UE_LOG("FMeshBatchInstancer: 인스턴스 버퍼 생성 실패 (%u instances)", NewCount);
+			return false;
+		}
+		AllocatedInstanceCount = NewCount;
+	}
+
+	// WRITE_DISCARD: 같은 프레임의 이전 패스가 참조하는 내용은 드라이버가 보존(리네이밍)함
+	D3D11_MAPPED_SUBRESOURCE MappedData;
+	if (FAILED(Context->Map(InstanceBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedData)))
+	{
+		return false;
+	}
+	memcpy(MappedData.pData, InstanceData.GetData(), NumInstances * sizeof(FStaticMeshInstanceData));
+	Context->Unmap(InstanceBuffer, 0);
+
+	return true;
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include "UEContainer.h"
+#include "MeshBatchSort.h"
+
+struct FMeshBatchElement;
+
+/**
+ * @struct FStaticMeshInstanceData
+ * @brief 자동 인스턴싱 시 인스턴스 버퍼(슬롯 1)에 기록되는 인스턴스별 데이터입니다.
+ *        UberLit.hlsl의 GPU_INSTANCING 입력 및 UShader::CreateInputLayout과 레이아웃이 일치해야 합니다. (128 bytes)
+ */
+struct alignas(16) FStaticMeshInstanceData
+{
+	FMatrix WorldMatrix;			// 64 bytes
+	FVector4 NormalMatrixRows[3];	// 48 bytes - WorldInverseTranspose 상위 3행
+	uint32 ObjectID = 0;			// 4 bytes - 피킹용 ID
+	uint32 Padding[3] = {};			// 12 bytes
+};
+
+/**
+ * @class FMeshBatchInstancer
+ * @brief 정렬된 드로우 리스트에서 같은 메시/머티리얼/셰이더를 쓰는 연속된 배치를 찾아
+ *        하나의 인스턴싱 드로우 콜로 병합합니다.
+ *        인스턴스 버퍼는 URenderer가 소유한 인스턴스에 유지되며, 필요할 때만 커집니다.
+ */
+class FMeshBatchInstancer
+{
+public:
+	FMeshBatchInstancer() = default;
+	~FMeshBatchInstancer();
+
+	FMeshBatchInstancer(const FMeshBatchInstancer&) = delete;
+	FMeshBatchInstancer& operator=(const FMeshBatchInstancer&) = delete;
+
+	/**
+	 * @brief 정렬된 드로우 순서를 따라 병합 가능한 배치들을 인스턴싱 배치로 합칩니다.
+	 *        병합된 배치는 InOutMeshBatches 뒤에 추가되고, InOutDrawOrder는 병합 후 순서로 교체됩니다.
+	 */
+	void MergeInstances(ID3D11Device* Device, ID3D11DeviceContext* Context, TArray<FMeshBatchElement>& InOutMeshBatches, TArray<FMeshBatchSortKey>& InOutDrawOrder);
+
+private:
+	static bool CanMerge(const FMeshBatchElement& A, const FMeshBatchElement& B);
+	bool UploadInstanceData(ID3D11Device* Device, ID3D11DeviceContext* Context);
+
+	// 병합 최소 인스턴스 수 (이보다 적으면 일반 드로우 유지)
+	static constexpr int32 MinInstancesToMerge = 2;
+
+	ID3D11Buffer* InstanceBuffer = nullptr;
+	uint32 AllocatedInstanceCount = 0;
+
+	// 매 패스 재사용되는 CPU 측 버퍼
+	TArray<FStaticMeshInstanceData> InstanceData;
+	TArray<FMeshBatchSortKey> MergedDrawOrder;
+};
@@ -0,0 +1,211 @@
+﻿#include "pch.h"
+#include "MeshBatchSort.h"
+#include "MeshBatchElement.h"
+#include "PlatformTime.h"
+#include <random>
+
+namespace
+{
+	// 포인터를 16비트 ID로 압축 (Fibonacci hashing)
+	inline uint64 HashPointer16(const void* Ptr)
+	{
+		const uint64 Value = reinterpret_cast<uint64>(Ptr) >> 4;	// 정렬로 인해 항상 0인 하위 비트 제거
+		return (Value * 0x9E3779B97F4A7C15ull) >> 48;
+	}
+
+	inline uint64 HashPointerPair16(const void* A, const void* B)
+	{
+		const uint64 Value = (reinterpret_cast<uint64>(A) >> 4) ^ ((reinterpret_cast<uint64>(B) >> 4) * 0xC2B2AE3D27D4EB4Full);
+		return (Value * 0x9E3779B97F4A7C15ull) >> 48;
+	}
+
+	// 양수 float의 비트 패턴은 부호 없는 정수로 비교해도 대소 관계가 유지된다.
+	// 부호 비트를 제외한 상위 12비트(지수 8비트 + 가수 상위 4비트)만 사용하여 로그 스케일 깊이 버킷을 만든다.
+	inline uint64 QuantizeDepth12(float DistanceSquared)
+	{
+		uint32 Bits;
+		std::memcpy(&Bits, &DistanceSquared, sizeof(Bits));
+		return static_cast<uint64>(Bits >> 19) & 0xFFF;
+	}
+
+	constexpr int32 RadixBits = 8;
+	constexpr int32 RadixBuckets = 1 << RadixBits;
+	constexpr int32 RadixPasses = 64 / RadixBits;
+}
+
+uint64 FMeshBatchSorter::MakeSortKey(const FMeshBatchElement& Batch, const FVector& ViewLocation)
+{
+	// 패스: 불투명 → 반투명, 같은 모드 안에서는 일반 → 인스턴싱
+	uint64 Pass = static_cast<uint64>(Batch.RenderMode) << 1;
+	if (Batch.InstanceBuffer)
+	{
+		Pass |= 1;
+	}
+
+	const uint64 ShaderId = HashPointerPair16(Batch.VertexShader, Batch.PixelShader);
+	const uint64 MaterialId = HashPointer16(Batch.Material);
+	// 같은 버퍼의 다른 섹션이 섞이지 않도록 StartIndex도 메시 ID에 포함 (자동 인스턴싱 병합률 향상)
+	const uint64 MeshId = HashPointerPair16(Batch.VertexBuffer, reinterpret_cast<const uint8*>(Batch.IndexBuffer) + (static_cast<uint64>(Batch.StartIndex) << 4));
+
+	const FVector Position(Batch.WorldMatrix.M[3][0], Batch.WorldMatrix.M[3][1], Batch.WorldMatrix.M[3][2]);
+	const uint64 Depth = QuantizeDepth12((Position - ViewLocation).SizeSquared());
+
+	return ((Pass & 0xF) << 60)
+		| (ShaderId << 44)
+		| (MaterialId << 28)
+		| (MeshId << 12)
+		| Depth;
+}
+
+TArray<FMeshBatchSortKey>& FMeshBatchSorter::Sort(const TArray<FMeshBatchElement>& InMeshBatches, const FVector& ViewLocation)
+{
+	BuildKeys(InMeshBatches, ViewLocation);
+	RadixSortKeys();
+	return Keys;
+}
+
+void FMeshBatchSorter::BuildKeys(const TArray<FMeshBatchElement>& InMeshBatches, const FVector& ViewLocation)
+{
+	const int32 NumBatches = InMeshBatches.Num();
+
+	// resize는 capacity 이내에서는 재할당하지 않음
+	Keys.SetNum(NumBatches);
+	for (int32 Index = 0; Index < NumBatches; ++Index)
+	{
+		FMeshBatchSortKey& SortKey = Keys[Index];
+		SortKey.Key = MakeSortKey(InMeshBatches[Index], ViewLocation);
+		SortKey.Index = static_cast<uint32>(Index);
+	}
+}
+
+void FMeshBatchSorter::RadixSortKeys()
+{
+	const int32 NumKeys = Keys.Num();
+	if (NumKeys <= 1)
+	{
+		return;
+	}
+
+	Scratch.SetNum(NumKeys);
+
+	// 1. 모든 자릿수의 히스토그램을 한 번의 순회로 계산
+	uint32 Histograms[RadixPasses][RadixBuckets] = {};
+	for (const FMeshBatchSortKey& SortKey : Keys)
+	{
+		for (int32 Pass = 0; Pass < RadixPasses; ++Pass)
+		{
+			++Histograms[Pass][(SortKey.Key >> (Pass * RadixBits)) & (RadixBuckets - 1)];
+		}
+	}
+
+	// 2. LSD 패스 (안정 정렬이므로 같은 키는 수집 순서 유지)
+	FMeshBatchSortKey* Src = Keys.GetData();
+	FMeshBatchSortKey* Dst = Scratch.GetData();
+	for (int32 Pass = 0; Pass < RadixPasses; ++Pass)
+	{
+		uint32* Histogram = Histograms[Pass];
+		const int32 Shift = Pass * RadixBits;
+
+		// 모든 키가 같은 버킷에 있으면 이 자릿수는 순서를 바꾸지 않으므로 생략
+		// (예: 패스 비트는 대부분 동일)
+		const uint32 FirstBucketCount = Histogram[(Src[0].Key >> Shift) & (RadixBuckets - 1)];
+		if (FirstBucketCount == static_cast<uint32>(NumKeys))
+		{
+			continue;
+		}
+
+		// 누적 합 → 각 버킷의 시작 오프셋
+		uint32 Offset = 0;
+		for (int32 Bucket = 0; Bucket < RadixBuckets; ++Bucket)
+		{
+			const uint32 Count = Histogram[Bucket];
+			Histogram[Bucket] = Offset;
+			Offset += Count;
+		}
+
+		for (int32 Index = 0; Index < NumKeys; ++Index)
+		{
+			const FMeshBatchSortKey& SortKey = Src[Index];
+			Dst[Histogram[(SortKey.Key >> Shift) & (RadixBuckets - 1)]++] = SortKey;
+		}
+
+		std::swap(Src, Dst);
+	}
+
+	// 최종 결과가 스크래치 버퍼에 있으면 버퍼를 교환 (vector swap은 할당 없음)
+	if (Src != Keys.GetData())
+	{
+		Keys.swap(Scratch);
+	}
+}
+
+FMeshBatchSortBenchmarkResult FMeshBatchSorter::RunBenchmark(int32 NumElements)
+{
+	FMeshBatchSortBenchmarkResult Result;
+	Result.NumElements = NumElements;
+	if (NumElements <= 0)
+	{
+		return Result;
+	}
+
+	// 실제 씬과 비슷한 분포: 셰이더 수 << 머티리얼 수 << 메시 수
+	constexpr int32 NumShaders = 8;
+	constexpr int32 NumMaterials = 64;
+	constexpr int32 NumMeshes = 512;
+
+	// 가짜 리소스 주소로 사용할 더미 배열 (역참조하지 않음)
+	TArray<uint8> FakeResources(NumShaders * 2 + NumMaterials + NumMeshes * 2);
+	auto FakePtr = [&FakeResources](int32 Slot) { return FakeResources.GetData() + Slot; };
+
+	std::mt19937 Random(12345);
+	std::uniform_int_distribution<int32> ShaderDist(0, NumShaders - 1);
+	std::uniform_int_distribution<int32> MaterialDist(0, NumMaterials - 1);
+	std::uniform_int_distribution<int32> MeshDist(0, NumMeshes - 1);
+	std::uniform_real_distribution<float> PositionDist(-1000.0f, 1000.0f);
+
+	TArray<FMeshBatchElement> Batches;
+	Batches.SetNum(NumElements);
+	for (FMeshBatchElement& Batch : Batches)
+	{
+		const int32 Shader = ShaderDist(Random);
+		const int32 Mesh = MeshDist(Random);
+		Batch.VertexShader = reinterpret_cast<ID3D11VertexShader*>(FakePtr(Shader * 2));
+		Batch.PixelShader = reinterpret_cast<ID3D11PixelShader*>(FakePtr(Shader * 2 + 1));
+		Batch.Material = reinterpret_cast<UMaterialInterface*>(FakePtr(NumShaders * 2 + MaterialDist(Random)));
+		Batch.VertexBuffer = reinterpret_cast<ID3D11Buffer*>(FakePtr(NumShaders * 2 + NumMaterials + Mesh * 2));
+		Batch.IndexBuffer = reinterpret_cast<ID3D11Buffer*>(FakePtr(NumShaders * 2 + NumMaterials + Mesh * 2 + 1));
+		Batch.VertexStride = 64;
+		Batch.WorldMatrix = FMatrix::Identity();
+		Batch.WorldMatrix.M[3][0] = PositionDist(Random);
+		Batch.WorldMatrix.M[3][1] = PositionDist(Random);
+		Batch.WorldMatrix.M[3][2] = PositionDist(Random);
+	}
+
+	const FVector ViewLocation(0.0f, 0.0f, 0.0f);
+
+	// 1. 기존 방식: 구조체 자체를 비교 정렬
+	{
+		TArray<FMeshBatchElement> Copy = Batches;
+		const uint64 Start = FPlatformTime::Cycles64();
+		Copy.Sort();
+		Result.ComparisonSortMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	}
+
+	// 2. 키 정렬 (워밍업 1회로 버퍼 용량을 확보한 뒤, 실제 프레임과 같은 조건에서 측정)
+	FMeshBatchSorter Sorter;
+	Sorter.Sort(Batches, ViewLocation);
+	{
+		const uint64 Start = FPlatformTime::Cycles64();
+		Sorter.BuildKeys(Batches, ViewLocation);
+		const uint64 Mid = FPlatformTime::Cycles64();
+		Sorter.RadixSortKeys();
+		const uint64 End = FPlatformTime::Cycles64();
+		Result.BuildKeysMS = FPlatformTime::ToMilliseconds(Mid - Start);
+		Result.RadixSortMS = FPlatformTime::ToMilliseconds(End - Mid);
+	}
+
+	Result.bOrderValid = std::is_sorted(Sorter.Keys.begin(), Sorter.Keys.end(),
+		[](const FMeshBatchSortKey& A, const FMeshBatchSortKey& B) { return A.Key < B.Key; });
+
+	return Result;
+}
@@ -0,0 +1,70 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+struct FMeshBatchElement;
+
+/**
+ * @struct FMeshBatchSortKey
+ * @brief 드로우 리스트 정렬에 사용하는 (64비트 키, 배치 인덱스) 쌍입니다.
+ *        100바이트가 넘는 FMeshBatchElement 대신 16바이트짜리 키만 정렬하고,
+ *        그리기 단계에서는 Index를 통해 원본 배치를 참조합니다.
+ *
+ * 키 비트 배치 (상위 비트일수록 우선순위가 높음):
+ *   [63..60] 패스 (RenderMode, 인스턴싱 여부)
+ *   [59..44] 셰이더 ID (VS/PS 해시)
+ *   [43..28] 머티리얼 ID
+ *   [27..12] 메시 ID (VB/IB 해시)
+ *   [11..0]  깊이 (카메라 거리, 앞→뒤 순서)
+ *
+ * NOTE: ID는 포인터 해시이므로 충돌할 수 있지만, DrawMeshBatches가 실제 GPU 상태를
+ *       다시 비교하므로 충돌은 상태 변경 횟수에만 영향을 주고 결과에는 영향이 없습니다.
+ */
+struct FMeshBatchSortKey
+{
+	uint64 Key = 0;
+	uint32 Index = 0;
+	uint32 Padding = 0;
+};
+
+/**
+ * @struct FMeshBatchSortBenchmarkResult
+ * @brief FMeshBatchSorter::RunBenchmark 결과입니다.
+ */
+struct FMeshBatchSortBenchmarkResult
+{
+	int32 NumElements = 0;
+	double ComparisonSortMS = 0.0;	// 기존 방식: FMeshBatchElement::operator< 로 TArray::Sort()
+	double BuildKeysMS = 0.0;		// 정렬 키 생성
+	double RadixSortMS = 0.0;		// (키, 인덱스) 쌍 기수 정렬
+	bool bOrderValid = false;		// 기수 정렬 결과가 키 오름차순인지 검증
+};
+
+/**
+ * @class FMeshBatchSorter
+ * @brief 드로우 리스트를 압축된 64비트 키로 기수 정렬(LSD Radix Sort)합니다.
+ *        키/스크래치 버퍼는 URenderer가 소유한 인스턴스에 유지되므로,
+ *        용량이 한번 확보된 이후에는 매 프레임 힙 할당이 발생하지 않습니다.
+ */
+class FMeshBatchSorter
+{
+public:
+	/** @brief 배치 하나의 정렬 키를 계산합니다. */
+	static uint64 MakeSortKey(const FMeshBatchElement& Batch, const FVector& ViewLocation);
+
+	/**
+	 * @brief 배치 목록으로부터 정렬 키를 만들고 기수 정렬합니다.
+	 * @return 정렬된 (키, 인덱스) 목록. 다음 Sort() 호출 전까지 유효합니다.
+	 *         (자동 인스턴싱이 병합 결과로 교체할 수 있도록 수정 가능한 참조를 반환)
+	 */
+	TArray<FMeshBatchSortKey>& Sort(const TArray<FMeshBatchElement>& InMeshBatches, const FVector& ViewLocation);
+
+	/** @brief 합성 배치 NumElements개로 기존 비교 정렬과 기수 정렬의 CPU 시간을 비교합니다. */
+	static FMeshBatchSortBenchmarkResult RunBenchmark(int32 NumElements = 100000);
+
+private:
+	void BuildKeys(const TArray<FMeshBatchElement>& InMeshBatches, const FVector& ViewLocation);
+	void RadixSortKeys();
+
+	TArray<FMeshBatchSortKey> Keys;
+	TArray<FMeshBatchSortKey> Scratch;
+};
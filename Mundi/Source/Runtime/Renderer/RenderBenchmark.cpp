@@ -0,0 +1,275 @@
+#include "pch.h"
+#include "RenderBenchmark.h"
+#include "RenderStats.h"
+#include "CameraActor.h"
+#include "CameraComponent.h"
+#include "FViewport.h"
+#include "SceneView.h"
+#include "PlatformTime.h"
+#include "TaskScheduler.h"
+#include <fstream>
+
+namespace
+{
+	// 공백으로 구분하되 큰따옴표로 감싼 토큰은 하나로 취급
+	TArray<FString> TokenizeCommandLine(const char* CommandLine)
+	{
+		TArray<FString> Tokens;
+		FString Current;
+		bool bInQuotes = false;
+		for (const char* Ch = CommandLine; Ch && *Ch; ++Ch)
+		{
+			if (*Ch == '"')
+			{
+				bInQuotes = !bInQuotes;
+			}
+			else if (*Ch == ' ' && !bInQuotes)
+			{
+				if (!Current.empty()) { Tokens.Add(Current); Current.clear(); }
+			}
+			else
+			{
+				Current += *Ch;
+			}
+		}
+		if (!Current.empty()) { Tokens.Add(Current); }
+		return Tokens;
+	}
+
+	bool ReadOption(const FString& Token, const char* Prefix, FString& OutValue)
+	{
+		const size_t PrefixLength = strlen(Prefix);
+		if (Token.size() > PrefixLength && _strnicmp(Token.c_str(), Prefix, PrefixLength) == 0)
+		{
+			OutValue = Token.substr(PrefixLength);
+			return true;
+		}
+		return false;
+	}
+
+	struct FPhaseSummary
+	{
+		double Average = 0.0;
+		double Min = 0.0;
+		double Median = 0.0;
+		double P95 = 0.0;
+		double Max = 0.0;
+	};
+
+	FPhaseSummary Summarize(TArray<double> Samples)
+	{
+		FPhaseSummary Summary;
+		if (Samples.IsEmpty())
+		{
+			return Summary;
+		}
+
+		std::sort(Samples.begin(), Samples.end());
+		double Sum = 0.0;
+		for (double Sample : Samples) { Sum += Sample; }
+
+		const int32 Num = Samples.Num();
+		Summary.Average = Sum / Num;
+		Summary.Min = Samples[0];
+		Summary.Median = Samples[Num / 2];
+		Summary.P95 = Samples[FMath::Min(Num - 1, static_cast<int32>(Num * 0.95))];
+		Summary.Max = Samples[Num - 1];
+		return Summary;
+	}
+}
+
+bool FRenderBenchmark::ParseCommandLine(const char* CommandLine, FRenderBenchmarkOptions& OutOptions)
+{
+	const TArray<FString> Tokens = TokenizeCommandLine(CommandLine);
+
+	bool bFound = false;
+	for (int32 Index = 0; Index < Tokens.Num(); ++Index)
+	{
+		const FString& Token = Tokens[Index];
+		FString Value;
+
+		if (_stricmp(Token.c_str(), "-renderbench") == 0)
+		{
+			bFound = true;
+			// 바로 뒤 토큰이 옵션이 아니면 씬 경로
+			if (Index + 1 < Tokens.Num() && Tokens[Index + 1][0] != '-')
+			{
+				OutOptions.ScenePath = Tokens[++Index];
+			}
+		}
+		else if (ReadOption(Token, "-frames=", Value))
+		{
+			OutOptions.NumFrames = FMath::Max(1, atoi(Value.c_str()));
+		}
+		else if (ReadOption(Token, "-warmup=", Value))
+		{
+			OutOptions.NumWarmupFrames = FMath::Max(0, atoi(Value.c_str()));
+		}
+		else if (ReadOption(Token, "-res=", Value))
+		{
+			uint32 Width = 0, Height = 0;
+			if (sscanf_s(Value.c_str(), "%ux%u", &Width, &Height) == 2 && Width > 0 && Height > 0)
+			{
+				OutOptions.Width = Width;
+				OutOptions.Height = Height;
+			}
+		}
+		else if (ReadOption(Token, "-rhi=", Value))
+		{
+			OutOptions.bNullDriver = _stricmp(Value.c_str(), "warp") != 0;
+		}
+		else if (ReadOption(Token, "-csv=", Value))
+		{
+			OutOptions.CsvPath = Value;
+		}
+	}
+
+	if (bFound && OutOptions.ScenePath.empty())
+	{
+		OutOptions.ScenePath = GDataDir + "/Scenes/DefaultScene.scene";
+	}
+	return bFound;
+}
+
+int32 FRenderBenchmark::RunHeadless(const FRenderBenchmarkOptions& Options)
+{
+	// GUI 서브시스템 실행 파일이므로, 표준 출력이 리다이렉트되지 않았다면 부모 콘솔에 연결
+	if (GetStdHandle(STD_OUTPUT_HANDLE) == nullptr && AttachConsole(ATTACH_PARENT_PROCESS))
+	{
+		FILE* Stream = nullptr;
+		freopen_s(&Stream, "CONOUT$", "w", stdout);
+	}
+
+	if (!GEngine.StartupHeadless(Options.Width, Options.Height, Options.bNullDriver))
+	{
+		printf("[RenderBench] Failed to create headless RHI device\n");
+		GEngine.Shutdown();
+		return 1;
+	}
+
+	const int32 Result = Run(Options);
+	GEngine.Shutdown();
+	return Result;
+}
+
+int32 FRenderBenchmark::Run(const FRenderBenchmarkOptions& Options)
+{
+	URenderer* Renderer = GEngine.GetRenderer();
+	D3D11RHI* RHIDevice = GEngine.GetRHIDevice();
+
+	// 월드 생성 (엔진 Shutdown에서 WorldContext로 삭제됨)
+	UWorld* World = NewObject<UWorld>();
+	GEngine.AddWorldContext(FWorldContext(World, EWorldType::Game));
+	GWorld = World;
+	World->Initialize();
+	// 에디터 전용 프리미티브(그리드, 기즈모)는 측정에서 제외
+	World->bPie = true;
+
+	// 씬 파일의 PerspectiveCamera가 적용되도록 로드 전에 카메라 지정
+	ACameraActor* Camera = NewObject<ACameraActor>();
+	World->SetEditorCameraActor(Camera);
+
+	if (!World->LoadLevelFromFile(UTF8ToWide(Options.ScenePath)))
+	{
+		printf("[RenderBench] Failed to load scene: %s\n", Options.ScenePath.c_str());
+		return 1;
+	}
+
+	FViewport Viewport;
+	if (!Viewport.Initialize(0, 0, static_cast<float>(Options.Width), static_cast<float>(Options.Height), RHIDevice->GetDevice()))
+	{
+		printf("[RenderBench] Failed to initialize viewport\n");
+		return 1;
+	}
+
+	const int32 NumTotalFrames = Options.NumWarmupFrames + Options.NumFrames;
+	TArray<double> FrameSamples;
+	TMap<FString, TArray<double>> PhaseSamples;
+	FRenderStats LastRenderStats;
+
+	for (int32 FrameIndex = 0; FrameIndex < NumTotalFrames; ++FrameIndex)
+	{
+		// 오버레이가 없으므로 프레임 단위 프로파일 초기화를 직접 수행
+		FScopeCycleCounter::TimeProfileInit();
+
+		const uint64 FrameStart = FPlatformTime::Cycles64();
+		Renderer->BeginFrame();
+		{
+			FSceneView RenderView(Camera->GetCameraComponent(), &Viewport, &World->GetRenderSettings());
+			TIME_PROFILE(SceneRender)
+			Renderer->RenderSceneForView(World, &RenderView, &Viewport);
+		}
+		Renderer->EndFrame();
+		const double FrameMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - FrameStart);
+
+		// WARP는 실제로 래스터화하므로 큐가 쌓이지 않도록 측정 구간 밖에서 비움
+		RHIDevice->GetDeviceContext()->Flush();
+
+		const int32 SampleIndex = FrameIndex - Options.NumWarmupFrames;
+		if (SampleIndex < 0)
+		{
+			continue;
+		}
+
+		FrameSamples.Add(FrameMS);
+		for (const FString& Key : FScopeCycleCounter::GetTimeProfileKeys())
+		{
+			TArray<double>& Samples = PhaseSamples[Key];
+			Samples.SetNum(SampleIndex);	// 중간에 처음 등장한 단계는 이전 프레임을 0으로 채움
+			Samples.Add(FScopeCycleCounter::GetTimeProfile(Key).Milliseconds);
+		}
+		LastRenderStats = FRenderStatManager::GetInstance().GetStats();
+	}
+
+	Viewport.Cleanup();
+
+	// --- 결과 출력 ---
+	TArray<FString> PhaseKeys = PhaseSamples.GetKeys();
+	std::sort(PhaseKeys.begin(), PhaseKeys.end());
+	for (const FString& Key : PhaseKeys)
+	{
+		PhaseSamples[Key].SetNum(Options.NumFrames);
+	}
+
+	const char* DriverName = RHIDevice->GetDriverType() == D3D_DRIVER_TYPE_NULL ? "null" : "warp";
+	printf("[RenderBench] Scene: %s\n", Options.ScenePath.c_str());
+	printf("[RenderBench] %d frames (+%d warmup), %ux%u, RHI: %s, Threads: %d\n",
+		Options.NumFrames, Options.NumWarmupFrames, Options.Width, Options.Height, DriverName, FTaskScheduler::GetNumWorkers() + 1);
+	printf("[RenderBench] Mesh Batches: %u, Draw Calls: %u, Shadow Passes: %u\n",
+		LastRenderStats.MeshBatchCount, LastRenderStats.DrawCallCount, LastRenderStats.ShadowPassCount);
+	printf("%-24s %10s %10s %10s %10s %10s\n", "Phase (ms)", "Avg", "Min", "Median", "P95", "Max");
+
+	auto PrintRow = [](const FString& Name, const TArray<double>& Samples)
+	{
+		const FPhaseSummary Summary = Summarize(Samples);
+		printf("%-24s %10.3f %10.3f %10.3f %10.3f %10.3f\n", Name.c_str(), Summary.Average, Summary.Min, Summary.Median, Summary.P95, Summary.Max);
+	};
+	PrintRow("Frame", FrameSamples);
+	for (const FString& Key : PhaseKeys)
+	{
+		PrintRow(Key, PhaseSamples[Key]);
+	}
+	fflush(stdout);
+
+	if (!Options.CsvPath.empty())
+	{
+		std::ofstream Csv(Options.CsvPath);
+		if (!Csv.is_open())
+		{
+			printf("[RenderBench] Failed to write CSV: %s\n", Options.CsvPath.c_str());
+			return 1;
+		}
+
+		Csv << "Frame,FrameMS";
+		for (const FString& Key : PhaseKeys) { Csv << "," << Key; }
+		Csv << "\n";
+		for (int32 SampleIndex = 0; SampleIndex < FrameSamples.Num(); ++SampleIndex)
+		{
+			Csv << SampleIndex << "," << FrameSamples[SampleIndex];
+			for (const FString& Key : PhaseKeys) { Csv << "," << PhaseSamples[Key][SampleIndex]; }
+			Csv << "\n";
+		}
+	}
+
+	return 0;
+}
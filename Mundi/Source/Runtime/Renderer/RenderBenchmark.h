@@ -0,0 +1,41 @@
+#pragma once
+#include "UEContainer.h"
+
+/**
+ * @struct FRenderBenchmarkOptions
+ * @brief 헤드리스 렌더 벤치마크 실행 옵션입니다. (명령줄 -renderbench 로 지정)
+ *
+ * 예: Mundi.exe -renderbench Data/Scenes/DefaultScene.scene -frames=300 -warmup=30 -res=1920x1080 -rhi=null -csv=RenderBench.csv
+ */
+struct FRenderBenchmarkOptions
+{
+	FString ScenePath;				// 비어 있으면 Data/Scenes/DefaultScene.scene
+	int32 NumFrames = 300;			// 측정 프레임 수
+	int32 NumWarmupFrames = 30;		// 셰이더 컴파일/버퍼 할당이 끝나도록 버리는 프레임 수
+	uint32 Width = 1920;
+	uint32 Height = 1080;
+	bool bNullDriver = true;		// false면 WARP (실제 래스터화 포함)
+	FString CsvPath;				// 비어 있지 않으면 프레임별 결과를 CSV로 저장
+};
+
+/**
+ * @class FRenderBenchmark
+ * @brief 창/GPU 없이 씬 파일을 로드해 FSceneRenderer::Render를 N 프레임 실행하고,
+ *        FScopeCycleCounter 단계별 시간(수집, 정렬, 인스턴싱, 그림자 등)을 집계해 출력합니다.
+ *        빌드 머신에서 렌더 스레드 CPU 성능 회귀를 추적하는 용도입니다.
+ */
+class FRenderBenchmark
+{
+public:
+	/** @brief 명령줄에 -renderbench 가 있으면 옵션을 채우고 true를 반환합니다. */
+	static bool ParseCommandLine(const char* CommandLine, FRenderBenchmarkOptions& OutOptions);
+
+	/**
+	 * @brief 엔진을 헤드리스로 시작해 벤치마크를 실행하고 종료합니다.
+	 * @return 프로세스 종료 코드 (0: 성공)
+	 */
+	static int32 RunHeadless(const FRenderBenchmarkOptions& Options);
+
+private:
+	static int32 Run(const FRenderBenchmarkOptions& Options);
+};
@@ -0,0 +1,84 @@
+#pragma once
+#include "UEContainer.h"
+
+// 렌더 통계 구조체
+// 드로우 리스트 정렬/병합 관련 정보를 프레임 단위로 추적 (모든 뷰포트 누적)
+struct FRenderStats
+{
+	// 자동 인스턴싱
+	uint32 MeshBatchCount = 0;        // 병합 전 배치 수 (= 병합하지 않았을 때의 드로우 콜 수)
+	uint32 DrawCallCount = 0;         // 병합 후 드로우 콜 수
+	uint32 InstancedDrawCount = 0;    // 병합으로 생성된 인스턴싱 드로우 콜 수
+	uint32 MergedInstanceCount = 0;   // 인스턴싱 드로우에 포함된 인스턴스 총합
+
+	// 그림자 패스 녹화
+	uint32 ShadowPassCount = 0;       // 녹화/실행한 그림자 뎁스 패스 수
+	uint32 ShadowRecordSlots = 0;     // 병렬 녹화에 사용한 Deferred Context 수 (0이면 직렬 실행)
+	double ShadowRecordMS = 0.0;      // 녹화(직렬 모드에서는 실행) 시간
+	double ShadowSubmitMS = 0.0;      // 커맨드 리스트 제출 시간
+
+	void Reset()
+	{
+		ShadowPassCount = 0;
+		ShadowRecordSlots = 0;
+		ShadowRecordMS = 0.0;
+		ShadowSubmitMS = 0.0;
+		MeshBatchCount = 0;
+		DrawCallCount = 0;
+		InstancedDrawCount = 0;
+		MergedInstanceCount = 0;
+	}
+};
+
+// 렌더 통계 전역 매니저 (싱글톤)
+// UStatsOverlayD2D에서 접근할 수 있도록 전역 통계 제공
+class FRenderStatManager
+{
+public:
+	static FRenderStatManager& GetInstance()
+	{
+		static FRenderStatManager Instance;
+		return Instance;
+	}
+
+	// 인스턴싱 병합 결과 누적
+	void AddInstancingResult(uint32 InBatchCount, uint32 InDrawCallCount, uint32 InInstancedDrawCount, uint32 InMergedInstanceCount)
+	{
+		CurrentStats.MeshBatchCount += InBatchCount;
+		CurrentStats.DrawCallCount += InDrawCallCount;
+		CurrentStats.InstancedDrawCount += InInstancedDrawCount;
+		CurrentStats.MergedInstanceCount += InMergedInstanceCount;
+	}
+
+	// 그림자 패스 녹화 결과 누적
+	void AddShadowPassResult(uint32 InPassCount, uint32 InRecordSlots, double InRecordMS, double InSubmitMS)
+	{
+		CurrentStats.ShadowPassCount += InPassCount;
+		if (InRecordSlots > CurrentStats.ShadowRecordSlots)
+		{
+			CurrentStats.ShadowRecordSlots = InRecordSlots;
+		}
+		CurrentStats.ShadowRecordMS += InRecordMS;
+		CurrentStats.ShadowSubmitMS += InSubmitMS;
+	}
+
+	// 통계 조회
+	const FRenderStats& GetStats() const
+	{
+		return CurrentStats;
+	}
+
+	// 매 프레임 시작 시 호출
+	void ResetFrameStats()
+	{
+		CurrentStats.Reset();
+	}
+
+private:
+	FRenderStatManager() = default;
+	~FRenderStatManager() = default;
+	FRenderStatManager(const FRenderStatManager&) = delete;
+	FRenderStatManager& operator=(const FRenderStatManager&) = delete;
+
+	FRenderStats CurrentStats;
+};
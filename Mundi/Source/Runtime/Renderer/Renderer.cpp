@@ -32,6 +32,7 @@
 #include "SceneRenderer.h"
 #include "SceneView.h"
 #include "SkinningStats.h"
+#include "RenderStats.h"
 #include "PlatformTime.h"
 
 #include <Windows.h>
@@ -71,8 +72,9 @@ void URenderer::BeginFrame()
 	// 지연 해제 큐 처리 (GPU 안전성 확보)
 	ProcessDeferredReleases();
 
-	// 프레임별 통계 초기화 (데칼, 스키닝)
+	// 프레임별 통계 초기화 (데칼, 스키닝, 드로우 콜)
 	FDecalStatManager::GetInstance().ResetFrameStats();
+	FRenderStatManager::GetInstance().ResetFrameStats();
 
 	// 이전 프레임의 GPU draw 시간 가져오기 (비동기, N-7 프레임 결과)
 	double LastGPUDrawTimeMS = FSkinningStatManager::GetInstance().GetGPUDrawTimeMS(RHIDevice->GetDeviceContext());
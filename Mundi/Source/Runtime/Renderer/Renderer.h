@@ -1,6 +1,8 @@
 ﻿#pragma once
 #include "RHIDevice.h"
 #include "LineDynamicMesh.h"
+#include "MeshBatchSort.h"
+#include "MeshBatchInstancer.h"
 
 class UStaticMeshComponent;
 class UTextRenderComponent;
@@ -52,6 +54,12 @@ public:
 	// Deferred buffer release system (GPU-safe resource management)
 	void DeferredReleaseBuffer(ID3D11Buffer* Buffer);
 
+	// 드로우 리스트 정렬기 (FSceneRenderer는 매 프레임 생성되므로 정렬 버퍼는 여기서 유지)
+	FMeshBatchSorter& GetMeshBatchSorter() { return MeshBatchSorter; }
+
+	// 자동 인스턴싱 (인스턴스 버퍼를 프레임 간 재사용)
+	FMeshBatchInstancer& GetMeshBatchInstancer() { return MeshBatchInstancer; }
+
 private:
 	// Deferred release structure
 	struct FDeferredRelease
@@ -89,5 +97,8 @@ private:
 	ID3D11ShaderResourceView* PreSRV = nullptr;*/
 
 	ACameraActor* CurrentCamera = nullptr;
+
+	FMeshBatchSorter MeshBatchSorter;
+	FMeshBatchInstancer MeshBatchInstancer;
 };
 
@@ -36,6 +36,10 @@
 #include "SpotLightComponent.h"
 #include "SwapGuard.h"
 #include "MeshBatchElement.h"
+#include "MeshBatchSort.h"
+#include "MeshBatchInstancer.h"
+#include "RenderStats.h"
+#include "TaskScheduler.h"
 #include "SceneView.h"
 #include "Shader.h"
 #include "ResourceManager.h"
@@ -100,7 +104,9 @@ void FSceneRenderer::Render()
     PrepareView();
     // (Background is cleared per-path when binding service color)
     // 렌더링할 대상 수집 (Cull + Gather)
+	TIME_PROFILE(SceneGather)
     GatherVisibleProxies();
+	TIME_PROFILE_END(SceneGather)
 
 	TIME_PROFILE(ShadowMapPass)
 	RenderShadowMaps();
@@ -112,7 +118,9 @@ void FSceneRenderer::Render()
 		View->RenderSettings->GetViewMode() == EViewMode::VMI_Lit_Lambert)
 	{
 		World->GetLightManager()->UpdateLightBuffer(RHIDevice);
+		TIME_PROFILE(TileLightCulling)
 		PerformTileLightCulling();	// 타일 기반 라이트 컬링 수행
+		TIME_PROFILE_END(TileLightCulling)
 		RenderLitPath();
 		RenderPostProcessingPasses();	// 후처리 체인 실행
 		RenderTileCullingDebug();	// 타일 컬링 디버그 시각화 draw
@@ -310,13 +318,15 @@ void FSceneRenderer::RenderShadowMaps()
 
 	// 2. 그림자 캐스터(Caster) 메시 수집
 	TArray<FMeshBatchElement> ShadowMeshBatches;
+	CollectTargets.Empty();
 	for (UMeshComponent* MeshComponent : Proxies.Meshes)
 	{
 		if (MeshComponent && MeshComponent->IsCastShadows() && MeshComponent->IsVisible())
 		{
-			MeshComponent->CollectMeshBatches(ShadowMeshBatches, View);
+			CollectTargets.Add(MeshComponent);
 		}
 	}
+	CollectMeshBatchesParallel(CollectTargets, ShadowMeshBatches);
 
 	// NOTE: 카메라 오버라이드 기능을 항상 활성화 하기 위해서 그림자를 그릴 곳이 없어도 함수 실행
 	//if (ShadowMeshBatches.IsEmpty()) return;
@@ -398,48 +408,56 @@ void FSceneRenderer::RenderShadowMaps()
 	// 2.2. 큐브맵 슬라이스 할당 (Allocate only)
 	LightManager->AllocateAtlasCubeSlices(RequestsCube); // FLightManager가 RequestsCube의 AssignedSliceIndex와 Size 업데이트
 
+	// 뎁스 셰이더는 리소스 매니저/셰이더 컴파일을 거치므로 녹화 전에 호출 스레드에서 확정
+	FShadowDepthShaders DepthShaders;
+	const bool bHasDepthShaders = ResolveShadowDepthShaders(DepthShaders);
+
+	// 각 그림자 요청은 자신이 쓰는 RT/DSV, 뷰포트, 상태를 모두 직접 설정하는 독립 패스로 등록하고,
+	// SF_ParallelCommandRecording이 켜져 있으면 워커 스레드의 Deferred Context에서 녹화한 뒤 순서대로 제출한다.
+	// (아틀라스 클리어, 라이트 매니저 데이터 갱신은 호출 스레드에서 직렬로 처리)
+
 	// --- 1단계: 2D 아틀라스 렌더링 (Spot + Directional) ---
+	ID3D11DepthStencilView* DefaultDSV = RHIDevice->GetSceneDSV();
+	bool bRenderedAtlas2D = false;
 	{
 		ID3D11DepthStencilView* AtlasDSV2D = LightManager->GetShadowAtlasDSV2D();
 		ID3D11RenderTargetView* VSMAtlasRTV2D = LightManager->GetVSMShadowAtlasRTV2D();
 		float AtlasTotalSize2D = (float)LightManager->GetShadowAtlasSize2D();
-		ID3D11DepthStencilView* DefaultDSV = RHIDevice->GetSceneDSV();
 		if (AtlasDSV2D && AtlasTotalSize2D > 0)
 		{
+			bRenderedAtlas2D = true;
+
 			ID3D11ShaderResourceView* NullSRV[2] = { nullptr, nullptr };
 			RHIDevice->GetDeviceContext()->PSSetShaderResources(9, 2, NullSRV);
 			
 			float ClearColor[] = {1.0f, 1.0f, 0.0f, 0.0f};
-			EShadowAATechnique ShadowAAType = World->GetRenderSettings().GetShadowAATechnique();
-			switch (ShadowAAType)
+			const bool bUseVSM = DepthShaders.ShadowAAType == EShadowAATechnique::VSM;
+			if (bUseVSM)
 			{
-			case EShadowAATechnique::PCF:
-				RHIDevice->OMSetCustomRenderTargets(0, nullptr, AtlasDSV2D);
-				break;
-			case EShadowAATechnique::VSM:
-				{
-					RHIDevice->OMSetCustomRenderTargets(1, &VSMAtlasRTV2D, AtlasDSV2D);
-					RHIDevice->GetDeviceContext()->ClearRenderTargetView(VSMAtlasRTV2D, ClearColor);
-					break;
-				}				
-			default:
-				RHIDevice->OMSetCustomRenderTargets(0, nullptr, AtlasDSV2D);
-				break;
+				RHIDevice->GetDeviceContext()->ClearRenderTargetView(VSMAtlasRTV2D, ClearColor);
 			}
-
 			RHIDevice->GetDeviceContext()->ClearDepthStencilView(AtlasDSV2D, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1, 0);
 
-			RHIDevice->RSSetState(ERasterizerMode::Shadows);
-			RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
-
 			for (FShadowRenderRequest& Request : Requests2D)
 			{
-				// 뷰포트 설정
-				D3D11_VIEWPORT ShadowVP = { Request.AtlasViewportOffset.X, Request.AtlasViewportOffset.Y, static_cast<FLOAT>(Request.Size), static_cast<FLOAT>(Request.Size), 0.0f, 1.0f };
-				RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
-
-				// 뎁스 패스 렌더링
-				RenderShadowDepthPass(Request, ShadowMeshBatches);
+				if (bHasDepthShaders)
+				{
+					const FShadowRenderRequest* RequestPtr = &Request;
+					ShadowPassScheduler.AddPass("ShadowDepth2D", [this, RequestPtr, &DepthShaders, &ShadowMeshBatches, AtlasDSV2D, VSMAtlasRTV2D, bUseVSM]()
+					{
+						ID3D11RenderTargetView* AtlasRTV = VSMAtlasRTV2D;
+						RHIDevice->OMSetCustomRenderTargets(bUseVSM ? 1 : 0, bUseVSM ? &AtlasRTV : nullptr, AtlasDSV2D);
+						RHIDevice->RSSetState(ERasterizerMode::Shadows);
+						RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
+
+						// 뷰포트 설정
+						D3D11_VIEWPORT ShadowVP = { RequestPtr->AtlasViewportOffset.X, RequestPtr->AtlasViewportOffset.Y, static_cast<FLOAT>(RequestPtr->Size), static_cast<FLOAT>(RequestPtr->Size), 0.0f, 1.0f };
+						RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
+
+						// 뎁스 패스 렌더링
+						RenderShadowDepthPass(DepthShaders, *RequestPtr, ShadowMeshBatches);
+					});
+				}
 
 				FShadowMapData Data;
 				if (Request.Size > 0) // 렌더링 성공
@@ -452,10 +470,7 @@ void FSceneRenderer::RenderShadowMaps()
 				}
 				// 렌더링 실패 시(Size==0) 빈 데이터(기본값) 전달
 				LightManager->SetShadowMapData(Request.LightOwner, Request.SubViewIndex, Data);
-				// vsm srv unbind
 			}
-			ID3D11RenderTargetView* NullRTV[1] = { nullptr };
-			RHIDevice->OMSetCustomRenderTargets(1, NullRTV, DefaultDSV);
 		}
 	}
 
@@ -465,14 +480,6 @@ void FSceneRenderer::RenderShadowMaps()
 		uint32 MaxCubeSlices = LightManager->GetShadowCubeArrayCount(); // MaxCubeSlices는 FLightManager에서 가져옴
 		if (AtlasSizeCube > 0 && MaxCubeSlices > 0)
 		{
-			// 2.1. RHI 상태 설정 (큐브맵)
-			RHIDevice->RSSetState(ERasterizerMode::Shadows);
-			RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual); // 상태 설정 추가
-
-			// 큐브맵은 항상 1:1 종횡비의 전체 뷰포트 사용
-			D3D11_VIEWPORT ShadowVP = { 0.0f, 0.0f, (float)AtlasSizeCube, (float)AtlasSizeCube, 0.0f, 1.0f };
-			RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
-
 			// 이제 RequestsCube 배열을 직접 순회
 			for (FShadowRenderRequest& Request : RequestsCube) // 레퍼런스 유지
 			{
@@ -495,16 +502,57 @@ void FSceneRenderer::RenderShadowMaps()
 
 				// 2.3. 면 렌더링 (기존 로직 유지)
 				ID3D11DepthStencilView* FaceDSV = LightManager->GetShadowCubeFaceDSV(SliceIndex, FaceIndex);
-				if (FaceDSV)
+				if (FaceDSV && bHasDepthShaders)
 				{
-					RHIDevice->OMSetCustomRenderTargets(0, nullptr, FaceDSV);
-					RHIDevice->GetDeviceContext()->ClearDepthStencilView(FaceDSV, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
-					RenderShadowDepthPass(Request, ShadowMeshBatches);
+					const FShadowRenderRequest* RequestPtr = &Request;
+					ShadowPassScheduler.AddPass("ShadowDepthCube", [this, RequestPtr, &DepthShaders, &ShadowMeshBatches, FaceDSV, AtlasSizeCube]()
+					{
+						RHIDevice->OMSetCustomRenderTargets(0, nullptr, FaceDSV);
+						RHIDevice->RSSetState(ERasterizerMode::Shadows);
+						RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
+
+						// 큐브맵은 항상 1:1 종횡비의 전체 뷰포트 사용
+						D3D11_VIEWPORT ShadowVP = { 0.0f, 0.0f, (float)AtlasSizeCube, (float)AtlasSizeCube, 0.0f, 1.0f };
+						RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
+
+						RHIDevice->GetDeviceContext()->ClearDepthStencilView(FaceDSV, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
+						RenderShadowDepthPass(DepthShaders, *RequestPtr, ShadowMeshBatches);
+					});
 				}
 			}
 		}
 	}
 
+	// 등록한 그림자 패스 녹화/제출
+	{
+		const int32 NumShadowPasses = ShadowPassScheduler.GetNumPasses();
+		bool bParallelRecording = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_ParallelCommandRecording);
+
+		// GPU 스키닝 본 버퍼는 Immediate Context에서 Map한 동적 버퍼라 Deferred Context에서는
+		// 다시 WRITE_DISCARD로 Map하기 전까지 사용할 수 없다. 이런 캐스터가 있으면 이번 프레임은 직렬로 그린다.
+		for (const FMeshBatchElement& Batch : ShadowMeshBatches)
+		{
+			if (Batch.BoneMatricesBuffer)
+			{
+				bParallelRecording = false;
+				break;
+			}
+		}
+
+		ShadowPassScheduler.Execute(RHIDevice->GetParallelCommandBackend(), bParallelRecording);
+		FRenderStatManager::GetInstance().AddShadowPassResult(
+			NumShadowPasses,
+			ShadowPassScheduler.WasLastExecutionParallel() ? ShadowPassScheduler.GetLastNumSlots() : 0,
+			ShadowPassScheduler.GetLastRecordMS(),
+			ShadowPassScheduler.GetLastSubmitMS());
+	}
+
+	if (bRenderedAtlas2D)
+	{
+		ID3D11RenderTargetView* NullRTV[1] = { nullptr };
+		RHIDevice->OMSetCustomRenderTargets(1, NullRTV, DefaultDSV);
+	}
+
 	// --- 3. RHI 상태 복구 ---
 	RHIDevice->RSSetState(ERasterizerMode::Solid);
 	ID3D11RenderTargetView* nullRTV = nullptr;
@@ -526,15 +574,15 @@ void FSceneRenderer::RenderShadowMaps()
 	}
 }
 
-void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InShadowBatches)
+bool FSceneRenderer::ResolveShadowDepthShaders(FShadowDepthShaders& OutShaders)
 {
 	// 1. 뎁스 전용 셰이더 로드
 	UShader* DepthVS = UResourceManager::GetInstance().Load<UShader>("Shaders/Shadows/DepthOnly_VS.hlsl");
-	if (!DepthVS || !DepthVS->GetVertexShader()) return;
+	if (!DepthVS || !DepthVS->GetVertexShader()) return false;
 
 	// 기본 셰이더 variant (CPU 스키닝 / 일반 메시용)
 	FShaderVariant* ShaderVariant = DepthVS->GetOrCompileShaderVariant();
-	if (!ShaderVariant) return;
+	if (!ShaderVariant) return false;
 
 	// GPU 스키닝용 셰이더 variant
 	TArray<FShaderMacro> GPUSkinningMacros;
@@ -546,20 +594,31 @@ void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest,
 
 	// vsm용 픽셀 셰이더
 	UShader* DepthPs = UResourceManager::GetInstance().Load<UShader>("Shaders/Shadows/DepthOnly_PS.hlsl");
-	if (!DepthPs || !DepthPs->GetPixelShader()) return;
+	if (!DepthPs || !DepthPs->GetPixelShader()) return false;
 
 	FShaderVariant* ShaderVarianVSM = DepthPs->GetOrCompileShaderVariant();
-	if (!ShaderVarianVSM) return;
+	if (!ShaderVarianVSM) return false;
+
+	OutShaders.DefaultVariant = ShaderVariant;
+	OutShaders.GPUSkinningVariant = GPUSkinningShaderVariant;
+	OutShaders.VSMPixelVariant = ShaderVarianVSM;
+	OutShaders.ShadowAAType = World->GetRenderSettings().GetShadowAATechnique();
+	return true;
+}
+
+void FSceneRenderer::RenderShadowDepthPass(const FShadowDepthShaders& Shaders, const FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InShadowBatches)
+{
+	FShaderVariant* ShaderVariant = Shaders.DefaultVariant;
+	FShaderVariant* GPUSkinningShaderVariant = Shaders.GPUSkinningVariant;
 
 	// 2. 픽셀 셰이더 설정 (VSM/PCF에 따라)
-	EShadowAATechnique ShadowAAType = World->GetRenderSettings().GetShadowAATechnique();
-	switch (ShadowAAType)
+	switch (Shaders.ShadowAAType)
 	{
 	case EShadowAATechnique::PCF:
 		RHIDevice->GetDeviceContext()->PSSetShader(nullptr, nullptr, 0);
 		break;
 	case EShadowAATechnique::VSM:
-		RHIDevice->GetDeviceContext()->PSSetShader(ShaderVarianVSM->PixelShader, nullptr, 0);
+		RHIDevice->GetDeviceContext()->PSSetShader(Shaders.VSMPixelVariant->PixelShader, nullptr, 0);
 		break;
 	default:
 		RHIDevice->GetDeviceContext()->PSSetShader(nullptr, nullptr, 0);
@@ -979,16 +1038,21 @@ void FSceneRenderer::PerformFrustumCulling()
 void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
 {
 	// --- 1. 수집 (Collect) ---
+	TIME_PROFILE(MeshBatchCollect)
 	MeshBatchElements.Empty();
+	CollectTargets.Empty();
+	CollectTargets.Reserve(Proxies.Meshes.Num() + Proxies.Billboards.Num());
 	for (UMeshComponent* MeshComponent : Proxies.Meshes)
 	{
-		MeshComponent->CollectMeshBatches(MeshBatchElements, View);
+		CollectTargets.Add(MeshComponent);
 	}
 
 	for (UBillboardComponent* BillboardComponent : Proxies.Billboards)
 	{
-		BillboardComponent->CollectMeshBatches(MeshBatchElements, View);
+		CollectTargets.Add(BillboardComponent);
 	}
+	CollectMeshBatchesParallel(CollectTargets, MeshBatchElements);
+	TIME_PROFILE_END(MeshBatchCollect)
 
 	for (UTextRenderComponent* TextRenderComponent : Proxies.Texts)
 	{
@@ -997,11 +1061,84 @@ void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
 	}
 
 	// --- 2. 정렬 (Sort) ---
-	MeshBatchElements.Sort();
+	// 배치 자체 대신 64비트 키 + 인덱스만 기수 정렬
+	TIME_PROFILE(MeshBatchSort)
+	TArray<FMeshBatchSortKey>& DrawOrder = OwnerRenderer->GetMeshBatchSorter().Sort(MeshBatchElements, View->ViewLocation);
+	TIME_PROFILE_END(MeshBatchSort)
 
-	// --- 3. 그리기 (Draw) ---
+	// --- 3. 자동 인스턴싱 (Merge) ---
+	// 정렬 후 연속된 동일 메시/머티리얼/셰이더 배치를 하나의 인스턴싱 드로우로 병합
+	if (View->RenderSettings->IsShowFlagEnabled(EEngineShowFlags::SF_AutoInstancing))
+	{
+		TIME_PROFILE(MeshBatchInstancing)
+		OwnerRenderer->GetMeshBatchInstancer().MergeInstances(RHIDevice->GetDevice(), RHIDevice->GetDeviceContext(), MeshBatchElements, DrawOrder);
+		TIME_PROFILE_END(MeshBatchInstancing)
+	}
+
+	// --- 4. 그리기 (Draw) ---
 	// GPU 타이머는 Renderer::BeginFrame/EndFrame에서 프레임 레벨로 측정됨
-	DrawMeshBatches(MeshBatchElements, true);
+	TIME_PROFILE(MeshBatchDraw)
+	DrawMeshBatches(MeshBatchElements, true, &DrawOrder);
+	TIME_PROFILE_END(MeshBatchDraw)
+}
+
+void FSceneRenderer::CollectMeshBatchesParallel(const TArray<UPrimitiveComponent*>& InPrimitives, TArray<FMeshBatchElement>& OutMeshBatches)
+{
+	// 청크 하나가 이보다 적은 프리미티브를 맡으면 스레드 동기화 비용이 수집 비용보다 커진다
+	constexpr int32 MinPrimitivesPerChunk = 128;
+
+	const int32 NumPrimitives = InPrimitives.Num();
+	if (NumPrimitives == 0)
+	{
+		return;
+	}
+
+	// 1. 직렬: GPU 버퍼 갱신 등 스레드 안전하지 않은 준비 작업
+	for (UPrimitiveComponent* Primitive : InPrimitives)
+	{
+		Primitive->PrepareMeshBatches(View);
+	}
+
+	const int32 NumChunks = FTaskScheduler::ComputeNumChunks(NumPrimitives, MinPrimitivesPerChunk);
+	if (NumChunks <= 1)
+	{
+		for (UPrimitiveComponent* Primitive : InPrimitives)
+		{
+			Primitive->CollectMeshBatches(OutMeshBatches, View);
+		}
+		return;
+	}
+
+	// 2. 병렬: 청크별 목록에 수집 (청크끼리 공유하는 쓰기 대상 없음)
+	if (ChunkMeshBatches.Num() < NumChunks)
+	{
+		ChunkMeshBatches.SetNum(NumChunks);
+	}
+	for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+	{
+		ChunkMeshBatches[ChunkIndex].Empty();
+	}
+
+	FTaskScheduler::ParallelFor(NumPrimitives, NumChunks, [this, &InPrimitives](int32 ChunkIndex, int32 Begin, int32 End)
+		{
+			TArray<FMeshBatchElement>& ChunkBatches = ChunkMeshBatches[ChunkIndex];
+			for (int32 Index = Begin; Index < End; ++Index)
+			{
+				InPrimitives[Index]->CollectMeshBatches(ChunkBatches, View);
+			}
+		});
+
+	// 3. 청크 순서대로 이어붙이기 (직렬 수집과 같은 순서 → 정렬 결과도 동일)
+	int32 NumCollected = 0;
+	for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+	{
+		NumCollected += ChunkMeshBatches[ChunkIndex].Num();
+	}
+	OutMeshBatches.Reserve(OutMeshBatches.Num() + NumCollected);
+	for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+	{
+		OutMeshBatches.Append(ChunkMeshBatches[ChunkIndex]);
+	}
 }
 
 void FSceneRenderer::RenderDecalPass()
@@ -1183,13 +1320,15 @@ void FSceneRenderer::RenderParticleSystemPass()
 	// 파티클 배치 수집
 	TArray<FMeshBatchElement> AllParticleBatches;
 
+	CollectTargets.Empty();
 	for (UParticleSystemComponent* ParticleSystem : Proxies.ParticleSystems)
 	{
 		if (ParticleSystem && ParticleSystem->IsVisible())
 		{
-			ParticleSystem->CollectMeshBatches(AllParticleBatches, View);
+			CollectTargets.Add(ParticleSystem);
 		}
 	}
+	CollectMeshBatchesParallel(CollectTargets, AllParticleBatches);
 
 	if (AllParticleBatches.Num() == 0)
 		return;
@@ -1553,7 +1692,7 @@ void FSceneRenderer::RenderFinalOverlayLines()
 }
 
 // 수집한 Batch 그리기
-void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw)
+void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw, const TArray<FMeshBatchSortKey>* InDrawOrder)
 {
 	if (InMeshBatches.IsEmpty()) return;
 
@@ -1585,9 +1724,12 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 	ID3D11SamplerState* ShadowSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::Shadow);
 	ID3D11SamplerState* VSMSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::VSM);
 
-	// 정렬된 리스트 순회
-	for (const FMeshBatchElement& Batch : InMeshBatches)
+	// 정렬된 리스트 순회 (정렬 키가 주어지면 키 순서대로 인덱스를 따라감)
+	const int32 NumDraws = InDrawOrder ? InDrawOrder->Num() : InMeshBatches.Num();
+	for (int32 DrawIndex = 0; DrawIndex < NumDraws; ++DrawIndex)
 	{
+		const FMeshBatchElement& Batch = InDrawOrder ? InMeshBatches[(*InDrawOrder)[DrawIndex].Index] : InMeshBatches[DrawIndex];
+
 		// --- 필수 요소 유효성 검사 ---
 		if (!Batch.VertexShader || !Batch.PixelShader || !Batch.VertexBuffer || !Batch.IndexBuffer || Batch.VertexStride == 0)
 		{
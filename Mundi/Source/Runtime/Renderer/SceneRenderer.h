@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "Frustum.h"
+#include "RHIPassScheduler.h"
 
 // TODO : Post Processing 떼어내기, 전방선언으로라든지...
 #include "PostProcessing/FadeInOutPass.h"
@@ -21,6 +22,7 @@ class UDirectionalLightComponent;
 class UPointLightComponent;
 class USpotLightComponent;
 struct FMeshBatchElement;
+struct FMeshBatchSortKey;
 class UMeshComponent;
 class UBillboardComponent;
 class UTextRenderComponent;
@@ -31,6 +33,16 @@ class ULineComponent;
 class UParticleSystemComponent;
 
 struct FCandidateDrawable;
+struct FShaderVariant;
+
+// 그림자 뎁스 패스에서 사용하는 셰이더 (패스 녹화 전에 확정)
+struct FShadowDepthShaders
+{
+	FShaderVariant* DefaultVariant = nullptr;		// CPU 스키닝 / 일반 메시
+	FShaderVariant* GPUSkinningVariant = nullptr;	// GPU_SKINNING=1 (없으면 nullptr)
+	FShaderVariant* VSMPixelVariant = nullptr;		// VSM 모멘트 출력
+	EShadowAATechnique ShadowAAType = EShadowAATechnique::PCF;
+};
 
 // 렌더링할 대상들의 집합을 담는 구조체
 struct FVisibleRenderProxySet
@@ -85,7 +97,10 @@ private:
 	void RenderSceneDepthPath();
 
 	void RenderShadowMaps();
-	void RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InShadowBatches);
+	/** @brief 그림자 뎁스 셰이더 variant를 확정합니다. 패스 녹화(워커 스레드) 전에 호출 스레드에서 호출해야 합니다. */
+	bool ResolveShadowDepthShaders(FShadowDepthShaders& OutShaders);
+	/** @brief 그림자 요청 하나의 뎁스를 그립니다. RT/DSV, 뷰포트, 래스터라이저 상태는 호출자가 설정합니다. */
+	void RenderShadowDepthPass(const FShadowDepthShaders& Shaders, const FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InShadowBatches);
 
 	/** @brief 렌더링에 필요한 포인터들이 유효한지 확인합니다. */
 	bool IsValid() const;
@@ -105,7 +120,18 @@ private:
 	/** @brief 불투명(Opaque) 객체들을 렌더링하는 패스입니다. */
 	void RenderOpaquePass(EViewMode InRenderViewMode);
 
-	void DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw);
+	/**
+	 * @brief 프리미티브 목록의 배치를 병렬로 수집해 OutMeshBatches 뒤에 추가합니다.
+	 *        PrepareMeshBatches는 직렬로 먼저 호출하고, CollectMeshBatches는 청크 단위로 워커 스레드에서
+	 *        청크별 목록에 수집한 뒤 청크 순서대로 이어붙입니다. (결과 순서는 직렬 수집과 동일)
+	 */
+	void CollectMeshBatchesParallel(const TArray<UPrimitiveComponent*>& InPrimitives, TArray<FMeshBatchElement>& OutMeshBatches);
+
+	/**
+	 * @brief 수집한 배치를 그립니다.
+	 * @param InDrawOrder 정렬된 (키, 인덱스) 목록. nullptr이면 InMeshBatches 순서대로 그립니다.
+	 */
+	void DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw, const TArray<FMeshBatchSortKey>* InDrawOrder = nullptr);
 
 	/** @brief 데칼(Decal)을 렌더링하는 패스입니다. */
 	void RenderDecalPass();
@@ -152,6 +178,13 @@ private:
 	// 각 패스에서 수집된 드로우 콜 정보 리스트
 	TArray<FMeshBatchElement> MeshBatchElements;
 
+	// 병렬 수집용 임시 목록 (수집 대상 프리미티브, 청크별 배치)
+	TArray<UPrimitiveComponent*> CollectTargets;
+	TArray<TArray<FMeshBatchElement>> ChunkMeshBatches;
+
+	// 그림자 뎁스 패스 녹화/제출
+	FRHIPassScheduler ShadowPassScheduler;
+
 	// 타일 기반 라이트 컬링 시스템 (매 프레임 생성되고 소멸되어서 스마트 포인터로 설정)
 	std::unique_ptr<FTileLightCuller> TileLightCuller;
 
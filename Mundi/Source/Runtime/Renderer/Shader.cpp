@@ -127,7 +127,7 @@ void UShader::Load(const FString& InShaderPath, ID3D11Device* InDevice, const TA
 		{
 			SetLastModifiedTime(std::filesystem::file_time_type::clock::now());
 		}
-		// Include 파일 파싱 (최초 1회)
+		// Include 파일 파싱 (최초 1회, SUPPORTS_GPU_INSTANCING 선언도 함께 확인)
 		ParseIncludeFiles(FilePath);
 	}
 
@@ -161,12 +161,22 @@ FShaderVariant* UShader::GetOrCompileShaderVariant(const TArray<FShaderMacro>& I
 	uint64 Key = GenerateShaderKey(InMacros);
 
 	// 2. 맵에 이미 컴파일된 Variant가 있는지 확인
-	if (FShaderVariant* Found = ShaderVariantMap.Find(Key))
 	{
-		return Found; // 찾았으면 즉시 반환
+		std::shared_lock<std::shared_mutex> ReadLock(ShaderVariantMapMutex);
+		if (FShaderVariant* Found = ShaderVariantMap.Find(Key))
+		{
+			return Found; // 찾았으면 즉시 반환 (TMap 원소 주소는 재해시 후에도 유지됨)
+		}
 	}
 
 	// 3. 맵에 없음 -> 새로 컴파일
+	// 다른 스레드가 잠금을 기다리는 사이 같은 Variant를 컴파일했을 수 있으므로 다시 확인
+	std::unique_lock<std::shared_mutex> WriteLock(ShaderVariantMapMutex);
+	if (FShaderVariant* Found = ShaderVariantMap.Find(Key))
+	{
+		return Found;
+	}
+
 	FShaderVariant NewShaderVariant;
 	bool bSuccess = CompileVariantInternal(InDevice, FilePath, InMacros, NewShaderVariant);
 
@@ -315,13 +325,19 @@ void UShader::CreateInputLayout(ID3D11Device* Device, const FString& InShaderPat
 	TArray<D3D11_INPUT_ELEMENT_DESC> descArray = UResourceManager::GetInstance().GetProperInputLayout(InShaderPath);
 
 	// GPU 스키닝을 사용하는 경우 BoneIndices와 BoneWeights 추가
+	// 자동 인스턴싱을 사용하는 경우 슬롯 1에 인스턴스 데이터 추가
 	bool bHasGPUSkinning = false;
+	bool bHasGPUInstancing = false;
 	for (const FShaderMacro& Macro : InMacros)
 	{
-		if (Macro.Name.ToString() == "GPU_SKINNING")
+		const FString MacroName = Macro.Name.ToString();
+		if (MacroName == "GPU_SKINNING")
 		{
 			bHasGPUSkinning = true;
-			break;
+		}
+		else if (MacroName == "GPU_INSTANCING")
+		{
+			bHasGPUInstancing = true;
 		}
 	}
 
@@ -333,6 +349,20 @@ void UShader::CreateInputLayout(ID3D11Device* Device, const FString& InShaderPat
 		descArray.Add({ "BLENDWEIGHT", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 80, D3D11_INPUT_PER_VERTEX_DATA, 0 });
 	}
 
+	if (bHasGPUInstancing && bSupportsGPUInstancing)
+	{
+		// 자동 인스턴싱을 위한 인스턴스 스트림 (슬롯 1)
+		// FStaticMeshInstanceData: World(64) + WorldInverseTranspose 3행(48) + ObjectID(4) + Padding(12)
+		descArray.Add({ "INSTANCE_WORLD", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 0, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+		descArray.Add({ "INSTANCE_WORLD", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 16, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+		descArray.Add({ "INSTANCE_WORLD", 2, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 32, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+		descArray.Add({ "INSTANCE_WORLD", 3, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 48, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+		descArray.Add({ "INSTANCE_NORMAL", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 64, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+		descArray.Add({ "INSTANCE_NORMAL", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 80, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+		descArray.Add({ "INSTANCE_NORMAL", 2, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 96, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+		descArray.Add({ "INSTANCE_UUID", 0, DXGI_FORMAT_R32_UINT, 1, 112, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+	}
+
 	const D3D11_INPUT_ELEMENT_DESC* layout = descArray.data();
 	uint32 layoutCount = static_cast<uint32>(descArray.size());
 
@@ -529,10 +559,12 @@ bool UShader::Reload(ID3D11Device* InDevice)
 }
 
 // Include 파일 파싱 (재귀적으로 처리)
+// 메인 파일의 '#define SUPPORTS_GPU_INSTANCING' 선언도 여기서 읽어 bSupportsGPUInstancing을 설정
 void UShader::ParseIncludeFiles(const FString& ShaderPath)
 {
 	// 이미 파싱된 파일 목록 초기화
 	IncludedFiles.clear();
+	bSupportsGPUInstancing = false;
 
 	// 파싱할 파일 큐
 	TArray<FString> FilesToParse;
@@ -581,6 +613,13 @@ void UShader::ParseIncludeFiles(const FString& ShaderPath)
 			}
 			Line = Line.substr(FirstNonSpace);
 
+			// 셰이더가 GPU_INSTANCING 입력 경로를 구현했다고 선언 (메인 파일에서만 인정)
+			if (CurrentFile == ShaderPath && Line.compare(0, 31, "#define SUPPORTS_GPU_INSTANCING") == 0)
+			{
+				bSupportsGPUInstancing = true;
+				continue;
+			}
+
 			// #include 지시문 찾기
 			if (Line.compare(0, 8, "#include") == 0)
 			{
@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "ResourceBase.h"
 #include <filesystem>
+#include <shared_mutex>
 
 struct FShaderMacro
 {
@@ -54,6 +55,9 @@ public:
 	ID3D11VertexShader* GetVertexShader(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
 	ID3D11PixelShader* GetPixelShader(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
 
+	// 자동 인스턴싱(GPU_INSTANCING variant) 지원 여부
+	bool SupportsGPUInstancing() const { return bSupportsGPUInstancing; }
+
 	// Hot Reload Support
 	bool IsOutdated() const;
 	bool Reload(ID3D11Device* InDevice);
@@ -65,6 +69,13 @@ protected:
 private:
 	TMap<uint64, FShaderVariant> ShaderVariantMap;
 
+	// 병렬 배치 수집 중 여러 스레드가 GetOrCompileShaderVariant를 호출하므로 조회/추가를 보호
+	// (조회는 공유 잠금, 컴파일·추가는 배타 잠금)
+	std::shared_mutex ShaderVariantMapMutex;
+
+	// 셰이더 메인 파일에 '#define SUPPORTS_GPU_INSTANCING'이 있으면 true (로드 시 ParseIncludeFiles에서 설정)
+	bool bSupportsGPUInstancing = false;
+
 	// Store included files (e.g., "Shaders/Common/LightingCommon.hlsl")
 	// Used for hot reload - if any included file changes, reload this shader
 	TArray<FString> IncludedFiles;
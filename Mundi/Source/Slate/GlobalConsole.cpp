@@ -1,10 +1,17 @@
 ﻿#include "pch.h"
 #include "Widgets/ConsoleWidget.h"
+#include <mutex>
 
 IMPLEMENT_CLASS(UGlobalConsole)
 
 UConsoleWidget* UGlobalConsole::ConsoleWidget = nullptr;
 
+namespace
+{
+    // 워커 스레드(병렬 배치 수집 등)에서도 UE_LOG를 호출할 수 있으므로 로그 추가를 직렬화
+    std::mutex GConsoleLogMutex;
+}
+
 void UGlobalConsole::Initialize()
 {
     // Nothing special to initialize
@@ -46,6 +53,7 @@ void UGlobalConsole::Log(const char* fmt, ...)
 void UGlobalConsole::LogV(const char* fmt, va_list args)
 {
 #ifdef _EDITOR
+    std::lock_guard<std::mutex> Lock(GConsoleLogMutex);
     if (ConsoleWidget)
     {
         ConsoleWidget->VAddLog(fmt, args);
@@ -16,6 +16,9 @@
 #include "SkinningStats.h"
 #include "SkinnedMeshComponent.h"
 #include "ParticleStats.h"
+#include "RenderStats.h"
+#include "TaskScheduler.h"
+#include "TickTaskManager.h"
 
 #pragma comment(lib, "d2d1")
 #pragma comment(lib, "dwrite")
@@ -166,7 +169,7 @@ static void DrawTextBlock(
 
 void UStatsOverlayD2D::Draw()
 {
-	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowLights && !bShowShadow && !bShowSkinning && !bShowParticles) || !SwapChain)
+	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowLights && !bShowShadow && !bShowSkinning && !bShowParticles && !bShowRender && !bShowTick) || !SwapChain)
 		return;
 
 	// D2D 리소스 초기화 (최초 1회만 실행)
@@ -540,6 +543,106 @@ void UStatsOverlayD2D::Draw()
 		NextY += particlePanelHeight + Space;
 	}
 
+	if (bShowRender)
+	{
+		const FRenderStats& Stats = FRenderStatManager::GetInstance().GetStats();
+		const FTimeProfile& CollectProfile = FScopeCycleCounter::GetTimeProfile("MeshBatchCollect");
+		const FTimeProfile& SortProfile = FScopeCycleCounter::GetTimeProfile("MeshBatchSort");
+		const FTimeProfile& InstancingProfile = FScopeCycleCounter::GetTimeProfile("MeshBatchInstancing");
+
+		// 병합으로 줄어든 드로우 콜 비율
+		const double SavedPercent = Stats.MeshBatchCount > 0
+			? 100.0 * (Stats.MeshBatchCount - Stats.DrawCallCount) / Stats.MeshBatchCount
+			: 0.0;
+
+		wchar_t RenderBuf[512];
+		swprintf_s(RenderBuf,
+			L"[Render]\n"
+			L"Mesh Batches: %u\n"
+			L"Draw Calls: %u (-%.1f%%)\n"
+			L"Instanced Draws: %u\n"
+			L"Merged Instances: %u\n"
+			L"Collect: %.3f ms (%d threads)\n"
+			L"Sort: %.3f ms\n"
+			L"Instancing: %.3f ms\n"
+			L"Shadow Passes: %u (%u contexts)\n"
+			L"Shadow Record/Submit: %.3f / %.3f ms",
+			Stats.MeshBatchCount,
+			Stats.DrawCallCount,
+			SavedPercent,
+			Stats.InstancedDrawCount,
+			Stats.MergedInstanceCount,
+			CollectProfile.Milliseconds,
+			FTaskScheduler::GetNumWorkers() + 1,
+			SortProfile.Milliseconds,
+			InstancingProfile.Milliseconds,
+			Stats.ShadowPassCount,
+			Stats.ShadowRecordSlots,
+			Stats.ShadowRecordMS,
+			Stats.ShadowSubmitMS);
+
+		const float renderPanelHeight = 210.0f;
+		D2D1_RECT_F renderRc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + renderPanelHeight);
+
+		DrawTextBlock(
+			D2dCtx, CachedBrush, TextFormat, RenderBuf, renderRc,
+			D2D1::ColorF(0, 0, 0, 0.6f),
+			D2D1::ColorF(D2D1::ColorF::LightGreen));
+
+		NextY += renderPanelHeight + Space;
+	}
+
+	if (bShowTick)
+	{
+		FTickFrameStats Stats;
+		if (GWorld && GWorld->GetTickTaskManager())
+		{
+			Stats = GWorld->GetTickTaskManager()->GetFrameStats();
+		}
+
+		// 그룹별 시간 / 월드가 틱한 컴포넌트 수 (병렬) / 웨이브 수
+		wchar_t GroupBuf[4][96];
+		for (int32 i = 0; i < static_cast<int32>(ETickingGroup::Max); ++i)
+		{
+			const FTickGroupStats& Group = Stats.Groups[i];
+			swprintf_s(GroupBuf[i], L"%hs: %.3f ms (%d/%d par, %d waves)",
+				FTickTaskManager::GetTickGroupName(static_cast<ETickingGroup>(i)),
+				Group.TimeMS, Group.NumParallel, Group.NumComponents, Group.NumWaves);
+		}
+
+		wchar_t TickBuf[768];
+		swprintf_s(TickBuf,
+			L"[Tick]\n"
+			L"Actors: %d / %d registered (%.3f ms)\n"
+			L"Components: %d registered\n"
+			L"%s\n"
+			L"%s\n"
+			L"Physics: %.3f ms\n"
+			L"%s\n"
+			L"%s\n"
+			L"Workers: %d",
+			Stats.NumActors,
+			Stats.NumRegisteredActors,
+			Stats.ActorTickMS,
+			Stats.NumRegisteredComponents,
+			GroupBuf[0],
+			GroupBuf[1],
+			Stats.PhysicsMS,
+			GroupBuf[2],
+			GroupBuf[3],
+			FTaskScheduler::GetNumWorkers() + 1);
+
+		const float tickPanelHeight = 190.0f;
+		D2D1_RECT_F tickRc = D2D1::RectF(Margin, NextY, Margin + SkinningPanelWidth, NextY + tickPanelHeight);
+
+		DrawTextBlock(
+			D2dCtx, CachedBrush, TextFormat, TickBuf, tickRc,
+			D2D1::ColorF(0, 0, 0, 0.6f),
+			D2D1::ColorF(D2D1::ColorF::Khaki));
+
+		NextY += tickPanelHeight + Space;
+	}
+
 	D2dCtx->EndDraw();
 	D2dCtx->SetTarget(nullptr);
 
@@ -639,3 +742,23 @@ void UStatsOverlayD2D::ToggleParticles()
 {
 	bShowParticles = !bShowParticles;
 }
+
+void UStatsOverlayD2D::SetShowRender(bool b)
+{
+	bShowRender = b;
+}
+
+void UStatsOverlayD2D::ToggleRender()
+{
+	bShowRender = !bShowRender;
+}
+
+void UStatsOverlayD2D::SetShowTick(bool b)
+{
+	bShowTick = b;
+}
+
+void UStatsOverlayD2D::ToggleTick()
+{
+	bShowTick = !bShowTick;
+}
@@ -21,6 +21,8 @@ public:
     void SetShowShadow(bool b);
     void SetShowSkinning(bool b);
     void SetShowParticles(bool b);
+    void SetShowRender(bool b);
+    void SetShowTick(bool b);
     void ToggleFPS();
     void ToggleMemory();
     void TogglePicking();
@@ -30,6 +32,8 @@ public:
     void ToggleShadow();
     void ToggleSkinning();
     void ToggleParticles();
+    void ToggleRender();
+    void ToggleTick();
     bool IsFPSVisible() const { return bShowFPS; }
     bool IsMemoryVisible() const { return bShowMemory; }
     bool IsPickingVisible() const { return bShowPicking; }
@@ -39,6 +43,8 @@ public:
     bool IsShadowVisible() const { return bShowShadow; }
     bool IsSkinningVisible() const { return bShowSkinning; }
     bool IsParticlesVisible() const { return bShowParticles; }
+    bool IsRenderVisible() const { return bShowRender; }
+    bool IsTickVisible() const { return bShowTick; }
 
 private:
     UStatsOverlayD2D() = default;
@@ -60,6 +66,8 @@ private:
     bool bShowLights = false;
     bool bShowSkinning = false;
     bool bShowParticles = false;
+    bool bShowRender = false;
+    bool bShowTick = false;
 
     ID3D11Device* D3DDevice = nullptr;
     ID3D11DeviceContext* D3DContext = nullptr;
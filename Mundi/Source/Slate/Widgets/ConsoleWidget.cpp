@@ -6,6 +6,14 @@
 #include "SlateManager.h"
 #include "SkinnedMeshComponent.h"
 #include "PlatformCrashHandler.h"
+#include "MeshBatchSort.h"
+#include "RHIPassScheduler.h"
+#include "ObjGeometryParser.h"
+#include "AssetStreamer.h"
+#include "JsonStream.h"
+#include "MeshBVH.h"
+#include "CollisionManager.h"
+#include "LuaManager.h"
 #include <windows.h>
 #include <cstdarg>
 #include <cctype>
@@ -52,6 +60,8 @@ void UConsoleWidget::Initialize()
 	HelpCommandList.Add("STAT PICKING");
 	HelpCommandList.Add("STAT DECAL");
 	HelpCommandList.Add("STAT SKINNING");
+	HelpCommandList.Add("STAT RENDER");
+	HelpCommandList.Add("STAT TICK");
 	HelpCommandList.Add("SKINNING GPU");
 	HelpCommandList.Add("SKINNING CPU");
 	HelpCommandList.Add("STAT ALL");
@@ -64,6 +74,19 @@ void UConsoleWidget::Initialize()
 	HelpCommandList.Add("CRASHIN <seconds>");
 	HelpCommandList.Add("CANCELCRASH");
 	HelpCommandList.Add("THROWEXCEPTION");
+	HelpCommandList.Add("BENCH MESHSORT");
+	HelpCommandList.Add("TEST PASSSCHEDULER");
+	HelpCommandList.Add("TEST LUABATCH");
+	HelpCommandList.Add("BENCH OBJPARSER [faces]");
+	HelpCommandList.Add("STAT STREAMING");
+	HelpCommandList.Add("BENCH JSON [MB]");
+	HelpCommandList.Add("BENCH MESHBVH [tris]");
+	HelpCommandList.Add("BENCH OVERLAP [shapes]");
+	HelpCommandList.Add("BENCH SWEEP [sweeps]");
+	HelpCommandList.Add("BENCH PHYSICS [bodies]");
+	HelpCommandList.Add("BENCH LUASPAWN [instances]");
+	HelpCommandList.Add("BENCH LUAPROPS [reads]");
+	HelpCommandList.Add("BENCH DELEGATE [broadcasts]");
 
 	// Add welcome messages
 	AddLog("=== Console Widget Initialized ===");
@@ -368,9 +391,22 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		AddLog("- STAT LIGHT");
 		AddLog("- STAT SHADOW");
 		AddLog("- STAT PARTICLES");
+		AddLog("- STAT RENDER");
+		AddLog("- STAT TICK");
+		AddLog("- STAT STREAMING");
 		AddLog("- STAT ALL");
 		AddLog("- STAT NONE");
 	}
+	else if (Stricmp(command_line, "STAT STREAMING") == 0)
+	{
+		const FAssetStreamingSettings& Settings = FAssetStreamer::GetSettings();
+		const FAssetStreamer::FStats Stats = FAssetStreamer::GetStats();
+		AddLog("Asset Streaming: %s (budget %u MB)", Settings.bEnabled ? "On" : "Off", Settings.BudgetMB);
+		AddLog("- Requests  : %d total, %d pending, %d failed", Stats.NumRequested, Stats.NumPending, Stats.NumFailed);
+		AddLog("- Resident  : %d meshes (%d referenced, %d held by handles), %.2f MB", Stats.NumEvictable, Stats.NumReferenced, Stats.NumHandlePinned, Stats.ResidentBytes / (1024.0 * 1024.0));
+		AddLog("- Evicted   : %d meshes, %.2f MB", Stats.NumEvicted, Stats.EvictedBytes / (1024.0 * 1024.0));
+		AddLog("- Last residency update: %.3f ms", Stats.LastResidencyMS);
+	}
 	else if (Stricmp(command_line, "STAT FPS") == 0)
 	{
 		UStatsOverlayD2D::Get().ToggleFPS();
@@ -406,6 +442,8 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowSkinning(true);
 		UStatsOverlayD2D::Get().SetShowShadow(true);
 		UStatsOverlayD2D::Get().SetShowParticles(true);
+		UStatsOverlayD2D::Get().SetShowRender(true);
+		UStatsOverlayD2D::Get().SetShowTick(true);
 		AddLog("STAT: ON");
 	}
 	else if (Stricmp(command_line, "STAT SKINNING") == 0)
@@ -423,6 +461,16 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().ToggleParticles();
 		AddLog("STAT PARTICLES TOGGLED");
 	}
+	else if (Stricmp(command_line, "STAT RENDER") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleRender();
+		AddLog("STAT RENDER TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT TICK") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleTick();
+		AddLog("STAT TICK TOGGLED");
+	}
 	else if (Stricmp(command_line, "STAT NONE") == 0)
 	{
 		UStatsOverlayD2D::Get().SetShowFPS(false);
@@ -433,6 +481,8 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowSkinning(false);
 		UStatsOverlayD2D::Get().SetShowShadow(false);
 		UStatsOverlayD2D::Get().SetShowParticles(false);
+		UStatsOverlayD2D::Get().SetShowRender(false);
+		UStatsOverlayD2D::Get().SetShowTick(false);
 		AddLog("STAT: OFF");
 	}
 	else if (Strnicmp(command_line, "SKINNING GPU", 12) == 0)
@@ -499,6 +549,171 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		// C++ 예외 던지기 (std::runtime_error)
 		throw std::runtime_error("Intentional C++ exception thrown from console command!");
 	}
+	else if (Stricmp(command_line, "BENCH MESHSORT") == 0)
+	{
+		// 합성 배치 100k개로 드로우 리스트 정렬 비용 비교
+		const FMeshBatchSortBenchmarkResult Result = FMeshBatchSorter::RunBenchmark(100000);
+		AddLog("MeshBatch Sort Benchmark (%d elements)", Result.NumElements);
+		AddLog("- Comparison Sort (operator<) : %.3f ms", Result.ComparisonSortMS);
+		AddLog("- Build Keys                  : %.3f ms", Result.BuildKeysMS);
+		AddLog("- Radix Sort (key, index)     : %.3f ms", Result.RadixSortMS);
+		AddLog("- Order Valid                 : %s", Result.bOrderValid ? "true" : "false");
+	}
+	else if (Stricmp(command_line, "TEST PASSSCHEDULER") == 0)
+	{
+		// Null 백엔드로 패스 병렬 녹화/순서 제출 검증 (GPU 미사용)
+		const bool bPassed = FRHIPassScheduler::RunNullBackendSelfTest(64);
+		AddLog("RHI Pass Scheduler (Null Backend, 64 passes): %s", bPassed ? "PASSED" : "FAILED");
+	}
+	else if (Stricmp(command_line, "TEST LUABATCH") == 0)
+	{
+		// TickBatch 호출 중 스폰(새 배치 등록)/파괴가 일어나도 배치 틱이 해제된 메모리를 읽지 않는지 검증
+		FLuaManager* LuaManager = GWorld ? GWorld->GetLuaManager() : nullptr;
+		if (!LuaManager)
+		{
+			AddLog("TEST LUABATCH: no Lua manager in current world");
+		}
+		else
+		{
+			const bool bPassed = LuaManager->RunTickBatchReentrancySelfTest();
+			AddLog("Lua Tick Batch Reentrancy (spawn + destroy during TickBatch): %s", bPassed ? "PASSED" : "FAILED");
+		}
+	}
+	else if (Strnicmp(command_line, "BENCH OBJPARSER", 15) == 0)
+	{
+		// 생성한 OBJ로 레거시(stringstream) / 메모리 매핑 직렬 / 병렬 파싱 비교 (기본 500만 면)
+		const int32 RequestedFaces = atoi(command_line + 15);
+		const FObjParserBenchmarkResult Result = FObjGeometryParser::RunBenchmark(RequestedFaces > 0 ? RequestedFaces : 5000000);
+		AddLog("OBJ Parser Benchmark (%d faces, %.1f MB)", Result.NumFaces, Result.FileSizeMB);
+		AddLog("- Generate                    : %.3f ms", Result.GenerateMS);
+		AddLog("- Legacy (getline+stringstream): %.3f ms", Result.LegacyParseMS);
+		AddLog("- Mapped Serial               : %.3f ms (match: %s)", Result.SerialParseMS, Result.bSerialMatches ? "true" : "false");
+		AddLog("- Mapped Parallel (%d chunks) : %.3f ms (match: %s)", Result.NumParallelChunks, Result.ParallelParseMS, Result.bParallelMatches ? "true" : "false");
+	}
+	else if (Strnicmp(command_line, "BENCH JSON", 10) == 0)
+	{
+		// 합성 씬 JSON으로 레거시(JSON::Load / dump) / 스트리밍 읽기·쓰기 비교 (기본 100MB)
+		const int32 RequestedMB = atoi(command_line + 10);
+		const FJsonStreamBenchmarkResult Result = FJsonStreamBenchmark::Run(RequestedMB > 0 ? RequestedMB : 100);
+		AddLog("JSON Stream Benchmark (%d actors, %.1f MB)", Result.NumActors, Result.FileSizeMB);
+		AddLog("- Generate (streaming writer) : %.3f ms", Result.GenerateMS);
+		AddLog("- Legacy Parse (JSON::Load)   : %.3f ms", Result.LegacyParseMS);
+		AddLog("- SAX Parse (%llu events)     : %.3f ms", Result.NumEvents, Result.SaxParseMS);
+		AddLog("- SAX -> DOM (%llu nodes)     : %.3f ms (match: %s)", Result.NumDomNodes, Result.DomBuildMS, Result.bDomMatches ? "true" : "false");
+		AddLog("- Legacy Write (dump)         : %.3f ms", Result.LegacyWriteMS);
+		AddLog("- Stream Write                : %.3f ms (round trip: %s)", Result.StreamWriteMS, Result.bRoundTripMatches ? "true" : "false");
+	}
+	else if (Strnicmp(command_line, "BENCH MESHBVH", 13) == 0)
+	{
+		// 합성 구 메시(기본 100만 삼각형)에 레이 100만 개: 기존 priority_queue 순회 / 스택+패킷 / 배치 API 처리량 비교
+		const int32 RequestedTriangles = atoi(command_line + 13);
+		const FMeshBVHBenchmarkResult Result = FMeshBVH::RunBenchmark(RequestedTriangles > 0 ? RequestedTriangles : 1000000, 1000000);
+		AddLog("Mesh BVH Benchmark (%d tris, %d nodes, %d rays, %d hits)", Result.NumTriangles, Result.NumNodes, Result.NumRays, Result.NumHits);
+		AddLog("- Build (binned SAH)          : %.3f ms", Result.BuildMS);
+		AddLog("- Legacy (priority_queue)     : %.2f MRays/s", Result.LegacyMRaysPerSec);
+		AddLog("- Stack + SoA Packets         : %.2f MRays/s", Result.StackMRaysPerSec);
+		AddLog("- Batch (IntersectRays)       : %.2f MRays/s (match: %s)", Result.BatchMRaysPerSec, Result.bResultsMatch ? "true" : "false");
+	}
+	else if (Strnicmp(command_line, "BENCH OVERLAP", 13) == 0)
+	{
+		// 구 셰이프 100개 ~ N개(기본 1만): 기존 TickComponent O(N^2) 순회 / 충돌 매니저 BVH 겹침 갱신 비교
+		const int32 RequestedShapes = atoi(command_line + 13);
+		const TArray<FOverlapBenchmarkSample> Samples = UCollisionManager::RunOverlapBenchmark(RequestedShapes > 0 ? RequestedShapes : 10000);
+		AddLog("Overlap Benchmark (spheres, ~2 neighbors each)");
+		for (const FOverlapBenchmarkSample& Sample : Samples)
+		{
+			if (Sample.LegacyMS >= 0.0)
+			{
+				AddLog("- %6d shapes | Legacy %9.3f ms (%lld visits) | BVH %7.3f ms + Overlap %7.3f ms (%d tests, %d pairs, match: %s)",
+					Sample.NumShapes, Sample.LegacyMS, Sample.LegacyVisits, Sample.BroadPhaseMS, Sample.OverlapMS,
+					Sample.NumCandidatePairs, Sample.NumOverlapPairs, Sample.bPairsMatch ? "true" : "false");
+			}
+			else
+			{
+				AddLog("- %6d shapes | Legacy   skipped | BVH %7.3f ms + Overlap %7.3f ms (%d tests, %d pairs)",
+					Sample.NumShapes, Sample.BroadPhaseMS, Sample.OverlapMS, Sample.NumCandidatePairs, Sample.NumOverlapPairs);
+			}
+		}
+	}
+	else if (Strnicmp(command_line, "BENCH SWEEP", 11) == 0)
+	{
+		// 박스 2000개 + 스태틱 메시 100개 사이로 캡슐 스윕 N개(기본 1000개): 단일 호출 / SweepBatch 비교
+		const int32 RequestedSweeps = atoi(command_line + 11);
+		const FSweepBenchmarkResult Result = UCollisionManager::RunSweepBenchmark(2000, RequestedSweeps > 0 ? RequestedSweeps : 1000, 100);
+		AddLog("Sweep Benchmark (%d capsule sweeps, %d boxes, %d static meshes, %d hits / %d on meshes)",
+			Result.NumSweeps, Result.NumShapes, Result.NumMeshes, Result.NumHits, Result.NumMeshHits);
+		AddLog("- Single %8.3f ms | Batch %8.3f ms (x%.2f) | match: %s",
+			Result.SingleMS, Result.BatchMS, Result.BatchMS > 0.0 ? Result.SingleMS / Result.BatchMS : 0.0,
+			Result.bResultsMatch ? "true" : "false");
+	}
+	else if (Strnicmp(command_line, "BENCH PHYSICS", 13) == 0)
+	{
+		// 쌓인/떨어지는 강체 N개(기본 5000개)를 120프레임 시뮬레이션: 아일랜드 솔버 스레드 수별 스텝 시간 비교
+		const int32 RequestedBodies = atoi(command_line + 13);
+		const TArray<FPhysicsBenchmarkSample> Samples = UCollisionManager::RunPhysicsBenchmark(RequestedBodies > 0 ? RequestedBodies : 5000, 120);
+		if (!Samples.IsEmpty())
+		{
+			AddLog("Physics Benchmark (%d bodies, %d frames @ 60Hz, %d islands, %d awake, %d contacts)",
+				Samples[0].NumBodies, Samples[0].NumFrames, Samples[0].NumIslands, Samples[0].NumAwakeBodies, Samples[0].NumContacts);
+		}
+		for (const FPhysicsBenchmarkSample& Sample : Samples)
+		{
+			AddLog("- %2d threads | Step avg %8.3f ms, max %8.3f ms | Solve %8.3f ms (x%.2f) | match: %s",
+				Sample.NumThreads, Sample.AvgStepMS, Sample.MaxStepMS, Sample.AvgSolveMS,
+				Sample.AvgStepMS > 0.0 ? Samples[0].AvgStepMS / Sample.AvgStepMS : 0.0, Sample.bResultsMatch ? "true" : "false");
+		}
+	}
+	else if (Strnicmp(command_line, "BENCH LUASPAWN", 14) == 0)
+	{
+		// 같은 스크립트를 쓰는 인스턴스 N개(기본 1000개)의 BeginPlay 로드: 인스턴스마다 load_file / 바이트코드 캐시 비교
+		FLuaManager* LuaManager = GWorld ? GWorld->GetLuaManager() : nullptr;
+		if (!LuaManager)
+		{
+			AddLog("BENCH LUASPAWN: no Lua manager in current world");
+		}
+		else
+		{
+			const int32 RequestedInstances = atoi(command_line + 14);
+			const FLuaSpawnBenchmarkResult Result = LuaManager->RunSpawnBenchmark(RequestedInstances > 0 ? RequestedInstances : 1000);
+			AddLog("Lua Spawn Benchmark (%d instances, %.1f KB script, %.1f KB bytecode)",
+				Result.NumInstances, Result.ScriptBytes / 1024.0, Result.BytecodeBytes / 1024.0);
+			AddLog("- Legacy (load_file each)     : %.3f ms", Result.LegacyMS);
+			AddLog("- Compile + DDC write (once)  : %.3f ms", Result.CompileMS);
+			AddLog("- DDC bytecode load (once)    : %.3f ms", Result.DiskCacheMS);
+			AddLog("- Cached bytecode each        : %.3f ms (x%.2f, match: %s)", Result.CachedMS,
+				Result.CachedMS > 0.0 ? Result.LegacyMS / Result.CachedMS : 0.0, Result.bResultsMatch ? "true" : "false");
+		}
+	}
+	else if (Strnicmp(command_line, "BENCH LUAPROPS", 14) == 0)
+	{
+		// Lua에서 컴포넌트 프로퍼티 N번(기본 1000만 번) 읽기: 접근마다 조회 / (클래스, 키) 접근자 캐시 비교
+		FLuaManager* LuaManager = GWorld ? GWorld->GetLuaManager() : nullptr;
+		if (!LuaManager)
+		{
+			AddLog("BENCH LUAPROPS: no Lua manager in current world");
+		}
+		else
+		{
+			const int32 RequestedReads = atoi(command_line + 14);
+			const FLuaPropertyBenchmarkResult Result = LuaManager->RunPropertyBenchmark(RequestedReads > 0 ? RequestedReads : 10000000);
+			AddLog("Lua Property Benchmark (%d reads)", Result.NumReads);
+			AddLog("- Legacy lookup   : %.3f ms", Result.LegacyMS);
+			AddLog("- Accessor cache  : %.3f ms (x%.2f, match: %s)", Result.CachedMS,
+				Result.CachedMS > 0.0 ? Result.LegacyMS / Result.CachedMS : 0.0, Result.bResultsMatch ? "true" : "false");
+		}
+	}
+	else if (Strnicmp(command_line, "BENCH DELEGATE", 14) == 0)
+	{
+		// 가상 멤버 함수 바인딩 8개에 N번(기본 100만 번) Broadcast + 추가/제거 N번: 이전 std::function 델리게이트 / 인라인 바인딩 비교
+		const int32 RequestedBroadcasts = atoi(command_line + 14);
+		const FDelegateBenchmarkResult Result = FDelegateBenchmark::Run(RequestedBroadcasts > 0 ? RequestedBroadcasts : 1000000);
+		AddLog("Delegate Benchmark (%d broadcasts, %d bindings)", Result.NumBroadcasts, Result.NumBindings);
+		AddLog("- Legacy Broadcast (std::function) : %.3f ms", Result.LegacyBroadcastMS);
+		AddLog("- Inline Broadcast                 : %.3f ms (x%.2f, match: %s)", Result.BroadcastMS,
+			Result.BroadcastMS > 0.0 ? Result.LegacyBroadcastMS / Result.BroadcastMS : 0.0, Result.bResultsMatch ? "true" : "false");
+		AddLog("- Legacy Add/Remove (remove_if)    : %.3f ms", Result.LegacyAddRemoveMS);
+		AddLog("- Add/Remove (handle slot)         : %.3f ms", Result.AddRemoveMS);
+	}
 	else
 	{
 		AddLog("Unknown command: '%s'", command_line);
@@ -2,6 +2,7 @@
 #include "MainToolbarWidget.h"
 #include "ImGui/imgui.h"
 #include "Level.h"
+#include "CookedLevel.h"
 #include "JsonSerializer.h"
 #include "SelectionManager.h"
 #include "CameraActor.h"
@@ -702,10 +703,10 @@ void UMainToolbarWidget::OnLoadScene()
         GWorld->GetSelectionManager()->ClearSelection();
 
         std::unique_ptr<ULevel> NewLevel = ULevelService::CreateDefaultLevel();
-        JSON LevelJsonData;
-        if (FJsonSerializer::LoadJsonFromFile(LevelJsonData, SelectedPath))
+        FLevelDocument LevelDocument;
+        if (FCookedLevelSerializer::LoadOrCook(SelectedPath.wstring(), LevelDocument))
         {
-            NewLevel->Serialize(true, LevelJsonData);
+            NewLevel->LoadFromDocument(LevelDocument);
             EditorINI["LastUsedLevel"] = WideToUTF8(fs::relative(SelectedPath));
 #ifdef _EDITOR
             {
@@ -288,6 +288,12 @@ bool UPropertyRenderer::RenderProperty(const FProperty& Property, void* ObjectIn
 		ImGui::SetTooltip("%s", Property.Tooltip);
 	}
 
+	// 디테일 패널 편집은 PIE 스냅샷을 무효화 (PIE 월드에서는 무시됨)
+	if (bChanged && GWorld)
+	{
+		GWorld->MarkLevelModified();
+	}
+
 	// SceneComponent/LightComponent는 특정 프로퍼티가 변경되면 Setter를 통해 동기화
 	// OwnerKind가 Class인 경우에만 UObject로 캐스팅 가능 (Struct인 경우 크래시 발생)
 	if (bChanged && ObjectInstance && Property.OwnerKind == EOwnerKind::Class)
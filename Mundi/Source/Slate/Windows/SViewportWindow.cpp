@@ -1432,6 +1432,7 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 				UStatsOverlayD2D::Get().SetShowShadow(false);
 				UStatsOverlayD2D::Get().SetShowSkinning(false);
 				UStatsOverlayD2D::Get().SetShowParticles(false);
+				UStatsOverlayD2D::Get().SetShowRender(false);
 			}
 
 			if (ImGui::IsItemHovered())
@@ -1541,6 +1542,26 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 				ImGui::SetTooltip("파티클 시스템 통계를 표시합니다. (시스템 수, 이미터 수, 파티클 수, 메모리 사용량)");
 			}
 
+			bool bRenderStats = UStatsOverlayD2D::Get().IsRenderVisible();
+			if (ImGui::Checkbox(" RENDER", &bRenderStats))
+			{
+				UStatsOverlayD2D::Get().ToggleRender();
+			}
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("렌더 통계를 표시합니다. (메시 배치 수, 드로우 콜 수, 인스턴싱 병합 수)");
+			}
+
+			bool bTickStats = UStatsOverlayD2D::Get().IsTickVisible();
+			if (ImGui::Checkbox(" TICK", &bTickStats))
+			{
+				UStatsOverlayD2D::Get().ToggleTick();
+			}
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("틱 그룹별 시간과 병렬로 틱한 컴포넌트 수를 표시합니다.");
+			}
+
 			ImGui::EndMenu();
 		}
 
@@ -2055,6 +2076,32 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 			ImGui::SetTooltip("GPU 스키닝을 사용합니다. (비활성화 시 CPU 스키닝)");
 		}
 
+		// 자동 인스턴싱
+		bool bAutoInstancing = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_AutoInstancing);
+		if (ImGui::Checkbox("##AutoInstancing", &bAutoInstancing))
+		{
+			RenderSettings.ToggleShowFlag(EEngineShowFlags::SF_AutoInstancing);
+		}
+		ImGui::SameLine();
+		ImGui::Text(" 자동 인스턴싱");
+		if (ImGui::IsItemHovered())
+		{
+			ImGui::SetTooltip("같은 메시/머티리얼의 스태틱 메시 드로우를 인스턴싱 드로우 하나로 병합합니다.");
+		}
+
+		// 병렬 커맨드 녹화
+		bool bParallelRecording = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_ParallelCommandRecording);
+		if (ImGui::Checkbox("##ParallelCommandRecording", &bParallelRecording))
+		{
+			RenderSettings.ToggleShowFlag(EEngineShowFlags::SF_ParallelCommandRecording);
+		}
+		ImGui::SameLine();
+		ImGui::Text(" 병렬 커맨드 녹화");
+		if (ImGui::IsItemHovered())
+		{
+			ImGui::SetTooltip("그림자 뎁스 패스를 워커 스레드의 Deferred Context에서 녹화한 뒤 순서대로 제출합니다.");
+		}
+
 		ImGui::PopStyleColor(3);
 		ImGui::PopStyleVar(2);
 		ImGui::EndPopup();
@@ -2,6 +2,7 @@
 #include "EditorEngine.h"
 #include "PlatformCrashHandler.h"
 #include "DebugUtils.h"
+#include "RenderBenchmark.h"
 #include <exception>
 
 #if defined(_MSC_VER) && defined(_DEBUG)
@@ -29,6 +30,13 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 
     try
     {
+        // -renderbench: 창 없이 씬을 렌더링해 단계별 CPU 시간을 출력하고 종료
+        FRenderBenchmarkOptions BenchmarkOptions;
+        if (FRenderBenchmark::ParseCommandLine(lpCmdLine, BenchmarkOptions))
+        {
+            return FRenderBenchmark::RunHeadless(BenchmarkOptions);
+        }
+
         if (!GEngine.Startup(hInstance))
             return -1;
 